@@ -39,6 +39,9 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                FluSgTime    : Physical time of FluSg
 //                MagSgTime    : Physical time of MagSg
 //                PotSgTime    : Physical time of PotSg
+//                PotRefineTime: Physical time when the patches were last constructed by Refine()
+//                               --> The potential stored in 1-PotSg is not associated with the current patches
+//                                   if PotSgTime[1-PotSg] < PotRefineTime (see Poi_WarmStart())
 //                NPatchComma  : (1) SERIAL: [1] = [2] = ... = [27] = num[lv] = total number of patches
 //                               (2) Parallel, but no LOAD_BALANCE:
 //                                   [ 0, start of buffer patches [s=0], start of buffer patches [s=1]
@@ -100,6 +103,7 @@ struct AMR_t
 #  ifdef GRAVITY
    int    PotSg       [NLEVEL];
    double PotSgTime   [NLEVEL][2];
+   double PotRefineTime[NLEVEL];
 #  endif
    int    NPatchComma [NLEVEL][28];
    double dh          [NLEVEL];
@@ -151,6 +155,7 @@ struct AMR_t
 #        ifdef GRAVITY
          PotSgTime[lv][   PotSg[lv] ] = -__FLT_MAX__;
          PotSgTime[lv][ 1-PotSg[lv] ] = -__FLT_MAX__;
+         PotRefineTime[lv]            = -__FLT_MAX__;
 #        endif
       }
 
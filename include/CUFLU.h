@@ -260,6 +260,43 @@
 #endif
 
 
+// solve the Riemann problems of an entire row of cell faces at once in the CPU fluid solvers
+// --> vectorized along x by the compiler (see CPU_RiemannSolver_Pencil.cpp)
+//     --> requires "-fno-math-errno -fno-trapping-math", which configure.py adds to CPU_RiemannSolver_Pencil.cpp
+//         only (CXXFLAG_PENCIL in the Makefile); neither flag changes the results
+// --> only for the HLLE/HLLC solvers in pure hydro and the HLLD solver in MHD, all with the constant-gamma
+//     EoS and the HLL_WAVESPEED_DAVIS wave speeds
+// --> the results are bitwise identical to those of the per-face solvers as long as the compiler does not
+//     contract floating-point operations differently (e.g., by FMA)
+// --> to disable it, comment out the line "#  define RSOLVER_PENCIL" below
+#if (  !defined __CUDACC__  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  \
+       !defined SRHD  &&  EOS == EOS_GAMMA  &&                                                         \
+       (  ( !defined MHD && RSOLVER == HLLE && HLLE_WAVESPEED == HLL_WAVESPEED_DAVIS ) ||               \
+          ( !defined MHD && RSOLVER == HLLC && HLLC_WAVESPEED == HLL_WAVESPEED_DAVIS ) ||               \
+          (  defined MHD && RSOLVER == HLLD && HLLD_WAVESPEED == HLL_WAVESPEED_DAVIS )  )  )
+#  define RSOLVER_PENCIL
+
+// compare the results with the per-face solvers in the debug mode and abort on any bitwise difference
+#  ifdef GAMER_DEBUG
+#     define RSOLVER_PENCIL_CHECK
+#  endif
+#endif
+
+
+// sweep each patch group slab by slab along z in the CPU MHM solver
+// --> data reconstruction, Riemann solver, and full-step update are interleaved slab by slab so that
+//     the working arrays of each slab are still in cache when consumed by the next step
+// --> FLU_BLOCK_NZ: number of output cells along z in each slab
+//     --> a smaller value reduces the working set at the cost of more function calls
+// --> only for pure hydro without cosmic rays
+// --> the results are bitwise identical to those of the unblocked sweep
+// --> to disable it, comment out the line "#  define FLU_CACHE_BLOCK" below
+#if (  !defined __CUDACC__  &&  FLU_SCHEME == MHM  &&  !defined MHD  &&  !defined SRHD  &&  !defined COSMIC_RAY  )
+#  define FLU_CACHE_BLOCK
+#  define FLU_BLOCK_NZ     2
+#endif
+
+
 
 // 2. ELBDM macro
 //=========================================================================================
@@ -525,6 +562,10 @@
 # define CGPU_LOOP( var, niter )    for (int (var)=0;           (var)<(niter); (var)++          )
 #endif
 
+// compile-time specialization of the EoS conversion functions
+// --> must be included after GPU_DEVICE is defined
+#include "EoS_Inline.h"
+
 
 
 #endif // #ifndef __CUFLU_H__
@@ -0,0 +1,229 @@
+#ifndef __EOS_INLINE_H__
+#define __EOS_INLINE_H__
+
+
+
+// *********************************************************************
+// ** Compile-time specialization of the EoS conversion functions    **
+// ** --> Included by "CUFLU.h" and thus shared by both CPU and GPU   **
+// *********************************************************************
+
+
+// The fluid solvers invoke the EoS routines through function pointers since the EoS is selected at
+// run time for EOS_USER and the tabular EoS. For EOS_GAMMA and EOS_ISOTHERMAL, however, the conversions
+// are closed-form expressions of a few auxiliary constants, and the indirect calls prevent the compiler
+// from inlining them and vectorizing the enclosing loops.
+// --> The wrappers below replace the function-pointer calls by the closed-form expressions when
+//     EOS == EOS_GAMMA/EOS_ISOTHERMAL and fall back to the function pointers otherwise
+// --> The expressions must be kept consistent with src/EoS/Gamma/CPU_EoS_Gamma.cpp and
+//     src/EoS/Isothermal/CPU_EoS_Isothermal.cpp (including the order of floating-point operations
+//     so that the results are bitwise identical)
+// --> The GAMER_DEBUG checks in the EoS routines are skipped in the specialized versions
+#if ( MODEL == HYDRO )
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Pres_Inline
+// Description :  Convert gas mass density and internal energy density to gas pressure
+//
+// Note        :  1. Closed-form expression for EOS_GAMMA/EOS_ISOTHERMAL
+//                   --> Invoke the function pointer "EoS_DensEint2Pres" for all other EoS
+//                2. See EoS_DensEint2Pres_*() in src/EoS/ for the definitions of the other parameters
+//
+// Parameter   :  EoS_DensEint2Pres : EoS routine to be used when there is no specialization
+//                Dens              : Gas mass density
+//                Eint              : Gas internal energy density
+//                Passive           : Passive scalars
+//                AuxArray_*        : Auxiliary arrays
+//                Table             : EoS tables
+//
+// Return      :  Gas pressure
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static inline
+real EoS_DensEint2Pres_Inline( const EoS_DE2P_t EoS_DensEint2Pres, const real Dens, const real Eint,
+                               const real Passive[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const real *const Table[EOS_NTABLE_MAX] )
+{
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma_m1 = (real)AuxArray_Flt[1];
+
+   return Eint * Gamma_m1;
+
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Cs2 = AuxArray_Flt[0];
+
+   return Cs2*Dens;
+
+#  else
+   return EoS_DensEint2Pres( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table );
+#  endif
+
+} // FUNCTION : EoS_DensEint2Pres_Inline
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2Eint_Inline
+// Description :  Convert gas mass density and pressure to gas internal energy density
+//
+// Note        :  1. See EoS_DensEint2Pres_Inline()
+//
+// Parameter   :  EoS_DensPres2Eint : EoS routine to be used when there is no specialization
+//                Dens              : Gas mass density
+//                Pres              : Gas pressure
+//                Passive           : Passive scalars
+//                AuxArray_*        : Auxiliary arrays
+//                Table             : EoS tables
+//
+// Return      :  Gas internal energy density
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static inline
+real EoS_DensPres2Eint_Inline( const EoS_DP2E_t EoS_DensPres2Eint, const real Dens, const real Pres,
+                               const real Passive[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const real *const Table[EOS_NTABLE_MAX] )
+{
+
+#  if   ( EOS == EOS_GAMMA )
+   const real _Gamma_m1 = (real)AuxArray_Flt[2];
+
+   return Pres * _Gamma_m1;
+
+#  elif ( EOS == EOS_ISOTHERMAL )
+   return (real)1.0e4*Pres;
+
+#  else
+   return EoS_DensPres2Eint( Dens, Pres, Passive, AuxArray_Flt, AuxArray_Int, Table );
+#  endif
+
+} // FUNCTION : EoS_DensPres2Eint_Inline
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2CSqr_Inline
+// Description :  Convert gas mass density and pressure to sound speed squared
+//
+// Note        :  1. See EoS_DensEint2Pres_Inline()
+//
+// Parameter   :  EoS_DensPres2CSqr : EoS routine to be used when there is no specialization
+//                Dens              : Gas mass density
+//                Pres              : Gas pressure
+//                Passive           : Passive scalars
+//                AuxArray_*        : Auxiliary arrays
+//                Table             : EoS tables
+//
+// Return      :  Sound speed squared
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static inline
+real EoS_DensPres2CSqr_Inline( const EoS_DP2C_t EoS_DensPres2CSqr, const real Dens, const real Pres,
+                               const real Passive[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const real *const Table[EOS_NTABLE_MAX] )
+{
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma = (real)AuxArray_Flt[0];
+
+   return Gamma * Pres / Dens;
+
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Cs2 = AuxArray_Flt[0];
+
+   return Cs2;
+
+#  else
+   return EoS_DensPres2CSqr( Dens, Pres, Passive, AuxArray_Flt, AuxArray_Int, Table );
+#  endif
+
+} // FUNCTION : EoS_DensPres2CSqr_Inline
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Temp_Inline
+// Description :  Convert gas mass density and internal energy density to gas temperature
+//
+// Note        :  1. See EoS_DensEint2Pres_Inline()
+//                2. Temperature is in kelvin
+//
+// Parameter   :  EoS_DensEint2Temp : EoS routine to be used when there is no specialization
+//                Dens              : Gas mass density
+//                Eint              : Gas internal energy density
+//                Passive           : Passive scalars
+//                AuxArray_*        : Auxiliary arrays
+//                Table             : EoS tables
+//
+// Return      :  Gas temperature in kelvin
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static inline
+real EoS_DensEint2Temp_Inline( const EoS_DE2T_t EoS_DensEint2Temp, const real Dens, const real Eint,
+                               const real Passive[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const real *const Table[EOS_NTABLE_MAX] )
+{
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma_m1 = (real)AuxArray_Flt[1];
+   const real m_kB     = (real)AuxArray_Flt[4];
+   const real Pres     = Eint * Gamma_m1;
+
+   return m_kB * Pres / Dens;
+
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Temp = AuxArray_Flt[1];
+
+   return Temp;
+
+#  else
+   return EoS_DensEint2Temp( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table );
+#  endif
+
+} // FUNCTION : EoS_DensEint2Temp_Inline
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Entr_Inline
+// Description :  Convert gas mass density and internal energy density to gas entropy
+//
+// Note        :  1. See EoS_DensEint2Pres_Inline()
+//                2. Entropy is not defined for EOS_ISOTHERMAL, for which NULL_REAL is returned
+//                   as in EoS_DensEint2Entr_Isothermal()
+//
+// Parameter   :  EoS_DensEint2Entr : EoS routine to be used when there is no specialization
+//                Dens              : Gas mass density
+//                Eint              : Gas internal energy density
+//                Passive           : Passive scalars
+//                AuxArray_*        : Auxiliary arrays
+//                Table             : EoS tables
+//
+// Return      :  Gas entropy
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static inline
+real EoS_DensEint2Entr_Inline( const EoS_DE2S_t EoS_DensEint2Entr, const real Dens, const real Eint,
+                               const real Passive[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const real *const Table[EOS_NTABLE_MAX] )
+{
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma_m1 = (real)AuxArray_Flt[1];
+   const real Pres     = Eint * Gamma_m1;
+
+   return Pres * POW( Dens, -Gamma_m1 );
+
+#  elif ( EOS == EOS_ISOTHERMAL )
+   return NULL_REAL;
+
+#  else
+   return EoS_DensEint2Entr( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table );
+#  endif
+
+} // FUNCTION : EoS_DensEint2Entr_Inline
+
+
+
+#endif // #if ( MODEL == HYDRO )
+
+
+
+#endif // #ifndef __EOS_INLINE_H__
@@ -44,7 +44,14 @@ const auto plan_dft_c2c_3d              = fftwf_plan_dft_3d;
 const auto plan_dft_c2c_1d              = fftwf_plan_dft_1d;
 const auto plan_dft_c2r_1d              = fftwf_plan_dft_c2r_1d;
 const auto plan_dft_r2c_1d              = fftwf_plan_dft_r2c_1d;
+const auto plan_many_dft_r2c            = fftwf_plan_many_dft_r2c;
+const auto plan_many_dft_c2r            = fftwf_plan_many_dft_c2r;
+const auto plan_many_dft_c2c            = fftwf_plan_many_dft;
 const auto cleanup                      = fftwf_cleanup;
+const auto import_wisdom_from_filename  = fftwf_import_wisdom_from_filename;
+const auto export_wisdom_to_filename    = fftwf_export_wisdom_to_filename;
+const auto forget_wisdom                = fftwf_forget_wisdom;
+const auto alignment_of                 = fftwf_alignment_of;
 #ifndef SERIAL
 using      real_mpi_plan_nd             = fftwf_plan;
 using      complex_mpi_plan_nd          = fftwf_plan;
@@ -57,6 +64,8 @@ const auto mpi_plan_dft_r2c_3d          = fftwf_mpi_plan_dft_r2c_3d;
 const auto mpi_plan_dft_c2r_3d          = fftwf_mpi_plan_dft_c2r_3d;
 const auto mpi_plan_dft_c2c_3d          = fftwf_mpi_plan_dft_3d;
 const auto mpi_cleanup                  = fftwf_mpi_cleanup;
+const auto mpi_broadcast_wisdom         = fftwf_mpi_broadcast_wisdom;
+const auto mpi_gather_wisdom            = fftwf_mpi_gather_wisdom;
 #endif // #ifndef SERIAL
 };
 
@@ -87,7 +96,14 @@ const auto plan_dft_c2c_3d              = fftw_plan_dft_3d;
 const auto plan_dft_c2c_1d              = fftw_plan_dft_1d;
 const auto plan_dft_c2r_1d              = fftw_plan_dft_c2r_1d;
 const auto plan_dft_r2c_1d              = fftw_plan_dft_r2c_1d;
+const auto plan_many_dft_r2c            = fftw_plan_many_dft_r2c;
+const auto plan_many_dft_c2r            = fftw_plan_many_dft_c2r;
+const auto plan_many_dft_c2c            = fftw_plan_many_dft;
 const auto cleanup                      = fftw_cleanup;
+const auto import_wisdom_from_filename  = fftw_import_wisdom_from_filename;
+const auto export_wisdom_to_filename    = fftw_export_wisdom_to_filename;
+const auto forget_wisdom                = fftw_forget_wisdom;
+const auto alignment_of                 = fftw_alignment_of;
 #ifndef SERIAL
 using      real_mpi_plan_nd             = fftw_plan;
 using      complex_mpi_plan_nd          = fftw_plan;
@@ -100,6 +116,8 @@ const auto mpi_plan_dft_r2c_3d          = fftw_mpi_plan_dft_r2c_3d;
 const auto mpi_plan_dft_c2r_3d          = fftw_mpi_plan_dft_c2r_3d;
 const auto mpi_plan_dft_c2c_3d          = fftw_mpi_plan_dft_3d;
 const auto mpi_cleanup                  = fftw_mpi_cleanup;
+const auto mpi_broadcast_wisdom         = fftw_mpi_broadcast_wisdom;
+const auto mpi_gather_wisdom            = fftw_mpi_gather_wisdom;
 #endif // #ifndef SERIAL
 };
 
@@ -187,6 +205,68 @@ const auto destroy_complex_plan_nd = gamer_fftw::destroy_complex_mpi_plan_nd;
 #endif // #endif
 };
 
+
+#ifdef SUPPORT_FFTW_PENCIL
+// 2D pencil decomposition of the root-level FFT (OPT__FFTW_PENCIL)
+// --> MPI ranks are arranged into a NP[0] x NP[1] grid with MPI_Rank = Coord[1]*NP[0] + Coord[0]
+// --> layouts of the local data (x: fastest index; all 1D FFTs are performed along the fastest index)
+//     x-pencil : real space   [z][y][2*(N[0]/2+1)] : full x, y in List_y_start [Coord[0]], z in List_z_start [Coord[1]]
+//     y-pencil : intermediate [z][kx][y]           : full y, kx in List_kx_start[Coord[0]], z in List_z_start [Coord[1]]
+//     z-pencil : k space      [kx][ky][z]          : full z, kx in List_kx_start[Coord[0]], ky in List_ky_start[Coord[1]]
+// --> the x-pencil <-> y-pencil (y-pencil <-> z-pencil) transposition only involves ranks with the same Coord[1] (Coord[0])
+// --> the root-level patch data are exchanged with the pencil ranks by point-to-point communication between
+//     the partner ranks recorded in PatchSide and PencilSide, which are only updated after the patches are
+//     redistributed (i.e., when amr->LB->NInit changes)
+// a block of a root-level patch exchanged between the patch owner and a pencil rank (see Patch2Pencil())
+// --> it always covers the entire patch along x
+struct PencilBlock_t
+{
+   int  Rank;      // target MPI rank (i.e., pencil rank on the patch side and patch owner on the pencil side)
+   int  PID;       // patch ID on the patch side (useless on the pencil side)
+   int  Cr[3];     // patch corner normalized to the root-level cell size
+   int  y[2];      // [start, end) y coordinates of the overlapping region
+   int  z[2];      // [start, end) z coordinates of the overlapping region
+   long LBIdx;     // patch LB_Idx (only used on the pencil side)
+   long Offset;    // offset of the block data in the MPI buffer
+};
+
+// blocks and partner ranks of one side of the patch <-> pencil exchange
+struct PencilSide_t
+{
+   int            NBlock;     // number of blocks
+   PencilBlock_t *Block;      // blocks sorted by LB_Idx
+   int            NPartner;   // number of partner ranks (including this rank if it exchanges data with itself)
+   int           *Partner;    // partner ranks sorted in ascending order
+   long          *NCount;     // number of elements exchanged with each partner
+   long          *Disp;       // offset of the data of each partner in the MPI buffer
+   long           NElem;      // total number of elements exchanged
+   real          *Buf;        // MPI buffer
+};
+
+struct FFTW_Pencil_t
+{
+   int      N[3];                               // FFT size
+   int      NP[2];                              // number of ranks along the two decomposed directions
+   int      Coord[2];                           // coordinates of this rank in the 2D rank grid
+   int     *List_y_start, *List_z_start;        // starting y/z  coordinates of each rank in the x-pencil layout
+   int     *List_kx_start, *List_ky_start;      // starting kx/ky coordinates of each rank in the z-pencil layout
+   int      local_ny, local_nz;                 // local size in the x-pencil layout
+   int      local_nkx, local_nky;               // local size in the z-pencil layout
+   long     total_local_size;                   // number of real elements required to store any of the three layouts
+   int      Alignment;                          // fftw_alignment_of() of the array used to create the 1D plans
+   MPI_Comm Comm_Row;                           // ranks with the same Coord[1] (for the x-pencil <-> y-pencil transposition)
+   MPI_Comm Comm_Col;                           // ranks with the same Coord[0] (for the y-pencil <-> z-pencil transposition)
+   gamer_fftw::real_plan_1d    Plan_R2C, Plan_C2R;
+   gamer_fftw::complex_plan_1d Plan_Y_Forward, Plan_Y_Backward, Plan_Z_Forward, Plan_Z_Backward;
+   gamer_fftw::fft_complex    *SendBuf, *RecvBuf;   // MPI buffers for the transposition
+   MPI_Comm     Comm_Patch;                     // duplicated communicator for the patch <-> pencil exchange
+   PencilSide_t PatchSide;                      // blocks of the local root-level patches
+   PencilSide_t PencilSide;                     // blocks of all root-level patches overlapping with the local x-pencil
+   MPI_Request *PatchReq;                       // MPI requests for the patch <-> pencil exchange
+   long         LB_NInit;                       // amr->LB->NInit when PatchSide and PencilSide were last updated
+};
+#endif // #ifdef SUPPORT_FFTW_PENCIL
+
 #if ( SUPPORT_FFTW == FFTW3 )
 #ifdef SERIAL
 #define root_fftw_create_3d_r2c_plan(size, arr, startup)            gamer_fftw::plan_dft_r2c_3d        ( size[2], size[1], size[0], (gamer_fftw::fft_real*)    arr, (gamer_fftw::fft_complex*) arr,                startup )
@@ -51,6 +51,11 @@
 #  endif
 #endif // #if ( SUPPORT_FFTW == FFTW3 ) ... #elif ( SUPPORT_FFTW == FFTW2 )
 
+// the pencil decomposition of the root-level FFT (OPT__FFTW_PENCIL) relies on FFTW3, MPI, and LOAD_BALANCE
+#if (  SUPPORT_FFTW == FFTW3  &&  !defined SERIAL  &&  defined LOAD_BALANCE  )
+#  define SUPPORT_FFTW_PENCIL
+#endif
+
 #ifdef SUPPORT_GRACKLE
 #ifdef FLOAT8
 #  define CONFIG_BFLOAT_8
@@ -74,6 +79,8 @@ extern "C" {
 #include "RandomNumber.h"
 #include "Profile.h"
 #include "Extrema.h"
+#include "PrepCache.h"
+#include "ScratchArena.h"
 #include "SrcTerms.h"
 #include "EoS.h"
 #include "Microphysics.h"
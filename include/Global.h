@@ -62,22 +62,26 @@ extern int        GPU_NSTREAM, FLAG_BUFFER_SIZE, FLAG_BUFFER_SIZE_MAXM1_LV, FLAG
 extern int        OPT__UM_IC_LEVEL, OPT__UM_IC_NLEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
 extern int        INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
 extern double     OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT_FACTOR, AUTO_REDUCE_DT_FACTOR_MIN;
-extern double     AUTO_REDUCE_INT_MONO_FACTOR, AUTO_REDUCE_INT_MONO_MIN;
+extern double     AUTO_REDUCE_INT_MONO_FACTOR, AUTO_REDUCE_INT_MONO_MIN, PREP_CACHE_MAX_MB;
 extern double     OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 extern bool       OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
 extern int        OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
-extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET, OPT__RESTART_PARALLEL,
+                  OPT__PATCH_SLAB;
 extern bool       OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
-extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
+extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__CPU_PIPELINE,
+                  OPT__TIMING_BALANCE, OPT__PREP_CACHE, OPT__AUTO_NPGROUP;
 extern bool       OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 extern bool       OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
 extern bool       OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
 extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID, OPT__RECORD_CENTER, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
 extern bool       OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
-extern bool       OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX;
+extern bool       OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX, OPT__OUTPUT_HDF5_MPIIO,
+                  OPT__OUTPUT_HDF5_ASYNC;
 extern char       OPT__OUTPUT_TEXT_FORMAT_FLT[MAX_STRING];
-extern int        OPT__UM_IC_FLOAT8;
+extern int        OPT__UM_IC_FLOAT8, OUTPUT_HDF5_DEFLATE_LEVEL, OUTPUT_HDF5_LOSSY_DIGITS;
+extern double     OUTPUT_HDF5_ASYNC_MAX_MEM;
 extern double     COM_CEN_X, COM_CEN_Y, COM_CEN_Z, COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R;
 extern int        COM_MAX_ITER;
 extern double     ANGMOM_ORIGIN_X, ANGMOM_ORIGIN_Y, ANGMOM_ORIGIN_Z;
@@ -87,6 +91,7 @@ extern TestProbID_t       TESTPROB_ID;
 extern OptInit_t          OPT__INIT;
 extern IntScheme_t        OPT__FLU_INT_SCHEME, OPT__REF_FLU_INT_SCHEME;
 extern OptOutputFormat_t  OPT__OUTPUT_TOTAL;
+extern OptHDF5Compress_t  OPT__OUTPUT_HDF5_COMPRESS;
 extern OptOutputPart_t    OPT__OUTPUT_PART;
 extern OptOutputMode_t    OPT__OUTPUT_MODE;
 extern OptFluBC_t         OPT__BC_FLU[6];          // boundary conditions of fluid at (-x,+x,-y,+y,-z,+z) faces
@@ -164,8 +169,13 @@ extern int           POT_GPU_NPGROUP;
 extern bool          OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, OPT__GRAVITY_EXTRA_MASS;
 extern double        SOR_OMEGA;
 extern int           SOR_MAX_ITER, SOR_MIN_ITER;
+extern double        SOR_TOLERATED_ERROR;
 extern double        MG_TOLERATED_ERROR;
 extern int           MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
+extern bool          OPT__POT_LEVEL_MG;
+extern double        POT_LEVEL_MG_TOLERATED_ERROR;
+extern int           POT_LEVEL_MG_MAX_ITER;
+extern bool          OPT__POT_WARM_START;
 extern char          EXT_POT_TABLE_NAME[MAX_STRING];
 extern double        EXT_POT_TABLE_DH[3], EXT_POT_TABLE_EDGEL[3];
 extern int           EXT_POT_TABLE_NPOINT[3], EXT_POT_TABLE_FLOAT8;
@@ -200,11 +210,14 @@ extern double     LB_INPUT__WLI_MAX;                  // LB->WLI_Max loaded from
 #ifdef PARTICLE
 extern double     LB_INPUT__PAR_WEIGHT;               // LB->Par_Weight loaded from "Input__Parameter"
 #endif
-extern bool       OPT__RECORD_LOAD_BALANCE;
+extern bool       OPT__RECORD_LOAD_BALANCE, OPT__MPI_SPARSE, OPT__MPI_PERSISTENT, OPT__LB_MEASURED_COST,
+                  OPT__LB_INCREMENTAL, OPT__LB_MULTI_CONSTRAINT;
+extern double     LB_MEASURED_COST_SMOOTH, LB_MC_TOL_CELL, LB_MC_TOL_PAR, LB_MC_TOL_TIME, LB_MC_TOL_MEM;
 #endif
 extern bool       OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
 extern int        OPT__FFTW_STARTUP;
+extern bool       OPT__FFTW_PENCIL, OPT__FFTW_WISDOM;
 #if ( SUPPORT_FFTW == FFTW3 )
 extern bool       FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #endif // # if ( SUPPORT_FFTW == FFTW3 )
@@ -20,6 +20,12 @@ datatypes in the HDF5 format
 #  define H5T_GAMER_REAL H5T_NATIVE_FLOAT
 #endif
 
+#ifdef FLOAT8_STORE
+#  define H5T_GAMER_REAL_STORE H5T_NATIVE_DOUBLE
+#else
+#  define H5T_GAMER_REAL_STORE H5T_NATIVE_FLOAT
+#endif
+
 #ifdef GAMER_DEBUG
 #  define DEBUG_HDF5
 #endif
@@ -121,6 +127,7 @@ struct Makefile_t
    int Timing;
    int TimingSolver;
    int Float8;
+   int Float8_Store;
    int Serial;
    int LoadBalance;
    int OverlapMPI;
@@ -507,6 +514,7 @@ struct InputPara_t
 #  endif
    int    Opt__ReuseMemory;
    int    Opt__MemoryPool;
+   int    Opt__PatchSlab;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -515,6 +523,16 @@ struct InputPara_t
    double LB_Par_Weight;
 #  endif
    int    Opt__RecordLoadBalance;
+   int    Opt__MPI_Sparse;
+   int    Opt__MPI_Persistent;
+   int    Opt__LB_MeasuredCost;
+   double LB_MeasuredCost_Smooth;
+   int    Opt__LB_Incremental;
+   int    Opt__LB_MultiConstraint;
+   double LB_MC_Tol_Cell;
+   double LB_MC_Tol_Par;
+   double LB_MC_Tol_Time;
+   double LB_MC_Tol_Mem;
 #  endif
    int    Opt__MinimizeMPIBarrier;
 
@@ -551,6 +569,7 @@ struct InputPara_t
 // fluid solvers in different models
    int    Flu_GPU_NPGroup;
    int    GPU_NStream;
+   int    Opt__AutoNPGroup;
    int    Opt__FixUp_Flux;
    long   FixUpFlux_Var;
 #  ifdef MHD
@@ -570,6 +589,9 @@ struct InputPara_t
    char  *MagLabel[NCOMP_MAG];
 #  endif
    int    Opt__OverlapMPI;
+   int    Opt__CPU_Pipeline;
+   int    Opt__PrepCache;
+   double PrepCache_MaxMB;
    int    Opt__ResetFluid;
    int    Opt__ResetFluidInit;
    int    Opt__FreezeFluid;
@@ -595,12 +617,17 @@ struct InputPara_t
    double SOR_Omega;
    int    SOR_MaxIter;
    int    SOR_MinIter;
+   double SOR_ToleratedError;
 #  elif ( POT_SCHEME == MG )
    int    MG_MaxIter;
    int    MG_NPreSmooth;
    int    MG_NPostSmooth;
    double MG_ToleratedError;
 #  endif
+   int    Opt__Pot_Level_MG;
+   int    Pot_Level_MG_MaxIter;
+   double Pot_Level_MG_ToleratedError;
+   int    Opt__Pot_WarmStart;
    int    Pot_GPU_NPGroup;
    int    Opt__GraP5Gradient;
    int    Opt__SelfGravity;
@@ -673,6 +700,7 @@ struct InputPara_t
    int    Opt__Init;
    int    RestartLoadNRank;
    int    Opt__RestartReset;
+   int    Opt__RestartParallel;
    int    Opt__UM_IC_Level;
    int    Opt__UM_IC_NLevel;
    int    Opt__UM_IC_NVar;
@@ -691,6 +719,8 @@ struct InputPara_t
 #  endif
 #  ifdef SUPPORT_FFTW
    int    Opt__FFTW_Startup;
+   int    Opt__FFTW_Pencil;
+   int    Opt__FFTW_Wisdom;
 #  endif
 
 // interpolation schemes
@@ -757,6 +787,12 @@ struct InputPara_t
    int    Opt__Output_UserField;
    int    Opt__Output_Mode;
    int    Opt__Output_Restart;
+   int    Opt__Output_HDF5_MPIIO;
+   int    Opt__Output_HDF5_Compress;
+   int    Output_HDF5_Deflate_Level;
+   int    Output_HDF5_Lossy_Digits;
+   int    Opt__Output_HDF5_Async;
+   double Output_HDF5_Async_Max_Mem;
    int    Opt__Output_Step;
    double Opt__Output_Dt;
    char  *Opt__Output_Text_Format_Flt;
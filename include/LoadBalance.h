@@ -34,6 +34,14 @@
 //                Par_Weight              : Load-balance weighting of one particle over one cell
 //                                          --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*Par_Weight"
 //                CutPoint                : Cut points in the space filling curve
+//                Neighbor                : Whether or not each rank exchanges data with this rank
+//                                          --> Used by the sparse MPI exchange (OPT__MPI_SPARSE)
+//                NNeighbor               : Number of neighbor ranks (-1 if the neighbor list is not available)
+//                NeighborList            : List of neighbor ranks
+//                NeighborReq             : MPI requests reused by the sparse MPI exchange (2*NNeighbor)
+//                Comm_Sparse             : Duplicated MPI communicator dedicated to the sparse MPI exchange
+//                NInit                   : Number of times LB_Init_LoadBalance() has been invoked
+//                                          --> Used to detect changes in the patch distribution (e.g., see Patch2Pencil())
 //                IdxList_Real            : Sorted LB_Idx list of all real patches
 //                IdxList_Real_IdxTable   : Index table for LB_IdxList_Real
 //                PaddedCr1DList          : Sorted PaddedCr1D list of all patches (real + buffer)
@@ -133,6 +141,12 @@ struct LB_t
    double Par_Weight;
 #  endif
    long  *CutPoint               [NLEVEL];
+   bool  *Neighbor;
+   int    NNeighbor;
+   int   *NeighborList;
+   MPI_Request *NeighborReq;
+   MPI_Comm     Comm_Sparse;
+   long         NInit;
    long  *IdxList_Real           [NLEVEL];
    int   *IdxList_Real_IdxTable  [NLEVEL];
    ulong *PaddedCr1DList         [NLEVEL];
@@ -236,6 +250,14 @@ struct LB_t
       Par_Weight = Input__Par_Weight;
 #     endif
 
+      Neighbor     = new bool [MPI_NRank];
+      for (int r=0; r<MPI_NRank; r++)  Neighbor[r] = false;
+      NNeighbor    = -1;
+      NeighborList = NULL;
+      NeighborReq  = NULL;
+      Comm_Sparse  = MPI_COMM_NULL;
+      NInit        = 0L;
+
       for (int lv=0; lv<NLEVEL; lv++)
       {
          OverlapMPI_FluSyncN    [lv] = 0;
@@ -579,6 +601,17 @@ struct LB_t
 #        endif
       } // for (int lv=0; lv<NLEVEL; lv++)
 
+      if ( Neighbor != NULL )  delete [] Neighbor;
+      Neighbor = NULL;
+
+      if ( NeighborList != NULL )   delete [] NeighborList;
+      if ( NeighborReq  != NULL )   delete [] NeighborReq;
+      NeighborList = NULL;
+      NeighborReq  = NULL;
+      NNeighbor    = -1;
+
+      if ( Comm_Sparse != MPI_COMM_NULL )    MPI_Comm_free( &Comm_Sparse );
+
    } // METHOD : ~LB_t
 
 
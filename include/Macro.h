@@ -850,6 +850,17 @@
 #endif
 
 
+// number and indices of the load-balance constraints (for OPT__LB_MULTI_CONSTRAINT)
+#ifdef LOAD_BALANCE
+#  define LB_NCON                4
+
+#  define LB_CON_CELL            0
+#  define LB_CON_PAR             1
+#  define LB_CON_TIME            2
+#  define LB_CON_MEM             3
+#endif
+
+
 // flag used in "Buf_RecordBoundaryFlag" and "Flag_Buffer" (must be negative)
 #ifndef SERIAL
 #  define BUFFER_IS_FLAGGED      ( -999 )
@@ -923,6 +934,18 @@
 #define MAX_STRING         512
 
 
+// precision of the patch data stored in memory
+// --> follow FLOAT8 by default; single-precision storage with FLOAT8 must be requested explicitly by FLOAT4_STORE
+#if ( defined FLOAT8  &&  !defined FLOAT4_STORE )
+#  ifndef FLOAT8_STORE
+#  define FLOAT8_STORE
+#  endif
+#endif
+
+#if ( defined FLOAT4_STORE  &&  defined FLOAT8_STORE )
+#  error : ERROR : FLOAT4_STORE and FLOAT8_STORE cannot be enabled at the same time !!
+#endif
+
 // MPI floating-point data type
 #ifdef FLOAT8
 #  define MPI_GAMER_REAL MPI_DOUBLE
@@ -936,6 +959,12 @@
 #  define MPI_GAMER_REAL_PAR MPI_FLOAT
 #endif
 
+#ifdef FLOAT8_STORE
+#  define MPI_GAMER_REAL_STORE MPI_DOUBLE
+#else
+#  define MPI_GAMER_REAL_STORE MPI_FLOAT
+#endif
+
 
 
 // ############
@@ -16,6 +16,8 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 void Aux_Message( FILE *Type, const char *Format, ... );
 ulong Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
+void *Aux_PatchSlab_Allocate( const int lv, const PatchSlab_t Type );
+void  Aux_PatchSlab_Free( const PatchSlab_t Type, void *Ptr );
 
 
 
@@ -26,6 +28,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //
 // Data Member :  fluid           : Fluid variables (mass density, momentum density x, y ,z, energy density)
 //                                  --> Including passively advected variables (e.g., metal density)
+//                                  --> Stored in the precision of real_store (i.e., FLOAT8_STORE) together with
+//                                      pot[] and flux[]
 //                magnetic        : Magnetic field (Bx, By, Bz)
 //                pot             : Potential
 //                pot_ext         : Potential with GRA_GHOST_SIZE ghost cells on each side
@@ -107,6 +111,9 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                      --> For both active and inactive patches, field arrays may be allocated or == NULL
 //                                  --> However, currently the flux arrays (i.e., flux, flux_tmp, and flux_bitrep) are guaranteed
 //                                      to be NULL for inactive patches
+//                level           : Refinement level of this patch
+//                                  --> Used by Aux_PatchSlab_Allocate() to allocate the field arrays from the blocks
+//                                      of the same level
 //                EdgeL/R         : Left and right edge of the patch
 //                                  --> Note that we always apply periodicity to EdgeL/R. So for an external patch its
 //                                      recorded "EdgeL/R" will still lie inside the simulation domain and will be
@@ -122,6 +129,10 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                      3D corner coordinates
 //                                  --> This number is independent of periodicity (because of the padded patches)
 //                LB_Idx          : Space-filling-curve index for load balance
+//                LB_Cost         : Exponentially smoothed wall time of updating this patch measured by the solvers
+//                                  --> Used as the load-balance weighting when enabling OPT__LB_MEASURED_COST
+//                                  --> < 0.0 : not measured yet
+//                LB_CostNow      : Wall time accumulated during the current update of this patch
 //                NPar            : Number of particles belonging to this leaf patch
 //                NPar_Type       : Number of different types of particles belonging to this leaf patch
 //                ParListSize     : Size of the array ParList (ParListSize can be >= NPar)
@@ -184,14 +195,14 @@ struct patch_t
 
 // data members
 // ===================================================================================
-   real (*fluid)[PS1][PS1][PS1];
+   real_store (*fluid)[PS1][PS1][PS1];
 
 #  ifdef MHD
    real (*magnetic)[ PS1P1*SQR(PS1) ];
 #  endif
 
 #  ifdef GRAVITY
-   real (*pot)[PS1][PS1];
+   real_store (*pot)[PS1][PS1];
 #  ifdef STORE_POT_GHOST
    real (*pot_ext)[GRA_NXT][GRA_NXT];
 #  endif
@@ -205,10 +216,10 @@ struct patch_t
    real (*rho_ext)[RHOEXT_NXT][RHOEXT_NXT];
 #  endif
 
-   real (*flux       [6])[PS1][PS1];
-   real (*flux_tmp   [6])[PS1][PS1];
+   real_store (*flux       [6])[PS1][PS1];
+   real_store (*flux_tmp   [6])[PS1][PS1];
 #  ifdef BIT_REP_FLUX
-   real (*flux_bitrep[6])[PS1][PS1];
+   real_store (*flux_bitrep[6])[PS1][PS1];
 #  endif
 
 #  ifdef MHD
@@ -226,11 +237,16 @@ struct patch_t
    int    son;
    bool   flag;
    bool   Active;
+   int    level;
    double EdgeL[3];
    double EdgeR[3];
 
    ulong  PaddedCr1D;
    long   LB_Idx;
+#  ifdef LOAD_BALANCE
+   double LB_Cost;
+   double LB_CostNow;
+#  endif
 
 #  ifdef PARTICLE
    int    NPar;
@@ -331,6 +347,7 @@ struct patch_t
       son       = -1;
       flag      = false;
       Active    = true;
+      level     = lv;
 
       for (int s=0; s<26; s++ )  sibling[s] = -1;     // -1 <--> NO sibling
 
@@ -352,6 +369,10 @@ struct patch_t
 
       PaddedCr1D = Mis_Idx3D2Idx1D( BoxNScale_Padded, Cr_Padded );   // independent of periodicity
       LB_Idx     = LB_Corner2Index( lv, corner, CHECK_OFF );         // always assumes periodicity
+#     ifdef LOAD_BALANCE
+      LB_Cost    = -1.0;                                             // -1.0 : not measured yet
+      LB_CostNow = 0.0;
+#     endif
 
 //    set the patch edge
       const int PScale = PS1*( 1<<(TOP_LEVEL-lv) );
@@ -535,11 +556,11 @@ struct patch_t
 #     endif
 #     endif
 
-      flux      [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
+      flux      [SibID]  = (real_store (*)[PS1][PS1])Aux_PatchSlab_Allocate( level, SLAB_FLUX );
       if ( AllocTmp )
-      flux_tmp  [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
+      flux_tmp  [SibID]  = (real_store (*)[PS1][PS1])Aux_PatchSlab_Allocate( level, SLAB_FLUX );
 #     ifdef BIT_REP_FLUX
-      flux_bitrep[SibID] = new real [NFLUX_TOTAL][PS1][PS1];
+      flux_bitrep[SibID] = (real_store (*)[PS1][PS1])Aux_PatchSlab_Allocate( level, SLAB_FLUX );
 #     endif
 
       for(int v=0; v<NFLUX_TOTAL; v++)
@@ -570,14 +591,14 @@ struct patch_t
 
       for (int s=0; s<6; s++)
       {
-         delete [] flux[s];
+         Aux_PatchSlab_Free( SLAB_FLUX, flux[s] );
          flux[s] = NULL;
 
-         delete [] flux_tmp[s];
+         Aux_PatchSlab_Free( SLAB_FLUX, flux_tmp[s] );
          flux_tmp[s] = NULL;
 
 #        ifdef BIT_REP_FLUX
-         delete [] flux_bitrep[s];
+         Aux_PatchSlab_Free( SLAB_FLUX, flux_bitrep[s] );
          flux_bitrep[s] = NULL;
 #        endif
       }
@@ -678,8 +699,8 @@ struct patch_t
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
-         fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
+         fluid = (real_store (*)[PS1][PS1][PS1])Aux_PatchSlab_Allocate( level, SLAB_FLUID );
+         fluid[0][0][0][0] = (real_store)-1.0;  // arbitrarily initialized
       }
 
    } // METHOD : hnew
@@ -693,7 +714,7 @@ struct patch_t
    void hdelete()
    {
 
-      delete [] fluid;
+      Aux_PatchSlab_Free( SLAB_FLUID, fluid );
       fluid = NULL;
 
 #     ifdef MASSIVE_PARTICLES
@@ -717,7 +738,7 @@ struct patch_t
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         magnetic = (real (*)[ PS1P1*SQR(PS1) ])Aux_PatchSlab_Allocate( level, SLAB_MAGNETIC );
          magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -732,7 +753,7 @@ struct patch_t
    void mdelete()
    {
 
-      delete [] magnetic;
+      Aux_PatchSlab_Free( SLAB_MAGNETIC, magnetic );
       magnetic = NULL;
 
    } // METHOD : mdelete
@@ -750,10 +771,10 @@ struct patch_t
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )      pot     = (real_store (*)[PS1][PS1])Aux_PatchSlab_Allocate( level, SLAB_POT );
 
 #     ifdef STORE_POT_GHOST
-      if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      if ( pot_ext == NULL )  pot_ext = (real (*)[GRA_NXT][GRA_NXT])Aux_PatchSlab_Allocate( level, SLAB_POT_EXT );
 
 //    always initialize pot_ext[] (even if pot_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Poi_StorePotWithGhostZone()
@@ -771,11 +792,11 @@ struct patch_t
    void gdelete()
    {
 
-      delete [] pot;
+      Aux_PatchSlab_Free( SLAB_POT, pot );
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
-      delete [] pot_ext;
+      Aux_PatchSlab_Free( SLAB_POT_EXT, pot_ext );
       pot_ext = NULL;
 #     endif
 
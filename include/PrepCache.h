@@ -0,0 +1,79 @@
+#ifndef __PREPCACHE_H__
+#define __PREPCACHE_H__
+
+
+
+#include "Macro.h"
+#include "Typedef.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PrepCacheKey_t
+// Description :  Key identifying the patch-group data prepared by Prepare_PatchData()
+//
+// Note        :  1. Set by Prepare_PatchData_Cache_SetKey() and used by the patch-data cache
+//                   (Main/Prepare_PatchData_Cache.cpp)
+//                2. Two keys are compared with memcmp()
+//                   --> Prepare_PatchData_Cache_SetKey() must zero the whole structure (including the padding
+//                       bytes) before setting the data members
+//                   --> Do NOT add any pointer or data member with a nontrivial constructor
+//                3. The key records all the input parameters of Prepare_PatchData() that affect the prepared
+//                   patch-group data except PrepUnit, which only controls how the data are copied to the output
+//                   arrays, and GhostSize, which is stored along with the cached data, and all the global states
+//                   that may change between two invocations (e.g., the sandglasses and INT_MONO_COEFF)
+//
+// Data Member :  lv             : Target refinement level
+//                TVarCC/FC      : Target cell-/face-centered variables
+//                IntScheme_CC/FC: Interpolation schemes of the cell-/face-centered variables
+//                NSide          : Number of sibling directions
+//                IntPhase       : Interpolation on phase in ELBDM
+//                FluBC/PotBC    : Fluid/gravity boundary conditions
+//                DE_Consistency : Dual-energy consistency check
+//                IntTime        : OPT__INT_TIME
+//                Min*           : Minimum density/pressure/temperature/entropy
+//                IntMonoCoeff*  : INT_MONO_COEFF and INT_MONO_COEFF_B
+//                PrepTime       : Target physical time
+//                Sg/SgTime      : Current sandglasses of the fluid, magnetic field, and potential and the physical time
+//                                 of both sandglasses at levels lv-1 and lv
+//                                 --> [0/1][0/1/2] = [lv-1/lv][fluid/magnetic field/potential]
+//                Depend         : Bitwise flags of the fields the prepared data depend on
+//                                 --> PREP_CACHE_DEP_FLU/MAG/POT
+//                SubRegion      : Whether the cached data can be served to requests with fewer ghost zones
+//                Hash           : Hash value of all the data members above
+//-------------------------------------------------------------------------------------------------------
+struct PrepCacheKey_t
+{
+
+   int    lv;
+   long   TVarCC;
+   long   TVarFC;
+   int    IntScheme_CC;
+   int    IntScheme_FC;
+   int    NSide;
+   int    IntPhase;
+   int    FluBC[6];
+   int    PotBC;
+   int    DE_Consistency;
+   int    IntTime;
+   real   MinDens;
+   real   MinPres;
+   real   MinTemp;
+   real   MinEntr;
+   double IntMonoCoeff;
+   double IntMonoCoeff_B;
+   double PrepTime;
+   int    Sg[2][3];
+   double SgTime[2][3][2];
+   int    Depend;
+   int    SubRegion;
+
+// Hash must be the last data member
+   unsigned long Hash;
+
+}; // struct PrepCacheKey_t
+
+
+
+#endif // #ifndef __PREPCACHE_H__
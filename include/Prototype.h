@@ -56,6 +56,13 @@ template <typename T> int  Aux_LoadTable( T *&Data, const char *FileName, const
 int Aux_IsFinite( const float x );
 int Aux_IsFinite( const double x );
 void Aux_PauseManually();
+ScratchArena_t *Aux_ScratchArena_Get();
+void Aux_ScratchArena_Free();
+int Aux_ScratchArena_Count();
+void Aux_PatchSlab_Init();
+void *Aux_PatchSlab_Allocate( const int lv, const PatchSlab_t Type );
+void Aux_PatchSlab_Free( const PatchSlab_t Type, void *Ptr );
+void Aux_PatchSlab_FreeAll();
 
 
 // Buffer
@@ -93,7 +100,8 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
                       const bool FracPassive, const int NFrac, const int FracIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff );
+                      const bool JeansMinPres, const real JeansMinPres_Coeff,
+                      double h_PG_Time[] );
 void Hydro_NormalizePassive( const real GasDens, real Passive[], const int NNorm, const int NormIdx[] );
 #if ( MODEL == HYDRO )
 real Hydro_Con2Pres( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
@@ -199,6 +207,17 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
                         const NSide_t NSide, const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                         const real MinDens, const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency );
+bool Prepare_PatchData_Cache_SetKey( PrepCacheKey_t &Key, const int lv, const double PrepTime, const int GhostSize,
+                                     const long TVarCC, const long TVarFC, const IntScheme_t IntScheme_CC,
+                                     const IntScheme_t IntScheme_FC, const NSide_t NSide, const bool IntPhase,
+                                     const OptFluBC_t FluBC[], const OptPotBC_t PotBC, const real MinDens,
+                                     const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency );
+bool Prepare_PatchData_Cache_Load( const PrepCacheKey_t &Key, const int PID0, const int GhostSize,
+                                   const int NVarCC, const int NVarFC, real *DataCC, real *DataFC );
+void Prepare_PatchData_Cache_Store( const PrepCacheKey_t &Key, const int PID0, const int GhostSize,
+                                    const int NVarCC, const int NVarFC, const real *DataCC, const real *DataFC );
+void Prepare_PatchData_Cache_Invalidate( const int lv, const long TVarCC, const long TVarFC );
+void Prepare_PatchData_Cache_Reset();
 
 
 // Init
@@ -246,6 +265,16 @@ void Slab2Patch( const real *VarS, real *SendBuf, real *RecvBuf, const int SaveS
                  int **List_PID, int **List_k, long *List_NSend, long *List_NRecv, const int local_nz, const int FFT_Size[],
                  const int NSendSlice, const long TVar, const bool InPlacePad );
 #endif // #ifdef SUPPORT_FFTW
+#ifdef SUPPORT_FFTW_PENCIL
+struct FFTW_Pencil_t;
+void Init_FFTW_Pencil( FFTW_Pencil_t &Pencil, const int FFT_Size[], const int StartupFlag );
+void End_FFTW_Pencil( FFTW_Pencil_t &Pencil );
+void FFTW_Pencil_R2C( FFTW_Pencil_t &Pencil, real *Var );
+void FFTW_Pencil_C2R( FFTW_Pencil_t &Pencil, real *Var );
+void Patch2Pencil( real *VarP, FFTW_Pencil_t &Pencil, const double PrepTime, const long TVar,
+                   const bool ForPoisson, const bool AddExtraMass );
+void Pencil2Patch( const real *VarP, FFTW_Pencil_t &Pencil, const int SaveSg, const long TVar );
+#endif // #ifdef SUPPORT_FFTW_PENCIL
 void Microphysics_Init();
 void Microphysics_End();
 
@@ -313,6 +342,10 @@ void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, cons
 void Output_DumpData_Total( const char *FileName );
 #ifdef SUPPORT_HDF5
 void Output_DumpData_Total_HDF5( const char *FileName );
+void Output_AsyncIO_Begin( const char *FileName );
+void Output_AsyncIO_Stage( const void *Data, const long Size, const long FileOffset );
+void Output_AsyncIO_Launch();
+void Output_AsyncIO_Wait();
 #endif
 void Output_DumpManually( int &Dump_global );
 void Output_FlagMap( const int lv, const int xyz, const char *comment );
@@ -344,7 +377,7 @@ void Output_BoundaryFlagList( const int option, const int lv, const char *commen
 void FindFather( const int lv, const int Mode );
 void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc );
 bool Flag_Check( const int lv, const int PID, const int i, const int j, const int k, const real dv,
-                 const real Fluid[][PS1][PS1][PS1], const real Pot[][PS1][PS1], const real MagCC[][PS1][PS1][PS1],
+                 const real_store Fluid[][PS1][PS1][PS1], const real_store Pot[][PS1][PS1], const real MagCC[][PS1][PS1][PS1],
                  const real Vel[][PS1][PS1][PS1], const real Pres[][PS1][PS1],  const real Lrtz[][PS1][PS1],
                  const real *Lohner_Var, const real *Lohner_Ave, const real *Lohner_Slope, const int Lohner_NVar,
                  const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff );
@@ -371,8 +404,9 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
                                      char h_DE_Array     [][PS1][PS1][PS1],
                                const real h_Emag_Array   [][PS1][PS1][PS1],
                                const int NPatchGroup, const real dt, const real dh, const int SOR_Min_Iter,
-                               const int SOR_Max_Iter, const real SOR_Omega, const int MG_Max_Iter,
-                               const int MG_NPre_Smooth, const int MG_NPost_Smooth, const real MG_Tolerated_Error,
+                               const int SOR_Max_Iter, const real SOR_Omega, const real SOR_Tolerated_Error,
+                               const int MG_Max_Iter, const int MG_NPre_Smooth, const int MG_NPost_Smooth,
+                               const real MG_Tolerated_Error, const bool WarmStart,
                                const real Poi_Coeff, const IntScheme_t IntScheme, const bool P5_Gradient,
                                const real ELBDM_Eta, const real ELBDM_Lambda, const bool Poisson, const bool GraAcc,
                                const bool SelfGravity, const OptExtPot_t ExtPot, const OptExtAcc_t ExtAcc,
@@ -384,6 +418,9 @@ void CPU_ExtPotSolver_BaseLevel( const ExtPot_t Func, const double AuxArray_Flt[
 void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double PrepTime );
 void Init_GreenFuncK();
 #endif
+#ifdef LOAD_BALANCE
+void CPU_PoissonSolver_LevelMG( const int lv, const real Poi_Coeff, const int SaveSg, const double PrepTime );
+#endif
 void End_MemFree_PoissonGravity();
 void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
                     const int SaveSg_Flu, const int SaveSg_Pot, const bool Poisson, const bool Gravity,
@@ -418,7 +455,9 @@ void Poi_BoundaryCondition_Extrapolation( real *Array, const int BC_Face, const
                                           const int Idx_Start[], const int Idx_End[] );
 void Poi_GetAverageDensity();
 void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In[][POT_NXT][POT_NXT][POT_NXT],
-                      const int NPG, const int *PID0_List );
+                      real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT], const int NPG, const int *PID0_List,
+                      const bool WarmStart );
+bool Poi_WarmStart( const int lv, const double PrepTime );
 void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][RHO_NXT][RHO_NXT][RHO_NXT],
                       const int NPG, const int *PID0_List );
 #ifdef STORE_POT_GHOST
@@ -470,15 +509,21 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                        const long TVarCC, const long TVarFC, const int ParaBuf );
 void*LB_GetBufferData_MemAllocate_Send( const long SendSize );
 void*LB_GetBufferData_MemAllocate_Recv( const long RecvSize );
+void LB_GetBufferData_FreePersistent( const int lv );
 void LB_GrandsonCheck( const int lv );
 void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, const double ParWeight, const bool Reset,
-                          const bool SortRealPatch, const int TLv );
+                          const bool SortRealPatch, const bool KeepCutPoint, const int TLv );
 void LB_Init_ByFunction();
 void LB_Init_Refine( const int FaLv, const bool AllocData );
 void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bool InputLBIdx0AndLoad,
                      long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const double ParWeight );
-void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG );
-double LB_EstimateLoadImbalance();
+int  LB_SetCutPoint_Incremental( const int lv, long *CutPoint, const double ParWeight );
+void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG, double *NPar_PG );
+void LB_EstimateConstraint_AllPatchGroup( const int lv, const double *NPar_PG, double (*Con_PG)[LB_NCON] );
+void LB_GetConstraintTolerance( double Tol[] );
+void LB_AddMeasuredCost( const int lv, const int NPG, const int *PID0_List, const double *PG_Time, const double BatchTime );
+void LB_UpdateMeasuredCost( const int lv );
+double LB_EstimateLoadImbalance( const bool Redistribute );
 void LB_SetCutPoint( const int lv, long *CutPoint, const bool InputLBIdx0AndLoad, long *LBIdx0_AllRank_Input,
                      double *Load_AllRank_Input, const double ParWeight );
 void LB_Output_LBIdx( const int lv );
@@ -486,6 +531,11 @@ void LB_RecordExchangeDataPatchID( const int Lv, const bool AfterRefine );
 void LB_RecordExchangeFixUpDataPatchID( const int Lv );
 void LB_RecordExchangeRestrictDataPatchID( const int FaLv );
 void LB_RecordOverlapMPIPatchID( const int Lv );
+void LB_RecordNeighborRank();
+void LB_SparseAlltoall( int *Send_NCount, int *Recv_NCount );
+template <typename T, typename U>
+void LB_SparseAlltoallv( T *SendBuf, U *Send_NCount, U *Send_NDisp, MPI_Datatype Send_Datatype,
+                         T *RecvBuf, U *Recv_NCount, U *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
 void LB_Refine( const int FaLv );
 void LB_SiblingSearch( const int lv, const bool SearchAllPID, const int NInput, int *TargetPID0 );
 void LB_Index2Corner( const int lv, const long Index, int Corner[], const Check_t Check );
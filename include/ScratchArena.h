@@ -0,0 +1,300 @@
+#ifndef __SCRATCHARENA_H__
+#define __SCRATCHARENA_H__
+
+
+
+#include <cstdlib>
+
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+struct ScratchArena_t;
+ScratchArena_t *Aux_ScratchArena_Get();
+
+
+// alignment of all scratch arrays in bytes (must be a power of two and a multiple of sizeof(void*))
+#define SCRATCH_ALIGN         64L
+
+// size of the enlarged main block relative to the high-water mark
+#define SCRATCH_GROW_FACTOR   1.2
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  ScratchChunk_t
+// Description :  Header of the overflow chunks of ScratchArena_t
+//
+// Note        :  1. The header is stored at the beginning of each overflow chunk and is followed by the data
+//                2. Its size is padded to SCRATCH_ALIGN so that the data remain aligned
+//
+// Data Member :  Next  : Previously allocated overflow chunk
+//                NByte : Size of the data in bytes
+//                Pad   : Padding
+//-------------------------------------------------------------------------------------------------------
+struct ScratchChunk_t
+{
+
+   ScratchChunk_t *Next;
+   long            NByte;
+   char            Pad[ SCRATCH_ALIGN - sizeof(ScratchChunk_t*) - sizeof(long) ];
+
+}; // struct ScratchChunk_t
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  ScratchArena_t
+// Description :  Per-thread bump allocator for the temporary arrays of the hot paths
+//
+// Note        :  1. Each OpenMP thread slot owns one arena returned by Aux_ScratchArena_Get()
+//                   --> Do NOT share the returned memory with other threads after the allocating scope ends
+//                2. Memory is released in the last-in-first-out order by Release()
+//                   --> Always use it through ScratchScope_t
+//                3. Requests not fitting in the main block are served by overflow chunks. The main block is
+//                   enlarged to the high-water mark once all the memory is released, after which the arena
+//                   no longer allocates any memory
+//                4. The main block is first touched by the owner thread, which places its memory pages on the
+//                   NUMA node of that thread
+//
+// Data Member :  Block      : Main block
+//                BlockSize  : Size of the main block in bytes
+//                Used       : Number of bytes currently allocated in the main block
+//                Overflow   : Linked list of the overflow chunks (the most recent one first)
+//                NOverflow  : Number of overflow chunks
+//                NByte_Ovf  : Number of bytes currently allocated in the overflow chunks
+//                HighWater  : Maximum number of bytes allocated at the same time
+//
+// Method      :  ScratchArena_t : Constructor
+//               ~ScratchArena_t : Destructor
+//                Allocate       : Allocate an aligned array
+//                Release        : Release all the memory allocated after the given mark
+//-------------------------------------------------------------------------------------------------------
+struct ScratchArena_t
+{
+
+// data members
+// ===================================================================================
+   char           *Block;
+   long            BlockSize;
+   long            Used;
+   ScratchChunk_t *Overflow;
+   long            NOverflow;
+   long            NByte_Ovf;
+   long            HighWater;
+
+
+
+   //===================================================================================
+   // Constructor :  ScratchArena_t
+   // Description :  Constructor of the structure "ScratchArena_t"
+   //
+   // Note        :  Initialize all data members
+   //===================================================================================
+   ScratchArena_t()
+   {
+      Block     = NULL;
+      BlockSize = 0L;
+      Used      = 0L;
+      Overflow  = NULL;
+      NOverflow = 0L;
+      NByte_Ovf = 0L;
+      HighWater = 0L;
+   }
+
+
+
+   //===================================================================================
+   // Destructor  :  ~ScratchArena_t
+   // Description :  Destructor of the structure "ScratchArena_t"
+   //
+   // Note        :  Release memory
+   //===================================================================================
+   ~ScratchArena_t()
+   {
+      while ( Overflow != NULL )
+      {
+         ScratchChunk_t *Next = Overflow->Next;
+
+         free( Overflow );
+         Overflow = Next;
+      }
+
+      free( Block );
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Allocate
+   // Description :  Allocate an array aligned to SCRATCH_ALIGN bytes
+   //
+   // Note        :  1. The returned memory is uninitialized
+   //                2. Never return NULL, even when NByte == 0
+   //
+   // Parameter   :  NByte : Number of bytes to be allocated
+   //
+   // Return      :  Pointer to the allocated array
+   //===================================================================================
+   void *Allocate( const long NByte )
+   {
+#     ifdef GAMER_DEBUG
+      if ( NByte < 0L )    Aux_Error( ERROR_INFO, "NByte (%ld) < 0 !!\n", NByte );
+#     endif
+
+      const long Size = ( NByte <= 0L ) ? SCRATCH_ALIGN : ( (NByte+SCRATCH_ALIGN-1L)/SCRATCH_ALIGN )*SCRATCH_ALIGN;
+      void      *Ptr  = NULL;
+
+//    main block
+      if ( NOverflow == 0L  &&  Used+Size <= BlockSize )
+      {
+         Ptr   = Block + Used;
+         Used += Size;
+      }
+
+//    overflow chunk
+      else
+      {
+         void *Chunk = NULL;
+
+         if ( posix_memalign( &Chunk, SCRATCH_ALIGN, sizeof(ScratchChunk_t)+Size ) != 0 )
+            Aux_Error( ERROR_INFO, "failed to allocate %ld bytes of scratch memory !!\n",
+                       (long)sizeof(ScratchChunk_t)+Size );
+
+         ( (ScratchChunk_t*)Chunk )->Next  = Overflow;
+         ( (ScratchChunk_t*)Chunk )->NByte = Size;
+         Overflow   = (ScratchChunk_t*)Chunk;
+         NOverflow ++;
+         NByte_Ovf += Size;
+
+         Ptr = (char*)Chunk + sizeof(ScratchChunk_t);
+      }
+
+      if ( Used+NByte_Ovf > HighWater )   HighWater = Used + NByte_Ovf;
+
+      return Ptr;
+
+   } // METHOD : Allocate
+
+
+
+   //===================================================================================
+   // Method      :  Release
+   // Description :  Release all the memory allocated after the given mark
+   //
+   // Note        :  1. The mark is the values of Used and NOverflow recorded before the allocation
+   //                2. Enlarge the main block to the high-water mark once all the memory is released
+   //                   if any overflow chunk has been allocated
+   //
+   // Parameter   :  Mark_Used      : Recorded Used
+   //                Mark_NOverflow : Recorded NOverflow
+   //===================================================================================
+   void Release( const long Mark_Used, const long Mark_NOverflow )
+   {
+      while ( NOverflow > Mark_NOverflow )
+      {
+         ScratchChunk_t *Next = Overflow->Next;
+
+         NByte_Ovf -= Overflow->NByte;
+         free( Overflow );
+         Overflow = Next;
+         NOverflow --;
+      }
+
+      Used = Mark_Used;
+
+      if ( Used == 0L  &&  NOverflow == 0L  &&  HighWater > BlockSize )
+      {
+         free( Block );
+
+         BlockSize = ( (long)(HighWater*SCRATCH_GROW_FACTOR)/SCRATCH_ALIGN + 1L )*SCRATCH_ALIGN;
+
+         void *NewBlock = NULL;
+         if ( posix_memalign( &NewBlock, SCRATCH_ALIGN, BlockSize ) != 0 )
+            Aux_Error( ERROR_INFO, "failed to allocate %ld bytes of scratch memory !!\n", BlockSize );
+
+         Block = (char*)NewBlock;
+      }
+   } // METHOD : Release
+
+
+}; // struct ScratchArena_t
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  ScratchScope_t
+// Description :  Scope of the scratch arrays allocated from the arena of the calling thread
+//
+// Note        :  1. All the arrays allocated through a scope are released when the scope is destroyed
+//                2. Scopes of the same thread must be destroyed in the reverse order of their construction,
+//                   which is guaranteed when they are declared as local variables
+//
+// Data Member :  Arena          : Arena of the calling thread
+//                Mark_Used      : Arena->Used      when the scope is constructed
+//                Mark_NOverflow : Arena->NOverflow when the scope is constructed
+//
+// Method      :  ScratchScope_t : Constructor
+//               ~ScratchScope_t : Destructor
+//                Allocate       : Allocate an array of N elements of type T
+//-------------------------------------------------------------------------------------------------------
+struct ScratchScope_t
+{
+
+// data members
+// ===================================================================================
+   ScratchArena_t *Arena;
+   long            Mark_Used;
+   long            Mark_NOverflow;
+
+
+
+   //===================================================================================
+   // Constructor :  ScratchScope_t
+   // Description :  Constructor of the structure "ScratchScope_t"
+   //
+   // Note        :  Record the current position of the arena of the calling thread
+   //===================================================================================
+   ScratchScope_t()
+   {
+      Arena          = Aux_ScratchArena_Get();
+      Mark_Used      = Arena->Used;
+      Mark_NOverflow = Arena->NOverflow;
+   }
+
+
+
+   //===================================================================================
+   // Destructor  :  ~ScratchScope_t
+   // Description :  Destructor of the structure "ScratchScope_t"
+   //
+   // Note        :  Release all the memory allocated through this scope
+   //===================================================================================
+   ~ScratchScope_t()
+   {
+      Arena->Release( Mark_Used, Mark_NOverflow );
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Allocate
+   // Description :  Allocate an array of N elements of type T
+   //
+   // Note        :  1. The returned memory is uninitialized
+   //                2. Use it only for the plain data types
+   //
+   // Parameter   :  N : Number of elements
+   //
+   // Return      :  Pointer to the allocated array
+   //===================================================================================
+   template <typename T>
+   T *Allocate( const long N )
+   {
+      return (T*)Arena->Allocate( N*(long)sizeof(T) );
+   } // METHOD : Allocate
+
+
+}; // struct ScratchScope_t
+
+
+
+#endif // #ifndef __SCRATCHARENA_H__
@@ -123,6 +123,23 @@ struct Timer_t
 
 
 
+   //===================================================================================
+   // Method      :  AddValue
+   // Description :  Add the elapsed time (in seconds) measured elsewhere to the timer
+   //
+   // Note        :  Timer must not be running
+   //===================================================================================
+   void AddValue( const double dt )
+   {
+#     ifdef GAMER_DEBUG
+      if ( Status )  Aux_Message( stderr, "WARNING : adding time to a ticking timer !!\n" );
+#     endif
+
+      Time += (ulong)( dt*1.0e6 );
+   }
+
+
+
    //===================================================================================
    // Method      :  Reset
    // Description :  Reset the timer
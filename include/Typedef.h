@@ -28,6 +28,14 @@ typedef double real_par;
 typedef float  real_par;
 #endif
 
+// precision of the patch data (fluid, pot, and flux) stored in memory
+// --> the solvers still compute in the precision of "real"
+#ifdef FLOAT8_STORE
+typedef double real_store;
+#else
+typedef float  real_store;
+#endif
+
 // short names for unsigned type
 typedef unsigned short     ushort;
 typedef unsigned int       uint;
@@ -152,6 +160,14 @@ const OptOutputFormat_t
    OUTPUT_FORMAT_CBINARY = 2;
 
 
+// compression filters of the HDF5 output
+typedef int OptHDF5Compress_t;
+const OptHDF5Compress_t
+   HDF5_COMPRESS_NONE            = 0,
+   HDF5_COMPRESS_DEFLATE         = 1,
+   HDF5_COMPRESS_SHUFFLE_DEFLATE = 2;
+
+
 // data output criteria
 typedef int OptOutputMode_t;
 const OptOutputMode_t
@@ -200,6 +216,14 @@ const UseLBFunc_t
    USELB_NO  = 0,
    USELB_YES = 1;
 
+typedef int PatchSlab_t;
+const PatchSlab_t
+   SLAB_FLUID    = 0,
+   SLAB_MAGNETIC = 1,
+   SLAB_POT      = 2,
+   SLAB_POT_EXT  = 3,
+   SLAB_FLUX     = 4;
+
 
 // enable check or not
 typedef int Check_t;
@@ -35,7 +35,7 @@ void Aux_Check_FluxAllocate( const int lv, const char *comment )
 
    int Pass = true;
    int SonPID, SibPID, SibSonPID;
-   real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
+   real_store (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
 
    for (int TargetRank=0; TargetRank<MPI_NRank; TargetRank++)
    {
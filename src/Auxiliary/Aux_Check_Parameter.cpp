@@ -47,6 +47,18 @@ void Aux_Check_Parameter()
 #     error : ERROR : incorrect number of NCOMP_PASSIVE !!
 #  endif
 
+#  if ( defined FLOAT8_STORE  &&  !defined FLOAT8 )
+#     error : ERROR : FLOAT8_STORE must work with FLOAT8 !!
+#  endif
+
+#  if ( defined FLOAT8  &&  !defined FLOAT8_STORE  &&  MODEL != HYDRO )
+#     error : ERROR : currently FLOAT8_STORE=off with FLOAT8=on is only supported in HYDRO !!
+#  endif
+
+#  if ( defined FLOAT8  &&  !defined FLOAT8_STORE  &&  defined SUPPORT_LIBYT )
+#     error : ERROR : SUPPORT_LIBYT does not support FLOAT8_STORE=off with FLOAT8=on !!
+#  endif
+
 #  ifdef SERIAL
    int NRank = 1;
 #  else
@@ -177,8 +189,9 @@ void Aux_Check_Parameter()
                  "OVERLAP_MPI", "OPT__OVERLAP_MPI" );
 #  endif
 
-   if ( OPT__OVERLAP_MPI )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported yet !!\n", "OPT__OVERLAP_MPI" );
+// MPI_Barrier() cannot be invoked by the communication and computation threads simultaneously
+   if ( OPT__OVERLAP_MPI  &&  OPT__TIMING_BARRIER )
+      Aux_Error( ERROR_INFO, "\"%s\" does NOT work with \"%s\" !!\n", "OPT__OVERLAP_MPI", "OPT__TIMING_BARRIER" );
 
    if ( AUTO_REDUCE_DT )
    {
@@ -287,6 +300,16 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "must enable either SERIAL or LOAD_BALANCE for OPT__INIT=3 !!\n" );
 #  endif
 
+#  if ( defined SUPPORT_FFTW  &&  !defined SUPPORT_FFTW_PENCIL )
+   if ( OPT__FFTW_PENCIL )
+      Aux_Error( ERROR_INFO, "OPT__FFTW_PENCIL only supports FFTW3 with LOAD_BALANCE (and SERIAL off) !!\n" );
+#  endif
+
+#  if ( SUPPORT_FFTW == FFTW2 )
+   if ( OPT__FFTW_WISDOM )
+      Aux_Error( ERROR_INFO, "OPT__FFTW_WISDOM only supports FFTW3 !!\n" );
+#  endif
+
    if ( OPT__OUTPUT_USER_FIELD )
    {
       int NDerField = UserDerField_Num;
@@ -354,6 +377,9 @@ void Aux_Check_Parameter()
       Aux_Message( stderr, "WARNING : OPT__OUTPUT_TOTAL = 2 (C-binary) is deprecated !!\n" );
 #     if ( ( defined PARTICLE ) && ( (defined FLOAT8 && !defined FLOAT8_PAR) || (!defined FLOAT8 && defined FLOAT8_PAR) ) )
       Aux_Error( ERROR_INFO, "Must adopt FLOAT8_PAR=FLOAT8 for OPT__OUTPUT_TOTAL=2 (C-binary) !!\n" );
+#     endif
+#     if ( defined FLOAT8  &&  !defined FLOAT8_STORE )
+      Aux_Error( ERROR_INFO, "Must adopt FLOAT8_STORE=FLOAT8 for OPT__OUTPUT_TOTAL=2 (C-binary) !!\n" );
 #     endif
    }
 
@@ -363,6 +389,19 @@ void Aux_Check_Parameter()
 #  endif
       Aux_Message( stderr, "WARNING : all output options are turned off --> no data will be output !!\n" );
 
+#  ifdef SUPPORT_FFTW
+   if ( OPT__FFTW_WISDOM  &&  OPT__FFTW_STARTUP == FFTW_STARTUP_ESTIMATE )
+      Aux_Message( stderr, "WARNING : OPT__FFTW_WISDOM is useless for OPT__FFTW_STARTUP=0 (FFTW_STARTUP_ESTIMATE) and will be ignored !!\n" );
+#  endif
+
+   if ( OPT__OUTPUT_TOTAL == OUTPUT_FORMAT_HDF5  &&  OUTPUT_HDF5_LOSSY_DIGITS > 0 )
+      Aux_Message( stderr, "WARNING : OUTPUT_HDF5_LOSSY_DIGITS (%d) > 0 --> restarting from the lossy snapshots is not exact !!\n",
+                   OUTPUT_HDF5_LOSSY_DIGITS );
+
+   if ( OPT__OUTPUT_HDF5_ASYNC  &&  OUTPUT_HDF5_ASYNC_MAX_MEM <= 0.0 )
+      Aux_Message( stderr, "WARNING : OUTPUT_HDF5_ASYNC_MAX_MEM (%13.7e) <= 0.0 --> no limit on the memory for staging snapshots !!\n",
+                   OUTPUT_HDF5_ASYNC_MAX_MEM );
+
    if ( StrLen_Flt <= 0 )
       Aux_Message( stderr, "WARNING : StrLen_Flt (%d) <= 0 (OPT__OUTPUT_TEXT_FORMAT_FLT=%s) --> text output might be misaligned !!\n",
                    StrLen_Flt, OPT__OUTPUT_TEXT_FORMAT_FLT );
@@ -437,6 +476,26 @@ void Aux_Check_Parameter()
 #     endif
    } // if ( OPT__OVERLAP_MPI )
 
+   if ( OPT__CPU_PIPELINE )
+   {
+#     if   ( defined GPU )
+      Aux_Message( stderr, "WARNING : \"%s\" only applies to the CPU fluid solvers and will be ignored !!\n",
+                   "OPT__CPU_PIPELINE" );
+#     elif ( defined OPENMP )
+      if ( OMP_NTHREAD < 2 )
+         Aux_Message( stderr, "WARNING : \"%s\" requires at least two OpenMP threads (OMP_NTHREAD = %d) !!\n",
+                      "OPT__CPU_PIPELINE", OMP_NTHREAD );
+#     else
+      Aux_Message( stderr, "WARNING : OpenMP is NOT turned on for \"%s\" !!\n", "OPT__CPU_PIPELINE" );
+#     endif
+   } // if ( OPT__CPU_PIPELINE )
+
+#  ifdef GPU
+   if ( OPT__AUTO_NPGROUP )
+      Aux_Message( stderr, "WARNING : \"%s\" only applies to the CPU solvers and will be ignored !!\n",
+                   "OPT__AUTO_NPGROUP" );
+#  endif
+
    if ( OPT__TIMING_BARRIER )
       Aux_Message( stderr, "WARNING : \"%s\" may deteriorate performance (especially if %s is on) ...\n",
                    "OPT__TIMING_BARRIER", "OPT__OVERLAP_MPI" );
@@ -523,6 +582,11 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "\"%s\" is required for \"%s\" in LOAD_BALANCE --> check LB_RecordExchangeFixUpDataPatchID() !!\n",
                  "Flu_ParaBuf < PATCH_SIZE", "OPT__FIXUP_FLUX" );
 
+// the incremental load balancing only considers the single weighted workload
+   if ( OPT__LB_INCREMENTAL  &&  OPT__LB_MULTI_CONSTRAINT )
+      Aux_Error( ERROR_INFO, "\"%s\" does not support \"%s\" !!\n",
+                 "OPT__LB_INCREMENTAL", "OPT__LB_MULTI_CONSTRAINT" );
+
 // ensure that the variable "PaddedCr1D" will not overflow
    const int Padded              = 1<<NLEVEL;
    const int BoxNScale_Padded[3] = { amr->BoxScale[0]/PATCH_SIZE + 2*Padded,
@@ -1352,6 +1416,7 @@ void Aux_Check_Parameter()
    if ( SOR_OMEGA < 0.0 )     Aux_Error( ERROR_INFO, "SOR_OMEGA (%14.7e) < 0.0 !!\n", SOR_OMEGA );
    if ( SOR_MAX_ITER < 0 )    Aux_Error( ERROR_INFO, "SOR_MAX_ITER (%d) < 0 !!\n", SOR_MAX_ITER );
    if ( SOR_MIN_ITER < 3 )    Aux_Error( ERROR_INFO, "SOR_MIN_ITER (%d) < 3 !!\n", SOR_MIN_ITER );
+   if ( SOR_TOLERATED_ERROR < 0.0 )    Aux_Error( ERROR_INFO, "SOR_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", SOR_TOLERATED_ERROR );
 #  endif
 
 #  if ( POT_SCHEME == MG )
@@ -1361,6 +1426,32 @@ void Aux_Check_Parameter()
    if ( MG_TOLERATED_ERROR < 0.0 )     Aux_Error( ERROR_INFO, "MG_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", MG_TOLERATED_ERROR );
 #  endif
 
+   if ( OPT__POT_LEVEL_MG )
+   {
+#     ifndef LOAD_BALANCE
+      Aux_Error( ERROR_INFO, "OPT__POT_LEVEL_MG only supports LOAD_BALANCE !!\n" );
+#     endif
+
+      if ( OPT__OVERLAP_MPI )
+         Aux_Error( ERROR_INFO, "OPT__POT_LEVEL_MG does not support OPT__OVERLAP_MPI !!\n" );
+
+      if ( POT_LEVEL_MG_MAX_ITER < 0 )
+         Aux_Error( ERROR_INFO, "POT_LEVEL_MG_MAX_ITER (%d) < 0 !!\n", POT_LEVEL_MG_MAX_ITER );
+
+      if ( POT_LEVEL_MG_TOLERATED_ERROR < 0.0 )
+         Aux_Error( ERROR_INFO, "POT_LEVEL_MG_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", POT_LEVEL_MG_TOLERATED_ERROR );
+   }
+
+   if ( OPT__POT_WARM_START )
+   {
+#     ifdef GPU
+      Aux_Error( ERROR_INFO, "OPT__POT_WARM_START does not support GPU !!\n" );
+#     endif
+
+      if ( OPT__POT_LEVEL_MG  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : OPT__POT_WARM_START has no effect when OPT__POT_LEVEL_MG is on !!\n" );
+   }
+
 #  if ( NLEVEL > 1 )
    int Trash_RefPot, NGhost_RefPot;
    Int_Table( OPT__REF_POT_INT_SCHEME, Trash_RefPot, NGhost_RefPot );
@@ -1525,8 +1616,11 @@ void Aux_Check_Parameter()
    if ( DT__PARACC > 1.0 )
       Aux_Message( stderr, "WARNING : DT__PARACC (%13.7e) is not within the normal range [0.0~1.0] !!\n", DT__PARACC );
 
+#  ifdef MASSIVE_PARTICLES
    if ( OPT__OVERLAP_MPI )
-      Aux_Message( stderr, "WARNING : PARTICLE does not support OPT__OVERLAP_MPI !!\n" );
+      Aux_Message( stderr, "WARNING : \"%s\" only applies to the fluid solver for MASSIVE_PARTICLES !!\n",
+                   "OPT__OVERLAP_MPI" );
+#  endif
 
 #  ifdef STORE_POT_GHOST
    if ( !amr->Par->ImproveAcc )
@@ -401,8 +401,8 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
                         if ( SkipPatch[LocalID] )  continue;
 
                         const int PID = PID0 + LocalID;
-                        const real (*FluidPtr     )[PS1][PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid;
-                        const real (*FluidPtr_IntT)[PS1][PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid : NULL;
+                        const real_store (*FluidPtr     )[PS1][PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid;
+                        const real_store (*FluidPtr_IntT)[PS1][PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid : NULL;
 
                         const double x0 = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh - Center[0];
                         const double y0 = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh - Center[1];
@@ -503,8 +503,8 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
                   if ( SkipPatch[LocalID] )  continue;
 
                   const int PID = PID0 + LocalID;
-                  const real (*DensPtr     )[PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid[DENS];
-                  const real (*DensPtr_IntT)[PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid[DENS] : NULL;
+                  const real_store (*DensPtr     )[PS1][PS1] =                  amr->patch[ FluSg      ][lv][PID]->fluid[DENS];
+                  const real_store (*DensPtr_IntT)[PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid[DENS] : NULL;
 
                   for (int k=0; k<PS1; k++)
                   for (int j=0; j<PS1; j++)
@@ -0,0 +1,448 @@
+#include "GAMER.h"
+#include <sys/mman.h>
+
+
+
+// size of the huge pages to which the slab blocks are aligned
+#define SLAB_PAGE_SIZE     ( 2L*1024L*1024L )
+
+// minimum and maximum numbers of slots per block
+#define SLAB_MIN_NSLOT     8
+#define SLAB_MAX_NSLOT     4096
+
+// alignment of each slot in bytes
+#define SLAB_ALIGN         64L
+
+// number of different field arrays (SLAB_FLUID, SLAB_MAGNETIC, SLAB_POT, SLAB_POT_EXT, SLAB_FLUX)
+#define SLAB_NTYPE         5
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  SlabBlock_t
+// Description :  Header stored at the beginning of each slab block
+//
+// Note        :  1. Each block has a size of Slab_BlockSize[Type], which is a power of two, and is aligned to
+//                   its own size
+//                   --> The header of the block containing a given slot can be found by masking the slot address
+//                2. The header is followed by NSlot slots, each of which has a size of Slab_SlotSize[Type]
+//
+// Data Member :  Lv        : Target refinement level
+//                Type      : Target field array (SLAB_FLUID, SLAB_MAGNETIC, ...)
+//                Idx       : Index of this block in Slab_List[Type][Lv]
+//                NSlot     : Number of slots
+//                NFree     : Number of free slots
+//                FirstWord : Index of the first word in Free[] that may contain a free slot
+//                Data      : Pointer to the first slot
+//                Free      : Bitmap of the free slots (1/0 <--> free/used)
+//                Untouched : Bitmap of the slots that have not been first touched (1/0 <--> untouched/touched)
+//-------------------------------------------------------------------------------------------------------
+struct SlabBlock_t
+{
+
+   int   Lv;
+   int   Type;
+   int   Idx;
+   int   NSlot;
+   int   NFree;
+   int   FirstWord;
+   char *Data;
+   ulong Free     [ SLAB_MAX_NSLOT/64 ];
+   ulong Untouched[ SLAB_MAX_NSLOT/64 ];
+
+}; // struct SlabBlock_t
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  SlabList_t
+// Description :  List of all the blocks allocated for one field array at one level
+//
+// Data Member :  Block     : Blocks in the order of allocation
+//                NBlock    : Number of blocks
+//                NAlloc    : Size of Block[]
+//                FirstFree : Index of the first block that may contain a free slot
+//-------------------------------------------------------------------------------------------------------
+struct SlabList_t
+{
+
+   SlabBlock_t **Block;
+   int           NBlock;
+   int           NAlloc;
+   int           FirstFree;
+
+}; // struct SlabList_t
+
+
+
+static bool       Slab_Initialized = false;
+static long       Slab_RawSize  [SLAB_NTYPE];           // size of each field array in bytes
+static long       Slab_SlotSize [SLAB_NTYPE];           // size of each slot in bytes
+static long       Slab_BlockSize[SLAB_NTYPE];           // size of each block in bytes (0 --> slab not applied)
+static long       Slab_HeaderSize;                      // size of the block header in bytes
+static SlabList_t Slab_List[SLAB_NTYPE][NLEVEL];
+
+static SlabBlock_t *Slab_NewBlock( const int lv, const PatchSlab_t Type );
+static void         Slab_TouchBlock( SlabBlock_t *Block, const long SlotSize );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PatchSlab_Allocate
+// Description :  Allocate a field array of a patch
+//
+// Note        :  1. Invoked by the patch_t methods hnew(), mnew(), gnew(), and fnew()
+//                2. For OPT__PATCH_SLAB, the array is carved out of the large blocks of the target level
+//                   --> The free slot with the lowest address in the earliest allocated block is always returned
+//                       first so that patches allocated in the order of their patch indices (which follow LB_Idx
+//                       after load balancing) are also stored in that order
+//                   --> Otherwise the array is allocated by malloc()
+//                3. Field arrays too large to fit SLAB_MIN_NSLOT slots in one block are always allocated by malloc()
+//                4. The returned memory is uninitialized
+//                   --> But each slot is first touched (zeroed) outside the critical section when it is claimed
+//                       for the first time
+//                       --> By all OpenMP threads for the entire new block when invoked outside an OpenMP parallel
+//                           region (see Slab_TouchBlock())
+//                       --> By the claiming thread for the claimed slot only when invoked inside a parallel region
+//                5. Free the returned memory by Aux_PatchSlab_Free()
+//                6. Aux_PatchSlab_Init() must be invoked in advance
+//
+// Parameter   :  lv   : Refinement level of the target patch
+//                Type : Target field array (SLAB_FLUID, SLAB_MAGNETIC, SLAB_POT, SLAB_POT_EXT, SLAB_FLUX)
+//
+// Return      :  Pointer to the allocated array
+//-------------------------------------------------------------------------------------------------------
+void *Aux_PatchSlab_Allocate( const int lv, const PatchSlab_t Type )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( !Slab_Initialized )                  Aux_Error( ERROR_INFO, "Aux_PatchSlab_Init() has not been invoked !!\n" );
+   if ( Type < 0  ||  Type >= SLAB_NTYPE )   Aux_Error( ERROR_INFO, "incorrect Type (%d) !!\n", Type );
+   if ( lv < 0  ||  lv >= NLEVEL )           Aux_Error( ERROR_INFO, "incorrect lv (%d) !!\n", lv );
+#  endif
+
+// allocate by malloc()
+   if ( !OPT__PATCH_SLAB  ||  Slab_BlockSize[Type] == 0L )
+   {
+      void *Ptr = malloc( Slab_RawSize[Type] );
+
+      if ( Ptr == NULL )   Aux_Error( ERROR_INFO, "failed to allocate %ld bytes !!\n", Slab_RawSize[Type] );
+
+      return Ptr;
+   }
+
+
+// allocate from the slab blocks
+   void        *Ptr      = NULL;
+   SlabBlock_t *NewBlock = NULL;
+   bool         Touch    = false;
+
+#  pragma omp critical( PATCH_SLAB )
+   {
+      SlabList_t  *List  = &Slab_List[Type][lv];
+      SlabBlock_t *Block = NULL;
+
+//    1. find the first block with a free slot
+      for (int b=List->FirstFree; b<List->NBlock; b++)
+      {
+         if ( List->Block[b]->NFree > 0 )
+         {
+            Block           = List->Block[b];
+            List->FirstFree = b;
+            break;
+         }
+      }
+
+//    2. allocate a new block if all blocks are full
+      if ( Block == NULL )
+      {
+         Block           = Slab_NewBlock( lv, Type );
+         List->FirstFree = Block->Idx;
+         NewBlock        = Block;
+      }
+
+//    3. take the free slot with the lowest address
+      int w = Block->FirstWord;
+      while ( Block->Free[w] == 0UL )  w ++;
+
+      const int Bit  = __builtin_ctzl( Block->Free[w] );
+      const int Slot = w*64 + Bit;
+
+      Block->Free[w]  &= ~( 1UL << Bit );
+      Block->FirstWord = w;
+      Block->NFree    --;
+
+      Ptr = Block->Data + Slot*Slab_SlotSize[Type];
+
+//    4. claim the first touch of this slot
+      Touch               = Block->Untouched[w] & ( 1UL << Bit );
+      Block->Untouched[w] &= ~( 1UL << Bit );
+   } // OpenMP critical
+
+
+// first touch outside the critical section
+// --> no other thread can access the new block outside a parallel region, so it is safe to touch all its slots here
+#  ifdef OPENMP
+   const bool InParallel = omp_in_parallel();
+#  else
+   const bool InParallel = false;
+#  endif
+
+   if      ( NewBlock != NULL  &&  !InParallel )   Slab_TouchBlock( NewBlock, Slab_SlotSize[Type] );
+   else if ( Touch )                                memset( Ptr, 0, Slab_SlotSize[Type] );
+
+   return Ptr;
+
+} // FUNCTION : Aux_PatchSlab_Allocate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PatchSlab_Free
+// Description :  Free a field array allocated by Aux_PatchSlab_Allocate()
+//
+// Note        :  1. Do nothing if Ptr == NULL
+//                2. The slot is returned to the free list of the level where it was allocated, which may be
+//                   different from the level of the patch owning it now
+//                3. Empty blocks are kept for reuse and are only freed by Aux_PatchSlab_FreeAll()
+//
+// Parameter   :  Type : Target field array (SLAB_FLUID, SLAB_MAGNETIC, SLAB_POT, SLAB_POT_EXT, SLAB_FLUX)
+//                Ptr  : Pointer to be freed
+//-------------------------------------------------------------------------------------------------------
+void Aux_PatchSlab_Free( const PatchSlab_t Type, void *Ptr )
+{
+
+   if ( Ptr == NULL )   return;
+
+   if ( !OPT__PATCH_SLAB  ||  Slab_BlockSize[Type] == 0L )
+   {
+      free( Ptr );
+      return;
+   }
+
+   SlabBlock_t *Block = (SlabBlock_t*)(  (ulong)Ptr & ~( (ulong)Slab_BlockSize[Type] - 1UL )  );
+   const int    Slot  = ( (char*)Ptr - Block->Data ) / Slab_SlotSize[Type];
+   const int    w     = Slot / 64;
+
+#  pragma omp critical( PATCH_SLAB )
+   {
+#     ifdef GAMER_DEBUG
+      if ( Block->Type != Type  ||  Slot < 0  ||  Slot >= Block->NSlot  ||
+           Block->Data + Slot*Slab_SlotSize[Type] != (char*)Ptr  ||  Block->Free[w] & ( 1UL << (Slot%64) ) )
+         Aux_Error( ERROR_INFO, "incorrect pointer %p (Type %d, Slot %d) !!\n", Ptr, Type, Slot );
+#     endif
+
+      SlabList_t *List = &Slab_List[Type][ Block->Lv ];
+
+      Block->Free[w]  |= 1UL << ( Slot%64 );
+      Block->FirstWord = MIN( Block->FirstWord, w );
+      Block->NFree    ++;
+      List->FirstFree  = MIN( List->FirstFree, Block->Idx );
+   }
+
+} // FUNCTION : Aux_PatchSlab_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PatchSlab_FreeAll
+// Description :  Free all the slab blocks
+//
+// Note        :  1. Invoked by End_MemFree() after all patches have been deleted
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_PatchSlab_FreeAll()
+{
+
+   if ( !Slab_Initialized )   return;
+
+   for (int t=0; t<SLAB_NTYPE; t++)
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      SlabList_t *List = &Slab_List[t][lv];
+
+      for (int b=0; b<List->NBlock; b++)
+      {
+#        ifdef GAMER_DEBUG
+         if ( List->Block[b]->NFree != List->Block[b]->NSlot )
+            Aux_Message( stderr, "WARNING : %d slots are still in use (Type %d, lv %d, block %d) !!\n",
+                         List->Block[b]->NSlot-List->Block[b]->NFree, t, lv, b );
+#        endif
+
+         free( List->Block[b] );
+      }
+
+      free( List->Block );
+
+      List->Block     = NULL;
+      List->NBlock    = 0;
+      List->NAlloc    = 0;
+      List->FirstFree = 0;
+   }
+
+} // FUNCTION : Aux_PatchSlab_FreeAll
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PatchSlab_Init
+// Description :  Set the slot and block sizes of all field arrays
+//
+// Note        :  1. Invoked by Init_MemAllocate() once before allocating any patch
+//                   --> Not invoked lazily by Aux_PatchSlab_Allocate() since patches may be allocated by
+//                       multiple OpenMP threads
+//                2. The block size is the smallest power of two that is no smaller than SLAB_PAGE_SIZE
+//                   and can hold at least SLAB_MIN_NSLOT slots
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_PatchSlab_Init()
+{
+
+   Slab_RawSize[SLAB_FLUID   ] = (long)sizeof(real_store)*NCOMP_TOTAL*CUBE(PS1);
+#  ifdef MHD
+   Slab_RawSize[SLAB_MAGNETIC] = (long)sizeof(real)*NCOMP_MAG*PS1P1*SQR(PS1);
+#  else
+   Slab_RawSize[SLAB_MAGNETIC] = 0L;
+#  endif
+#  ifdef GRAVITY
+   Slab_RawSize[SLAB_POT     ] = (long)sizeof(real_store)*CUBE(PS1);
+#  ifdef STORE_POT_GHOST
+   Slab_RawSize[SLAB_POT_EXT ] = (long)sizeof(real)*CUBE(GRA_NXT);
+#  else
+   Slab_RawSize[SLAB_POT_EXT ] = 0L;
+#  endif
+#  else
+   Slab_RawSize[SLAB_POT     ] = 0L;
+   Slab_RawSize[SLAB_POT_EXT ] = 0L;
+#  endif
+   Slab_RawSize[SLAB_FLUX    ] = (long)sizeof(real_store)*NFLUX_TOTAL*SQR(PS1);
+
+   Slab_HeaderSize = ( (long)sizeof(SlabBlock_t) + SLAB_ALIGN - 1L )/SLAB_ALIGN*SLAB_ALIGN;
+
+   for (int t=0; t<SLAB_NTYPE; t++)
+   {
+//    pad each slot to SLAB_ALIGN and ensure that one huge page holds no more than SLAB_MAX_NSLOT slots
+      const long MinSlot = ( (SLAB_PAGE_SIZE-Slab_HeaderSize)/SLAB_MAX_NSLOT + SLAB_ALIGN - 1L )/SLAB_ALIGN*SLAB_ALIGN;
+
+      Slab_SlotSize[t] = ( Slab_RawSize[t] + SLAB_ALIGN - 1L )/SLAB_ALIGN*SLAB_ALIGN;
+      Slab_SlotSize[t] = MAX( Slab_SlotSize[t], MinSlot );
+
+      Slab_BlockSize[t] = SLAB_PAGE_SIZE;
+      while ( Slab_BlockSize[t] < Slab_HeaderSize + SLAB_MIN_NSLOT*Slab_SlotSize[t] )   Slab_BlockSize[t] *= 2L;
+
+//    do not apply the slab allocator to the unused arrays and to the arrays requiring a block larger than 64 huge pages
+      if ( Slab_RawSize[t] == 0L  ||  Slab_BlockSize[t] > 64L*SLAB_PAGE_SIZE )   Slab_BlockSize[t] = 0L;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         Slab_List[t][lv].Block     = NULL;
+         Slab_List[t][lv].NBlock    = 0;
+         Slab_List[t][lv].NAlloc    = 0;
+         Slab_List[t][lv].FirstFree = 0;
+      }
+   }
+
+   Slab_Initialized = true;
+
+} // FUNCTION : Aux_PatchSlab_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Slab_NewBlock
+// Description :  Allocate a new block and append it to Slab_List[Type][lv]
+//
+// Note        :  1. Invoked by Aux_PatchSlab_Allocate() inside the critical section
+//                2. Request transparent huge pages for the block if supported
+//                3. The slots are NOT touched here to avoid spawning OpenMP threads inside the critical section
+//                   --> They are first touched by Aux_PatchSlab_Allocate() after leaving the critical section
+//
+// Parameter   :  lv   : Target refinement level
+//                Type : Target field array
+//
+// Return      :  Pointer to the new block
+//-------------------------------------------------------------------------------------------------------
+SlabBlock_t *Slab_NewBlock( const int lv, const PatchSlab_t Type )
+{
+
+   const long BlockSize = Slab_BlockSize[Type];
+   const long SlotSize  = Slab_SlotSize [Type];
+   SlabList_t *List     = &Slab_List[Type][lv];
+
+// 1. allocate memory
+   void *Ptr = NULL;
+
+   if ( posix_memalign( &Ptr, BlockSize, BlockSize ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to allocate a slab block of %ld bytes !!\n", BlockSize );
+
+#  ifdef MADV_HUGEPAGE
+   madvise( Ptr, BlockSize, MADV_HUGEPAGE );
+#  endif
+
+
+// 2. initialize the header
+   SlabBlock_t *Block = (SlabBlock_t*)Ptr;
+
+   Block->Lv        = lv;
+   Block->Type      = Type;
+   Block->Idx       = List->NBlock;
+   Block->NSlot     = MIN( (BlockSize-Slab_HeaderSize)/SlotSize, (long)SLAB_MAX_NSLOT );
+   Block->NFree     = Block->NSlot;
+   Block->FirstWord = 0;
+   Block->Data      = (char*)Ptr + Slab_HeaderSize;
+
+   for (int w=0; w<SLAB_MAX_NSLOT/64; w++)
+   {
+      const int NBit = Block->NSlot - w*64;
+
+      if      ( NBit >= 64 )  Block->Free[w] = ~0UL;
+      else if ( NBit >   0 )  Block->Free[w] = ( 1UL << NBit ) - 1UL;
+      else                    Block->Free[w] = 0UL;
+
+      Block->Untouched[w] = Block->Free[w];
+   }
+
+
+// 3. append it to the block list
+   if ( List->NBlock >= List->NAlloc )
+   {
+      List->NAlloc = ( List->NAlloc == 0 ) ? 16 : 2*List->NAlloc;
+      List->Block  = (SlabBlock_t**)realloc( List->Block, List->NAlloc*sizeof(SlabBlock_t*) );
+   }
+
+   List->Block[ List->NBlock ++ ] = Block;
+
+   return Block;
+
+} // FUNCTION : Slab_NewBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Slab_TouchBlock
+// Description :  First touch all the untouched slots of a new block in parallel
+//
+// Note        :  1. Invoked by Aux_PatchSlab_Allocate() outside both the critical section and any OpenMP
+//                   parallel region
+//                2. Slots are touched by all OpenMP threads with a static schedule, which matches the
+//                   thread-patch assignment of the loops sweeping over patches in the order of their patch indices
+//
+// Parameter   :  Block    : Target block
+//                SlotSize : Size of each slot in bytes
+//-------------------------------------------------------------------------------------------------------
+void Slab_TouchBlock( SlabBlock_t *Block, const long SlotSize )
+{
+
+   const int NSlot = Block->NSlot;
+   char     *Data  = Block->Data;
+
+#  pragma omp parallel for schedule( static )
+   for (int s=0; s<NSlot; s++)   memset( Data + s*SlotSize, 0, SlotSize );
+
+   for (int w=0; w<SLAB_MAX_NSLOT/64; w++)   Block->Untouched[w] = 0UL;
+
+} // FUNCTION : Slab_TouchBlock
@@ -0,0 +1,162 @@
+#include "GAMER.h"
+
+
+
+// arenas indexed by the thread slots returned by GetSlot()
+// --> do not use threadprivate since libgomp creates new threads for each nested team, which would leave
+//     one orphaned arena per nested region (e.g., OPT__OVERLAP_MPI)
+// --> the table is allocated once with OMP_NTHREAD^2 slots to cover up to two active parallel levels
+static ScratchArena_t **Arena_Slot  = NULL;
+static int              Arena_NSlot = 0;
+static int              Arena_N     = 0;
+
+static int GetSlot();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_ScratchArena_Get
+// Description :  Return the scratch arena of the calling thread
+//
+// Note        :  1. The arena is allocated by the calling thread on its first invocation so that its memory
+//                   is first touched by the owner thread
+//                2. Use ScratchScope_t declared in ScratchArena.h instead of invoking this function directly
+//                3. Arenas are keyed by the thread slot instead of the thread identity so that threads running
+//                   at the same position of the OpenMP thread hierarchy share the same arena
+//                   --> The number of arenas is bounded by OMP_NTHREAD^2
+//
+// Parameter   :  None
+//
+// Return      :  Pointer to the arena of the calling thread
+//-------------------------------------------------------------------------------------------------------
+ScratchArena_t *Aux_ScratchArena_Get()
+{
+
+// allocate the slot table
+   if ( Arena_Slot == NULL )
+   {
+#     pragma omp critical( SCRATCH_ARENA )
+      {
+         if ( Arena_Slot == NULL )
+         {
+            if ( OMP_NTHREAD <= 0 )
+               Aux_Error( ERROR_INFO, "OMP_NTHREAD (%d) <= 0 !!\n", OMP_NTHREAD );
+
+            Arena_NSlot = SQR( OMP_NTHREAD );
+            Arena_N     = 0;
+            Arena_Slot  = (ScratchArena_t**)calloc( Arena_NSlot, sizeof(ScratchArena_t*) );
+         }
+      }
+   }
+
+
+// allocate the arena of this slot
+// --> no critical section is required since each slot is used by one thread at a time
+   const int Slot = GetSlot();
+
+   if ( Arena_Slot[Slot] == NULL )
+   {
+      Arena_Slot[Slot] = new ScratchArena_t;
+
+#     pragma omp atomic
+      Arena_N ++;
+   }
+
+   return Arena_Slot[Slot];
+
+} // FUNCTION : Aux_ScratchArena_Get
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetSlot
+// Description :  Return the arena slot of the calling thread
+//
+// Note        :  1. Slot = ancestor thread index at the first active level * OMP_NTHREAD
+//                         + ancestor thread index at the second active level
+//                   --> Serial code and the master threads of the nested teams map to the same slots as the
+//                       threads spawning them, which are never active at the same time
+//                2. Inactive levels (team size = 1) are skipped since they do not create any new thread
+//                3. Only two active levels are supported
+//
+// Parameter   :  None
+//
+// Return      :  Slot in the range [0, OMP_NTHREAD^2)
+//-------------------------------------------------------------------------------------------------------
+int GetSlot()
+{
+
+   int Slot = 0;
+
+#  ifdef OPENMP
+   int Idx[2] = { 0, 0 };
+   int NActive = 0;
+
+   for (int l=1; l<=omp_get_level(); l++)
+   {
+      if ( omp_get_team_size(l) <= 1 )   continue;
+
+      if ( NActive >= 2 )
+         Aux_Error( ERROR_INFO, "scratch arenas do not support more than two active parallel levels !!\n" );
+
+      Idx[ NActive ++ ] = omp_get_ancestor_thread_num( l );
+   }
+
+   if ( Idx[0] >= OMP_NTHREAD  ||  Idx[1] >= OMP_NTHREAD )
+      Aux_Error( ERROR_INFO, "thread index (%d, %d) >= OMP_NTHREAD (%d) !!\n", Idx[0], Idx[1], OMP_NTHREAD );
+
+   Slot = Idx[0]*OMP_NTHREAD + Idx[1];
+#  endif
+
+   return Slot;
+
+} // FUNCTION : GetSlot
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_ScratchArena_Count
+// Description :  Return the number of scratch arenas allocated so far
+//
+// Note        :  1. Used by the debug checks to verify that the arenas are reused across steps
+//
+// Parameter   :  None
+//
+// Return      :  Number of arenas
+//-------------------------------------------------------------------------------------------------------
+int Aux_ScratchArena_Count()
+{
+
+   int N;
+
+#  pragma omp atomic read
+   N = Arena_N;
+
+   return N;
+
+} // FUNCTION : Aux_ScratchArena_Count
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_ScratchArena_Free
+// Description :  Free the scratch arenas of all threads
+//
+// Note        :  1. Invoked by End_MemFree()
+//                2. Must not be invoked when any scratch scope is still alive
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_ScratchArena_Free()
+{
+
+   for (int t=0; t<Arena_NSlot; t++)   delete Arena_Slot[t];
+
+   free( Arena_Slot );
+
+   Arena_Slot  = NULL;
+   Arena_NSlot = 0;
+   Arena_N     = 0;
+
+} // FUNCTION : Aux_ScratchArena_Free
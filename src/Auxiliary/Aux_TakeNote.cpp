@@ -313,6 +313,12 @@ void Aux_TakeNote()
       fprintf( Note, "FLOAT8                          OFF\n" );
 #     endif
 
+#     ifdef FLOAT8_STORE
+      fprintf( Note, "FLOAT8_STORE                    ON\n" );
+#     else
+      fprintf( Note, "FLOAT8_STORE                    OFF\n" );
+#     endif
+
 #     ifdef FLOAT8_PAR
       fprintf( Note, "FLOAT8_PAR                      ON\n" );
 #     else
@@ -950,6 +956,7 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY              % d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL               % d\n",      OPT__MEMORY_POOL          );
+      fprintf( Note, "OPT__PATCH_SLAB                % d\n",      OPT__PATCH_SLAB           );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 
@@ -972,6 +979,16 @@ void Aux_TakeNote()
       fprintf( Note, "LB_PAR_WEIGHT                  % 14.7e\n",  amr->LB->Par_Weight       );
 #     endif
       fprintf( Note, "OPT__RECORD_LOAD_BALANCE       % d\n",      OPT__RECORD_LOAD_BALANCE  );
+      fprintf( Note, "OPT__MPI_SPARSE                % d\n",      OPT__MPI_SPARSE           );
+      fprintf( Note, "OPT__MPI_PERSISTENT            % d\n",      OPT__MPI_PERSISTENT       );
+      fprintf( Note, "OPT__LB_MEASURED_COST          % d\n",      OPT__LB_MEASURED_COST     );
+      fprintf( Note, "LB_MEASURED_COST_SMOOTH        % 14.7e\n",  LB_MEASURED_COST_SMOOTH   );
+      fprintf( Note, "OPT__LB_INCREMENTAL            % d\n",      OPT__LB_INCREMENTAL       );
+      fprintf( Note, "OPT__LB_MULTI_CONSTRAINT       % d\n",      OPT__LB_MULTI_CONSTRAINT  );
+      fprintf( Note, "LB_MC_TOL_CELL                 % 14.7e\n",  LB_MC_TOL_CELL            );
+      fprintf( Note, "LB_MC_TOL_PAR                  % 14.7e\n",  LB_MC_TOL_PAR             );
+      fprintf( Note, "LB_MC_TOL_TIME                 % 14.7e\n",  LB_MC_TOL_TIME            );
+      fprintf( Note, "LB_MC_TOL_MEM                  % 14.7e\n",  LB_MC_TOL_MEM             );
 #     endif // #ifdef LOAD_BALANCE
       fprintf( Note, "OPT__MINIMIZE_MPI_BARRIER      % d\n",      OPT__MINIMIZE_MPI_BARRIER );
       fprintf( Note, "***********************************************************************************\n" );
@@ -1139,6 +1156,7 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "FLU_GPU_NPGROUP                % d\n",      FLU_GPU_NPGROUP          );
       fprintf( Note, "GPU_NSTREAM                    % d\n",      GPU_NSTREAM              );
+      fprintf( Note, "OPT__AUTO_NPGROUP              % d\n",      OPT__AUTO_NPGROUP        );
       fprintf( Note, "OPT__FIXUP_FLUX                % d\n",      OPT__FIXUP_FLUX          );
 
 //    target scalars to be applied fix-up flux operations
@@ -1188,6 +1206,9 @@ void Aux_TakeNote()
 #     endif
 
       fprintf( Note, "OPT__OVERLAP_MPI               % d\n",      OPT__OVERLAP_MPI         );
+      fprintf( Note, "OPT__CPU_PIPELINE              % d\n",      OPT__CPU_PIPELINE        );
+      fprintf( Note, "OPT__PREP_CACHE                % d\n",      OPT__PREP_CACHE          );
+      fprintf( Note, "PREP_CACHE_MAX_MB              % 14.7e\n",  PREP_CACHE_MAX_MB        );
       fprintf( Note, "OPT__RESET_FLUID               % d\n",      OPT__RESET_FLUID         );
       fprintf( Note, "OPT__RESET_FLUID_INIT          % d\n",      OPT__RESET_FLUID_INIT    );
       if ( OPT__RESET_FLUID || OPT__RESET_FLUID_INIT ) {
@@ -1248,12 +1269,18 @@ void Aux_TakeNote()
       fprintf( Note, "SOR_OMEGA                      % 14.7e\n",  SOR_OMEGA               );
       fprintf( Note, "SOR_MAX_ITER                   % d\n",      SOR_MAX_ITER            );
       fprintf( Note, "SOR_MIN_ITER                   % d\n",      SOR_MIN_ITER            );
+      fprintf( Note, "SOR_TOLERATED_ERROR            % 14.7e\n",  SOR_TOLERATED_ERROR     );
 #     elif ( POT_SCHEME == MG )
       fprintf( Note, "MG_MAX_ITER                    % d\n",      MG_MAX_ITER             );
       fprintf( Note, "MG_NPRE_SMOOTH                 % d\n",      MG_NPRE_SMOOTH          );
       fprintf( Note, "MG_NPOST_SMOOTH                % d\n",      MG_NPOST_SMOOTH         );
       fprintf( Note, "MG_TOLERATED_ERROR             % 14.7e\n",  MG_TOLERATED_ERROR      );
 #     endif
+      fprintf( Note, "OPT__POT_LEVEL_MG              % d\n",      OPT__POT_LEVEL_MG       );
+      if ( OPT__POT_LEVEL_MG ) {
+      fprintf( Note, "POT_LEVEL_MG_MAX_ITER          % d\n",      POT_LEVEL_MG_MAX_ITER   );
+      fprintf( Note, "POT_LEVEL_MG_TOLERATED_ERROR   % 14.7e\n",  POT_LEVEL_MG_TOLERATED_ERROR ); }
+      fprintf( Note, "OPT__POT_WARM_START            % d\n",      OPT__POT_WARM_START     );
       fprintf( Note, "POT_GPU_NPGROUP                % d\n",      POT_GPU_NPGROUP         );
       fprintf( Note, "OPT__GRA_P5_GRADIENT           % d\n",      OPT__GRA_P5_GRADIENT    );
       fprintf( Note, "OPT__SELF_GRAVITY              % d\n",      OPT__SELF_GRAVITY       );
@@ -1284,6 +1311,7 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__INIT                      % d\n",      OPT__INIT                 );
       fprintf( Note, "RESTART_LOAD_NRANK             % d\n",      RESTART_LOAD_NRANK        );
       fprintf( Note, "OPT__RESTART_RESET             % d\n",      OPT__RESTART_RESET        );
+      fprintf( Note, "OPT__RESTART_PARALLEL          % d\n",      OPT__RESTART_PARALLEL     );
       fprintf( Note, "OPT__UM_IC_LEVEL               % d\n",      OPT__UM_IC_LEVEL          );
       fprintf( Note, "OPT__UM_IC_NLEVEL              % d\n",      OPT__UM_IC_NLEVEL         );
       fprintf( Note, "OPT__UM_IC_NVAR                % d\n",      OPT__UM_IC_NVAR           );
@@ -1309,6 +1337,8 @@ void Aux_TakeNote()
 
          default:                       fprintf( Note, "UNKNOWN\n" );
       } // switch ( OPT__FFTW_STARTUP )
+      fprintf( Note, "OPT__FFTW_PENCIL               % d\n",      OPT__FFTW_PENCIL          );
+      fprintf( Note, "OPT__FFTW_WISDOM               % d\n",      OPT__FFTW_WISDOM          );
 #     endif // # ifdef SUPPORT_FFTW
 
 //    refinement region for OPT__UM_IC_NLEVEL>1
@@ -1429,6 +1459,12 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Data Dump\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__OUTPUT_TOTAL              % d\n",      OPT__OUTPUT_TOTAL           );
+      fprintf( Note, "OPT__OUTPUT_HDF5_MPIIO         % d\n",      OPT__OUTPUT_HDF5_MPIIO      );
+      fprintf( Note, "OPT__OUTPUT_HDF5_COMPRESS      % d\n",      OPT__OUTPUT_HDF5_COMPRESS   );
+      fprintf( Note, "OUTPUT_HDF5_DEFLATE_LEVEL      % d\n",      OUTPUT_HDF5_DEFLATE_LEVEL   );
+      fprintf( Note, "OUTPUT_HDF5_LOSSY_DIGITS       % d\n",      OUTPUT_HDF5_LOSSY_DIGITS    );
+      fprintf( Note, "OPT__OUTPUT_HDF5_ASYNC         % d\n",      OPT__OUTPUT_HDF5_ASYNC      );
+      fprintf( Note, "OUTPUT_HDF5_ASYNC_MAX_MEM      % 21.14e\n", OUTPUT_HDF5_ASYNC_MAX_MEM   );
       fprintf( Note, "OPT__OUTPUT_PART               % d\n",      OPT__OUTPUT_PART            );
       fprintf( Note, "OPT__OUTPUT_USER               % d\n",      OPT__OUTPUT_USER            );
       fprintf( Note, "OPT__OUTPUT_TEXT_FORMAT_FLT     %s\n",      OPT__OUTPUT_TEXT_FORMAT_FLT );
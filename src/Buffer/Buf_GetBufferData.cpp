@@ -161,7 +161,7 @@ void Buf_GetBufferData( const int lv, const int FluSg, const int MagSg, const in
    int SendSize[2], RecvSize[2], PID, Counter;
    real *SendBuffer[2] = { NULL, NULL };
    real *RecvBuffer[2] = { NULL, NULL };
-   real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
+   real_store (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
 
 
 // loop over all target sibling directions (two opposite directions at a time)
@@ -27,7 +27,7 @@ void Buf_RecordExchangeFluxPatchID( const int lv )
 
    const int MirrorSib[6] = { 1,0,3,2,5,4 };
    int PID, SibPID;
-   real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
+   real_store (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
 
    for (int s=0; s<6; s++)
    {
@@ -24,7 +24,7 @@ void Buf_ResetBufferFlux( const int lv )
    }
 
 
-   real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
+   real_store (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
 
 #  pragma omp parallel for private( FluxPtr ) schedule( runtime )
    for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][27]; PID++)
@@ -454,8 +454,13 @@ void FB_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 // 12. store the updated fluid data
 #  ifdef FB_SEP_FLUOUT
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-      memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0], fluid_updated[PID][0][0][0],
-              NCOMP_TOTAL*CUBE(PS1)*sizeof(real) );
+   {
+//    use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
+            real_store *FluPtr = amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0];
+      const real       *UpdPtr = fluid_updated[PID][0][0][0];
+
+      for (int t=0; t<NCOMP_TOTAL*CUBE(PS1); t++)  FluPtr[t] = UpdPtr[t];
+   }
 #  endif
 
 
@@ -232,9 +232,9 @@ void StoreFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2
          {
 //          for bitwise reproducibility, store the fluxes to be corrected in flux_bitrep[]
 #           ifdef BIT_REP_FLUX
-            real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux_bitrep[s];
+            real_store (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux_bitrep[s];
 #           else
-            real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
+            real_store (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
 #           endif
 
             if ( FluxPtr != NULL )
@@ -338,8 +338,8 @@ void CorrectFlux( const int SonLv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQ
 
 //          for AUTO_REDUCE_DT, store the updated fluxes in the temporary array flux_tmp[] since
 //          we may need to abandon them if the fluid solver fails
-            real (*FluxPtr)[PS1][PS1] = ( AUTO_REDUCE_DT ) ? amr->patch[0][FaLv][FaSibPID]->flux_tmp[ MirrorSib[s] ] :
-                                                             amr->patch[0][FaLv][FaSibPID]->flux    [ MirrorSib[s] ];
+            real_store (*FluxPtr)[PS1][PS1] = ( AUTO_REDUCE_DT ) ? amr->patch[0][FaLv][FaSibPID]->flux_tmp[ MirrorSib[s] ] :
+                                                                   amr->patch[0][FaLv][FaSibPID]->flux    [ MirrorSib[s] ];
 
 //          skip patches not adjacent to coarse-fine boundaries
             if ( FluxPtr == NULL )  continue;
@@ -1199,6 +1199,8 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 // accumulate the total number of corrected cells in one global time-step if CorrectUnphysical() works
    else
    {
+//    use atomic since Flu_Close() can be invoked by multiple threads simultaneously for OPT__CPU_PIPELINE
+#     pragma omp atomic
       NCorrUnphy[lv] += NCorrThisTime;
    }
 
@@ -92,7 +92,7 @@ void Flu_FixUp_Flux( const int lv, const long TVar )
 #     ifdef BIT_REP_FLUX
       for (int s=0; s<6; s++)
       {
-         real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
+         real_store (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
 
          if ( FluxPtr != NULL )
          {
@@ -110,12 +110,12 @@ void Flu_FixUp_Flux( const int lv, const long TVar )
       for (int s=0; s<6; s++)
       {
 //       skip the faces not adjacent to the coarse-fine boundaries
-         const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
+         const real_store (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
          if ( FluxPtr == NULL  )  continue;
 
 
 //       set the pointers to the target face
-         real *FluidPtr1D0[NCOMP_TOTAL], *FluidPtr1D[NCOMP_TOTAL];
+         real_store *FluidPtr1D0[NCOMP_TOTAL], *FluidPtr1D[NCOMP_TOTAL];
          for (int v=0; v<NCOMP_TOTAL; v++)   FluidPtr1D0[v] = amr->patch[FluSg][lv][PID]->fluid[v][0][0] + Offset[s];
 #        ifdef DUAL_ENERGY
          const char *DE_StatusPtr1D0 = amr->patch[0][lv][PID]->de_status[0][0] + Offset[s];
@@ -360,7 +360,7 @@ void Flu_FixUp_Flux( const int lv, const long TVar )
    {
       for (int s=0; s<6; s++)
       {
-         real (*FluxPtr)[PS1][PS1] = NULL;
+         real_store (*FluxPtr)[PS1][PS1] = NULL;
 
          FluxPtr = amr->patch[0][lv][PID]->flux[s];
          if ( FluxPtr != NULL )
@@ -172,8 +172,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
          for (int v=0; v<NFluVar; v++)
          {
             const int TFluVarIdx = TFluVarIdxList[v];
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
+            const real_store (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
+                  real_store (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
 
             int ii, jj, kk, I, J, K, Ip, Jp, Kp;
 
@@ -193,8 +193,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
 #        ifdef GRAVITY
          if ( ResPot )
          {
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
+            const real_store (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
+                  real_store (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
 
             int ii, jj, kk, I, J, K, Ip, Jp, Kp;
 
@@ -317,15 +317,21 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
          const real UseDual2FixEngy  = HUGE_NUMBER;
          char dummy;    // we do not record the dual-energy status here
 
+//       use temporary variables since the patch data may be stored in a different precision (i.e., real_store)
+         real Etot = amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i];
+         real Dual = amr->patch[FaFluSg][FaLv][FaPID]->fluid[DUAL][k][j][i];
+
          Hydro_DualEnergyFix( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
                               amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
                               amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
                               amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[DUAL][k][j][i],
+                              Etot, Dual,
                               dummy, EoS_AuxArray_Flt[1], EoS_AuxArray_Flt[2], CheckMinPres_Yes, MIN_PRES,
                               UseDual2FixEngy, Emag );
 
+         amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i] = Etot;
+         amr->patch[FaFluSg][FaLv][FaPID]->fluid[DUAL][k][j][i] = Dual;
+
 #        else // #ifdef DUAL_ENERGY
 
 //       actually it might not be necessary to check the minimum internal energy here
@@ -100,7 +100,7 @@ void Flu_InitFixUpTempArray( const int lv )
       for (int s=0; s<6; s++)
       {
          if ( amr->patch[0][lv][PID]->flux_tmp[s] != NULL )
-            memcpy( amr->patch[0][lv][PID]->flux_tmp[s], amr->patch[0][lv][PID]->flux[s], SQR(PS1)*NFLUX_TOTAL*sizeof(real) );
+            memcpy( amr->patch[0][lv][PID]->flux_tmp[s], amr->patch[0][lv][PID]->flux[s], SQR(PS1)*NFLUX_TOTAL*sizeof(real_store) );
       }
 
 #     ifdef MHD
@@ -76,7 +76,7 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
 #  ifdef DUAL_ENERGY
    real Pres;
 #  endif
-   real (*fluid)[PS1][PS1][PS1]=NULL;
+   real_store (*fluid)[PS1][PS1][PS1]=NULL;
 
    const real *Ptr_Dens=NULL, *Ptr_sEint=NULL, *Ptr_Ent=NULL, *Ptr_e=NULL, *Ptr_HI=NULL, *Ptr_HII=NULL;
    const real *Ptr_HeI=NULL, *Ptr_HeII=NULL, *Ptr_HeIII=NULL, *Ptr_HM=NULL, *Ptr_H2I=NULL, *Ptr_H2II=NULL;
@@ -121,14 +121,14 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
             Eint = Hydro_CheckMinEint( Eint, MIN_EINT );
 
 //          update the total energy density
-            *( fluid[ENGY     ][0][0] + idx_p ) = Eint + Ptr_Ent[idx_pg];
+            *( fluid[ENGY     ][0][0] + idx_p ) = (real_store)( Eint + Ptr_Ent[idx_pg] );
 
 //          update the dual-energy variable to be consistent with the updated pressure
 #           ifdef DUAL_ENERGY
 #           if   ( DUAL_ENERGY == DE_ENPY )
 //          DE_ENPY only works with EOS_GAMMA, which does not involve passive scalars
             Pres = EoS_DensEint2Pres_CPUPtr( Dens, Eint, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-            *( fluid[DUAL     ][0][0] + idx_p ) = Hydro_DensPres2Dual( Dens, Pres, EoS_AuxArray_Flt[1] );
+            *( fluid[DUAL     ][0][0] + idx_p ) = (real_store)( Hydro_DensPres2Dual( Dens, Pres, EoS_AuxArray_Flt[1] ) );
 
 #           elif ( DUAL_ENERGY == DE_EINT )
 #           error : DE_EINT is NOT supported yet !!
@@ -137,26 +137,26 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
 
 //          update all chemical species
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
-            *( fluid[Idx_e    ][0][0] + idx_p ) = Ptr_e    [idx_pg] * MassRatio_ep;
-            *( fluid[Idx_HI   ][0][0] + idx_p ) = Ptr_HI   [idx_pg];
-            *( fluid[Idx_HII  ][0][0] + idx_p ) = Ptr_HII  [idx_pg];
-            *( fluid[Idx_HeI  ][0][0] + idx_p ) = Ptr_HeI  [idx_pg];
-            *( fluid[Idx_HeII ][0][0] + idx_p ) = Ptr_HeII [idx_pg];
-            *( fluid[Idx_HeIII][0][0] + idx_p ) = Ptr_HeIII[idx_pg];
+            *( fluid[Idx_e    ][0][0] + idx_p ) = (real_store)( Ptr_e    [idx_pg] * MassRatio_ep );
+            *( fluid[Idx_HI   ][0][0] + idx_p ) = (real_store)( Ptr_HI   [idx_pg] );
+            *( fluid[Idx_HII  ][0][0] + idx_p ) = (real_store)( Ptr_HII  [idx_pg] );
+            *( fluid[Idx_HeI  ][0][0] + idx_p ) = (real_store)( Ptr_HeI  [idx_pg] );
+            *( fluid[Idx_HeII ][0][0] + idx_p ) = (real_store)( Ptr_HeII [idx_pg] );
+            *( fluid[Idx_HeIII][0][0] + idx_p ) = (real_store)( Ptr_HeIII[idx_pg] );
             }
 
 //          9-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE9 ) {
-            *( fluid[Idx_HM   ][0][0] + idx_p ) = Ptr_HM   [idx_pg];
-            *( fluid[Idx_H2I  ][0][0] + idx_p ) = Ptr_H2I  [idx_pg];
-            *( fluid[Idx_H2II ][0][0] + idx_p ) = Ptr_H2II [idx_pg];
+            *( fluid[Idx_HM   ][0][0] + idx_p ) = (real_store)( Ptr_HM   [idx_pg] );
+            *( fluid[Idx_H2I  ][0][0] + idx_p ) = (real_store)( Ptr_H2I  [idx_pg] );
+            *( fluid[Idx_H2II ][0][0] + idx_p ) = (real_store)( Ptr_H2II [idx_pg] );
             }
 
 //          12-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE12 ) {
-            *( fluid[Idx_DI   ][0][0] + idx_p ) = Ptr_DI   [idx_pg];
-            *( fluid[Idx_DII  ][0][0] + idx_p ) = Ptr_DII  [idx_pg];
-            *( fluid[Idx_HDI  ][0][0] + idx_p ) = Ptr_HDI  [idx_pg];
+            *( fluid[Idx_DI   ][0][0] + idx_p ) = (real_store)( Ptr_DI   [idx_pg] );
+            *( fluid[Idx_DII  ][0][0] + idx_p ) = (real_store)( Ptr_DII  [idx_pg] );
+            *( fluid[Idx_HDI  ][0][0] + idx_p ) = (real_store)( Ptr_HDI  [idx_pg] );
             }
 
             idx_p  ++;
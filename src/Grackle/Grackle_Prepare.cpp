@@ -130,7 +130,7 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 #  else
    real Px, Py, Pz, Emag=NULL_REAL;
 #  endif // #ifdef DUAL_ENERGY ... else ...
-   real (*fluid)[PS1][PS1][PS1]=NULL;
+   real_store (*fluid)[PS1][PS1][PS1]=NULL;
 
    real *Ptr_Dens=NULL, *Ptr_sEint=NULL, *Ptr_Ent=NULL, *Ptr_e=NULL, *Ptr_HI=NULL, *Ptr_HII=NULL;
    real *Ptr_HeI=NULL, *Ptr_HeII=NULL, *Ptr_HeIII=NULL, *Ptr_HM=NULL, *Ptr_H2I=NULL, *Ptr_H2II=NULL;
@@ -170,14 +170,14 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
          for (int j=0; j<PS1; j++)
          for (int i=0; i<PS1; i++)
          {
-            Dens  = *( fluid[DENS][0][0] + idx_p );
-            Etot  = *( fluid[ENGY][0][0] + idx_p );
+            Dens  = (real)*( fluid[DENS][0][0] + idx_p );
+            Etot  = (real)*( fluid[ENGY][0][0] + idx_p );
 
 //          use the dual-energy variable to calculate the internal energy if applicable
 #           ifdef DUAL_ENERGY
 
 #           if   ( DUAL_ENERGY == DE_ENPY )
-            Pres  = Hydro_DensDual2Pres( Dens, *(fluid[DUAL][0][0]+idx_p), EoS_AuxArray_Flt[1], CheckMinPres_No, NULL_REAL );
+            Pres  = Hydro_DensDual2Pres( Dens, (real)*(fluid[DUAL][0][0]+idx_p), EoS_AuxArray_Flt[1], CheckMinPres_No, NULL_REAL );
 //          EOS_GAMMA does not involve passive scalars
             Eint  = EoS_DensPres2Eint_CPUPtr( Dens, Pres, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
 #           elif ( DUAL_ENERGY == DE_EINT )
@@ -186,9 +186,9 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 
 #           else // #ifdef DUAL_ENERGY
 
-            Px    = *( fluid[MOMX][0][0] + idx_p );
-            Py    = *( fluid[MOMY][0][0] + idx_p );
-            Pz    = *( fluid[MOMZ][0][0] + idx_p );
+            Px    = (real)*( fluid[MOMX][0][0] + idx_p );
+            Py    = (real)*( fluid[MOMY][0][0] + idx_p );
+            Pz    = (real)*( fluid[MOMZ][0][0] + idx_p );
 #           ifdef MHD
             Emag  = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, amr->MagSg[lv] );
 #           endif
@@ -198,7 +198,7 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 
 //          Grackle doesn't know cosmic rays so we must exclude the cosmic-ray energy from the input gas internal energy
 #           ifdef COSMIC_RAY
-            Eint -= *( fluid[CRAY][0][0] + idx_p );
+            Eint -= (real)*( fluid[CRAY][0][0] + idx_p );
 #           endif
 
 //          mandatory fields
@@ -208,31 +208,31 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 
 //          6-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
-            Ptr_e    [idx_pg] = *( fluid[Idx_e    ][0][0] + idx_p ) * MassRatio_pe;
-            Ptr_HI   [idx_pg] = *( fluid[Idx_HI   ][0][0] + idx_p );
-            Ptr_HII  [idx_pg] = *( fluid[Idx_HII  ][0][0] + idx_p );
-            Ptr_HeI  [idx_pg] = *( fluid[Idx_HeI  ][0][0] + idx_p );
-            Ptr_HeII [idx_pg] = *( fluid[Idx_HeII ][0][0] + idx_p );
-            Ptr_HeIII[idx_pg] = *( fluid[Idx_HeIII][0][0] + idx_p );
+            Ptr_e    [idx_pg] = (real)*( fluid[Idx_e    ][0][0] + idx_p ) * MassRatio_pe;
+            Ptr_HI   [idx_pg] = (real)*( fluid[Idx_HI   ][0][0] + idx_p );
+            Ptr_HII  [idx_pg] = (real)*( fluid[Idx_HII  ][0][0] + idx_p );
+            Ptr_HeI  [idx_pg] = (real)*( fluid[Idx_HeI  ][0][0] + idx_p );
+            Ptr_HeII [idx_pg] = (real)*( fluid[Idx_HeII ][0][0] + idx_p );
+            Ptr_HeIII[idx_pg] = (real)*( fluid[Idx_HeIII][0][0] + idx_p );
             }
 
 //          9-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE9 ) {
-            Ptr_HM   [idx_pg] = *( fluid[Idx_HM   ][0][0] + idx_p );
-            Ptr_H2I  [idx_pg] = *( fluid[Idx_H2I  ][0][0] + idx_p );
-            Ptr_H2II [idx_pg] = *( fluid[Idx_H2II ][0][0] + idx_p );
+            Ptr_HM   [idx_pg] = (real)*( fluid[Idx_HM   ][0][0] + idx_p );
+            Ptr_H2I  [idx_pg] = (real)*( fluid[Idx_H2I  ][0][0] + idx_p );
+            Ptr_H2II [idx_pg] = (real)*( fluid[Idx_H2II ][0][0] + idx_p );
             }
 
 //          12-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE12 ) {
-            Ptr_DI   [idx_pg] = *( fluid[Idx_DI   ][0][0] + idx_p );
-            Ptr_DII  [idx_pg] = *( fluid[Idx_DII  ][0][0] + idx_p );
-            Ptr_HDI  [idx_pg] = *( fluid[Idx_HDI  ][0][0] + idx_p );
+            Ptr_DI   [idx_pg] = (real)*( fluid[Idx_DI   ][0][0] + idx_p );
+            Ptr_DII  [idx_pg] = (real)*( fluid[Idx_DII  ][0][0] + idx_p );
+            Ptr_HDI  [idx_pg] = (real)*( fluid[Idx_HDI  ][0][0] + idx_p );
             }
 
 //          metallicity for metal cooling
             if ( GRACKLE_METAL )
-            Ptr_Metal[idx_pg] = *( fluid[Idx_Metal][0][0] + idx_p );
+            Ptr_Metal[idx_pg] = (real)*( fluid[Idx_Metal][0][0] + idx_p );
 
             idx_p  ++;
             idx_pg ++;
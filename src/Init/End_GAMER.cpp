@@ -8,6 +8,7 @@
 // Description :  Put everything you want to do before terminating the program right here
 //
 // Note        :  1. Function pointer "End_User_Ptr" may be set by a test problem initializer
+//                2. Wait for the asynchronous HDF5 output (OPT__OUTPUT_HDF5_ASYNC) before terminating
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -17,6 +18,11 @@ void End_GAMER()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// wait until the last snapshot has been written to disk by the background I/O thread
+#  ifdef SUPPORT_HDF5
+   Output_AsyncIO_Wait();
+#  endif
+
 #  ifdef TIMING
    Aux_DeleteTimer();
 #  endif
@@ -94,6 +94,18 @@ void End_MemFree()
    delete [] UM_IC_RefineRegion;    UM_IC_RefineRegion = NULL;
 
 
+// 10. patch-data cache
+   Prepare_PatchData_Cache_Reset();
+
+
+// 11. scratch arenas of all threads
+   Aux_ScratchArena_Free();
+
+
+// 12. slab blocks of the patch field arrays (must be after deleting amr)
+   Aux_PatchSlab_FreeAll();
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_MemFree
@@ -12,12 +12,18 @@ template <typename T>
 static herr_t LoadField( const char *FieldName, void *FieldPtr, const hid_t H5_SetID_Target,
                          const hid_t H5_TypeID_Target, const bool Fatal_Nonexist,
                          const T *ComprPtr, const int NCompr, const bool Fatal_Compr );
-static void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const bool Recursive,
+static void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const int LoadIdx, const bool Recursive,
                           const int *SonList, const int (*CrList)[3],
                           const hid_t *H5_SetID_Field, const hid_t H5_SpaceID_Field, const hid_t H5_MemID_Field,
                           const hid_t *H5_SetID_FCMag, const hid_t *H5_SpaceID_FCMag, const hid_t *H5_MemID_FCMag,
                           const int *NParList, real_par **ParBuf, long *NewParList, const hid_t *H5_SetID_ParData,
                           const hid_t H5_SpaceID_ParData, const long *GParID_Offset, const long NParThisRank );
+#ifdef LOAD_BALANCE
+static void LoadTree_Parallel( const char *FileName, const int NLv, const int NLvRescale,
+                               const int *GID_LvStart, const bool ReenablePar, int &NPatchInList, int *&GIDList,
+                               int (*&CrList)[3], int *&NParList, long *&GParID_Offset,
+                               int *LoadIdx_Start, int *LoadIdx_Stop );
+#endif
 static void Check_Makefile ( const char *FileName, const int FormatVersion );
 static void Check_SymConst ( const char *FileName, const int FormatVersion );
 static void Check_InputPara( const char *FileName, const int FormatVersion );
@@ -349,201 +355,234 @@ void Init_ByRestart_HDF5( const char *FileName )
 
 
 // 2. load the tree information (load-balance indices, corner, son, ... etc) of all patches (by all ranks)
-   H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
-   if ( H5_FileID < 0 )
-      Aux_Error( ERROR_INFO, "failed to open the restart HDF5 file \"%s\" !!\n", FileName );
-
-// 2-1. corner
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading corner table ...\n" );
-
-// allocate memory
-   int (*CrList_AllLv)[3] = new int [ NPatchAllLv ][3];
-
-// load data
-   H5_SetID_Cr = H5Dopen( H5_FileID, "Tree/Corner", H5P_DEFAULT );
-   if ( H5_SetID_Cr < 0 )     Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/Corner" );
-   H5_Status = H5Dread( H5_SetID_Cr, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, CrList_AllLv );
-   H5_Status = H5Dclose( H5_SetID_Cr );
-
-// rescale the loaded corner (necessary when KeyInfo.NLevel != NLEVEL)
-   if ( NLvRescale != 1 )
-   for (int GID=0; GID<NPatchAllLv; GID++)
-   for (int d=0; d<3; d++)
-      CrList_AllLv[GID][d] *= NLvRescale;
-
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading corner table ... done\n" );
-
-
-// 2-2. LBIdx
+//    --> with OPT__RESTART_PARALLEL, each rank only loads the tree information of its own patches (see LoadTree_Parallel())
+//        --> CrList_AllLv[], NParList_AllLv[], and GParID_Offset[] then only store these patches in the loading order
+//            (with their GIDs stored in GIDList_Load[]) instead of all patches sorted by GID
+   int (*CrList_AllLv)[3] = NULL;
+   int  *NParList_AllLv   = NULL;
+   long *GParID_Offset    = NULL;
+   int   NPatchInList     = NPatchAllLv;    // number of patches stored in the above lists
 #  ifdef LOAD_BALANCE
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading load-balance index table ...\n" );
-
-   long *LBIdxList_AllLv;
+   long *LBIdxList_AllLv  = NULL;
    long *LBIdxList_EachLv         [NLEVEL];
    int  *LBIdxList_EachLv_IdxTable[NLEVEL];
    int   LoadIdx_Start[NLEVEL], LoadIdx_Stop[NLEVEL];
-
-// 2-2-1. allocate memory
-   LBIdxList_AllLv = new long [ NPatchAllLv ];
+   int  *GIDList_Load     = NULL;
 
    for (int lv=0; lv<NLEVEL; lv++)
    {
-      if ( lv < KeyInfo.NLevel )
-      {
-         LBIdxList_EachLv         [lv] = LBIdxList_AllLv + GID_LvStart[lv];
-         LBIdxList_EachLv_IdxTable[lv] = new int [ NPatchTotal[lv] ];
-      }
-
-      else
-      {
-         LBIdxList_EachLv         [lv] = NULL;
-         LBIdxList_EachLv_IdxTable[lv] = NULL;
-      }
+      LBIdxList_EachLv         [lv] = NULL;
+      LBIdxList_EachLv_IdxTable[lv] = NULL;
    }
+#  else
+   int  *SonList_AllLv    = NULL;
+#  endif
 
+#  ifdef LOAD_BALANCE
+   if ( OPT__RESTART_PARALLEL )
+   {
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading tree information in parallel ...\n" );
 
-// 2-2-2. load LBIdx list (sorted by GID)
-   H5_SetID_LBIdx = H5Dopen( H5_FileID, "Tree/LBIdx", H5P_DEFAULT );
+      LoadTree_Parallel( FileName, KeyInfo.NLevel, NLvRescale, GID_LvStart, ReenablePar, NPatchInList,
+                         GIDList_Load, CrList_AllLv, NParList_AllLv, GParID_Offset, LoadIdx_Start, LoadIdx_Stop );
 
-   if ( H5_SetID_LBIdx < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/LBIdx" );
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading tree information in parallel ... done\n" );
+   }
 
-   H5_Status = H5Dread( H5_SetID_LBIdx, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, LBIdxList_AllLv );
-   H5_Status = H5Dclose( H5_SetID_LBIdx );
+   else
+#  endif // #ifdef LOAD_BALANCE
+   {
+      H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+      if ( H5_FileID < 0 )
+         Aux_Error( ERROR_INFO, "failed to open the restart HDF5 file \"%s\" !!\n", FileName );
 
+//    2-1. corner
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading corner table ...\n" );
 
-   for (int lv=0; lv<KeyInfo.NLevel; lv++)
-   {
-//    2-2-3. sort the LBIdx list at each level and set the load-balance cut points
-#     if ( LOAD_BALANCE != HILBERT )
+//    allocate memory
+      CrList_AllLv = new int [ NPatchAllLv ][3];
+
+//    load data
+      H5_SetID_Cr = H5Dopen( H5_FileID, "Tree/Corner", H5P_DEFAULT );
+      if ( H5_SetID_Cr < 0 )     Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/Corner" );
+      H5_Status = H5Dread( H5_SetID_Cr, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, CrList_AllLv );
+      H5_Status = H5Dclose( H5_SetID_Cr );
+
+//    rescale the loaded corner (necessary when KeyInfo.NLevel != NLEVEL)
       if ( NLvRescale != 1 )
-      Aux_Message( stderr, "WARNING : please make sure that the patch LBIdx doesn't change when NLvRescale != 1 !!\n" );
-#     endif
+      for (int GID=0; GID<NPatchAllLv; GID++)
+      for (int d=0; d<3; d++)
+         CrList_AllLv[GID][d] *= NLvRescale;
 
-//    Mis_Heapsort must be called before LB_SetCutPoint in order to get LBIdxList_EachLv_IdxTable
-//    (since LB_SetCutPoint will sort LBIdxList_EachLv as well)
-//    --> Actually it's not necessary anymore since we now send LBIdx0_AllRank instead of LBIdxList_EachLv into LB_SetCutPoint()
-      Mis_Heapsort( NPatchTotal[lv], LBIdxList_EachLv[lv], LBIdxList_EachLv_IdxTable[lv] );
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading corner table ... done\n" );
 
-//    prepare LBIdx and load-balance weighting of each **patch group** for LB_SetCutPoint()
-      const bool InputLBIdx0AndLoad_Yes = true;
-      long   *LBIdx0_AllRank = NULL;
-      double *Load_AllRank   = NULL;
 
-      if ( MPI_Rank == 0 )
+//    2-2. LBIdx
+#     ifdef LOAD_BALANCE
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading load-balance index table ...\n" );
+
+//    2-2-1. allocate memory
+      LBIdxList_AllLv = new long [ NPatchAllLv ];
+
+      for (int lv=0; lv<NLEVEL; lv++)
       {
-         LBIdx0_AllRank = new long   [ NPatchTotal[lv] / 8 ];
-         Load_AllRank   = new double [ NPatchTotal[lv] / 8 ];
+         if ( lv < KeyInfo.NLevel )
+         {
+            LBIdxList_EachLv         [lv] = LBIdxList_AllLv + GID_LvStart[lv];
+            LBIdxList_EachLv_IdxTable[lv] = new int [ NPatchTotal[lv] ];
+         }
 
-         for (int t=0; t<NPatchTotal[lv]/8; t++)
+         else
          {
-            LBIdx0_AllRank[t]  = LBIdxList_EachLv[lv][t*8];
-            LBIdx0_AllRank[t] -= LBIdx0_AllRank[t] % 8;     // assuming LBIdxList_EachLv is NOT sorted yet
-            Load_AllRank  [t]  = 8.0;                       // assuming all patches have the same weighting == 1.0
+            LBIdxList_EachLv         [lv] = NULL;
+            LBIdxList_EachLv_IdxTable[lv] = NULL;
          }
       }
 
-//    do NOT consider load-balance weighting of particles since at this point we don't have that information
-      const double ParWeight_Zero = 0.0;
-      LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank, Load_AllRank,
-                      ParWeight_Zero );
 
-//    free memory
-      if ( MPI_Rank == 0 )
-      {
-         delete [] LBIdx0_AllRank;
-         delete [] Load_AllRank;
-      }
+//    2-2-2. load LBIdx list (sorted by GID)
+      H5_SetID_LBIdx = H5Dopen( H5_FileID, "Tree/LBIdx", H5P_DEFAULT );
 
+      if ( H5_SetID_LBIdx < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/LBIdx" );
 
-//    2-2-4. get the target LBIdx range of each rank
-      LoadIdx_Start[lv] = -1;    // -1 --> indicate that it has not been set
-      LoadIdx_Stop [lv] = -1;    // must be initialized as <= LoadIdx_Start[lv]
+      H5_Status = H5Dread( H5_SetID_LBIdx, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, LBIdxList_AllLv );
+      H5_Status = H5Dclose( H5_SetID_LBIdx );
 
-//    skip levels with no patch (otherwise LoadIdx_Start and LoadIdx_Stop will be set incorrectly)
-      if ( NPatchTotal[lv] == 0 )   continue;
 
-      for (int t=0; t<NPatchTotal[lv]; t++)
+      for (int lv=0; lv<KeyInfo.NLevel; lv++)
       {
-//       set LoadIdx_Start to "the first patch belonging to this rank"
-         if (  LoadIdx_Start[lv] == -1  &&  LB_Index2Rank( lv, LBIdxList_EachLv[lv][t], CHECK_ON ) == MPI_Rank  )
-            LoadIdx_Start[lv] = t;
+//       2-2-3. sort the LBIdx list at each level and set the load-balance cut points
+#        if ( LOAD_BALANCE != HILBERT )
+         if ( NLvRescale != 1 )
+         Aux_Message( stderr, "WARNING : please make sure that the patch LBIdx doesn't change when NLvRescale != 1 !!\n" );
+#        endif
+
+//       Mis_Heapsort must be called before LB_SetCutPoint in order to get LBIdxList_EachLv_IdxTable
+//       (since LB_SetCutPoint will sort LBIdxList_EachLv as well)
+//       --> Actually it's not necessary anymore since we now send LBIdx0_AllRank instead of LBIdxList_EachLv into LB_SetCutPoint()
+         Mis_Heapsort( NPatchTotal[lv], LBIdxList_EachLv[lv], LBIdxList_EachLv_IdxTable[lv] );
 
-//       set LoadIdx_Stop to "the last patch belonging to this rank + 1"
-         if ( LoadIdx_Start[lv] != -1 )
+//       prepare LBIdx and load-balance weighting of each **patch group** for LB_SetCutPoint()
+         const bool InputLBIdx0AndLoad_Yes = true;
+         long   *LBIdx0_AllRank = NULL;
+         double *Load_AllRank   = NULL;
+
+         if ( MPI_Rank == 0 )
          {
-            if (  LB_Index2Rank( lv, LBIdxList_EachLv[lv][t], CHECK_ON ) > MPI_Rank  )
+            LBIdx0_AllRank = new long   [ NPatchTotal[lv] / 8 ];
+            Load_AllRank   = new double [ NPatchTotal[lv] / 8 ];
+
+            for (int t=0; t<NPatchTotal[lv]/8; t++)
             {
-               LoadIdx_Stop[lv] = t;
-               break;
+               LBIdx0_AllRank[t]  = LBIdxList_EachLv[lv][t*8];
+               LBIdx0_AllRank[t] -= LBIdx0_AllRank[t] % 8;     // assuming LBIdxList_EachLv is NOT sorted yet
+               Load_AllRank  [t]  = 8.0;                       // assuming all patches have the same weighting == 1.0
             }
+         }
+
+//       do NOT consider load-balance weighting of particles since at this point we don't have that information
+         const double ParWeight_Zero = 0.0;
+         LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank, Load_AllRank,
+                         ParWeight_Zero );
+
+//       free memory
+         if ( MPI_Rank == 0 )
+         {
+            delete [] LBIdx0_AllRank;
+            delete [] Load_AllRank;
+         }
+
+
+//       2-2-4. get the target LBIdx range of each rank
+         LoadIdx_Start[lv] = -1;    // -1 --> indicate that it has not been set
+         LoadIdx_Stop [lv] = -1;    // must be initialized as <= LoadIdx_Start[lv]
+
+//       skip levels with no patch (otherwise LoadIdx_Start and LoadIdx_Stop will be set incorrectly)
+         if ( NPatchTotal[lv] == 0 )   continue;
 
-//          rank owning the last patch needs to be treated separately
-            else if ( t == NPatchTotal[lv] - 1 )
+         for (int t=0; t<NPatchTotal[lv]; t++)
+         {
+//          set LoadIdx_Start to "the first patch belonging to this rank"
+            if (  LoadIdx_Start[lv] == -1  &&  LB_Index2Rank( lv, LBIdxList_EachLv[lv][t], CHECK_ON ) == MPI_Rank  )
+               LoadIdx_Start[lv] = t;
+
+//          set LoadIdx_Stop to "the last patch belonging to this rank + 1"
+            if ( LoadIdx_Start[lv] != -1 )
             {
-               LoadIdx_Stop[lv] = NPatchTotal[lv];
-               break;
+               if (  LB_Index2Rank( lv, LBIdxList_EachLv[lv][t], CHECK_ON ) > MPI_Rank  )
+               {
+                  LoadIdx_Stop[lv] = t;
+                  break;
+               }
+
+//             rank owning the last patch needs to be treated separately
+               else if ( t == NPatchTotal[lv] - 1 )
+               {
+                  LoadIdx_Stop[lv] = NPatchTotal[lv];
+                  break;
+               }
             }
          }
-      }
 
-#     ifdef DEBUG_HDF5
-      if ( LoadIdx_Start[lv]%8 != 0  &&  LoadIdx_Start[lv] != -1 )
-         Aux_Error( ERROR_INFO, "LoadIdx_Start[%d] = %d --> %%8 != 0 !!\n", lv, LoadIdx_Start[lv]%8 );
+#        ifdef DEBUG_HDF5
+         if ( LoadIdx_Start[lv]%8 != 0  &&  LoadIdx_Start[lv] != -1 )
+            Aux_Error( ERROR_INFO, "LoadIdx_Start[%d] = %d --> %%8 != 0 !!\n", lv, LoadIdx_Start[lv]%8 );
 
-      if ( LoadIdx_Stop [lv]%8 != 0  &&  LoadIdx_Stop[lv] != -1 )
-         Aux_Error( ERROR_INFO, "LoadIdx_Stop [%d] = %d --> %%8 != 0 !!\n", lv, LoadIdx_Stop [lv]%8 );
+         if ( LoadIdx_Stop [lv]%8 != 0  &&  LoadIdx_Stop[lv] != -1 )
+            Aux_Error( ERROR_INFO, "LoadIdx_Stop [%d] = %d --> %%8 != 0 !!\n", lv, LoadIdx_Stop [lv]%8 );
 
-      if (  ( LoadIdx_Start[lv] == -1 && LoadIdx_Stop[lv] != -1 )  ||
-            ( LoadIdx_Start[lv] != -1 && LoadIdx_Stop[lv] == -1 )   )
-         Aux_Error( ERROR_INFO, "LoadIdx_Start/Stop[%d] = %d/%d !!\n", lv, LoadIdx_Start[lv], LoadIdx_Stop[lv] );
-#     endif
-   } // for (int lv=0; lv<KeyInfo.NLevel; lv++)
+         if (  ( LoadIdx_Start[lv] == -1 && LoadIdx_Stop[lv] != -1 )  ||
+               ( LoadIdx_Start[lv] != -1 && LoadIdx_Stop[lv] == -1 )   )
+            Aux_Error( ERROR_INFO, "LoadIdx_Start/Stop[%d] = %d/%d !!\n", lv, LoadIdx_Start[lv], LoadIdx_Stop[lv] );
+#        endif
+      } // for (int lv=0; lv<KeyInfo.NLevel; lv++)
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading load-balance index table ... done\n" );
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading load-balance index table ... done\n" );
 
 
-#  else // #ifdef LOAD_BALANCE
+#     else // #ifdef LOAD_BALANCE
 
 
-// 2-3. son
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading son table ...\n" );
+//    2-3. son
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading son table ...\n" );
 
-// allocate memory
-   int *SonList_AllLv = new int [ NPatchAllLv ];
+//    allocate memory
+      SonList_AllLv = new int [ NPatchAllLv ];
 
-// load data
-   H5_SetID_Son = H5Dopen( H5_FileID, "Tree/Son", H5P_DEFAULT );
-   if ( H5_SetID_Son < 0 )    Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/Son" );
-   H5_Status = H5Dread( H5_SetID_Son, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, SonList_AllLv );
-   H5_Status = H5Dclose( H5_SetID_Son );
+//    load data
+      H5_SetID_Son = H5Dopen( H5_FileID, "Tree/Son", H5P_DEFAULT );
+      if ( H5_SetID_Son < 0 )    Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/Son" );
+      H5_Status = H5Dread( H5_SetID_Son, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, SonList_AllLv );
+      H5_Status = H5Dclose( H5_SetID_Son );
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading son table ... done\n" );
-#  endif // #ifdef LOAD_BALANCE ... else ...
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading son table ... done\n" );
+#     endif // #ifdef LOAD_BALANCE ... else ...
 
 
-// 2-4. number of particles in each patch
-#  ifdef PARTICLE
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading particle counts ...\n" );
+//    2-4. number of particles in each patch
+#     ifdef PARTICLE
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading particle counts ...\n" );
 
-   hid_t H5_SetID_NPar;
+      hid_t H5_SetID_NPar;
 
-// allocate memory
-   int *NParList_AllLv = new int [ NPatchAllLv ];
+//    allocate memory
+      NParList_AllLv = new int [ NPatchAllLv ];
 
-// load data
-   if ( ReenablePar )   for (int t=0; t<NPatchAllLv; t++)   NParList_AllLv[t] = 0;
-   else {
-      H5_SetID_NPar = H5Dopen( H5_FileID, "Tree/NPar", H5P_DEFAULT );
-      if ( H5_SetID_NPar < 0 )   Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/NPar" );
-      H5_Status = H5Dread( H5_SetID_NPar, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, NParList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_NPar );
-   } // if ( ReenablePar ) ... else ...
+//    load data
+      if ( ReenablePar )   for (int t=0; t<NPatchAllLv; t++)   NParList_AllLv[t] = 0;
+      else {
+         H5_SetID_NPar = H5Dopen( H5_FileID, "Tree/NPar", H5P_DEFAULT );
+         if ( H5_SetID_NPar < 0 )   Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", "Tree/NPar" );
+         H5_Status = H5Dread( H5_SetID_NPar, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, NParList_AllLv );
+         H5_Status = H5Dclose( H5_SetID_NPar );
+      } // if ( ReenablePar ) ... else ...
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading particle counts ... done\n" );
-#  endif // #ifdef PARTICLE
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading particle counts ... done\n" );
+#     endif // #ifdef PARTICLE
 
 
-   H5_Status = H5Fclose( H5_FileID );
+      H5_Status = H5Fclose( H5_FileID );
+   } // if ( OPT__RESTART_PARALLEL ) ... else ...
 
 
 // 2-5. initialize particle variables
@@ -556,15 +595,21 @@ void Init_ByRestart_HDF5( const char *FileName )
 #  ifdef LOAD_BALANCE
    NParThisRank = 0;
 
-   for (int lv=0; lv<KeyInfo.NLevel; lv++)
-   for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t++)
+   if ( OPT__RESTART_PARALLEL )
+      for (int t=0; t<NPatchInList; t++)  NParThisRank += NParList_AllLv[t];
+
+   else
    {
-#     ifdef DEBUG_HDF5
-      if ( t < 0  ||  t >= NPatchTotal[lv] )
-         Aux_Error( ERROR_INFO, "incorrect load index (%d) !!\n", t );
-#     endif
+      for (int lv=0; lv<KeyInfo.NLevel; lv++)
+      for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t++)
+      {
+#        ifdef DEBUG_HDF5
+         if ( t < 0  ||  t >= NPatchTotal[lv] )
+            Aux_Error( ERROR_INFO, "incorrect load index (%d) !!\n", t );
+#        endif
 
-      NParThisRank += NParList_AllLv[ LBIdxList_EachLv_IdxTable[lv][t] + GID_LvStart[lv] ];
+         NParThisRank += NParList_AllLv[ LBIdxList_EachLv_IdxTable[lv][t] + GID_LvStart[lv] ];
+      }
    }
 
 #  ifdef DEBUG_HDF5
@@ -592,16 +637,20 @@ void Init_ByRestart_HDF5( const char *FileName )
 
 
 // 2-5-3. calculate the starting global particle indices (i.e., GParID_Offset) for all patches
-   long *GParID_Offset = new long [ NPatchAllLv ];
+//        --> already set by LoadTree_Parallel() with OPT__RESTART_PARALLEL
+   if ( ! OPT__RESTART_PARALLEL )
+   {
+      GParID_Offset = new long [ NPatchAllLv ];
 
-   GParID_Offset[0] = 0;
-   for (int t=1; t<NPatchAllLv; t++)   GParID_Offset[t] = GParID_Offset[t-1] + NParList_AllLv[t-1];
+      GParID_Offset[0] = 0;
+      for (int t=1; t<NPatchAllLv; t++)   GParID_Offset[t] = GParID_Offset[t-1] + NParList_AllLv[t-1];
 
-#  ifdef DEBUG_HDF5
-   if ( GParID_Offset[ NPatchAllLv-1 ] + NParList_AllLv[ NPatchAllLv-1 ] != amr->Par->NPar_Active_AllRank )
-      Aux_Error( ERROR_INFO, "total number of particles (%ld) != expect (%ld) !!\n",
-                 GParID_Offset[ NPatchAllLv-1 ] + NParList_AllLv[ NPatchAllLv-1 ], amr->Par->NPar_Active_AllRank );
-#  endif
+#     ifdef DEBUG_HDF5
+      if ( GParID_Offset[ NPatchAllLv-1 ] + NParList_AllLv[ NPatchAllLv-1 ] != amr->Par->NPar_Active_AllRank )
+         Aux_Error( ERROR_INFO, "total number of particles (%ld) != expect (%ld) !!\n",
+                    GParID_Offset[ NPatchAllLv-1 ] + NParList_AllLv[ NPatchAllLv-1 ], amr->Par->NPar_Active_AllRank );
+#     endif
+   }
 
 
 // 2-5-4. get the maximum number of particles in one patch and allocate an I/O buffer accordingly
@@ -609,7 +658,7 @@ void Init_ByRestart_HDF5( const char *FileName )
    long *NewParList       = NULL;
    real_par **ParBuf      = NULL;
 
-   for (int t=0; t<NPatchAllLv; t++)   MaxNParInOnePatch = MAX( MaxNParInOnePatch, NParList_AllLv[t] );
+   for (int t=0; t<NPatchInList; t++)  MaxNParInOnePatch = MAX( MaxNParInOnePatch, NParList_AllLv[t] );
 
    NewParList = new long [MaxNParInOnePatch];
 
@@ -652,10 +701,8 @@ void Init_ByRestart_HDF5( const char *FileName )
    hid_t   H5_SetID_ParData[PAR_NATT_STORED], H5_SpaceID_ParData, H5_GroupID_Particle;
 #  else
 // define useless variables when PARTICLE is off
-   int       *NParList_AllLv     = NULL;
    real_par **ParBuf             = NULL;
    long      *NewParList         = NULL;
-   long      *GParID_Offset      = NULL;
    hid_t     *H5_SetID_ParData   = NULL;
    hid_t      H5_SpaceID_ParData = NULL_INT;
    long       NParThisRank       = NULL_INT;
@@ -722,10 +769,12 @@ void Init_ByRestart_HDF5( const char *FileName )
 #  endif
 
 
-// load data with RESTART_LOAD_NRANK ranks at a time
-   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+// load data with RESTART_LOAD_NRANK ranks at a time (or with all ranks at once when enabling OPT__RESTART_PARALLEL)
+   const int LoadNRank = ( OPT__RESTART_PARALLEL ) ? MPI_NRank : RESTART_LOAD_NRANK;
+
+   for (int TRanks=0; TRanks<MPI_NRank; TRanks+=LoadNRank)
    {
-      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+LoadNRank )
       {
 //       3-3. open the target datasets just once
          H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
@@ -772,27 +821,41 @@ void Init_ByRestart_HDF5( const char *FileName )
          {
             if ( MPI_Rank == TRanks )
             Aux_Message( stdout, "      Loading ranks %4d -- %4d, lv %2d ... ",
-                         TRanks, MIN(TRanks+RESTART_LOAD_NRANK-1, MPI_NRank-1), lv );
+                         TRanks, MIN(TRanks+LoadNRank-1, MPI_NRank-1), lv );
 
-//          loop over all target LBIdx
-            for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t+=8)
+//          loop over all target patches already sorted by LoadTree_Parallel()
+            if ( OPT__RESTART_PARALLEL )
             {
-#              ifdef DEBUG_HDF5
-               if ( t < 0  ||  t >= NPatchTotal[lv]  ||  t%8 != 0 )
-                 Aux_Error( ERROR_INFO, "incorrect load index (%d) !!\n", t );
-#              endif
-
-//             make sure that we load patch from LocalID == 0
-               GID0 = LBIdxList_EachLv_IdxTable[lv][t] - LBIdxList_EachLv_IdxTable[lv][t]%8 + GID_LvStart[lv];
-
-               for (int GID=GID0; GID<GID0+8; GID++)
-                  LoadOnePatch( H5_FileID, lv, GID, Recursive_No, NULL, CrList_AllLv,
+               for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t++)
+                  LoadOnePatch( H5_FileID, lv, GIDList_Load[t], t, Recursive_No, NULL, CrList_AllLv,
                                 H5_SetID_Field, H5_SpaceID_Field, H5_MemID_Field,
                                 H5_SetID_FCMag, H5_SpaceID_FCMag, H5_MemID_FCMag,
                                 NParList_AllLv, ParBuf, NewParList, H5_SetID_ParData, H5_SpaceID_ParData,
                                 GParID_Offset, NParThisRank );
             }
 
+//          loop over all target LBIdx
+            else
+            {
+               for (int t=LoadIdx_Start[lv]; t<LoadIdx_Stop[lv]; t+=8)
+               {
+#                 ifdef DEBUG_HDF5
+                  if ( t < 0  ||  t >= NPatchTotal[lv]  ||  t%8 != 0 )
+                    Aux_Error( ERROR_INFO, "incorrect load index (%d) !!\n", t );
+#                 endif
+
+//                make sure that we load patch from LocalID == 0
+                  GID0 = LBIdxList_EachLv_IdxTable[lv][t] - LBIdxList_EachLv_IdxTable[lv][t]%8 + GID_LvStart[lv];
+
+                  for (int GID=GID0; GID<GID0+8; GID++)
+                     LoadOnePatch( H5_FileID, lv, GID, GID, Recursive_No, NULL, CrList_AllLv,
+                                   H5_SetID_Field, H5_SpaceID_Field, H5_MemID_Field,
+                                   H5_SetID_FCMag, H5_SpaceID_FCMag, H5_MemID_FCMag,
+                                   NParList_AllLv, ParBuf, NewParList, H5_SetID_ParData, H5_SpaceID_ParData,
+                                   GParID_Offset, NParThisRank );
+               }
+            } // if ( OPT__RESTART_PARALLEL ) ... else ...
+
 //          check if LocalID matches corner
 #           ifdef DEBUG_HDF5
             const int PatchScale = PS1*amr->scale[lv];
@@ -841,7 +904,7 @@ void Init_ByRestart_HDF5( const char *FileName )
             if (  CrList_AllLv[GID][0] >= TRange_Min[0]  &&  CrList_AllLv[GID][0] < TRange_Max[0]  &&
                   CrList_AllLv[GID][1] >= TRange_Min[1]  &&  CrList_AllLv[GID][1] < TRange_Max[1]  &&
                   CrList_AllLv[GID][2] >= TRange_Min[2]  &&  CrList_AllLv[GID][2] < TRange_Max[2]     )
-               LoadOnePatch( H5_FileID, 0, GID, Recursive_Yes, SonList_AllLv, CrList_AllLv,
+               LoadOnePatch( H5_FileID, 0, GID, GID, Recursive_Yes, SonList_AllLv, CrList_AllLv,
                              H5_SetID_Field, H5_SpaceID_Field, H5_MemID_Field,
                              H5_SetID_FCMag, H5_SpaceID_FCMag, H5_MemID_FCMag,
                              NParList_AllLv, ParBuf, NewParList, H5_SetID_ParData, H5_SpaceID_ParData,
@@ -865,10 +928,10 @@ void Init_ByRestart_HDF5( const char *FileName )
 #        endif
 
          H5_Status = H5Fclose( H5_FileID );
-      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+RESTART_LOAD_NRANK )
+      } // if ( MPI_Rank >= TRanks  &&  MPI_Rank < TRanks+LoadNRank )
 
       MPI_Barrier( MPI_COMM_WORLD );
-   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
+   } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=LoadNRank)
 
 // free HDF5 objects
    H5_Status = H5Sclose( H5_SpaceID_Field );
@@ -946,6 +1009,7 @@ void Init_ByRestart_HDF5( const char *FileName )
 #  ifdef LOAD_BALANCE
    delete [] LBIdxList_AllLv;
    for (int lv=0; lv<NLEVEL; lv++)  delete [] LBIdxList_EachLv_IdxTable[lv];
+   delete [] GIDList_Load;
 #  else
    delete [] SonList_AllLv;
 #  endif
@@ -981,14 +1045,15 @@ void Init_ByRestart_HDF5( const char *FileName )
    const bool   SendGridData_No   = false;
    const bool   ResetLB_Yes       = true;
    const bool   ResetLB_No        = false;
+   const bool   KeepCutPoint_No   = false;
    const int    AllLv             = -1;
 
-   LB_Init_LoadBalance( Redistribute_No,  SendGridData_No,  ParWeight_Zero,      ResetLB_No,  OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+   LB_Init_LoadBalance( Redistribute_No,  SendGridData_No,  ParWeight_Zero,      ResetLB_No,  OPT__SORT_PATCH_BY_LBIDX,  KeepCutPoint_No, AllLv );
 
 // redistribute patches again if we want to take into account the load-balance weighting of particles
 #  ifdef PARTICLE
    if ( amr->LB->Par_Weight > 0.0  &&  !ReenablePar )
-   LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, amr->LB->Par_Weight, ResetLB_Yes, OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+   LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, amr->LB->Par_Weight, ResetLB_Yes, OPT__SORT_PATCH_BY_LBIDX,  KeepCutPoint_No, AllLv );
 #  endif
 
 
@@ -1221,6 +1286,9 @@ herr_t LoadField( const char *FieldName, void *FieldPtr, const hid_t H5_SetID_Ta
 // Parameter   :  H5_FileID          : HDF5 file ID of the restart file
 //                lv                 : Target level
 //                GID                : Target GID
+//                LoadIdx            : Index of the target patch in CrList, NParList, and GParID_Offset
+//                                     --> Equal to GID except when enabling OPT__RESTART_PARALLEL, for which
+//                                         these lists only store the patches loaded by this rank
 //                Recursive          : Find all children (and childrens' children, ...) recuresively
 //                SonList            : List of son indices
 //                                     --> Set only when LOAD_BALANCE is not defined
@@ -1248,7 +1316,7 @@ herr_t LoadField( const char *FieldName, void *FieldPtr, const hid_t H5_SetID_Ta
 //                GParID_Offset      : Starting global particle indices for all patches
 //                NParThisRank       : Total number of particles in this rank (for check only)
 //-------------------------------------------------------------------------------------------------------
-void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const bool Recursive,
+void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const int LoadIdx, const bool Recursive,
                    const int *SonList, const int (*CrList)[3],
                    const hid_t *H5_SetID_Field, const hid_t H5_SpaceID_Field, const hid_t H5_MemID_Field,
                    const hid_t *H5_SetID_FCMag, const hid_t *H5_SpaceID_FCMag, const hid_t *H5_MemID_FCMag,
@@ -1266,7 +1334,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
    int     SonGID0, PID;
 
 // allocate patch
-   amr->pnew( lv, CrList[GID][0], CrList[GID][1], CrList[GID][2], -1, WithData_Yes, WithData_Yes, WithData_Yes );
+   amr->pnew( lv, CrList[LoadIdx][0], CrList[LoadIdx][1], CrList[LoadIdx][2], -1, WithData_Yes, WithData_Yes, WithData_Yes );
 
    PID = amr->num[lv] - 1;
 
@@ -1288,9 +1356,10 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 
 // load cell-centered intrinsic variables from disk
 // --> excluding all derived variables such as gravitational potential and cell-centered B field
+// --> HDF5 converts the data to the precision of the patch data (i.e., real_store) automatically
    for (int v=0; v<NCOMP_TOTAL; v++)
    {
-      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT,
+      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL_STORE, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT,
                            amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v] );
       if ( H5_Status < 0 )
          Aux_Error( ERROR_INFO, "failed to load a field variable (lv %d, GID %d, v %d) !!\n", lv, GID, v );
@@ -1325,7 +1394,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 
 // load particle data
 #  ifdef PARTICLE
-   const int NParThisPatch = NParList[GID];
+   const int NParThisPatch = NParList[LoadIdx];
 
    hsize_t     H5_Offset_ParData[1], H5_Count_ParData[1], H5_MemDims_ParData[1];
    hid_t       H5_MemID_ParData;
@@ -1341,7 +1410,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 #     endif
 
 //    determine the memory space and the subset of dataspace for particle data
-      H5_Offset_ParData [0] = GParID_Offset[GID];
+      H5_Offset_ParData [0] = GParID_Offset[LoadIdx];
       H5_Count_ParData  [0] = NParThisPatch;
       H5_MemDims_ParData[0] = NParThisPatch;
 
@@ -1393,7 +1462,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 //    free resource
       H5_Status = H5Sclose( H5_MemID_ParData );
 
-   } // if ( NParList[GID] > 0 )
+   } // if ( NParThisPatch > 0 )
 #  endif // #ifdef PARTICLE
 
 
@@ -1407,7 +1476,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
       if ( SonGID0 != -1 )
       {
          for (int SonGID=SonGID0; SonGID<SonGID0+8; SonGID++)
-            LoadOnePatch( H5_FileID, lv+1, SonGID, Recursive, SonList, CrList,
+            LoadOnePatch( H5_FileID, lv+1, SonGID, SonGID, Recursive, SonList, CrList,
                           H5_SetID_Field, H5_SpaceID_Field, H5_MemID_Field,
                           H5_SetID_FCMag, H5_SpaceID_FCMag, H5_MemID_FCMag,
                           NParList, ParBuf, NewParList, H5_SetID_ParData, H5_SpaceID_ParData,
@@ -1418,6 +1487,341 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 } // FUNCTION : LoadOnePatch
 
 
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadTree_Parallel
+// Description :  Load the tree information (corner, load-balance index, and particle count) of the patches
+//                to be loaded by this rank when enabling OPT__RESTART_PARALLEL
+//
+// Note        :  1. Each rank reads only a contiguous slice of the tree datasets on each level instead of
+//                   the entire tree
+//                   --> Slices are aligned with patch groups and are sorted by MPI rank
+//                2. Tree records are redistributed to their home ranks by MPI_Alltoallv() after setting the
+//                   load-balance cut points
+//                3. Patches received by each rank are sorted by level and then by LBIdx, which is the same
+//                   order adopted by the serial restart
+//                4. Starting global particle indices are computed by MPI_Exscan() since no rank holds the
+//                   particle counts of all patches
+//                5. Output arrays are allocated here and must be deallocated by the caller
+//
+// Parameter   :  FileName      : Restart file name
+//                NLv           : Number of AMR levels stored in the restart file
+//                NLvRescale    : Rescale factor of the patch corners (necessary when NLv != NLEVEL)
+//                GID_LvStart   : Starting GID on each level
+//                ReenablePar   : Whether or not the restart file has no particle data
+//                NPatchInList  : Number of patches loaded by this rank
+//                GIDList       : GIDs of the patches loaded by this rank
+//                CrList        : Corners of the patches loaded by this rank
+//                NParList      : Particle counts of the patches loaded by this rank (PARTICLE only)
+//                GParID_Offset : Starting global particle indices of the patches loaded by this rank (PARTICLE only)
+//                LoadIdx_Start : Index of the first patch on each level in the above lists
+//                LoadIdx_Stop  : Index of the last patch on each level in the above lists + 1
+//
+// Return      :  NPatchInList, GIDList, CrList, NParList, GParID_Offset, LoadIdx_Start, LoadIdx_Stop
+//-------------------------------------------------------------------------------------------------------
+void LoadTree_Parallel( const char *FileName, const int NLv, const int NLvRescale,
+                        const int *GID_LvStart, const bool ReenablePar, int &NPatchInList, int *&GIDList,
+                        int (*&CrList)[3], int *&NParList, long *&GParID_Offset,
+                        int *LoadIdx_Start, int *LoadIdx_Stop )
+{
+
+   const int NRec = 8;     // number of elements in each tree record: lv, GID, LBIdx, corner[3], NPar, GParID_Offset
+
+
+// 1. load the tree slice of this rank
+// 1-1. set the target slice on each level
+   int Slice_Start[NLEVEL], Slice_NPatch[NLEVEL], Slice_Disp[NLEVEL], Slice_NPatchAllLv=0;
+
+   for (int lv=0; lv<NLv; lv++)
+   {
+      const long NPG      = NPatchTotal[lv] / 8;
+      const long PG_Start = NPG*(MPI_Rank  )/MPI_NRank;
+      const long PG_Stop  = NPG*(MPI_Rank+1)/MPI_NRank;
+
+      Slice_Start [lv]   = GID_LvStart[lv] + 8*PG_Start;
+      Slice_NPatch[lv]   = 8*( PG_Stop - PG_Start );
+      Slice_Disp  [lv]   = Slice_NPatchAllLv;
+      Slice_NPatchAllLv += Slice_NPatch[lv];
+   }
+
+   long *Slice_LBIdx     = new long [ Slice_NPatchAllLv ];
+   int (*Slice_Cr)[3]    = new int  [ Slice_NPatchAllLv ][3];
+   int  *Slice_NPar      = new int  [ Slice_NPatchAllLv ];
+   int  *Slice_Rank      = new int  [ Slice_NPatchAllLv ];
+   long *Slice_GParID    = new long [ Slice_NPatchAllLv ];
+
+   for (int t=0; t<Slice_NPatchAllLv; t++)   Slice_NPar[t] = 0;
+
+
+// 1-2. load data
+//      --> select the slices on all levels at once so that each dataset requires only one H5Dread()
+#  ifdef PARTICLE
+   const int   NSet          = ( ReenablePar ) ? 2 : 3;
+#  else
+   const int   NSet          = 2;
+#  endif
+   const char *SetName  [3]  = { "Tree/LBIdx", "Tree/Corner", "Tree/NPar" };
+   const hid_t SetType  [3]  = { H5T_NATIVE_LONG, H5T_NATIVE_INT, H5T_NATIVE_INT };
+   void       *SetBuf   [3]  = { Slice_LBIdx, Slice_Cr, Slice_NPar };
+
+   hid_t   H5_FileID, H5_SetID, H5_SpaceID, H5_MemID;
+   herr_t  H5_Status;
+   hsize_t H5_Offset[2], H5_Count[2];
+
+   H5_FileID = H5Fopen( FileName, H5F_ACC_RDONLY, H5P_DEFAULT );
+   if ( H5_FileID < 0 )
+      Aux_Error( ERROR_INFO, "failed to open the restart HDF5 file \"%s\" !!\n", FileName );
+
+   for (int s=0; s<NSet; s++)
+   {
+      if ( Slice_NPatchAllLv == 0 )    break;
+
+      H5_SetID = H5Dopen( H5_FileID, SetName[s], H5P_DEFAULT );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", SetName[s] );
+
+      H5_SpaceID = H5Dget_space( H5_SetID );
+      H5_Status  = H5Sselect_none( H5_SpaceID );
+
+      for (int lv=0; lv<NLv; lv++)
+      {
+         if ( Slice_NPatch[lv] == 0 )  continue;
+
+         H5_Offset[0] = Slice_Start [lv];
+         H5_Offset[1] = 0;
+         H5_Count [0] = Slice_NPatch[lv];
+         H5_Count [1] = 3;
+
+         H5_Status = H5Sselect_hyperslab( H5_SpaceID, H5S_SELECT_OR, H5_Offset, NULL, H5_Count, NULL );
+         if ( H5_Status < 0 )
+            Aux_Error( ERROR_INFO, "failed to select the slice of the dataset \"%s\" on level %d !!\n", SetName[s], lv );
+      }
+
+      H5_Count[0] = Slice_NPatchAllLv;
+      H5_Count[1] = 3;
+      H5_MemID    = H5Screate_simple( (s==1)?2:1, H5_Count, NULL );
+
+      H5_Status = H5Dread( H5_SetID, SetType[s], H5_MemID, H5_SpaceID, H5P_DEFAULT, SetBuf[s] );
+      if ( H5_Status < 0 )
+         Aux_Error( ERROR_INFO, "failed to load the dataset \"%s\" !!\n", SetName[s] );
+
+      H5_Status = H5Sclose( H5_MemID );
+      H5_Status = H5Sclose( H5_SpaceID );
+      H5_Status = H5Dclose( H5_SetID );
+   }
+
+   H5_Status = H5Fclose( H5_FileID );
+
+
+// 2. set the load-balance cut points
+//    --> gather the LBIdx of each **patch group** to the root rank since LB_SetCutPoint() only uses LBIdx0_AllRank there
+   const bool   InputLBIdx0AndLoad_Yes = true;
+   const double ParWeight_Zero         = 0.0;  // do NOT consider load-balance weighting of particles
+
+   int *Gather_NPG   = new int [MPI_NRank];
+   int *Gather_Disp  = new int [MPI_NRank];
+
+   for (int lv=0; lv<NLv; lv++)
+   {
+      const int NPG_Slice = Slice_NPatch[lv] / 8;
+      long   *LBIdx0_Slice   = new long [NPG_Slice];
+      long   *LBIdx0_AllRank = NULL;
+      double *Load_AllRank   = NULL;
+
+      for (int t=0; t<NPG_Slice; t++)
+      {
+         LBIdx0_Slice[t]  = Slice_LBIdx[ Slice_Disp[lv] + t*8 ];
+         LBIdx0_Slice[t] -= LBIdx0_Slice[t] % 8;
+      }
+
+      MPI_Gather( &NPG_Slice, 1, MPI_INT, Gather_NPG, 1, MPI_INT, 0, MPI_COMM_WORLD );
+
+      if ( MPI_Rank == 0 )
+      {
+         LBIdx0_AllRank = new long   [ NPatchTotal[lv] / 8 ];
+         Load_AllRank   = new double [ NPatchTotal[lv] / 8 ];
+
+         Gather_Disp[0] = 0;
+         for (int r=1; r<MPI_NRank; r++)  Gather_Disp[r] = Gather_Disp[r-1] + Gather_NPG[r-1];
+
+         for (int t=0; t<NPatchTotal[lv]/8; t++)   Load_AllRank[t] = 8.0;   // assuming all patches have the same weighting == 1.0
+      }
+
+      MPI_Gatherv( LBIdx0_Slice, NPG_Slice, MPI_LONG, LBIdx0_AllRank, Gather_NPG, Gather_Disp, MPI_LONG, 0, MPI_COMM_WORLD );
+
+      LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdx0AndLoad_Yes, LBIdx0_AllRank, Load_AllRank,
+                      ParWeight_Zero );
+
+      delete [] LBIdx0_Slice;
+      delete [] LBIdx0_AllRank;
+      delete [] Load_AllRank;
+   } // for (int lv=0; lv<NLv; lv++)
+
+   delete [] Gather_NPG;
+   delete [] Gather_Disp;
+
+
+// 3. calculate the starting global particle indices of all patches in the slice
+//    --> particles are stored in the order of GID
+   long NPar_Slice[NLEVEL], NPar_Lv[NLEVEL], NPar_Exscan[NLEVEL];
+
+   for (int lv=0; lv<NLv; lv++)
+   {
+      NPar_Slice[lv] = 0;
+      for (int t=Slice_Disp[lv]; t<Slice_Disp[lv]+Slice_NPatch[lv]; t++)   NPar_Slice[lv] += Slice_NPar[t];
+   }
+
+   MPI_Exscan   ( NPar_Slice, NPar_Exscan, NLv, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+   MPI_Allreduce( NPar_Slice, NPar_Lv,     NLv, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+
+// the receive buffer of MPI_Exscan() is undefined on the root rank
+   if ( MPI_Rank == 0 )
+      for (int lv=0; lv<NLv; lv++)  NPar_Exscan[lv] = 0;
+
+   long GParID_Lv = 0;
+
+   for (int lv=0; lv<NLv; lv++)
+   {
+      long GParID = GParID_Lv + NPar_Exscan[lv];
+
+      for (int t=Slice_Disp[lv]; t<Slice_Disp[lv]+Slice_NPatch[lv]; t++)
+      {
+         Slice_GParID[t]  = GParID;
+         GParID          += Slice_NPar[t];
+      }
+
+      GParID_Lv += NPar_Lv[lv];
+   }
+
+
+// 4. send the tree records to their home ranks
+   int  *Send_NCount = new int [MPI_NRank];
+   int  *Recv_NCount = new int [MPI_NRank];
+   int  *Send_Disp   = new int [MPI_NRank];
+   int  *Recv_Disp   = new int [MPI_NRank];
+   int  *Send_Counter= new int [MPI_NRank];
+   long *SendBuf     = new long [ (long)NRec*Slice_NPatchAllLv ];
+   long *RecvBuf     = NULL;
+
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (int lv=0; lv<NLv; lv++)
+   for (int t=Slice_Disp[lv]; t<Slice_Disp[lv]+Slice_NPatch[lv]; t++)
+   {
+      Slice_Rank[t] = LB_Index2Rank( lv, Slice_LBIdx[t], CHECK_ON );
+      Send_NCount[ Slice_Rank[t] ] += NRec;
+   }
+
+   MPI_Alltoall( Send_NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   Send_Disp[0] = 0;
+   Recv_Disp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_Disp[r] = Send_Disp[r-1] + Send_NCount[r-1];
+      Recv_Disp[r] = Recv_Disp[r-1] + Recv_NCount[r-1];
+   }
+
+   const int NRecv_Total = Recv_Disp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1];
+   RecvBuf = new long [NRecv_Total];
+
+   for (int r=0; r<MPI_NRank; r++)  Send_Counter[r] = Send_Disp[r];
+
+   for (int lv=0; lv<NLv; lv++)
+   for (int t=Slice_Disp[lv]; t<Slice_Disp[lv]+Slice_NPatch[lv]; t++)
+   {
+      long *Rec = SendBuf + Send_Counter[ Slice_Rank[t] ];
+
+      Rec[0] = lv;
+      Rec[1] = Slice_Start[lv] + t - Slice_Disp[lv];
+      Rec[2] = Slice_LBIdx[t];
+      Rec[3] = Slice_Cr[t][0];
+      Rec[4] = Slice_Cr[t][1];
+      Rec[5] = Slice_Cr[t][2];
+      Rec[6] = Slice_NPar[t];
+      Rec[7] = Slice_GParID[t];
+
+      Send_Counter[ Slice_Rank[t] ] += NRec;
+   }
+
+   MPI_Alltoallv( SendBuf, Send_NCount, Send_Disp, MPI_LONG, RecvBuf, Recv_NCount, Recv_Disp, MPI_LONG, MPI_COMM_WORLD );
+
+   delete [] Slice_LBIdx;
+   delete [] Slice_Cr;
+   delete [] Slice_NPar;
+   delete [] Slice_Rank;
+   delete [] Slice_GParID;
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+   delete [] Send_Disp;
+   delete [] Recv_Disp;
+   delete [] Send_Counter;
+   delete [] SendBuf;
+
+
+// 5. sort the received patches by level and then by LBIdx
+//    --> patches in the same patch group share the same LBIdx0 and are sorted by their local IDs (i.e., GID%8)
+//        to match the loading order of the serial restart
+   NPatchInList  = NRecv_Total / NRec;
+   GIDList       = new int [NPatchInList];
+   CrList        = new int [NPatchInList][3];
+#  ifdef PARTICLE
+   NParList      = new int  [NPatchInList];
+   GParID_Offset = new long [NPatchInList];
+#  endif
+
+   int  *Rec_Idx = new int  [NPatchInList];
+   long *Rec_Key = new long [NPatchInList];
+   int  *IdxTable= new int  [NPatchInList];
+
+   int NPatchInList_Lv = 0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int Start = NPatchInList_Lv;
+
+      for (int t=0; t<NPatchInList; t++)
+      {
+         const long *Rec = RecvBuf + (long)NRec*t;
+
+         if ( Rec[0] != lv )  continue;
+
+         Rec_Idx[NPatchInList_Lv] = t;
+         Rec_Key[NPatchInList_Lv] = Rec[2] - Rec[2]%8 + Rec[1]%8;
+         NPatchInList_Lv ++;
+      }
+
+      LoadIdx_Start[lv] = Start;
+      LoadIdx_Stop [lv] = NPatchInList_Lv;
+
+      Mis_Heapsort( NPatchInList_Lv-Start, Rec_Key+Start, IdxTable+Start );
+
+      for (int t=Start; t<NPatchInList_Lv; t++)
+      {
+         const long *Rec = RecvBuf + (long)NRec*Rec_Idx[ Start + IdxTable[t] ];
+
+         GIDList[t] = Rec[1];
+         for (int d=0; d<3; d++)    CrList[t][d] = Rec[3+d]*NLvRescale;
+#        ifdef PARTICLE
+         NParList     [t] = Rec[6];
+         GParID_Offset[t] = Rec[7];
+#        endif
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+#  ifdef DEBUG_HDF5
+   if ( NPatchInList_Lv != NPatchInList )
+      Aux_Error( ERROR_INFO, "number of sorted patches (%d) != expect (%d) !!\n", NPatchInList_Lv, NPatchInList );
+#  endif
+
+   delete [] Rec_Idx;
+   delete [] Rec_Key;
+   delete [] IdxTable;
+   delete [] RecvBuf;
+
+} // FUNCTION : LoadTree_Parallel
+#endif // #ifdef LOAD_BALANCE
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Check_Makefile
@@ -1473,6 +1877,7 @@ void Check_Makefile( const char *FileName, const int FormatVersion )
    LoadField( "Timing",                 &RS.Timing,                 SID, TID, NonFatal, &RT.Timing,                 1, NonFatal );
    LoadField( "TimingSolver",           &RS.TimingSolver,           SID, TID, NonFatal, &RT.TimingSolver,           1, NonFatal );
    LoadField( "Float8",                 &RS.Float8,                 SID, TID, NonFatal, &RT.Float8,                 1, NonFatal );
+   LoadField( "Float8_Store",           &RS.Float8_Store,           SID, TID, NonFatal, &RT.Float8_Store,           1, NonFatal );
    LoadField( "Serial",                 &RS.Serial,                 SID, TID, NonFatal, &RT.Serial,                 1, NonFatal );
    LoadField( "LoadBalance",            &RS.LoadBalance,            SID, TID, NonFatal, &RT.LoadBalance,            1, NonFatal );
    LoadField( "OverlapMPI",             &RS.OverlapMPI,             SID, TID, NonFatal, &RT.OverlapMPI,             1, NonFatal );
@@ -1935,6 +2340,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__ReuseMemory",        &RS.Opt__ReuseMemory,        SID, TID, NonFatal, &RT.Opt__ReuseMemory,         1, NonFatal );
    LoadField( "Opt__MemoryPool",         &RS.Opt__MemoryPool,         SID, TID, NonFatal, &RT.Opt__MemoryPool,          1, NonFatal );
+   LoadField( "Opt__PatchSlab",          &RS.Opt__PatchSlab,          SID, TID, NonFatal, &RT.Opt__PatchSlab,           1, NonFatal );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -1943,6 +2349,16 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "LB_Par_Weight",           &RS.LB_Par_Weight,           SID, TID, NonFatal, &RT.LB_Par_Weight,            1, NonFatal );
 #  endif
    LoadField( "Opt__RecordLoadBalance",  &RS.Opt__RecordLoadBalance,  SID, TID, NonFatal, &RT.Opt__RecordLoadBalance,   1, NonFatal );
+   LoadField( "Opt__MPI_Sparse",         &RS.Opt__MPI_Sparse,         SID, TID, NonFatal, &RT.Opt__MPI_Sparse,          1, NonFatal );
+   LoadField( "Opt__MPI_Persistent",     &RS.Opt__MPI_Persistent,     SID, TID, NonFatal, &RT.Opt__MPI_Persistent,      1, NonFatal );
+   LoadField( "Opt__LB_MeasuredCost",    &RS.Opt__LB_MeasuredCost,    SID, TID, NonFatal, &RT.Opt__LB_MeasuredCost,     1, NonFatal );
+   LoadField( "LB_MeasuredCost_Smooth",  &RS.LB_MeasuredCost_Smooth,  SID, TID, NonFatal, &RT.LB_MeasuredCost_Smooth,   1, NonFatal );
+   LoadField( "Opt__LB_Incremental",     &RS.Opt__LB_Incremental,     SID, TID, NonFatal, &RT.Opt__LB_Incremental,      1, NonFatal );
+   LoadField( "Opt__LB_MultiConstraint", &RS.Opt__LB_MultiConstraint, SID, TID, NonFatal, &RT.Opt__LB_MultiConstraint,  1, NonFatal );
+   LoadField( "LB_MC_Tol_Cell",          &RS.LB_MC_Tol_Cell,          SID, TID, NonFatal, &RT.LB_MC_Tol_Cell,           1, NonFatal );
+   LoadField( "LB_MC_Tol_Par",           &RS.LB_MC_Tol_Par,           SID, TID, NonFatal, &RT.LB_MC_Tol_Par,            1, NonFatal );
+   LoadField( "LB_MC_Tol_Time",          &RS.LB_MC_Tol_Time,          SID, TID, NonFatal, &RT.LB_MC_Tol_Time,           1, NonFatal );
+   LoadField( "LB_MC_Tol_Mem",           &RS.LB_MC_Tol_Mem,           SID, TID, NonFatal, &RT.LB_MC_Tol_Mem,            1, NonFatal );
 #  endif
    LoadField( "Opt__MinimizeMPIBarrier", &RS.Opt__MinimizeMPIBarrier, SID, TID, NonFatal, &RT.Opt__MinimizeMPIBarrier,  1, NonFatal );
 
@@ -1979,6 +2395,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 // fluid solvers in both HYDRO/ELBDM
    LoadField( "Flu_GPU_NPGroup",         &RS.Flu_GPU_NPGroup,         SID, TID, NonFatal, &RT.Flu_GPU_NPGroup,          1, NonFatal );
    LoadField( "GPU_NStream",             &RS.GPU_NStream,             SID, TID, NonFatal, &RT.GPU_NStream,              1, NonFatal );
+   LoadField( "Opt__AutoNPGroup",        &RS.Opt__AutoNPGroup,        SID, TID, NonFatal, &RT.Opt__AutoNPGroup,         1, NonFatal );
    LoadField( "Opt__FixUp_Flux",         &RS.Opt__FixUp_Flux,         SID, TID, NonFatal, &RT.Opt__FixUp_Flux,          1, NonFatal );
    LoadField( "FixUpFlux_Var",           &RS.FixUpFlux_Var,           SID, TID, NonFatal, &RT.FixUpFlux_Var,            1, NonFatal );
 #  ifdef MHD
@@ -1994,6 +2411,9 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "IntFracPassive_NVar",     &RS.IntFracPassive_NVar,     SID, TID, NonFatal, &RT.IntFracPassive_NVar,      1, NonFatal );
    LoadField( "IntFracPassive_VarIdx",    RS.IntFracPassive_VarIdx,   SID, TID, NonFatal,  RT.IntFracPassive_VarIdx,   NP, NonFatal );
    LoadField( "Opt__OverlapMPI",         &RS.Opt__OverlapMPI,         SID, TID, NonFatal, &RT.Opt__OverlapMPI,          1, NonFatal );
+   LoadField( "Opt__CPU_Pipeline",       &RS.Opt__CPU_Pipeline,       SID, TID, NonFatal, &RT.Opt__CPU_Pipeline,        1, NonFatal );
+   LoadField( "Opt__PrepCache",          &RS.Opt__PrepCache,          SID, TID, NonFatal, &RT.Opt__PrepCache,           1, NonFatal );
+   LoadField( "PrepCache_MaxMB",         &RS.PrepCache_MaxMB,         SID, TID, NonFatal, &RT.PrepCache_MaxMB,          1, NonFatal );
    LoadField( "Opt__ResetFluid",         &RS.Opt__ResetFluid,         SID, TID, NonFatal, &RT.Opt__ResetFluid,          1, NonFatal );
    LoadField( "Opt__ResetFluidInit",     &RS.Opt__ResetFluidInit,     SID, TID, NonFatal, &RT.Opt__ResetFluidInit,      1, NonFatal );
    LoadField( "Opt__FreezeFluid",        &RS.Opt__FreezeFluid,        SID, TID, NonFatal, &RT.Opt__FreezeFluid,         1, NonFatal );
@@ -2019,12 +2439,17 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "SOR_Omega",               &RS.SOR_Omega,               SID, TID, NonFatal, &RT.SOR_Omega,                1, NonFatal );
    LoadField( "SOR_MaxIter",             &RS.SOR_MaxIter,             SID, TID, NonFatal, &RT.SOR_MaxIter,              1, NonFatal );
    LoadField( "SOR_MinIter",             &RS.SOR_MinIter,             SID, TID, NonFatal, &RT.SOR_MinIter,              1, NonFatal );
+   LoadField( "SOR_ToleratedError",      &RS.SOR_ToleratedError,      SID, TID, NonFatal, &RT.SOR_ToleratedError,       1, NonFatal );
 #  elif ( POT_SCHEME == MG )
    LoadField( "MG_MaxIter",              &RS.MG_MaxIter,              SID, TID, NonFatal, &RT.MG_MaxIter,               1, NonFatal );
    LoadField( "MG_NPreSmooth",           &RS.MG_NPreSmooth,           SID, TID, NonFatal, &RT.MG_NPreSmooth,            1, NonFatal );
    LoadField( "MG_NPostSmooth",          &RS.MG_NPostSmooth,          SID, TID, NonFatal, &RT.MG_NPostSmooth,           1, NonFatal );
    LoadField( "MG_ToleratedError",       &RS.MG_ToleratedError,       SID, TID, NonFatal, &RT.MG_ToleratedError,        1, NonFatal );
 #  endif
+   LoadField( "Opt__Pot_Level_MG",       &RS.Opt__Pot_Level_MG,       SID, TID, NonFatal, &RT.Opt__Pot_Level_MG,        1, NonFatal );
+   LoadField( "Pot_Level_MG_MaxIter",    &RS.Pot_Level_MG_MaxIter,    SID, TID, NonFatal, &RT.Pot_Level_MG_MaxIter,     1, NonFatal );
+   LoadField( "Pot_Level_MG_ToleratedError", &RS.Pot_Level_MG_ToleratedError, SID, TID, NonFatal, &RT.Pot_Level_MG_ToleratedError, 1, NonFatal );
+   LoadField( "Opt__Pot_WarmStart",      &RS.Opt__Pot_WarmStart,      SID, TID, NonFatal, &RT.Opt__Pot_WarmStart,       1, NonFatal );
    LoadField( "Pot_GPU_NPGroup",         &RS.Pot_GPU_NPGroup,         SID, TID, NonFatal, &RT.Pot_GPU_NPGroup,          1, NonFatal );
    LoadField( "Opt__GraP5Gradient",      &RS.Opt__GraP5Gradient,      SID, TID, NonFatal, &RT.Opt__GraP5Gradient,       1, NonFatal );
    LoadField( "Opt__SelfGravity",        &RS.Opt__SelfGravity,        SID, TID, NonFatal, &RT.Opt__SelfGravity,         1, NonFatal );
@@ -2095,6 +2520,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__Init",               &RS.Opt__Init,               SID, TID, NonFatal, &RT.Opt__Init,                1, NonFatal );
    LoadField( "RestartLoadNRank",        &RS.RestartLoadNRank,        SID, TID, NonFatal, &RT.RestartLoadNRank,         1, NonFatal );
    LoadField( "Opt__RestartReset",       &RS.Opt__RestartReset,       SID, TID, NonFatal, &RT.Opt__RestartReset,        1, NonFatal );
+   LoadField( "Opt__RestartParallel",    &RS.Opt__RestartParallel,    SID, TID, NonFatal, &RT.Opt__RestartParallel,     1, NonFatal );
    LoadField( "Opt__UM_IC_Level",        &RS.Opt__UM_IC_Level,        SID, TID, NonFatal, &RT.Opt__UM_IC_Level,         1, NonFatal );
    LoadField( "Opt__UM_IC_NLevel",       &RS.Opt__UM_IC_NLevel,       SID, TID, NonFatal, &RT.Opt__UM_IC_NLevel,        1, NonFatal );
    LoadField( "Opt__UM_IC_NVar",         &RS.Opt__UM_IC_NVar,         SID, TID, NonFatal, &RT.Opt__UM_IC_NVar,          1, NonFatal );
@@ -2112,6 +2538,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
 #  ifdef SUPPORT_FFTW
    LoadField( "Opt__FFTW_Startup",       &RS.Opt__FFTW_Startup,       SID, TID, NonFatal, &RT.Opt__FFTW_Startup,        1, NonFatal );
+   LoadField( "Opt__FFTW_Pencil",        &RS.Opt__FFTW_Pencil,        SID, TID, NonFatal, &RT.Opt__FFTW_Pencil,         1, NonFatal );
+   LoadField( "Opt__FFTW_Wisdom",        &RS.Opt__FFTW_Wisdom,        SID, TID, NonFatal, &RT.Opt__FFTW_Wisdom,         1, NonFatal );
 #  endif
 
 // interpolation schemes
@@ -2184,6 +2612,12 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__Output_Mode",            &RS.Opt__Output_Mode,            SID, TID, NonFatal, &RT.Opt__Output_Mode,            1, NonFatal );
    LoadField( "Opt__Output_Restart",         &RS.Opt__Output_Restart,         SID, TID, NonFatal, &RT.Opt__Output_Restart,         1, NonFatal );
+   LoadField( "Opt__Output_HDF5_MPIIO",      &RS.Opt__Output_HDF5_MPIIO,      SID, TID, NonFatal, &RT.Opt__Output_HDF5_MPIIO,      1, NonFatal );
+   LoadField( "Opt__Output_HDF5_Compress",   &RS.Opt__Output_HDF5_Compress,   SID, TID, NonFatal, &RT.Opt__Output_HDF5_Compress,   1, NonFatal );
+   LoadField( "Output_HDF5_Deflate_Level",   &RS.Output_HDF5_Deflate_Level,   SID, TID, NonFatal, &RT.Output_HDF5_Deflate_Level,   1, NonFatal );
+   LoadField( "Output_HDF5_Lossy_Digits",    &RS.Output_HDF5_Lossy_Digits,    SID, TID, NonFatal, &RT.Output_HDF5_Lossy_Digits,    1, NonFatal );
+   LoadField( "Opt__Output_HDF5_Async",      &RS.Opt__Output_HDF5_Async,      SID, TID, NonFatal, &RT.Opt__Output_HDF5_Async,      1, NonFatal );
+   LoadField( "Output_HDF5_Async_Max_Mem",   &RS.Output_HDF5_Async_Max_Mem,   SID, TID, NonFatal, &RT.Output_HDF5_Async_Max_Mem,   1, NonFatal );
    LoadField( "Opt__Output_Step",            &RS.Opt__Output_Step,            SID, TID, NonFatal, &RT.Opt__Output_Step,            1, NonFatal );
    LoadField( "Opt__Output_Dt",              &RS.Opt__Output_Dt,              SID, TID, NonFatal, &RT.Opt__Output_Dt,              1, NonFatal );
    LoadField( "Opt__Output_Text_Format_Flt", &RS.Opt__Output_Text_Format_Flt, SID, TID, NonFatal,  RT.Opt__Output_Text_Format_Flt, 1, NonFatal );
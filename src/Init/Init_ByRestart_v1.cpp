@@ -480,9 +480,10 @@ void Init_ByRestart_v1( const char FileName[] )
    const bool   SendGridData_No = false;
    const bool   ResetLB_Yes     = true;
    const bool   ResetLB_No      = false;
+   const bool   KeepCutPoint_No = false;
    const int    AllLv           = -1;
 
-   LB_Init_LoadBalance( Redistribute_No, SendGridData_No, ParWeight_Zero, ResetLB_No, OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+   LB_Init_LoadBalance( Redistribute_No, SendGridData_No, ParWeight_Zero, ResetLB_No, OPT__SORT_PATCH_BY_LBIDX,  KeepCutPoint_No, AllLv );
 
 
 // fill up the data of non-leaf patches
@@ -62,6 +62,10 @@ void Init_ByRestart()
    Aux_Error( ERROR_INFO, "Must adopt FLOAT8_PAR=FLOAT8 for OPT__OUTPUT_TOTAL=2 (C-binary) !!\n" );
 #  endif
 
+#  if ( defined FLOAT8  &&  !defined FLOAT8_STORE )
+   Aux_Error( ERROR_INFO, "Must adopt FLOAT8_STORE=FLOAT8 for OPT__OUTPUT_TOTAL=2 (C-binary) !!\n" );
+#  endif
+
    MPI_Barrier( MPI_COMM_WORLD );
 
 
@@ -712,14 +716,15 @@ void Init_ByRestart()
    const bool   SendGridData_No   = false;
    const bool   ResetLB_Yes       = true;
    const bool   ResetLB_No        = false;
+   const bool   KeepCutPoint_No   = false;
    const int    AllLv             = -1;
 
-   LB_Init_LoadBalance( Redistribute_No,  SendGridData_No,  ParWeight_Zero,      ResetLB_No,  OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+   LB_Init_LoadBalance( Redistribute_No,  SendGridData_No,  ParWeight_Zero,      ResetLB_No,  OPT__SORT_PATCH_BY_LBIDX,  KeepCutPoint_No, AllLv );
 
 // redistribute patches again if we want to take into account the load-balance weighting of particles
 #  ifdef PARTICLE
    if ( amr->LB->Par_Weight > 0.0 )
-   LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, amr->LB->Par_Weight, ResetLB_Yes, OPT__SORT_PATCH_BY_LBIDX,  AllLv );
+   LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, amr->LB->Par_Weight, ResetLB_Yes, OPT__SORT_PATCH_BY_LBIDX,  KeepCutPoint_No, AllLv );
 #  endif
 
 
@@ -3,12 +3,24 @@
 #ifdef SUPPORT_FFTW
 
 static int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
+#if ( SUPPORT_FFTW == FFTW3 )
+static void FFTW_GetWisdomFileName( char *FileName );
+static void FFTW_ImportWisdom( const char *FileName );
+static void FFTW_ExportWisdom( const char *FileName );
+#endif
 
 root_fftw::real_plan_nd FFTW_Plan_PS;                       // PS  : plan for calculating the power spectrum
 #ifdef GRAVITY
 root_fftw::real_plan_nd FFTW_Plan_Poi, FFTW_Plan_Poi_Inv;   // Poi : plan for the self-gravity Poisson solver
 #endif // #ifdef GRAVITY
 
+#ifdef SUPPORT_FFTW_PENCIL
+FFTW_Pencil_t           FFTW_Pencil_PS;                     // pencil decomposition for OPT__FFTW_PENCIL
+#ifdef GRAVITY
+FFTW_Pencil_t           FFTW_Pencil_Poi;
+#endif
+#endif // #ifdef SUPPORT_FFTW_PENCIL
+
 
 
 
@@ -43,6 +55,9 @@ int ComputeTotalSize(int* size) {
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_FFTW
 // Description :  Create the FFTW plans
+//
+// Note        :  1. For OPT__FFTW_WISDOM, the FFTW wisdom is loaded from the file set by FFTW_GetWisdomFileName()
+//                   before creating the plans and saved back to the same file afterwards
 //-------------------------------------------------------------------------------------------------------
 void Init_FFTW()
 {
@@ -133,6 +148,38 @@ void Init_FFTW()
       default:                       Aux_Error( ERROR_INFO, "unrecognised FFTW startup option %d  !!\n", OPT__FFTW_STARTUP );
    } // switch ( OPT__FFTW_STARTUP )
 
+// load the wisdom cached by the previous runs
+// --> skip it for FFTW_ESTIMATE since it is useless and may break BITWISE_REPRODUCIBILITY
+#  if ( SUPPORT_FFTW == FFTW3 )
+   const bool UseWisdom = ( OPT__FFTW_WISDOM  &&  StartupFlag != FFTW_ESTIMATE );
+   char WisdomFile[MAX_STRING];
+
+   if ( UseWisdom )
+   {
+      FFTW_GetWisdomFileName( WisdomFile );
+      FFTW_ImportWisdom( WisdomFile );
+   }
+#  endif
+
+// create the 1D plans of the pencil decomposition instead for OPT__FFTW_PENCIL
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )
+   {
+      Init_FFTW_Pencil( FFTW_Pencil_PS,  PS_FFT_Size,      StartupFlag );
+#     ifdef GRAVITY
+      Init_FFTW_Pencil( FFTW_Pencil_Poi, Gravity_FFT_Size, StartupFlag );
+#     endif
+
+#     if ( SUPPORT_FFTW == FFTW3 )
+      if ( UseWisdom )  FFTW_ExportWisdom( WisdomFile );
+#     endif
+
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+      return;
+   }
+#  endif
+
 // allocate memory for arrays in fftw3
 #  if ( SUPPORT_FFTW == FFTW3 )
    PS   = (real*) root_fftw::fft_malloc(ComputePaddedTotalSize(PS_FFT_Size     ) * sizeof(real));
@@ -156,6 +203,11 @@ void Init_FFTW()
 #  endif // # ifdef GRAVITY
 #  endif // # if ( SUPPORT_FFTW == FFTW3 )
 
+// save the wisdom for the next run
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( UseWisdom )  FFTW_ExportWisdom( WisdomFile );
+#  endif
+
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
@@ -163,6 +215,106 @@ void Init_FFTW()
 
 
 
+#if ( SUPPORT_FFTW == FFTW3 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_GetWisdomFileName
+// Description :  Set the name of the FFTW wisdom file for OPT__FFTW_WISDOM
+//
+// Note        :  1. The wisdom is only valid for the same FFT sizes, number of MPI ranks and OpenMP threads,
+//                   and floating-point precision, all of which are thus encoded into the file name
+//                   --> Runs with different setups never load the wisdom of each other
+//                2. The file is located in the current working directory
+//
+// Parameter   :  FileName : Name of the wisdom file to be returned
+//-------------------------------------------------------------------------------------------------------
+void FFTW_GetWisdomFileName( char *FileName )
+{
+
+#  ifdef OPENMP
+   const int NThread = OMP_NTHREAD;
+#  else
+   const int NThread = 1;
+#  endif
+#  ifdef FLOAT8
+   const char Precision[] = "Double";
+#  else
+   const char Precision[] = "Single";
+#  endif
+
+   sprintf( FileName, "FFTW_Wisdom_NX0_%d_%d_%d_NRank_%d_NThread_%d_%s",
+            NX0_TOT[0], NX0_TOT[1], NX0_TOT[2], MPI_NRank, NThread, Precision );
+
+} // FUNCTION : FFTW_GetWisdomFileName
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_ImportWisdom
+// Description :  Load the FFTW wisdom on rank 0 and broadcast it to all ranks
+//
+// Note        :  1. A missing or invalid wisdom file is ignored and the plans will be created from scratch
+//                2. Must be invoked by all ranks
+//
+// Parameter   :  FileName : Name of the wisdom file
+//-------------------------------------------------------------------------------------------------------
+void FFTW_ImportWisdom( const char *FileName )
+{
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( !Aux_CheckFileExist(FileName) )
+         Aux_Message( stdout, "\nNOTE : FFTW wisdom file \"%s\" does not exist --> create the plans from scratch\n",
+                      FileName );
+
+//    discard any partially imported wisdom
+      else if ( !gamer_fftw::import_wisdom_from_filename(FileName) )
+      {
+         gamer_fftw::forget_wisdom();
+
+         Aux_Message( stderr, "WARNING : failed to import the FFTW wisdom file \"%s\" --> create the plans from scratch !!\n",
+                      FileName );
+      }
+   }
+
+#  ifndef SERIAL
+   gamer_fftw::mpi_broadcast_wisdom( MPI_COMM_WORLD );
+#  endif
+
+} // FUNCTION : FFTW_ImportWisdom
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_ExportWisdom
+// Description :  Gather the FFTW wisdom from all ranks and save it on rank 0
+//
+// Note        :  1. Write to a temporary file first and then rename it so that an interrupted run never leaves
+//                   a truncated wisdom file behind
+//                2. Must be invoked by all ranks
+//
+// Parameter   :  FileName : Name of the wisdom file
+//-------------------------------------------------------------------------------------------------------
+void FFTW_ExportWisdom( const char *FileName )
+{
+
+#  ifndef SERIAL
+   gamer_fftw::mpi_gather_wisdom( MPI_COMM_WORLD );
+#  endif
+
+   if ( MPI_Rank == 0 )
+   {
+      char TempFileName[2*MAX_STRING];
+      sprintf( TempFileName, "%s.tmp", FileName );
+
+      if ( !gamer_fftw::export_wisdom_to_filename(TempFileName)  ||  rename(TempFileName, FileName) != 0 )
+         Aux_Message( stderr, "WARNING : failed to export the FFTW wisdom file \"%s\" !!\n", FileName );
+   }
+
+} // FUNCTION : FFTW_ExportWisdom
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  End_FFTW
 // Description :  Delete the FFTW plans
@@ -172,12 +324,25 @@ void End_FFTW()
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
 
-   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_PS      );
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )
+   {
+      End_FFTW_Pencil( FFTW_Pencil_PS  );
+#     ifdef GRAVITY
+      End_FFTW_Pencil( FFTW_Pencil_Poi );
+#     endif
+   }
+
+   else
+#  endif
+   {
+      root_fftw::destroy_real_plan_nd  ( FFTW_Plan_PS      );
 
-#  ifdef GRAVITY
-   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi     );
-   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi_Inv );
-#  endif // #  ifdef GRAVITY
+#     ifdef GRAVITY
+      root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi     );
+      root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi_Inv );
+#     endif // #  ifdef GRAVITY
+   }
 
 #  if ( SUPPORT_FFTW == FFTW3 )
 #  ifdef OPENMP
@@ -627,11 +792,18 @@ void Slab2Patch( const real *VarS, real *SendBuf, real *RecvBuf, const int SaveS
          PID = List_PID[r][t];
          k   = List_k  [r][t];
 
+//       use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
          if ( TVarIdx < NCOMP_TOTAL )
-            memcpy( amr->patch[SaveSg][0][PID]->fluid[TVarIdx][k], RecvPtr, PSSize*sizeof(real) );
+         {
+            real_store *FluPtr = amr->patch[SaveSg][0][PID]->fluid[TVarIdx][k][0];
+            for (int t=0; t<PSSize; t++)  FluPtr[t] = RecvPtr[t];
+         }
 #        ifdef GRAVITY
          else if ( TVarIdx == NCOMP_TOTAL+NDERIVE ) // TVar == _POTE
-            memcpy( amr->patch[SaveSg][0][PID]->pot[k], RecvPtr, PSSize*sizeof(real) );
+         {
+            real_store *PotPtr = amr->patch[SaveSg][0][PID]->pot[k][0];
+            for (int t=0; t<PSSize; t++)  PotPtr[t] = RecvPtr[t];
+         }
 #        endif
          else
             Aux_Error( ERROR_INFO, "incorrect target variable index %s = %d !!\n", "TVarIdx", TVarIdx );
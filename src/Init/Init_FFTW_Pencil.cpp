@@ -0,0 +1,1231 @@
+#include "GAMER.h"
+
+#ifdef SUPPORT_FFTW_PENCIL
+
+
+static void Pencil_Split( const int N, const int NP, int *List_start );
+static void Pencil_CheckAlignment( const FFTW_Pencil_t &Pencil, real *Var );
+static int  Pencil_GetBlock_PatchSide( const FFTW_Pencil_t &Pencil, PencilBlock_t *&Block );
+static int  Pencil_GetBlock_PencilSide( const FFTW_Pencil_t &Pencil, PencilBlock_t *&Block );
+static void Pencil_SetPartner( PencilSide_t &Side );
+static void Pencil_UpdateExchange( FFTW_Pencil_t &Pencil );
+static void Pencil_SparseExchange( FFTW_Pencil_t &Pencil, const PencilSide_t &SendSide, const PencilSide_t &RecvSide );
+static void Pencil_Alltoallv( FFTW_Pencil_t &Pencil, const MPI_Comm Comm, const int NMember,
+                              const long *Send_NCount, const long *Recv_NCount );
+static void Pencil_Transpose_XY( FFTW_Pencil_t &Pencil, gamer_fftw::fft_complex *cdata, const bool Forward );
+static void Pencil_Transpose_YZ( FFTW_Pencil_t &Pencil, gamer_fftw::fft_complex *cdata, const bool Forward );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_FFTW_Pencil
+// Description :  Set up the 2D pencil decomposition and create the 1D FFTW plans for OPT__FFTW_PENCIL
+//
+// Note        :  1. Invoked by Init_FFTW()
+//                2. All MPI ranks are arranged into a NP[0] x NP[1] grid by MPI_Dims_create()
+//                   --> Up to MIN(N[1],N[0]/2+1)*MIN(N[2],N[1]) ranks can hold data, in contrast to N[2] in the
+//                       slab decomposition
+//                3. A 3D real-to-complex FFT is done by three sets of serial 1D FFTs along x, y, and z, interleaved
+//                   with two transpositions within the rows and columns of the rank grid
+//                   --> See FFTW_Pencil_t in FFTW.h for the data layouts
+//                4. Ranks with no data in any of the three layouts simply skip the corresponding 1D FFTs
+//                5. The root-level patch blocks overlapping with the local x-pencil are fixed and thus recorded here
+//                   --> Their owners and the partner ranks of the patch <-> pencil exchange are set by
+//                       Pencil_UpdateExchange() only after the patches are redistributed
+//                6. The 1D plans are created on a temporary array and executed on other arrays by the new-array
+//                   execute interface (e.g., fftw_execute_dft())
+//                   --> These arrays must have the same alignment as the temporary array (i.e., allocated by
+//                       fft_malloc()), which is checked by FFTW_Pencil_R2C() and FFTW_Pencil_C2R()
+//
+// Parameter   :  Pencil      : FFTW_Pencil_t object to be initialized
+//                FFT_Size    : Size of the FFT operation including the zero-padding regions
+//                StartupFlag : FFTW planner flag
+//-------------------------------------------------------------------------------------------------------
+void Init_FFTW_Pencil( FFTW_Pencil_t &Pencil, const int FFT_Size[], const int StartupFlag )
+{
+
+   for (int d=0; d<3; d++)    Pencil.N[d] = FFT_Size[d];
+
+   const int NxC = Pencil.N[0]/2 + 1;
+
+
+// 1. set up the 2D rank grid and the row/column communicators
+   int Dims[2] = { 0, 0 };
+
+   MPI_Dims_create( MPI_NRank, 2, Dims );
+
+   Pencil.NP   [0] = Dims[0];
+   Pencil.NP   [1] = Dims[1];
+   Pencil.Coord[0] = MPI_Rank % Pencil.NP[0];
+   Pencil.Coord[1] = MPI_Rank / Pencil.NP[0];
+
+   MPI_Comm_split( MPI_COMM_WORLD, Pencil.Coord[1], Pencil.Coord[0], &Pencil.Comm_Row );
+   MPI_Comm_split( MPI_COMM_WORLD, Pencil.Coord[0], Pencil.Coord[1], &Pencil.Comm_Col );
+
+
+// 2. distribute the y/z (kx/ky) coordinates evenly along the rows (columns) of the rank grid
+   Pencil.List_y_start  = new int [ Pencil.NP[0]+1 ];
+   Pencil.List_z_start  = new int [ Pencil.NP[1]+1 ];
+   Pencil.List_kx_start = new int [ Pencil.NP[0]+1 ];
+   Pencil.List_ky_start = new int [ Pencil.NP[1]+1 ];
+
+   Pencil_Split( Pencil.N[1], Pencil.NP[0], Pencil.List_y_start  );
+   Pencil_Split( Pencil.N[2], Pencil.NP[1], Pencil.List_z_start  );
+   Pencil_Split( NxC,         Pencil.NP[0], Pencil.List_kx_start );
+   Pencil_Split( Pencil.N[1], Pencil.NP[1], Pencil.List_ky_start );
+
+   Pencil.local_ny  = Pencil.List_y_start [ Pencil.Coord[0]+1 ] - Pencil.List_y_start [ Pencil.Coord[0] ];
+   Pencil.local_nz  = Pencil.List_z_start [ Pencil.Coord[1]+1 ] - Pencil.List_z_start [ Pencil.Coord[1] ];
+   Pencil.local_nkx = Pencil.List_kx_start[ Pencil.Coord[0]+1 ] - Pencil.List_kx_start[ Pencil.Coord[0] ];
+   Pencil.local_nky = Pencil.List_ky_start[ Pencil.Coord[1]+1 ] - Pencil.List_ky_start[ Pencil.Coord[1] ];
+
+   const long NCplx_X = (long)NxC             *Pencil.local_ny   *Pencil.local_nz;
+   const long NCplx_Y = (long)Pencil.local_nkx*Pencil.N[1]       *Pencil.local_nz;
+   const long NCplx_Z = (long)Pencil.local_nkx*Pencil.local_nky  *Pencil.N[2];
+   const long NCplx   = MAX( MAX( NCplx_X, NCplx_Y ), NCplx_Z );
+
+   Pencil.total_local_size = 2*NCplx;
+
+   if ( MPI_Rank == 0  &&  ( Pencil.NP[0] > MIN(Pencil.N[1],NxC)  ||  Pencil.NP[1] > MIN(Pencil.N[2],Pencil.N[1]) ) )
+      Aux_Message( stderr, "WARNING : some ranks hold no data in the FFT pencil decomposition (rank grid %d x %d, FFT size %d x %d x %d) !!\n",
+                   Pencil.NP[0], Pencil.NP[1], Pencil.N[0], Pencil.N[1], Pencil.N[2] );
+
+
+// 3. allocate the MPI buffers for the transposition
+// --> always allocate at least one element to get a valid pointer for MPI and FFTW
+   Pencil.SendBuf = (gamer_fftw::fft_complex*) root_fftw::fft_malloc( MAX(NCplx,1L)*sizeof(gamer_fftw::fft_complex) );
+   Pencil.RecvBuf = (gamer_fftw::fft_complex*) root_fftw::fft_malloc( MAX(NCplx,1L)*sizeof(gamer_fftw::fft_complex) );
+
+
+// 4. create the in-place 1D plans
+// --> plans with zero transforms are skipped
+   gamer_fftw::fft_complex *Tmp  = (gamer_fftw::fft_complex*) root_fftw::fft_malloc( MAX(NCplx,1L)*sizeof(gamer_fftw::fft_complex) );
+   gamer_fftw::fft_real    *TmpR = (gamer_fftw::fft_real*)Tmp;
+
+   Pencil.Alignment = gamer_fftw::alignment_of( TmpR );
+
+   const int NTrans_X = Pencil.local_ny *Pencil.local_nz;
+   const int NTrans_Y = Pencil.local_nkx*Pencil.local_nz;
+   const int NTrans_Z = Pencil.local_nkx*Pencil.local_nky;
+
+   Pencil.Plan_R2C        = NULL;
+   Pencil.Plan_C2R        = NULL;
+   Pencil.Plan_Y_Forward  = NULL;
+   Pencil.Plan_Y_Backward = NULL;
+   Pencil.Plan_Z_Forward  = NULL;
+   Pencil.Plan_Z_Backward = NULL;
+
+   if ( NTrans_X > 0 )
+   {
+      Pencil.Plan_R2C        = gamer_fftw::plan_many_dft_r2c( 1, Pencil.N+0, NTrans_X, TmpR, NULL, 1, 2*NxC,
+                                                              Tmp,  NULL, 1, NxC, StartupFlag );
+      Pencil.Plan_C2R        = gamer_fftw::plan_many_dft_c2r( 1, Pencil.N+0, NTrans_X, Tmp,  NULL, 1, NxC,
+                                                              TmpR, NULL, 1, 2*NxC, StartupFlag );
+   }
+
+   if ( NTrans_Y > 0 )
+   {
+      Pencil.Plan_Y_Forward  = gamer_fftw::plan_many_dft_c2c( 1, Pencil.N+1, NTrans_Y, Tmp, NULL, 1, Pencil.N[1],
+                                                              Tmp, NULL, 1, Pencil.N[1], FFTW_FORWARD,  StartupFlag );
+      Pencil.Plan_Y_Backward = gamer_fftw::plan_many_dft_c2c( 1, Pencil.N+1, NTrans_Y, Tmp, NULL, 1, Pencil.N[1],
+                                                              Tmp, NULL, 1, Pencil.N[1], FFTW_BACKWARD, StartupFlag );
+   }
+
+   if ( NTrans_Z > 0 )
+   {
+      Pencil.Plan_Z_Forward  = gamer_fftw::plan_many_dft_c2c( 1, Pencil.N+2, NTrans_Z, Tmp, NULL, 1, Pencil.N[2],
+                                                              Tmp, NULL, 1, Pencil.N[2], FFTW_FORWARD,  StartupFlag );
+      Pencil.Plan_Z_Backward = gamer_fftw::plan_many_dft_c2c( 1, Pencil.N+2, NTrans_Z, Tmp, NULL, 1, Pencil.N[2],
+                                                              Tmp, NULL, 1, Pencil.N[2], FFTW_BACKWARD, StartupFlag );
+   }
+
+   root_fftw::fft_free( Tmp );
+
+   if (  ( NTrans_X > 0  &&  ( Pencil.Plan_R2C       == NULL || Pencil.Plan_C2R        == NULL ) )  ||
+         ( NTrans_Y > 0  &&  ( Pencil.Plan_Y_Forward == NULL || Pencil.Plan_Y_Backward == NULL ) )  ||
+         ( NTrans_Z > 0  &&  ( Pencil.Plan_Z_Forward == NULL || Pencil.Plan_Z_Backward == NULL ) )     )
+      Aux_Error( ERROR_INFO, "failed to create the FFTW plans for the pencil decomposition (rank %d) !!\n", MPI_Rank );
+
+
+// 5. record the root-level patch blocks overlapping with the local x-pencil and allocate their MPI buffer
+// --> the patch <-> pencil exchange uses a duplicated communicator to avoid interfering with other messages
+   MPI_Comm_dup( MPI_COMM_WORLD, &Pencil.Comm_Patch );
+
+   PencilSide_t *Side[2] = { &Pencil.PatchSide, &Pencil.PencilSide };
+
+   for (int s=0; s<2; s++)
+   {
+      Side[s]->NBlock   = 0;
+      Side[s]->Block    = NULL;
+      Side[s]->NPartner = 0;
+      Side[s]->Partner  = NULL;
+      Side[s]->NCount   = NULL;
+      Side[s]->Disp     = NULL;
+      Side[s]->NElem    = 0L;
+      Side[s]->Buf      = NULL;
+   }
+
+   Pencil.PencilSide.NBlock = Pencil_GetBlock_PencilSide( Pencil, Pencil.PencilSide.Block );
+
+   for (int t=0; t<Pencil.PencilSide.NBlock; t++)
+   {
+      const PencilBlock_t &B = Pencil.PencilSide.Block[t];
+      Pencil.PencilSide.NElem += (long)( B.z[1] - B.z[0] )*( B.y[1] - B.y[0] )*PS1;
+   }
+
+   Pencil.PencilSide.Buf = new real [ MAX(Pencil.PencilSide.NElem,1L) ];
+   Pencil.PatchReq       = NULL;
+   Pencil.LB_NInit       = -1L;
+
+} // FUNCTION : Init_FFTW_Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  End_FFTW_Pencil
+// Description :  Delete the FFTW plans, communicators, and buffers allocated by Init_FFTW_Pencil()
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object to be freed
+//-------------------------------------------------------------------------------------------------------
+void End_FFTW_Pencil( FFTW_Pencil_t &Pencil )
+{
+
+   if ( Pencil.Plan_R2C        != NULL )   gamer_fftw::destroy_real_plan_1d   ( Pencil.Plan_R2C        );
+   if ( Pencil.Plan_C2R        != NULL )   gamer_fftw::destroy_real_plan_1d   ( Pencil.Plan_C2R        );
+   if ( Pencil.Plan_Y_Forward  != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Y_Forward  );
+   if ( Pencil.Plan_Y_Backward != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Y_Backward );
+   if ( Pencil.Plan_Z_Forward  != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Z_Forward  );
+   if ( Pencil.Plan_Z_Backward != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Z_Backward );
+
+   MPI_Comm_free( &Pencil.Comm_Row );
+   MPI_Comm_free( &Pencil.Comm_Col );
+
+   delete [] Pencil.List_y_start;
+   delete [] Pencil.List_z_start;
+   delete [] Pencil.List_kx_start;
+   delete [] Pencil.List_ky_start;
+
+   root_fftw::fft_free( Pencil.SendBuf );
+   root_fftw::fft_free( Pencil.RecvBuf );
+
+   MPI_Comm_free( &Pencil.Comm_Patch );
+
+   PencilSide_t *Side[2] = { &Pencil.PatchSide, &Pencil.PencilSide };
+
+   for (int s=0; s<2; s++)
+   {
+      delete [] Side[s]->Block;
+      delete [] Side[s]->Partner;
+      delete [] Side[s]->NCount;
+      delete [] Side[s]->Disp;
+      delete [] Side[s]->Buf;
+   }
+
+   delete [] Pencil.PatchReq;
+
+} // FUNCTION : End_FFTW_Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_Pencil_R2C
+// Description :  Forward 3D real-to-complex FFT in the pencil decomposition
+//
+// Note        :  1. Input : x-pencil layout [z][y][2*(N[0]/2+1)] (the last 2 - N[0]%2 elements along x are useless)
+//                   Output: z-pencil layout [kx][ky][z] (complex)
+//                2. Unnormalized as in FFTW
+//                3. Must be invoked by all ranks
+//                4. Var[] must have the same alignment as the array used to create the plans in Init_FFTW_Pencil()
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object initialized by Init_FFTW_Pencil()
+//                Var    : In-place array with at least Pencil.total_local_size elements allocated by fft_malloc()
+//-------------------------------------------------------------------------------------------------------
+void FFTW_Pencil_R2C( FFTW_Pencil_t &Pencil, real *Var )
+{
+
+   Pencil_CheckAlignment( Pencil, Var );
+
+   gamer_fftw::fft_complex *cdata = (gamer_fftw::fft_complex*)Var;
+
+   if ( Pencil.Plan_R2C       != NULL )  gamer_fftw::execute_dft_r2c_1d( Pencil.Plan_R2C, (gamer_fftw::fft_real*)Var, cdata );
+
+   Pencil_Transpose_XY( Pencil, cdata, true );
+
+   if ( Pencil.Plan_Y_Forward != NULL )  gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Y_Forward, cdata, cdata );
+
+   Pencil_Transpose_YZ( Pencil, cdata, true );
+
+   if ( Pencil.Plan_Z_Forward != NULL )  gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Z_Forward, cdata, cdata );
+
+} // FUNCTION : FFTW_Pencil_R2C
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_Pencil_C2R
+// Description :  Backward 3D complex-to-real FFT in the pencil decomposition
+//
+// Note        :  1. Inverse of FFTW_Pencil_R2C(): z-pencil layout (complex) --> x-pencil layout (real)
+//                2. Unnormalized as in FFTW
+//                3. Must be invoked by all ranks
+//                4. Var[] must have the same alignment as the array used to create the plans in Init_FFTW_Pencil()
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object initialized by Init_FFTW_Pencil()
+//                Var    : In-place array with at least Pencil.total_local_size elements allocated by fft_malloc()
+//-------------------------------------------------------------------------------------------------------
+void FFTW_Pencil_C2R( FFTW_Pencil_t &Pencil, real *Var )
+{
+
+   Pencil_CheckAlignment( Pencil, Var );
+
+   gamer_fftw::fft_complex *cdata = (gamer_fftw::fft_complex*)Var;
+
+   if ( Pencil.Plan_Z_Backward != NULL )  gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Z_Backward, cdata, cdata );
+
+   Pencil_Transpose_YZ( Pencil, cdata, false );
+
+   if ( Pencil.Plan_Y_Backward != NULL )  gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Y_Backward, cdata, cdata );
+
+   Pencil_Transpose_XY( Pencil, cdata, false );
+
+   if ( Pencil.Plan_C2R        != NULL )  gamer_fftw::execute_dft_c2r_1d( Pencil.Plan_C2R, cdata, (gamer_fftw::fft_real*)Var );
+
+} // FUNCTION : FFTW_Pencil_C2R
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_Split
+// Description :  Distribute N elements evenly over NP ranks
+//
+// Parameter   :  N          : Number of elements
+//                NP         : Number of ranks
+//                List_start : Starting index of each rank (with List_start[NP] = N)
+//-------------------------------------------------------------------------------------------------------
+void Pencil_Split( const int N, const int NP, int *List_start )
+{
+   for (int p=0; p<=NP; p++)  List_start[p] = int( (long)N*p/NP );
+} // FUNCTION : Pencil_Split
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_CheckAlignment
+// Description :  Check whether the input array has the same alignment as the array used to create the 1D plans
+//
+// Note        :  1. The new-array execute interface requires identical alignment, otherwise FFTW may crash or
+//                   return wrong results silently for SIMD plans
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object initialized by Init_FFTW_Pencil()
+//                Var    : Array to be transformed
+//-------------------------------------------------------------------------------------------------------
+void Pencil_CheckAlignment( const FFTW_Pencil_t &Pencil, real *Var )
+{
+   const int Alignment = gamer_fftw::alignment_of( (gamer_fftw::fft_real*)Var );
+
+   if ( Alignment != Pencil.Alignment )
+      Aux_Error( ERROR_INFO, "alignment of the input array (%d) != alignment of the planning array (%d) --> allocate it by fft_malloc() !!\n",
+                 Alignment, Pencil.Alignment );
+} // FUNCTION : Pencil_CheckAlignment
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_Alltoallv
+// Description :  Exchange the packed Pencil.SendBuf[] to Pencil.RecvBuf[] within a row or column of the rank grid
+//
+// Parameter   :  Pencil      : FFTW_Pencil_t object
+//                Comm        : Pencil.Comm_Row or Pencil.Comm_Col
+//                NMember     : Number of ranks in Comm
+//                Send_NCount : Number of complex elements sent to each rank in Comm
+//                Recv_NCount : Number of complex elements received from each rank in Comm
+//-------------------------------------------------------------------------------------------------------
+void Pencil_Alltoallv( FFTW_Pencil_t &Pencil, const MPI_Comm Comm, const int NMember,
+                       const long *Send_NCount, const long *Recv_NCount )
+{
+
+   int *Send_N    = new int [NMember];
+   int *Recv_N    = new int [NMember];
+   int *Send_Disp = new int [NMember];
+   int *Recv_Disp = new int [NMember];
+
+   long Send_Disp_Long = 0L, Recv_Disp_Long = 0L;
+
+// each complex element is sent as two real elements
+   for (int q=0; q<NMember; q++)
+   {
+      if ( 2L*(Send_Disp_Long+Send_NCount[q]) > __INT_MAX__  ||  2L*(Recv_Disp_Long+Recv_NCount[q]) > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "MPI buffer of the pencil transposition exceeds __INT_MAX__ --> use more MPI processes !!\n" );
+
+      Send_N   [q] = int( 2L*Send_NCount[q] );
+      Recv_N   [q] = int( 2L*Recv_NCount[q] );
+      Send_Disp[q] = int( 2L*Send_Disp_Long );
+      Recv_Disp[q] = int( 2L*Recv_Disp_Long );
+
+      Send_Disp_Long += Send_NCount[q];
+      Recv_Disp_Long += Recv_NCount[q];
+   }
+
+   MPI_Alltoallv( (real*)Pencil.SendBuf, Send_N, Send_Disp, MPI_GAMER_REAL,
+                  (real*)Pencil.RecvBuf, Recv_N, Recv_Disp, MPI_GAMER_REAL, Comm );
+
+   delete [] Send_N;
+   delete [] Recv_N;
+   delete [] Send_Disp;
+   delete [] Recv_Disp;
+
+} // FUNCTION : Pencil_Alltoallv
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_Transpose_XY
+// Description :  Transpose the data between the x-pencil layout [z][y][kx] (with the full kx range) and
+//                the y-pencil layout [z][kx][y] (with the full y range)
+//
+// Note        :  Only ranks in the same row of the rank grid (Pencil.Comm_Row) exchange data
+//
+// Parameter   :  Pencil  : FFTW_Pencil_t object
+//                cdata   : In-place complex array
+//                Forward : true  --> x-pencil to y-pencil
+//                          false --> y-pencil to x-pencil
+//-------------------------------------------------------------------------------------------------------
+void Pencil_Transpose_XY( FFTW_Pencil_t &Pencil, gamer_fftw::fft_complex *cdata, const bool Forward )
+{
+
+   const int  NMember = Pencil.NP[0];
+   const int  NxC     = Pencil.N[0]/2 + 1;
+   const int  Ny      = Pencil.N[1];
+   const int  nz      = Pencil.local_nz;
+   const int  ny      = Pencil.local_ny;
+   const int  nkx     = Pencil.local_nkx;
+   const int *y_start = Pencil.List_y_start;
+   const int *x_start = Pencil.List_kx_start;
+
+   long *Send_NCount = new long [NMember];
+   long *Recv_NCount = new long [NMember];
+   long  Idx         = 0;
+
+
+// 1. pack
+// --> the packed order is always [z][y][kx]
+   for (int q=0; q<NMember; q++)
+   {
+      const int nkx_q = x_start[q+1] - x_start[q];
+      const int ny_q  = y_start[q+1] - y_start[q];
+
+      if ( Forward )
+      {
+         Send_NCount[q] = (long)nz*ny*nkx_q;
+         Recv_NCount[q] = (long)nz*ny_q*nkx;
+
+         for (int k=0; k<nz;    k++)
+         for (int j=0; j<ny;    j++)
+         for (int i=0; i<nkx_q; i++)
+         {
+            const long t = ( (long)k*ny + j )*NxC + x_start[q] + i;
+            c_re( Pencil.SendBuf[Idx] ) = c_re( cdata[t] );
+            c_im( Pencil.SendBuf[Idx] ) = c_im( cdata[t] );
+            Idx ++;
+         }
+      }
+
+      else
+      {
+         Send_NCount[q] = (long)nz*ny_q*nkx;
+         Recv_NCount[q] = (long)nz*ny*nkx_q;
+
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_q; j++)
+         for (int i=0; i<nkx;  i++)
+         {
+            const long t = ( (long)k*nkx + i )*Ny + y_start[q] + j;
+            c_re( Pencil.SendBuf[Idx] ) = c_re( cdata[t] );
+            c_im( Pencil.SendBuf[Idx] ) = c_im( cdata[t] );
+            Idx ++;
+         }
+      }
+   } // for (int q=0; q<NMember; q++)
+
+
+// 2. exchange
+   Pencil_Alltoallv( Pencil, Pencil.Comm_Row, NMember, Send_NCount, Recv_NCount );
+
+
+// 3. unpack
+   Idx = 0;
+
+   for (int q=0; q<NMember; q++)
+   {
+      const int nkx_q = x_start[q+1] - x_start[q];
+      const int ny_q  = y_start[q+1] - y_start[q];
+
+      if ( Forward )
+      {
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_q; j++)
+         for (int i=0; i<nkx;  i++)
+         {
+            const long t = ( (long)k*nkx + i )*Ny + y_start[q] + j;
+            c_re( cdata[t] ) = c_re( Pencil.RecvBuf[Idx] );
+            c_im( cdata[t] ) = c_im( Pencil.RecvBuf[Idx] );
+            Idx ++;
+         }
+      }
+
+      else
+      {
+         for (int k=0; k<nz;    k++)
+         for (int j=0; j<ny;    j++)
+         for (int i=0; i<nkx_q; i++)
+         {
+            const long t = ( (long)k*ny + j )*NxC + x_start[q] + i;
+            c_re( cdata[t] ) = c_re( Pencil.RecvBuf[Idx] );
+            c_im( cdata[t] ) = c_im( Pencil.RecvBuf[Idx] );
+            Idx ++;
+         }
+      }
+   } // for (int q=0; q<NMember; q++)
+
+
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+
+} // FUNCTION : Pencil_Transpose_XY
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_Transpose_YZ
+// Description :  Transpose the data between the y-pencil layout [z][kx][ky] (with the full ky range) and
+//                the z-pencil layout [kx][ky][z] (with the full z range)
+//
+// Note        :  Only ranks in the same column of the rank grid (Pencil.Comm_Col) exchange data
+//
+// Parameter   :  Pencil  : FFTW_Pencil_t object
+//                cdata   : In-place complex array
+//                Forward : true  --> y-pencil to z-pencil
+//                          false --> z-pencil to y-pencil
+//-------------------------------------------------------------------------------------------------------
+void Pencil_Transpose_YZ( FFTW_Pencil_t &Pencil, gamer_fftw::fft_complex *cdata, const bool Forward )
+{
+
+   const int  NMember = Pencil.NP[1];
+   const int  Ny      = Pencil.N[1];
+   const int  Nz      = Pencil.N[2];
+   const int  nz      = Pencil.local_nz;
+   const int  nkx     = Pencil.local_nkx;
+   const int  nky     = Pencil.local_nky;
+   const int *z_start = Pencil.List_z_start;
+   const int *y_start = Pencil.List_ky_start;
+
+   long *Send_NCount = new long [NMember];
+   long *Recv_NCount = new long [NMember];
+   long  Idx         = 0;
+
+
+// 1. pack
+// --> the packed order is always [z][kx][ky]
+   for (int q=0; q<NMember; q++)
+   {
+      const int nky_q = y_start[q+1] - y_start[q];
+      const int nz_q  = z_start[q+1] - z_start[q];
+
+      if ( Forward )
+      {
+         Send_NCount[q] = (long)nz*nkx*nky_q;
+         Recv_NCount[q] = (long)nz_q*nkx*nky;
+
+         for (int k=0; k<nz;    k++)
+         for (int i=0; i<nkx;   i++)
+         for (int j=0; j<nky_q; j++)
+         {
+            const long t = ( (long)k*nkx + i )*Ny + y_start[q] + j;
+            c_re( Pencil.SendBuf[Idx] ) = c_re( cdata[t] );
+            c_im( Pencil.SendBuf[Idx] ) = c_im( cdata[t] );
+            Idx ++;
+         }
+      }
+
+      else
+      {
+         Send_NCount[q] = (long)nz_q*nkx*nky;
+         Recv_NCount[q] = (long)nz*nkx*nky_q;
+
+         for (int k=0; k<nz_q; k++)
+         for (int i=0; i<nkx;  i++)
+         for (int j=0; j<nky;  j++)
+         {
+            const long t = ( (long)i*nky + j )*Nz + z_start[q] + k;
+            c_re( Pencil.SendBuf[Idx] ) = c_re( cdata[t] );
+            c_im( Pencil.SendBuf[Idx] ) = c_im( cdata[t] );
+            Idx ++;
+         }
+      }
+   } // for (int q=0; q<NMember; q++)
+
+
+// 2. exchange
+   Pencil_Alltoallv( Pencil, Pencil.Comm_Col, NMember, Send_NCount, Recv_NCount );
+
+
+// 3. unpack
+   Idx = 0;
+
+   for (int q=0; q<NMember; q++)
+   {
+      const int nky_q = y_start[q+1] - y_start[q];
+      const int nz_q  = z_start[q+1] - z_start[q];
+
+      if ( Forward )
+      {
+         for (int k=0; k<nz_q; k++)
+         for (int i=0; i<nkx;  i++)
+         for (int j=0; j<nky;  j++)
+         {
+            const long t = ( (long)i*nky + j )*Nz + z_start[q] + k;
+            c_re( cdata[t] ) = c_re( Pencil.RecvBuf[Idx] );
+            c_im( cdata[t] ) = c_im( Pencil.RecvBuf[Idx] );
+            Idx ++;
+         }
+      }
+
+      else
+      {
+         for (int k=0; k<nz;    k++)
+         for (int i=0; i<nkx;   i++)
+         for (int j=0; j<nky_q; j++)
+         {
+            const long t = ( (long)k*nkx + i )*Ny + y_start[q] + j;
+            c_re( cdata[t] ) = c_re( Pencil.RecvBuf[Idx] );
+            c_im( cdata[t] ) = c_im( Pencil.RecvBuf[Idx] );
+            Idx ++;
+         }
+      }
+   } // for (int q=0; q<NMember; q++)
+
+
+   delete [] Send_NCount;
+   delete [] Recv_NCount;
+
+} // FUNCTION : Pencil_Transpose_YZ
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_GetBlock_PatchSide
+// Description :  Get the blocks of all local real patches on level 0 to be exchanged with the pencil ranks
+//
+// Note        :  1. Blocks are sorted by the patch LB_Idx, which is the order expected by Pencil_GetBlock_PencilSide()
+//                2. Block[] will be allocated here and must be deallocated manually
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object
+//                Block  : Block list to be returned
+//
+// Return      :  Block[], number of blocks
+//-------------------------------------------------------------------------------------------------------
+int Pencil_GetBlock_PatchSide( const FFTW_Pencil_t &Pencil, PencilBlock_t *&Block )
+{
+
+   const int NPatch = amr->NPatchComma[0][1];
+
+   long *LBIdx    = new long [NPatch];
+   int  *IdxTable = new int  [NPatch];
+
+   for (int PID=0; PID<NPatch; PID++)  LBIdx[PID] = amr->patch[0][0][PID]->LB_Idx;
+
+   Mis_Heapsort( NPatch, LBIdx, IdxTable );
+
+
+// each patch overlaps with at most two pencils along y and z, respectively, if pencils are thicker than a patch
+// --> use PS1 as an upper bound for thin pencils
+   const int *y_start = Pencil.List_y_start;
+   const int *z_start = Pencil.List_z_start;
+   const int  MaxNBlk = NPatch*MIN( PS1, Pencil.NP[0] )*MIN( PS1, Pencil.NP[1] );
+   int        NBlock  = 0;
+
+   Block = new PencilBlock_t [ MAX(MaxNBlk,1) ];
+
+   for (int t=0; t<NPatch; t++)
+   {
+      const int PID = IdxTable[t];
+      int Cr[3];
+
+      for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / amr->scale[0];
+
+      for (int pz=0; pz<Pencil.NP[1]; pz++)
+      {
+         const int z0 = MAX( Cr[2],     z_start[pz  ] );
+         const int z1 = MIN( Cr[2]+PS1, z_start[pz+1] );
+
+         if ( z0 >= z1 )   continue;
+
+         for (int py=0; py<Pencil.NP[0]; py++)
+         {
+            const int y0 = MAX( Cr[1],     y_start[py  ] );
+            const int y1 = MIN( Cr[1]+PS1, y_start[py+1] );
+
+            if ( y0 >= y1 )   continue;
+
+            PencilBlock_t &B = Block[ NBlock ++ ];
+
+            B.Rank  = pz*Pencil.NP[0] + py;
+            B.PID   = PID;
+            B.LBIdx = LBIdx[t];
+            B.y[0] = y0;
+            B.y[1] = y1;
+            B.z[0] = z0;
+            B.z[1] = z1;
+            for (int d=0; d<3; d++)    B.Cr[d] = Cr[d];
+         }
+      }
+   } // for (int t=0; t<NPatch; t++)
+
+   delete [] LBIdx;
+   delete [] IdxTable;
+
+   return NBlock;
+
+} // FUNCTION : Pencil_GetBlock_PatchSide
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_GetBlock_PencilSide
+// Description :  Get the blocks of all root-level patches overlapping with the x-pencil of this rank
+//
+// Note        :  1. Blocks are sorted by the patch LB_Idx, which is the order adopted by Pencil_GetBlock_PatchSide()
+//                   --> Data can be exchanged without transferring the patch coordinates
+//                2. Block[].Rank is left undefined since the patch owners change with the load balancing
+//                   --> Set by Pencil_UpdateExchange()
+//                3. Block[] will be allocated here and must be deallocated manually
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object
+//                Block  : Block list to be returned
+//
+// Return      :  Block[], number of blocks
+//-------------------------------------------------------------------------------------------------------
+int Pencil_GetBlock_PencilSide( const FFTW_Pencil_t &Pencil, PencilBlock_t *&Block )
+{
+
+// pencil region overlapping with the simulation domain (i.e., excluding the zero-padding regions)
+   const int y0 = MIN( Pencil.List_y_start[ Pencil.Coord[0]   ], NX0_TOT[1] );
+   const int y1 = MIN( Pencil.List_y_start[ Pencil.Coord[0]+1 ], NX0_TOT[1] );
+   const int z0 = MIN( Pencil.List_z_start[ Pencil.Coord[1]   ], NX0_TOT[2] );
+   const int z1 = MIN( Pencil.List_z_start[ Pencil.Coord[1]+1 ], NX0_TOT[2] );
+
+   Block = NULL;
+
+   if ( y0 >= y1  ||  z0 >= z1 )    return 0;
+
+
+   const int NPx    = NX0_TOT[0]/PS1;
+   const int PY0    = y0/PS1;
+   const int PZ0    = z0/PS1;
+   const int NPy    = (y1-1)/PS1 - PY0 + 1;
+   const int NPz    = (z1-1)/PS1 - PZ0 + 1;
+   const int NBlock = NPx*NPy*NPz;
+
+   PencilBlock_t *Temp     = new PencilBlock_t [NBlock];
+   long          *LBIdx    = new long          [NBlock];
+   int           *IdxTable = new int           [NBlock];
+   int            Corner[3];
+
+   for (int k=0; k<NPz; k++)
+   for (int j=0; j<NPy; j++)
+   for (int i=0; i<NPx; i++)
+   {
+      const int t = ( k*NPy + j )*NPx + i;
+      PencilBlock_t &B = Temp[t];
+
+      B.Cr[0] = i*PS1;
+      B.Cr[1] = ( PY0 + j )*PS1;
+      B.Cr[2] = ( PZ0 + k )*PS1;
+      B.PID  = -1;
+      B.y[0] = MAX( B.Cr[1],     y0 );
+      B.y[1] = MIN( B.Cr[1]+PS1, y1 );
+      B.z[0] = MAX( B.Cr[2],     z0 );
+      B.z[1] = MIN( B.Cr[2]+PS1, z1 );
+
+      for (int d=0; d<3; d++)    Corner[d] = B.Cr[d]*amr->scale[0];
+
+      LBIdx[t] = LB_Corner2Index( 0, Corner, CHECK_ON );
+      B.LBIdx  = LBIdx[t];
+      B.Rank   = -1;
+   }
+
+   Mis_Heapsort( NBlock, LBIdx, IdxTable );
+
+   Block = new PencilBlock_t [NBlock];
+
+   for (int t=0; t<NBlock; t++)  Block[t] = Temp[ IdxTable[t] ];
+
+   delete [] Temp;
+   delete [] LBIdx;
+   delete [] IdxTable;
+
+   return NBlock;
+
+} // FUNCTION : Pencil_GetBlock_PencilSide
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_SetPartner
+// Description :  Set the partner ranks, the number of elements exchanged with each partner, and the offset
+//                of each block in the MPI buffer
+//
+// Note        :  1. Invoked by Pencil_UpdateExchange()
+//                2. Data of each partner are stored contiguously in the order of rank, and blocks of the same
+//                   partner are stored in the order of Side.Block[] (i.e., LB_Idx)
+//                   --> Consistent between the sender and receiver since both sort blocks by LB_Idx
+//
+// Parameter   :  Side : PencilSide_t object with Block[].Rank already set
+//-------------------------------------------------------------------------------------------------------
+void Pencil_SetPartner( PencilSide_t &Side )
+{
+
+// 1. collect the unique partner ranks
+   int *Rank     = new int [ MAX(Side.NBlock,1) ];
+   int  NPartner = 0;
+
+   for (int t=0; t<Side.NBlock; t++)   Rank[t] = Side.Block[t].Rank;
+
+   Mis_Heapsort( Side.NBlock, Rank, (int*)NULL );
+
+   for (int t=0; t<Side.NBlock; t++)
+      if ( t == 0  ||  Rank[t] != Rank[t-1] )   Rank[ NPartner ++ ] = Rank[t];
+
+   delete [] Side.Partner;
+   delete [] Side.NCount;
+   delete [] Side.Disp;
+
+   Side.NPartner = NPartner;
+   Side.Partner  = new int  [ MAX(NPartner,1) ];
+   Side.NCount   = new long [ MAX(NPartner,1) ];
+   Side.Disp     = new long [ MAX(NPartner,1) ];
+
+   for (int p=0; p<NPartner; p++)
+   {
+      Side.Partner[p] = Rank[p];
+      Side.NCount [p] = 0L;
+   }
+
+   delete [] Rank;
+
+
+// 2. count the number of elements exchanged with each partner
+   for (int t=0; t<Side.NBlock; t++)
+   {
+      const PencilBlock_t &B = Side.Block[t];
+      const int p = Mis_BinarySearch( Side.Partner, 0, NPartner-1, B.Rank );
+
+      Side.NCount[p] += (long)( B.z[1] - B.z[0] )*( B.y[1] - B.y[0] )*PS1;
+   }
+
+   Side.NElem = 0L;
+
+   for (int p=0; p<NPartner; p++)
+   {
+      if ( Side.NCount[p] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "number of elements exchanged with rank %d exceeds __INT_MAX__ !!\n", Side.Partner[p] );
+
+      Side.Disp[p]  = Side.NElem;
+      Side.NElem   += Side.NCount[p];
+   }
+
+
+// 3. set the offset of each block in the MPI buffer
+   long *Offset = new long [ MAX(NPartner,1) ];
+
+   for (int p=0; p<NPartner; p++)   Offset[p] = Side.Disp[p];
+
+   for (int t=0; t<Side.NBlock; t++)
+   {
+      PencilBlock_t &B = Side.Block[t];
+      const int p = Mis_BinarySearch( Side.Partner, 0, NPartner-1, B.Rank );
+
+      B.Offset   = Offset[p];
+      Offset[p] += (long)( B.z[1] - B.z[0] )*( B.y[1] - B.y[0] )*PS1;
+   }
+
+   delete [] Offset;
+
+} // FUNCTION : Pencil_SetPartner
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_UpdateExchange
+// Description :  Update the blocks and partner ranks of the patch <-> pencil exchange after the patches are
+//                redistributed
+//
+// Note        :  1. Invoked by Patch2Pencil() and Pencil2Patch()
+//                2. Do nothing if LB_Init_LoadBalance() has not been invoked since the last update
+//                   --> Only the local patches and the owners of the blocks in PencilSide need to be updated,
+//                       which involves no communication
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object
+//-------------------------------------------------------------------------------------------------------
+void Pencil_UpdateExchange( FFTW_Pencil_t &Pencil )
+{
+
+   if ( Pencil.LB_NInit == amr->LB->NInit )  return;
+
+
+// 1. blocks of the local root-level patches
+   delete [] Pencil.PatchSide.Block;
+   Pencil.PatchSide.NBlock = Pencil_GetBlock_PatchSide( Pencil, Pencil.PatchSide.Block );
+
+
+// 2. owners of the blocks overlapping with the local x-pencil
+   for (int t=0; t<Pencil.PencilSide.NBlock; t++)
+      Pencil.PencilSide.Block[t].Rank = LB_Index2Rank( 0, Pencil.PencilSide.Block[t].LBIdx, CHECK_ON );
+
+
+// 3. partner ranks and MPI buffers
+   Pencil_SetPartner( Pencil.PatchSide  );
+   Pencil_SetPartner( Pencil.PencilSide );
+
+   delete [] Pencil.PatchSide.Buf;
+   delete [] Pencil.PatchReq;
+
+   Pencil.PatchSide.Buf = new real        [ MAX(Pencil.PatchSide.NElem,1L) ];
+   Pencil.PatchReq      = new MPI_Request [ Pencil.PatchSide.NPartner + Pencil.PencilSide.NPartner + 1 ];
+
+   Pencil.LB_NInit = amr->LB->NInit;
+
+} // FUNCTION : Pencil_UpdateExchange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_SparseExchange
+// Description :  Exchange data between the patch owners and the pencil ranks by point-to-point communication
+//
+// Note        :  1. Only the partner ranks recorded by Pencil_UpdateExchange() are involved
+//                   --> The cost scales with the number of overlapping ranks instead of MPI_NRank
+//                2. Send SendSide.Buf[] to RecvSide.Buf[]
+//                   --> Patch2Pencil(): PatchSide --> PencilSide
+//                       Pencil2Patch(): PencilSide --> PatchSide
+//                3. Use Pencil.Comm_Patch so that the messages cannot match those sent by other routines
+//
+// Parameter   :  Pencil   : FFTW_Pencil_t object
+//                SendSide : Side sending data
+//                RecvSide : Side receiving data
+//-------------------------------------------------------------------------------------------------------
+void Pencil_SparseExchange( FFTW_Pencil_t &Pencil, const PencilSide_t &SendSide, const PencilSide_t &RecvSide )
+{
+
+   const int Tag = 0;
+
+   MPI_Request *Req      = Pencil.PatchReq;
+   int          NReq     = 0;
+   real        *SendSelf = NULL, *RecvSelf = NULL;
+   long         NSelf[2] = { 0L, 0L };
+
+   for (int p=0; p<RecvSide.NPartner; p++)
+   {
+      const int r = RecvSide.Partner[p];
+
+      if ( r == MPI_Rank )
+      {
+         RecvSelf = RecvSide.Buf + RecvSide.Disp[p];
+         NSelf[1] = RecvSide.NCount[p];
+      }
+
+      else
+         MPI_Irecv( RecvSide.Buf+RecvSide.Disp[p], (int)RecvSide.NCount[p], MPI_GAMER_REAL, r, Tag,
+                    Pencil.Comm_Patch, Req+(NReq++) );
+   }
+
+   for (int p=0; p<SendSide.NPartner; p++)
+   {
+      const int r = SendSide.Partner[p];
+
+      if ( r == MPI_Rank )
+      {
+         SendSelf = SendSide.Buf + SendSide.Disp[p];
+         NSelf[0] = SendSide.NCount[p];
+      }
+
+      else
+         MPI_Isend( SendSide.Buf+SendSide.Disp[p], (int)SendSide.NCount[p], MPI_GAMER_REAL, r, Tag,
+                    Pencil.Comm_Patch, Req+(NReq++) );
+   }
+
+#  ifdef GAMER_DEBUG
+   if ( NSelf[0] != NSelf[1] )
+      Aux_Error( ERROR_INFO, "number of elements sent to (%ld) and received from (%ld) rank %d itself differ !!\n",
+                 NSelf[0], NSelf[1], MPI_Rank );
+#  endif
+
+   if ( NSelf[0] > 0L )    memcpy( RecvSelf, SendSelf, NSelf[0]*sizeof(real) );
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+} // FUNCTION : Pencil_SparseExchange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Patch2Pencil
+// Description :  Patch-based data --> pencil domain decomposition
+//
+// Note        :  1. Counterpart of Patch2Slab() for OPT__FFTW_PENCIL
+//                2. Each patch block is sent directly to the pencil rank covering it
+//                   --> No all-to-all communication is involved
+//                3. Both sides determine the number of exchanged elements locally (see Pencil_GetBlock_*())
+//                   --> The blocks, partner ranks, and MPI buffers are reused until the patches are redistributed
+//                       (see Pencil_UpdateExchange())
+//                4. Zero-padding regions in VarP[] are not touched
+//
+// Parameter   :  VarP         : Array of the target variable in the x-pencil layout
+//                Pencil       : FFTW_Pencil_t object
+//                PrepTime     : Physical time for preparing the target variable field
+//                TVar         : Target variable to be prepared
+//                ForPoisson   : Preparing the density field for the Poisson solver
+//                AddExtraMass : Adding an extra density field for computing gravitational potential (only works with ForPoisson)
+//-------------------------------------------------------------------------------------------------------
+void Patch2Pencil( real *VarP, FFTW_Pencil_t &Pencil, const double PrepTime, const long TVar,
+                   const bool ForPoisson, const bool AddExtraMass )
+{
+
+// check
+// check only single field
+   if ( TVar == 0  ||  TVar & (TVar-1) )
+      Aux_Error( ERROR_INFO, "number of target variables is not one !!\n" );
+
+#  ifdef GRAVITY
+   if ( ForPoisson  &&  TVar != _TOTAL_DENS )
+      Aux_Error( ERROR_INFO, "TVar != _TOTAL_DENS for Poisson solver !!\n" );
+
+   if ( ForPoisson  &&  AddExtraMass  &&  Poi_AddExtraMassForGravity_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "Poi_AddExtraMassForGravity_Ptr == NULL for AddExtraMass !!\n" );
+#  endif // GRAVITY
+
+
+   const int NPatch = amr->NPatchComma[0][1];
+
+
+// 1. prepare the data of all local patches
+   const OptPotBC_t  PotBC_None        = BC_POT_NONE;
+   const IntScheme_t IntScheme         = INT_NONE;
+   const NSide_t     NSide_None        = NSIDE_00;
+   const bool        IntPhase_No       = false;
+   const bool        DE_Consistency_No = false;
+   const real        MinDens_No        = -1.0;
+   const real        MinPres_No        = -1.0;
+   const real        MinTemp_No        = -1.0;
+   const real        MinEntr_No        = -1.0;
+   const int         GhostSize         = 0;
+   const int         NPG               = 1;
+
+   real (*VarPatch)[PS1][PS1][PS1] = new real [ MAX(NPatch,1) ][PS1][PS1][PS1];
+
+   for (int PID0=0; PID0<NPatch; PID0+=8)
+   {
+//    even with NSIDE_00 and GhostSize=0, we still need OPT__BC_FLU to determine whether periodic BC is adopted
+//    for depositing particle mass onto grids
+      Prepare_PatchData( 0, PrepTime, VarPatch[PID0][0][0], NULL, GhostSize, NPG, &PID0, TVar, _NONE,
+                         IntScheme, INT_NONE, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
+                         MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+
+#     ifdef GRAVITY
+//    add extra mass source for gravity if required
+      if ( ForPoisson  &&  AddExtraMass )
+      {
+         const double dh = amr->dh[0];
+
+         for (int PID=PID0; PID<PID0+8; PID++)
+         {
+            const double x0 = amr->patch[0][0][PID]->EdgeL[0] + 0.5*dh;
+            const double y0 = amr->patch[0][0][PID]->EdgeL[1] + 0.5*dh;
+            const double z0 = amr->patch[0][0][PID]->EdgeL[2] + 0.5*dh;
+
+            double x, y, z;
+
+            for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
+            for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
+            for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
+               VarPatch[PID][k][j][i] += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[0], 0, NULL );
+            }}}
+         }
+      }
+
+//    subtract the background density (which is assumed to be UNITY) for the isolated BC in the comoving frame
+//    --> to be consistent with the comoving-frame Poisson eq.
+#     ifdef COMOVING
+      if ( ForPoisson  &&  OPT__BC_POT == BC_POT_ISOLATED )
+      {
+         for (int PID=PID0; PID<PID0+8; PID++)
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+            VarPatch[PID][k][j][i] -= (real)1.0;
+      }
+#     endif
+#     endif // #ifdef GRAVITY
+   } // for (int PID0=0; PID0<NPatch; PID0+=8)
+
+
+// 2. update the blocks and partner ranks if the patches have been redistributed
+   Pencil_UpdateExchange( Pencil );
+
+
+// 3. prepare the send buffer (blocks are grouped by the target rank)
+   const PencilSide_t &SendSide = Pencil.PatchSide;
+   const PencilSide_t &RecvSide = Pencil.PencilSide;
+
+   for (int t=0; t<SendSide.NBlock; t++)
+   {
+      const PencilBlock_t &B = SendSide.Block[t];
+      real *Ptr = SendSide.Buf + B.Offset;
+
+      for (int z=B.z[0]; z<B.z[1]; z++)
+      for (int y=B.y[0]; y<B.y[1]; y++)
+      {
+         memcpy( Ptr, VarPatch[B.PID][ z-B.Cr[2] ][ y-B.Cr[1] ], PS1*sizeof(real) );
+         Ptr += PS1;
+      }
+   }
+
+   delete [] VarPatch;
+
+
+// 4. exchange data by point-to-point MPI
+   Pencil_SparseExchange( Pencil, SendSide, RecvSide );
+
+
+// 5. store the received data to the padded array "VarP" for FFTW
+   const int NxP = 2*( Pencil.N[0]/2 + 1 );
+   const int y0  = Pencil.List_y_start[ Pencil.Coord[0] ];
+   const int z0  = Pencil.List_z_start[ Pencil.Coord[1] ];
+
+   for (int t=0; t<RecvSide.NBlock; t++)
+   {
+      const PencilBlock_t &B = RecvSide.Block[t];
+      const real *Ptr = RecvSide.Buf + B.Offset;
+
+      for (int z=B.z[0]; z<B.z[1]; z++)
+      for (int y=B.y[0]; y<B.y[1]; y++)
+      {
+         memcpy( VarP + ( (long)(z-z0)*Pencil.local_ny + (y-y0) )*NxP + B.Cr[0], Ptr, PS1*sizeof(real) );
+         Ptr += PS1;
+      }
+   }
+
+} // FUNCTION : Patch2Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil2Patch
+// Description :  Pencil domain decomposition --> patch-based data
+//
+// Note        :  1. Counterpart of Slab2Patch() for OPT__FFTW_PENCIL
+//                2. Inverse of Patch2Pencil() with the same point-to-point communication pattern
+//
+// Parameter   :  VarP   : Array of the target variable in the x-pencil layout
+//                Pencil : FFTW_Pencil_t object
+//                SaveSg : Sandglass to store the updated data
+//                TVar   : Target variable to be stored
+//-------------------------------------------------------------------------------------------------------
+void Pencil2Patch( const real *VarP, FFTW_Pencil_t &Pencil, const int SaveSg, const long TVar )
+{
+
+// check
+// check only single field
+   if ( TVar == 0  ||  TVar & (TVar-1) )
+      Aux_Error( ERROR_INFO, "number of target variables is not one !!\n" );
+
+// check TVar is one of the fields in NCOMP_TOTAL or POTE
+   long SupportedVar = _TOTAL;
+#  ifdef GRAVITY
+   SupportedVar |= _POTE;
+#  endif
+
+   if ( TVar & ~SupportedVar )
+      Aux_Error( ERROR_INFO, "unsupported variable %s = %d !!\n", "TVar", TVar );
+
+// find the variable index
+   int TVarIdx = -1;   // target variable index
+   for (int v=0; v<NCOMP_TOTAL; v++)
+      if ( TVar & (1L<<v) )  TVarIdx = v;  // assuming only single field
+
+#  ifdef GRAVITY
+   if ( TVar == _POTE )  TVarIdx = NCOMP_TOTAL+NDERIVE;  // assuming only single field
+#  endif
+
+   if ( TVarIdx < 0 )
+      Aux_Error( ERROR_INFO, "TVarIdx is not found !!\n" );
+
+
+// 1. update the blocks and partner ranks if the patches have been redistributed
+   Pencil_UpdateExchange( Pencil );
+
+
+// 2. prepare the send buffer (blocks are grouped by the target rank)
+   const PencilSide_t &SendSide = Pencil.PencilSide;
+   const PencilSide_t &RecvSide = Pencil.PatchSide;
+
+   const int NxP = 2*( Pencil.N[0]/2 + 1 );
+   const int y0  = Pencil.List_y_start[ Pencil.Coord[0] ];
+   const int z0  = Pencil.List_z_start[ Pencil.Coord[1] ];
+
+   for (int t=0; t<SendSide.NBlock; t++)
+   {
+      const PencilBlock_t &B = SendSide.Block[t];
+      real *Ptr = SendSide.Buf + B.Offset;
+
+      for (int z=B.z[0]; z<B.z[1]; z++)
+      for (int y=B.y[0]; y<B.y[1]; y++)
+      {
+         memcpy( Ptr, VarP + ( (long)(z-z0)*Pencil.local_ny + (y-y0) )*NxP + B.Cr[0], PS1*sizeof(real) );
+         Ptr += PS1;
+      }
+   }
+
+
+// 3. exchange data by point-to-point MPI
+   Pencil_SparseExchange( Pencil, SendSide, RecvSide );
+
+
+// 4. store the received data to different patch objects
+// --> use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
+   for (int t=0; t<RecvSide.NBlock; t++)
+   {
+      const PencilBlock_t &B = RecvSide.Block[t];
+      const real *Ptr = RecvSide.Buf + B.Offset;
+
+      for (int z=B.z[0]; z<B.z[1]; z++)
+      for (int y=B.y[0]; y<B.y[1]; y++)
+      {
+         const int k = z - B.Cr[2];
+         const int j = y - B.Cr[1];
+
+         if ( TVarIdx < NCOMP_TOTAL )
+         {
+            real_store *FluPtr = amr->patch[SaveSg][0][B.PID]->fluid[TVarIdx][k][j];
+            for (int i=0; i<PS1; i++)  FluPtr[i] = Ptr[i];
+         }
+#        ifdef GRAVITY
+         else if ( TVarIdx == NCOMP_TOTAL+NDERIVE ) // TVar == _POTE
+         {
+            real_store *PotPtr = amr->patch[SaveSg][0][B.PID]->pot[k][j];
+            for (int i=0; i<PS1; i++)  PotPtr[i] = Ptr[i];
+         }
+#        endif
+         else
+            Aux_Error( ERROR_INFO, "incorrect target variable index %s = %d !!\n", "TVarIdx", TVarIdx );
+
+         Ptr += PS1;
+      }
+   }
+
+} // FUNCTION : Pencil2Patch
+
+
+
+#endif // #ifdef SUPPORT_FFTW_PENCIL
@@ -244,7 +244,7 @@ void Init_GAMER( int *argc, char ***argv )
 
 // record the initial weighted load-imbalance factor
 #  ifdef LOAD_BALANCE
-   if ( OPT__RECORD_LOAD_BALANCE )  LB_EstimateLoadImbalance();
+   if ( OPT__RECORD_LOAD_BALANCE )  LB_EstimateLoadImbalance( false );
 #  endif
 
 
@@ -191,6 +191,7 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
    ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PATCH_SLAB",            &OPT__PATCH_SLAB,                 false,           Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -200,6 +201,16 @@ void Init_Load_Parameter()
    ReadPara->Add( "LB_INPUT__PAR_WEIGHT",       &LB_INPUT__PAR_WEIGHT,            0.0,             0.0,           NoMax_double   );
 #  endif
    ReadPara->Add( "OPT__RECORD_LOAD_BALANCE",   &OPT__RECORD_LOAD_BALANCE,        true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__MPI_SPARSE",            &OPT__MPI_SPARSE,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__MPI_PERSISTENT",        &OPT__MPI_PERSISTENT,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_MEASURED_COST",      &OPT__LB_MEASURED_COST,           false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "LB_MEASURED_COST_SMOOTH",    &LB_MEASURED_COST_SMOOTH,         0.5,             Eps_double,    1.0            );
+   ReadPara->Add( "OPT__LB_INCREMENTAL",        &OPT__LB_INCREMENTAL,             false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_MULTI_CONSTRAINT",   &OPT__LB_MULTI_CONSTRAINT,        false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "LB_MC_TOL_CELL",             &LB_MC_TOL_CELL,                  0.1,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "LB_MC_TOL_PAR",              &LB_MC_TOL_PAR,                   0.1,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "LB_MC_TOL_TIME",             &LB_MC_TOL_TIME,                  0.1,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "LB_MC_TOL_MEM",              &LB_MC_TOL_MEM,                   0.1,             NoMin_double,  NoMax_double   );
 #  endif
    ReadPara->Add( "OPT__MINIMIZE_MPI_BARRIER",  &OPT__MINIMIZE_MPI_BARRIER,       false,           Useless_bool,  Useless_bool   );
 
@@ -315,6 +326,7 @@ void Init_Load_Parameter()
 // do not check FLU_GPU_NPGROUP and GPU_NSTREAM since they may be reset by either Init_ResetDefaultParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "FLU_GPU_NPGROUP",            &FLU_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "GPU_NSTREAM",                &GPU_NSTREAM,                    -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__AUTO_NPGROUP",          &OPT__AUTO_NPGROUP,               false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__FIXUP_FLUX",            &OPT__FIXUP_FLUX,                 true,            Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__FIXUP_ELECTRIC",        &OPT__FIXUP_ELECTRIC,             true,            Useless_bool,  Useless_bool   );
@@ -325,6 +337,9 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__NORMALIZE_PASSIVE",     &OPT__NORMALIZE_PASSIVE,          true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__INT_FRAC_PASSIVE_LR",   &OPT__INT_FRAC_PASSIVE_LR,        true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OVERLAP_MPI",           &OPT__OVERLAP_MPI,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__CPU_PIPELINE",          &OPT__CPU_PIPELINE,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PREP_CACHE",            &OPT__PREP_CACHE,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "PREP_CACHE_MAX_MB",          &PREP_CACHE_MAX_MB,               1024.0,          0.0,           NoMax_double   );
    ReadPara->Add( "OPT__RESET_FLUID",           &OPT__RESET_FLUID,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RESET_FLUID_INIT",      &OPT__RESET_FLUID_INIT,          -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__FREEZE_FLUID",          &OPT__FREEZE_FLUID,               false,           Useless_bool,  Useless_bool   );
@@ -354,11 +369,17 @@ void Init_Load_Parameter()
    ReadPara->Add( "SOR_OMEGA",                  &SOR_OMEGA,                      -1.0,             NoMin_double,  NoMax_double   );
    ReadPara->Add( "SOR_MAX_ITER",               &SOR_MAX_ITER,                   -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "SOR_MIN_ITER",               &SOR_MIN_ITER,                   -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "SOR_TOLERATED_ERROR",        &SOR_TOLERATED_ERROR,            -1.0,             NoMin_double,  NoMax_double   );
 // do not check MG_XXX since they may be reset by Init_Set_Default_MG_Parameter()
    ReadPara->Add( "MG_MAX_ITER",                &MG_MAX_ITER,                    -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_NPRE_SMOOTH",             &MG_NPRE_SMOOTH,                 -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_NPOST_SMOOTH",            &MG_NPOST_SMOOTH,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_TOLERATED_ERROR",         &MG_TOLERATED_ERROR,             -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OPT__POT_LEVEL_MG",          &OPT__POT_LEVEL_MG,               false,           Useless_bool,  Useless_bool   );
+// do not check POT_LEVEL_MG_XXX since they may be reset by Init_ResetParameter()
+   ReadPara->Add( "POT_LEVEL_MG_MAX_ITER",      &POT_LEVEL_MG_MAX_ITER,          -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "POT_LEVEL_MG_TOLERATED_ERROR",&POT_LEVEL_MG_TOLERATED_ERROR,  -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OPT__POT_WARM_START",        &OPT__POT_WARM_START,             false,           Useless_bool,  Useless_bool   );
 // do not check POT_GPU_NPGROUP since it may be reset by either Init_ResetDefaultParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "POT_GPU_NPGROUP",            &POT_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__GRA_P5_GRADIENT",       &OPT__GRA_P5_GRADIENT,            false,           Useless_bool,  Useless_bool   );
@@ -386,6 +407,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__INIT",                  &OPT__INIT,                      -1,               1,             3              );
    ReadPara->Add( "RESTART_LOAD_NRANK",         &RESTART_LOAD_NRANK,              1,               1,             NoMax_int      );
    ReadPara->Add( "OPT__RESTART_RESET",         &OPT__RESTART_RESET,              false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RESTART_PARALLEL",      &OPT__RESTART_PARALLEL,           false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__UM_IC_LEVEL",           &OPT__UM_IC_LEVEL,                0,               0,             TOP_LEVEL      );
    ReadPara->Add( "OPT__UM_IC_NLEVEL",          &OPT__UM_IC_NLEVEL,               1,               1,             NoMax_int      );
 // do not check OPT__UM_IC_NVAR since it depends on OPT__INIT and MODEL
@@ -415,6 +437,8 @@ void Init_Load_Parameter()
 #  else  // # if ( SUPPORT_FFTW == FFTW2 ) ... # else
 #  error : ERROR : Unsupported FFTW version for OPT__FFTW_STARTUP
 #  endif // #  if ( SUPPORT_FFTW == FFTW2 ) ... # else
+   ReadPara->Add( "OPT__FFTW_PENCIL",           &OPT__FFTW_PENCIL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FFTW_WISDOM",           &OPT__FFTW_WISDOM,                false,           Useless_bool,  Useless_bool   );
 #  endif // # ifdef SUPPORT_FFTW
 
 // interpolation schemes
@@ -454,6 +478,12 @@ void Init_Load_Parameter()
 
 // data dump
    ReadPara->Add( "OPT__OUTPUT_TOTAL",          &OPT__OUTPUT_TOTAL,               1,               0,             2              );
+   ReadPara->Add( "OPT__OUTPUT_HDF5_MPIIO",     &OPT__OUTPUT_HDF5_MPIIO,          false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_HDF5_COMPRESS",  &OPT__OUTPUT_HDF5_COMPRESS,       0,               0,             2              );
+   ReadPara->Add( "OUTPUT_HDF5_DEFLATE_LEVEL",  &OUTPUT_HDF5_DEFLATE_LEVEL,       1,               1,             9              );
+   ReadPara->Add( "OUTPUT_HDF5_LOSSY_DIGITS",   &OUTPUT_HDF5_LOSSY_DIGITS,       -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__OUTPUT_HDF5_ASYNC",     &OPT__OUTPUT_HDF5_ASYNC,          false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OUTPUT_HDF5_ASYNC_MAX_MEM",  &OUTPUT_HDF5_ASYNC_MAX_MEM,       1024.0,          NoMin_double,  NoMax_double   );
    ReadPara->Add( "OPT__OUTPUT_PART",           &OPT__OUTPUT_PART,                0,               0,             7              );
    ReadPara->Add( "OPT__OUTPUT_USER",           &OPT__OUTPUT_USER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OUTPUT_TEXT_FORMAT_FLT", OPT__OUTPUT_TEXT_FORMAT_FLT,     "%24.16e",       Useless_str,   Useless_str    );
@@ -13,7 +13,11 @@ void Init_MemAllocate()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
-// a. allocate the BaseP
+// a. set up the slab allocator of the patch field arrays before allocating any patch
+   Aux_PatchSlab_Init();
+
+
+// b. allocate the BaseP
    const int NPatch1D[3] = { NX0[0]/PATCH_SIZE+4, NX0[1]/PATCH_SIZE+4, NX0[2]/PATCH_SIZE+4 };
 #  ifdef LOAD_BALANCE
    if ( OPT__INIT != INIT_BY_RESTART )
@@ -21,7 +25,7 @@ void Init_MemAllocate()
    BaseP = new int [ NPatch1D[0]*NPatch1D[1]*NPatch1D[2] ];
 
 
-// b. allocate memory for all CPU solvers
+// c. allocate memory for all CPU solvers
 //    --> memory of GPU solvers is allocated by CUAPI_MemAllocate()
 #  ifndef GPU
 #  ifndef GRAVITY
@@ -39,7 +43,7 @@ void Init_MemAllocate()
 #  endif
 
 
-// c. allocate load-balance variables
+// d. allocate load-balance variables
 #  ifdef LOAD_BALANCE
 #  ifdef PARTICLE
    amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, LB_INPUT__PAR_WEIGHT );
@@ -49,7 +53,7 @@ void Init_MemAllocate()
 #  endif // #ifdef LOAD_BALANCE
 
 
-// d. allocate particle repository (for restart, it will be allocated after loading the checkpoint file)
+// e. allocate particle repository (for restart, it will be allocated after loading the checkpoint file)
 #  ifdef PARTICLE
    if ( amr->Par->Init != PAR_INIT_BY_RESTART )    amr->Par->InitRepo( amr->Par->NPar_AcPlusInac, MPI_NRank );
 #  endif
@@ -4,20 +4,6 @@
 #include "CUFLU.h"
 
 
-#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-extern real (*h_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
-extern real (*h_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
-extern real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
-extern real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
-#ifdef MHD
-extern real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
-extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
-#endif
-#endif // FLU_SCHEME
-
-
-
-
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_MemAllocate_Fluid
 // Description :  Allocate memory for the fluid solver
@@ -78,20 +64,6 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
       }
    } // for (int t=0; t<2; t++)
 
-
-#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-   h_FC_Var      = new real [Flu_NPatchGroup][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
-   h_FC_Flux     = new real [Flu_NPatchGroup][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
-   h_PriVar      = new real [Flu_NPatchGroup]   [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
-#  if ( LR_SCHEME == PPM )
-   h_Slope_PPM   = new real [Flu_NPatchGroup][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
-#  endif
-#  ifdef MHD
-   h_FC_Mag_Half = new real [Flu_NPatchGroup][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
-   h_EC_Ele      = new real [Flu_NPatchGroup][NCOMP_MAG][ CUBE(N_EC_ELE)          ];
-#  endif
-#  endif // FLU_SCHEME
-
 } // FUNCTION : Init_MemAllocate_Fluid
 
 
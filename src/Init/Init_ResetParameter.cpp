@@ -1,5 +1,8 @@
 #include "GAMER.h"
 #include <string.h>
+#ifdef SUPPORT_HDF5
+#include "hdf5.h"
+#endif
 
 
 
@@ -155,6 +158,24 @@ void Init_ResetParameter()
 #  elif ( POT_SCHEME == MG  )
    Init_Set_Default_MG_Parameter();
 #  endif
+
+   if ( OPT__POT_LEVEL_MG  &&  POT_LEVEL_MG_MAX_ITER < 0 )
+   {
+      POT_LEVEL_MG_MAX_ITER = 30;
+
+      PRINT_RESET_PARA( POT_LEVEL_MG_MAX_ITER, FORMAT_INT, "" );
+   }
+
+   if ( OPT__POT_LEVEL_MG  &&  POT_LEVEL_MG_TOLERATED_ERROR < 0.0 )
+   {
+#     ifdef FLOAT8
+      POT_LEVEL_MG_TOLERATED_ERROR = 1.0e-10;
+#     else
+      POT_LEVEL_MG_TOLERATED_ERROR = 1.0e-5;
+#     endif
+
+      PRINT_RESET_PARA( POT_LEVEL_MG_TOLERATED_ERROR, FORMAT_REAL, "" );
+   }
 #  endif // GRAVITY
 
 
@@ -604,6 +625,68 @@ void Init_ResetParameter()
 #  endif
 
 
+// turn off "OPT__OUTPUT_HDF5_MPIIO" if (1) SERIAL=on, (2) SUPPORT_HDF5=off, (3) HDF5 is not built with the parallel support
+#  if ( defined SERIAL  ||  !defined SUPPORT_HDF5  ||  !defined H5_HAVE_PARALLEL )
+   if ( OPT__OUTPUT_HDF5_MPIIO )
+   {
+      OPT__OUTPUT_HDF5_MPIIO = false;
+
+#     if   ( defined SERIAL )
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_MPIIO, FORMAT_INT, "since SERIAL is enabled" );
+#     elif ( !defined SUPPORT_HDF5 )
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_MPIIO, FORMAT_INT, "since SUPPORT_HDF5 is disabled" );
+#     else
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_MPIIO, FORMAT_INT, "since the HDF5 library does not support parallel I/O" );
+#     endif
+   }
+#  endif
+
+// turn off the HDF5 filters for OPT__OUTPUT_HDF5_MPIIO if HDF5 < 1.10.2, which does not support writing filtered datasets in parallel
+#  ifdef SUPPORT_HDF5
+#  if ( !H5_VERSION_GE(1,10,2) )
+   if ( OPT__OUTPUT_HDF5_MPIIO  &&  OPT__OUTPUT_HDF5_COMPRESS != HDF5_COMPRESS_NONE )
+   {
+      OPT__OUTPUT_HDF5_COMPRESS = HDF5_COMPRESS_NONE;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_COMPRESS, FORMAT_INT, "since parallel compression requires HDF5 >= 1.10.2" );
+   }
+
+   if ( OPT__OUTPUT_HDF5_MPIIO  &&  OUTPUT_HDF5_LOSSY_DIGITS > 0 )
+   {
+      OUTPUT_HDF5_LOSSY_DIGITS = -1;
+
+      PRINT_RESET_PARA( OUTPUT_HDF5_LOSSY_DIGITS, FORMAT_INT, "since parallel compression requires HDF5 >= 1.10.2" );
+   }
+#  endif
+#  endif // #ifdef SUPPORT_HDF5
+
+// turn off "OPT__OUTPUT_HDF5_ASYNC" if (1) SUPPORT_HDF5=off, (2) the HDF5 filters are enabled since the asynchronous output
+// requires contiguous datasets
+#  ifndef SUPPORT_HDF5
+   if ( OPT__OUTPUT_HDF5_ASYNC )
+   {
+      OPT__OUTPUT_HDF5_ASYNC = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_ASYNC, FORMAT_INT, "since SUPPORT_HDF5 is disabled" );
+   }
+#  endif
+
+   if ( OPT__OUTPUT_HDF5_ASYNC  &&  ( OPT__OUTPUT_HDF5_COMPRESS != HDF5_COMPRESS_NONE || OUTPUT_HDF5_LOSSY_DIGITS > 0 ) )
+   {
+      OPT__OUTPUT_HDF5_ASYNC = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_ASYNC, FORMAT_INT, "since it does not support OPT__OUTPUT_HDF5_COMPRESS and OUTPUT_HDF5_LOSSY_DIGITS" );
+   }
+
+// turn off "OPT__OUTPUT_HDF5_MPIIO" if "OPT__OUTPUT_HDF5_ASYNC" is on
+   if ( OPT__OUTPUT_HDF5_ASYNC  &&  OPT__OUTPUT_HDF5_MPIIO )
+   {
+      OPT__OUTPUT_HDF5_MPIIO = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_MPIIO, FORMAT_INT, "since OPT__OUTPUT_HDF5_ASYNC is enabled" );
+   }
+
+
 // disable "OPT__CK_FLUX_ALLOCATE" if no flux arrays are going to be allocated
    if ( OPT__CK_FLUX_ALLOCATE  &&  !amr->WithFlux )
    {
@@ -881,6 +964,17 @@ void Init_ResetParameter()
 #  endif
 
 
+// only load-balance routines support OPT__RESTART_PARALLEL
+#  ifndef LOAD_BALANCE
+   if ( OPT__RESTART_PARALLEL )
+   {
+      OPT__RESTART_PARALLEL = false;
+
+      PRINT_RESET_PARA( OPT__RESTART_PARALLEL, FORMAT_INT, "since LOAD_BALANCE is disabled" );
+   }
+#  endif
+
+
 // OPT__UM_IC_NVAR
    if ( OPT__INIT == INIT_BY_FILE  &&  OPT__UM_IC_NVAR <= 0 )
    {
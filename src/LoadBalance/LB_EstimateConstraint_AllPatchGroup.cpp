@@ -0,0 +1,129 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_EstimateConstraint_AllPatchGroup
+// Description :  Estimate all load-balance constraints of all patch groups in this rank
+//
+// Note        :  1. Used by OPT__LB_MULTI_CONSTRAINT
+//                2. Constraints (see LB_CON_* in Macro.h):
+//                   LB_CON_CELL : number of patches (i.e., 8 per patch group), which is proportional to the
+//                                 number of cells
+//                   LB_CON_PAR  : number of particles, **including particles in the children patches**
+//                                 (same as LB_EstimateWorkload_AllPatchGroup())
+//                   LB_CON_TIME : measured fluid-solver wall time normalized such that the average workload
+//                                 of a single patch is 1.0 (see LB_EstimateWorkload_AllPatchGroup())
+//                                 --> Same as LB_CON_CELL when OPT__LB_MEASURED_COST is off
+//                   LB_CON_MEM  : estimated memory consumption in bytes of the grid data of both sandglasses
+//                                 and the particles residing in the leaf patches
+//                                 --> Buffer patches and temporary arrays are not included
+//                3. Must be invoked by all ranks
+//                4. Particles are NOT collected here
+//                   --> LB_CON_PAR is taken from NPar_PG returned by LB_EstimateWorkload_AllPatchGroup()
+//                   --> LB_CON_MEM only counts the particles in the leaf real patches, which are available
+//                       directly from patch->NPar
+//
+// Parameter   :  lv      : Target refinement level
+//                NPar_PG : Number of particles in all patch groups in this rank returned by
+//                          LB_EstimateWorkload_AllPatchGroup()
+//                          --> Useless if PARTICLE is off
+//                Con_PG  : Estimated constraints of all patch groups in this rank
+//                          --> Must be preallocated with the size "amr->NPatchComma[lv][1]/8"
+//
+// Return      :  Con_PG
+//-------------------------------------------------------------------------------------------------------
+void LB_EstimateConstraint_AllPatchGroup( const int lv, const double *NPar_PG, double (*Con_PG)[LB_NCON] )
+{
+
+// check
+   if ( Con_PG == NULL )   Aux_Error( ERROR_INFO, "Con_PG == NULL !!\n" );
+#  ifdef PARTICLE
+   if ( NPar_PG == NULL )  Aux_Error( ERROR_INFO, "NPar_PG == NULL !!\n" );
+#  endif
+
+
+   const int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
+
+// memory consumption of the grid data in one patch (both sandglasses)
+// --> fluid and pot are stored in real_store (see FLOAT8_STORE) while magnetic and pot_ext are stored in real
+   long PatchByte = (long)NCOMP_TOTAL*CUBE(PS1)*sizeof(real_store) + (long)NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real);
+#  ifdef GRAVITY
+   PatchByte += (long)CUBE(PS1)*sizeof(real_store);
+#  ifdef STORE_POT_GHOST
+   PatchByte += (long)CUBE(GRA_NXT)*sizeof(real);
+#  endif
+#  endif
+   PatchByte *= 2L;
+
+
+// 1. cells, measured time, and grid memory
+   double *Time_PG = new double [NPG_ThisRank];
+
+   LB_EstimateWorkload_AllPatchGroup( lv, 0.0, Time_PG, NULL );
+
+   for (int t=0; t<NPG_ThisRank; t++)
+   {
+      Con_PG[t][LB_CON_CELL] = 8.0;
+      Con_PG[t][LB_CON_PAR ] = 0.0;
+      Con_PG[t][LB_CON_TIME] = Time_PG[t];
+      Con_PG[t][LB_CON_MEM ] = 8.0*PatchByte;
+   }
+
+   delete [] Time_PG;
+
+
+// 2. particles
+#  ifdef PARTICLE
+   const double ParByte = PAR_NATT_TOTAL*sizeof(real_par);
+
+   for (int t=0; t<NPG_ThisRank; t++)
+   {
+      Con_PG[t][LB_CON_PAR] = NPar_PG[t];
+
+//    particles are stored only in the leaf patches
+      for (int PID=t*8; PID<(t+1)*8; PID++)
+         if ( amr->patch[0][lv][PID]->son == -1 )
+            Con_PG[t][LB_CON_MEM] += amr->patch[0][lv][PID]->NPar*ParByte;
+   }
+#  endif // #ifdef PARTICLE
+
+} // FUNCTION : LB_EstimateConstraint_AllPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetConstraintTolerance
+// Description :  Get the imbalance tolerance of all load-balance constraints
+//
+// Note        :  1. Used by OPT__LB_MULTI_CONSTRAINT
+//                2. Constraints not applicable to the current simulation are disabled by setting their
+//                   tolerance to zero
+//                   --> LB_CON_PAR  without PARTICLE
+//                       LB_CON_TIME without OPT__LB_MEASURED_COST
+//
+// Parameter   :  Tol : Array to store the tolerances
+//                      --> <= 0.0 : ignore this constraint
+//
+// Return      :  Tol[]
+//-------------------------------------------------------------------------------------------------------
+void LB_GetConstraintTolerance( double Tol[] )
+{
+
+   Tol[LB_CON_CELL] = LB_MC_TOL_CELL;
+#  ifdef PARTICLE
+   Tol[LB_CON_PAR ] = LB_MC_TOL_PAR;
+#  else
+   Tol[LB_CON_PAR ] = 0.0;
+#  endif
+   Tol[LB_CON_TIME] = ( OPT__LB_MEASURED_COST ) ? LB_MC_TOL_TIME : 0.0;
+   Tol[LB_CON_MEM ] = LB_MC_TOL_MEM;
+
+} // FUNCTION : LB_GetConstraintTolerance
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -21,10 +21,29 @@
 //                           Record__ParticleCount. The latter only considers particles in the leaf patches
 //                4. Invoked by main() to determine whether we should redistribute all patches
 //                   (by calling LB_Init_LoadBalance()) to improve the load balance
+//                5. For OPT__LB_MULTI_CONSTRAINT, also estimate the imbalance "(Max - Ave)/Ave" of each constraint
+//                   returned by LB_EstimateConstraint_AllPatchGroup()
+//                   --> Summed over all levels, where all constraints except LB_CON_MEM are weighted by
+//                       "amr->NUpdateLv"
+//                   --> The imbalance of each constraint is normalized by its tolerance and then scaled by
+//                       amr->LB->WLI_Max (i.e., "WLI_Max*Imb/Tol"), so that it exceeds WLI_Max if and only if the
+//                       constraint exceeds its tolerance
+//                   --> Return the larger of amr->LB->WLI and the worst normalized imbalance of all constraints,
+//                       while amr->LB->WLI still records the weighted load-imbalance factor
+//                   --> Ignored constraints (see LB_GetConstraintTolerance()) are recorded but never trigger
+//                       the redistribution
+//                   --> Hysteresis: if the last redistribution did not reduce the worst normalized imbalance,
+//                       the constraints no longer trigger the redistribution until this imbalance grows again
+//                       --> Return amr->LB->WLI in this case
+//                       --> Only updated when Redistribute == true
 //
-// Return      :  amr->LB->WLI
+// Parameter   :  Redistribute : Whether patches will be redistributed if the returned value > amr->LB->WLI_Max
+//                               --> Used by the hysteresis of OPT__LB_MULTI_CONSTRAINT
+//                               --> Set to false when only recording the load imbalance (e.g., during initialization)
+//
+// Return      :  amr->LB->WLI (or the worst normalized imbalance of all constraints if larger)
 //-------------------------------------------------------------------------------------------------------
-double LB_EstimateLoadImbalance()
+double LB_EstimateLoadImbalance( const bool Redistribute )
 {
 
 // 1. get the workload at each level for each rank
@@ -35,14 +54,19 @@ double LB_EstimateLoadImbalance()
 #  endif
 
    double Load_ThisRank[NLEVEL];
+   double Con_ThisRank[LB_NCON];
+
+   for (int c=0; c<LB_NCON; c++)    Con_ThisRank[c] = 0.0;
 
    for (int lv=0; lv<NLEVEL; lv++)
    {
       const int NPG = amr->NPatchComma[lv][1] / 8;
 
       double *Load_AllPG = new double [NPG];
+      double *NPar_AllPG = ( OPT__LB_MULTI_CONSTRAINT ) ? new double [NPG] : NULL;
 
-      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_AllPG );
+//    also get the number of particles for OPT__LB_MULTI_CONSTRAINT so that particles are collected only once
+      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_AllPG, NPar_AllPG );
 
       Load_ThisRank[lv] = 0.0;
       for (int t=0; t<NPG; t++)  Load_ThisRank[lv] += Load_AllPG[t];
@@ -51,6 +75,22 @@ double LB_EstimateLoadImbalance()
       Load_ThisRank[lv] *= (double)amr->NUpdateLv[lv];
 
       delete [] Load_AllPG;
+
+//    all load-balance constraints (for OPT__LB_MULTI_CONSTRAINT only)
+      if ( OPT__LB_MULTI_CONSTRAINT )
+      {
+         double (*Con_AllPG)[LB_NCON] = new double [NPG][LB_NCON];
+
+         LB_EstimateConstraint_AllPatchGroup( lv, NPar_AllPG, Con_AllPG );
+
+         for (int t=0; t<NPG; t++)
+         for (int c=0; c<LB_NCON; c++)
+            Con_ThisRank[c] += Con_AllPG[t][c]*( (c==LB_CON_MEM) ? 1.0 : (double)amr->NUpdateLv[lv] );
+
+         delete [] Con_AllPG;
+      }
+
+      delete [] NPar_AllPG;
    }
 
 
@@ -59,6 +99,20 @@ double LB_EstimateLoadImbalance()
 
    MPI_Gather( Load_ThisRank, NLEVEL, MPI_DOUBLE, Load_AllRank, NLEVEL, MPI_DOUBLE, 0, MPI_COMM_WORLD );
 
+   double (*Con_AllRank)[LB_NCON] = ( MPI_Rank == 0  &&  OPT__LB_MULTI_CONSTRAINT ) ? new double [MPI_NRank][LB_NCON] : NULL;
+
+   if ( OPT__LB_MULTI_CONSTRAINT )
+      MPI_Gather( Con_ThisRank, LB_NCON, MPI_DOUBLE, (Con_AllRank==NULL)?NULL:Con_AllRank[0], LB_NCON, MPI_DOUBLE,
+                  0, MPI_COMM_WORLD );
+
+// worst normalized imbalance of all constraints that triggered the last redistribution and that was found
+// not reduced by it (for the hysteresis of OPT__LB_MULTI_CONSTRAINT)
+   static double ConImb_LastLB = -1.0;
+   static double ConImb_Skip   = -1.0;
+
+   double Imb_Return = NULL_REAL;
+   bool   ConSkip    = false;
+
 
    if ( MPI_Rank == 0 )
    {
@@ -94,6 +148,50 @@ double LB_EstimateLoadImbalance()
 
       amr->LB->WLI = ( Load_Max_AllLv - Load_Ave_AllLv ) / Load_Ave_AllLv;
 
+//    3-3. each constraint (for OPT__LB_MULTI_CONSTRAINT only)
+      double Con_Max[LB_NCON], Con_Ave[LB_NCON], Con_Imb[LB_NCON], Con_Tol[LB_NCON];
+      double ConImb_Worst = 0.0;
+
+      if ( OPT__LB_MULTI_CONSTRAINT )
+      {
+         LB_GetConstraintTolerance( Con_Tol );
+
+         for (int c=0; c<LB_NCON; c++)
+         {
+            Con_Max[c] = -1.0;
+            Con_Ave[c] = 0.0;
+
+            for (int r=0; r<MPI_NRank; r++)
+            {
+               Con_Max[c]  = MAX( Con_Max[c], Con_AllRank[r][c] );
+               Con_Ave[c] += Con_AllRank[r][c];
+            }
+
+            Con_Ave[c] /= (double)MPI_NRank;
+            Con_Imb[c]  = ( Con_Max[c] == 0.0 ) ? 0.0 : ( Con_Max[c] - Con_Ave[c] ) / Con_Ave[c];
+
+            if ( Con_Tol[c] > 0.0 )    ConImb_Worst = MAX( ConImb_Worst, amr->LB->WLI_Max*Con_Imb[c]/Con_Tol[c] );
+         }
+
+//       hysteresis
+//       --> check whether the last redistribution reduced the worst normalized imbalance
+         if ( Redistribute  &&  ConImb_LastLB >= 0.0 )
+         {
+            if ( ConImb_Worst >= ConImb_LastLB )   ConImb_Skip = ConImb_Worst;
+
+            ConImb_LastLB = -1.0;
+         }
+
+//       --> do not let the constraints trigger the redistribution again until the imbalance grows
+         ConSkip = ( ConImb_Skip >= 0.0  &&  ConImb_Worst <= ConImb_Skip );
+
+         if ( !ConSkip )   ConImb_Skip = -1.0;
+      }
+
+      Imb_Return = ( OPT__LB_MULTI_CONSTRAINT && !ConSkip ) ? MAX( amr->LB->WLI, ConImb_Worst ) : amr->LB->WLI;
+
+      if ( OPT__LB_MULTI_CONSTRAINT  &&  Redistribute  &&  Imb_Return > amr->LB->WLI_Max )   ConImb_LastLB = ConImb_Worst;
+
 
 //    4. write to the file "Record__LoadBalance"
       if ( OPT__RECORD_LOAD_BALANCE )
@@ -156,6 +254,52 @@ double LB_EstimateLoadImbalance()
 
          fprintf( File, "-------------------------------------------------------------------------------------" );
          fprintf( File, "-------------------------------------------------------------------------------------\n" );
+
+//       per-constraint imbalance (for OPT__LB_MULTI_CONSTRAINT only)
+         if ( OPT__LB_MULTI_CONSTRAINT )
+         {
+            const char ConName[LB_NCON][5] = { "Cell", "Par", "Time", "Mem" };
+
+            fprintf( File, "%4s", "Rank" );
+            for (int c=0; c<LB_NCON; c++)    fprintf( File, "%19s", ConName[c] );
+            fprintf( File, "\n" );
+
+            for (int r=0; r<MPI_NRank; r++)
+            {
+               fprintf( File, "%4d", r );
+               for (int c=0; c<LB_NCON; c++) fprintf( File, " %8.2e(%+7.2lf%%)", Con_AllRank[r][c],
+                                                      (Con_Ave[c]==0.0)?0.0:100.0*(Con_AllRank[r][c]-Con_Ave[c])/Con_Ave[c] );
+               fprintf( File, "\n" );
+            }
+
+            fprintf( File, "-------------------------------------------------------------------------------------\n" );
+
+            fprintf( File, "%4s", "Ave:" );
+            for (int c=0; c<LB_NCON; c++)    fprintf( File, " %8.2e%10s", Con_Ave[c], "" );
+            fprintf( File, "\n" );
+
+            fprintf( File, "%4s", "Max:" );
+            for (int c=0; c<LB_NCON; c++)    fprintf( File, " %8.2e%10s", Con_Max[c], "" );
+            fprintf( File, "\n" );
+
+            fprintf( File, "%4s", "Imb:" );
+            for (int c=0; c<LB_NCON; c++)    fprintf( File, " %7.2lf%%%10s", 100.0*Con_Imb[c], "" );
+            fprintf( File, "\n" );
+
+            fprintf( File, "%4s", "Tol:" );
+            for (int c=0; c<LB_NCON; c++)
+            {
+               if ( Con_Tol[c] > 0.0 )    fprintf( File, " %7.2lf%%%10s", 100.0*Con_Tol[c], "" );
+               else                       fprintf( File, " %8s%10s", "ignored", "" );
+            }
+            fprintf( File, "\n" );
+
+            fprintf( File, "Worst normalized constraint imbalance = %6.2f%% (threshold %6.2f%%)%s\n",
+                     100.0*ConImb_Worst, 100.0*amr->LB->WLI_Max,
+                     ( ConSkip ) ? " --> ignored since the last redistribution did not reduce it" : "" );
+
+            fprintf( File, "-------------------------------------------------------------------------------------\n" );
+         } // if ( OPT__LB_MULTI_CONSTRAINT )
          fprintf( File, "\n\n" );
 
          fclose( File );
@@ -163,15 +307,24 @@ double LB_EstimateLoadImbalance()
    } // if ( MPI_Rank == 0 )
 
 
-// broadcast WLI to all ranks
-   MPI_Bcast( &amr->LB->WLI, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+// broadcast WLI and the returned imbalance to all ranks
+   double Imb_Bcast[2] = { amr->LB->WLI, Imb_Return };
+
+   MPI_Bcast( Imb_Bcast, 2, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+   amr->LB->WLI = Imb_Bcast[0];
+   Imb_Return   = Imb_Bcast[1];
 
 
 // free memory
-   if ( MPI_Rank == 0 )    delete [] Load_AllRank;
+   if ( MPI_Rank == 0 )
+   {
+      delete [] Load_AllRank;
+      delete [] Con_AllRank;
+   }
 
 
-   return amr->LB->WLI;
+   return Imb_Return;
 
 } // FUNCTION : LB_EstimateLoadImbalance
 
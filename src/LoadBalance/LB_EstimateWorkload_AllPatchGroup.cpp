@@ -17,16 +17,29 @@
 //                   --> For non-leaf patches, this function will collect particles from the leaf patches
 //                3. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
 //                   function "Mis_GetTotalPatchNumber( lv )"
+//                4. For OPT__LB_MEASURED_COST, the grid workload of each patch group is replaced by its
+//                   measured wall time (patch->LB_Cost) normalized by the average over all measured patch
+//                   groups at lv in all ranks
+//                   --> Average workload of a single patch thus remains 1.0
+//                   --> Patch groups not measured yet are assigned the average workload (i.e., 8.0)
+//                   --> Must be invoked by all ranks
+//                5. The number of particles in each patch group (including particles in the children patches)
+//                   is also returned if NPar_PG != NULL
+//                   --> Particles are collected even when ParWeight <= 0.0 in this case
+//                   --> Used by OPT__LB_MULTI_CONSTRAINT to avoid collecting particles twice
 //
 // Parameter   :  lv        : Target refinement level
 //                ParWeight : Relative workload weighting of particles
 //                            --> <= 0.0 : do not consider particle weighting
 //                Load_PG   : Estimated workload of all patch groups in this rank
 //                            --> Must be preallocated with th size "amr->NPatchComma[lv][1]/8"
+//                NPar_PG   : Number of particles in all patch groups in this rank
+//                            --> Must be preallocated with th size "amr->NPatchComma[lv][1]/8"
+//                            --> NULL : do not return the number of particles
 //
-// Return      :  Load_PG
+// Return      :  Load_PG, NPar_PG (if NPar_PG != NULL)
 //-------------------------------------------------------------------------------------------------------
-void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG )
+void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG, double *NPar_PG )
 {
 
 // check
@@ -39,12 +52,61 @@ void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, do
    for (int t=0; t<NPG_ThisRank; t++)  Load_PG[t] = 8.0; // 8 patches per patch group
 
 
+// 1-1. replace it with the measured workload normalized by its global average
+   if ( OPT__LB_MEASURED_COST )
+   {
+      double *Cost_PG = new double [NPG_ThisRank];
+      double  Sum_ThisRank[2] = { 0.0, 0.0 };   // [0/1] = [sum of measured cost/number of measured patch groups]
+      double  Sum_AllRank [2];
+
+//    a patch group is regarded as measured only if all its patches have been measured
+      for (int t=0; t<NPG_ThisRank; t++)
+      {
+         Cost_PG[t] = 0.0;
+
+         for (int PID=t*8; PID<(t+1)*8; PID++)
+         {
+            const double Cost = amr->patch[0][lv][PID]->LB_Cost;
+
+            if ( Cost < 0.0 )
+            {
+               Cost_PG[t] = -1.0;
+               break;
+            }
+
+            Cost_PG[t] += Cost;
+         }
+
+         if ( Cost_PG[t] >= 0.0 )
+         {
+            Sum_ThisRank[0] += Cost_PG[t];
+            Sum_ThisRank[1] += 1.0;
+         }
+      }
+
+      MPI_Allreduce( Sum_ThisRank, Sum_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      if ( Sum_AllRank[0] > 0.0 )
+      {
+         const double Norm = 8.0*Sum_AllRank[1]/Sum_AllRank[0];
+
+         for (int t=0; t<NPG_ThisRank; t++)
+            if ( Cost_PG[t] >= 0.0 )   Load_PG[t] = Norm*Cost_PG[t];
+      }
+
+      delete [] Cost_PG;
+   } // if ( OPT__LB_MEASURED_COST )
+
+
 // 2. workload of particles
+   if ( NPar_PG != NULL )
+      for (int t=0; t<NPG_ThisRank; t++)  NPar_PG[t] = 0.0;
+
 #  ifdef PARTICLE
-   if ( ParWeight > 0.0 )
+   if ( ParWeight > 0.0  ||  NPar_PG != NULL )
    {
 //    renormalize the load-balance weighting of one particle so that the weighting of one patch is 1.0
-      const double ParWeight_Norm = ParWeight / (double)CUBE(PS1);
+      const double ParWeight_Norm = MAX( ParWeight, 0.0 ) / (double)CUBE(PS1);
 
 //    get the number of particles in each patch
       const bool PredictPos_No     = false;
@@ -72,12 +134,14 @@ void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, do
 
 //       add the load-balance weighting of all particles in this patch
          Load_PG[t] += NParThisPatch*ParWeight_Norm;
+
+         if ( NPar_PG != NULL )  NPar_PG[t] += NParThisPatch;
       } // for t ... PID ...
 
 //    free memory allocated by Par_CollectParticle2OneLevel
       Par_CollectParticle2OneLevel_FreeMemory( lv, SibBufPatch_No, FaSibBufPatch_No );
 
-   } // if ( ParWeight_Norm > 0.0 )
+   } // if ( ParWeight > 0.0  ||  NPar_PG != NULL )
 #  endif // #ifdef PARTICLE
 
 } // FUNCTION : LB_EstimateWorkload_AllPatchGroup
@@ -1,16 +1,60 @@
 #include "GAMER.h"
+#include <unistd.h>
 
 #ifdef LOAD_BALANCE
 
 
 const real BufSizeFactor = 1.05;    // Send/RecvBufSize = (long)(SendSize/RecvSize*BufSizeFactor) --> must be >= 1.0
 
+// the MPI buffers store data in real_store to reduce the communication volume of the patch data
+// --> the face-centered B field and electric field, which are stored in real, are copied bitwise to
+//     NBUF_PER_REAL consecutive buffer elements so that they are transferred without any round-off error
+#define NBUF_PER_REAL   ( (int)( sizeof(real)/sizeof(real_store) ) )
+
+static inline void BufPackReal  (       real_store *Buf, const real Value ) {             memcpy( Buf, &Value, sizeof(real) );                 }
+static inline real BufUnpackReal( const real_store *Buf )                   { real Value; memcpy( &Value, Buf, sizeof(real) );  return Value; }
+
 // MPI buffers are shared by some particle routines
 static void *MPI_SendBuf_Shared = NULL;
 static void *MPI_RecvBuf_Shared = NULL;
 static long  SendBufSize        = -1L;
 static long  RecvBufSize        = -1L;
 
+// persistent MPI requests and their dedicated buffers for OPT__MPI_PERSISTENT
+// --> one set for each combination of (lv, GetBufMode, TVarCC, TVarFC, ParaBuf)
+// --> discarded by LB_GetBufferData_FreePersistent() when the MPI lists are reconstructed
+// --> rebuilt by GetPersistExch() whenever the number of elements exchanged with any rank changes
+struct PersistExch_t
+{
+   GetBufMode_t GetBufMode;
+   long         TVarCC;
+   long         TVarFC;
+   int          ParaBuf;
+   long        *Send_NCount;
+   long        *Recv_NCount;
+   real_store  *SendBuf;
+   real_store  *RecvBuf;
+   int          NReq;
+   MPI_Request *Req;
+};
+
+static PersistExch_t *PersistExch       [NLEVEL];
+static int            PersistExch_N     [NLEVEL];
+static int            PersistExch_NAlloc[NLEVEL];
+
+// dedicated communicator of the persistent requests to avoid matching unrelated messages in flight
+static MPI_Comm       Comm_Persist = MPI_COMM_NULL;
+
+static PersistExch_t *GetPersistExch( const int lv, const GetBufMode_t GetBufMode, const long TVarCC, const long TVarFC,
+                                      const int ParaBuf, const long *Send_NCount, const long *Recv_NCount,
+                                      const long *Send_NDisp, const long *Recv_NDisp,
+                                      const long NSend_Total, const long NRecv_Total );
+static void  InitPersistExch( PersistExch_t *Exch, const long *Send_NCount, const long *Recv_NCount,
+                             const long *Send_NDisp, const long *Recv_NDisp,
+                             const long NSend_Total, const long NRecv_Total );
+static void  FreePersistExch( PersistExch_t *Exch );
+static void *AllocatePageAligned( const long Size );
+
 #ifdef TIMING
 extern Timer_t *Timer_MPI[3];
 #endif
@@ -328,26 +372,26 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             switch ( TMagVarIdx )
             {
                case MAGX :
-                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 2; s< 6; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
-                  for (int s=10; s<14; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
-                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
+                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 2; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
+                  for (int s=10; s<14; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
+                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
                   break;
 
                case MAGY :
-                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 2; s< 4; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 6; s<14; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
-                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
+                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 2; s< 4; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 6; s<14; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
+                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
                   break;
 
                case MAGZ :
-                  for (int s= 0; s< 4; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
-                  for (int s=10; s<18; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
+                  for (int s= 0; s< 4; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
+                  for (int s=10; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
                   break;
 
                default:
@@ -356,8 +400,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             } // switch ( TMagVarIdx )
          } // for (int v=0; v<NVarFC_Mag; v++)
 
-         for (int s=18; s<26; s++)  { DataUnit_Buf[ s] += NVarFC_Mag*ParaBufP1*SQR( ParaBuf ); }
-                                      DataUnit_Buf[26] += NVarFC_Mag*PS1P1*SQR( PS1 );
+         for (int s=18; s<26; s++)  { DataUnit_Buf[ s] += NBUF_PER_REAL*NVarFC_Mag*ParaBufP1*SQR( ParaBuf ); }
+                                      DataUnit_Buf[26] += NBUF_PER_REAL*NVarFC_Mag*PS1P1*SQR( PS1 );
 #        endif // #ifdef MHD
 
          for (int r=0; r<MPI_NRank; r++)
@@ -417,26 +461,26 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             switch ( TMagVarIdx )
             {
                case MAGX :
-                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 2; s< 6; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
-                  for (int s=10; s<14; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
-                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
+                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 2; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
+                  for (int s=10; s<14; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
+                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
                   break;
 
                case MAGY :
-                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 2; s< 4; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 6; s<14; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
-                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
+                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 2; s< 4; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 6; s<14; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
+                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
                   break;
 
                case MAGZ :
-                  for (int s= 0; s< 4; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
-                  for (int s=10; s<18; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
+                  for (int s= 0; s< 4; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
+                  for (int s=10; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
                   break;
 
                default:
@@ -445,8 +489,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             } // switch ( TMagVarIdx )
          } // for (int v=0; v<NVarFC_Mag; v++)
 
-         for (int s=18; s<26; s++)  { DataUnit_Buf[ s] += NVarFC_Mag*ParaBufP1*SQR( ParaBuf ); }
-                                      DataUnit_Buf[26] += NVarFC_Mag*PS1P1*SQR( PS1 );
+         for (int s=18; s<26; s++)  { DataUnit_Buf[ s] += NBUF_PER_REAL*NVarFC_Mag*ParaBufP1*SQR( ParaBuf ); }
+                                      DataUnit_Buf[26] += NBUF_PER_REAL*NVarFC_Mag*PS1P1*SQR( PS1 );
 #        endif // #ifdef MHD
 
          for (int r=0; r<MPI_NRank; r++)
@@ -484,26 +528,26 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             switch ( TMagVarIdx )
             {
                case MAGX :
-                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 2; s< 6; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
-                  for (int s=10; s<14; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
-                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
+                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 2; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
+                  for (int s=10; s<14; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
+                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
                   break;
 
                case MAGY :
-                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 2; s< 4; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 6; s<14; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
-                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
+                  for (int s= 0; s< 2; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 2; s< 4; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 6; s<14; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
+                  for (int s=14; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
                   break;
 
                case MAGZ :
-                  for (int s= 0; s< 4; s++)  DataUnit_Buf[s] += PS1P1 * PS1     * ParaBuf;
-                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += PS1   * PS1     * ParaBufP1;
-                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += PS1P1 * ParaBuf * ParaBuf;
-                  for (int s=10; s<18; s++)  DataUnit_Buf[s] += PS1   * ParaBuf * ParaBufP1;
+                  for (int s= 0; s< 4; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * PS1     * ParaBuf;
+                  for (int s= 4; s< 6; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * PS1     * ParaBufP1;
+                  for (int s= 6; s<10; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1P1 * ParaBuf * ParaBuf;
+                  for (int s=10; s<18; s++)  DataUnit_Buf[s] += NBUF_PER_REAL*PS1   * ParaBuf * ParaBufP1;
                   break;
 
                default:
@@ -512,8 +556,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             } // switch ( TMagVarIdx )
          } // for (int v=0; v<NVarFC_Mag; v++)
 
-         for (int s=18; s<26; s++)  { DataUnit_Buf[ s] = NVarFC_Mag*ParaBufP1*SQR( ParaBuf ); }
-                                      DataUnit_Buf[26] = NVarFC_Mag*PS1P1*SQR( PS1 );
+         for (int s=18; s<26; s++)  { DataUnit_Buf[ s] = NBUF_PER_REAL*NVarFC_Mag*ParaBufP1*SQR( ParaBuf ); }
+                                      DataUnit_Buf[26] = NBUF_PER_REAL*NVarFC_Mag*PS1P1*SQR( PS1 );
 
          for (int r=0; r<MPI_NRank; r++)
          {
@@ -536,8 +580,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             Send_NCount[r]  = (long)Send_NList[r]*(long)CUBE( PS1 )*(long)NVarCC_Tot;
             Recv_NCount[r]  = (long)Recv_NList[r]*(long)CUBE( PS1 )*(long)NVarCC_Tot;
 #           ifdef MHD
-            Send_NCount[r] += (long)Send_NList[r]*(long)SQR( PS1 )*(long)PS1P1*(long)NVarFC_Mag;
-            Recv_NCount[r] += (long)Recv_NList[r]*(long)SQR( PS1 )*(long)PS1P1*(long)NVarFC_Mag;
+            Send_NCount[r] += (long)Send_NList[r]*(long)SQR( PS1 )*(long)PS1P1*(long)NVarFC_Mag*(long)NBUF_PER_REAL;
+            Recv_NCount[r] += (long)Recv_NList[r]*(long)SQR( PS1 )*(long)PS1P1*(long)NVarFC_Mag*(long)NBUF_PER_REAL;
 #           endif
          }
          break; // case DATA_RESTRICT
@@ -561,8 +605,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             Send_NCount[r] = 0L;
             Recv_NCount[r] = 0L;
 
-            for(int t=0; t<Send_NList[r]; t++)  Send_NCount[r] += ( Send_SibList[r][t] < 6 ) ? (long)NCOMP_ELE*(long)PS1M1*(long)PS1 : (long)PS1;
-            for(int t=0; t<Recv_NList[r]; t++)  Recv_NCount[r] += ( Recv_SibList[r][t] < 6 ) ? (long)NCOMP_ELE*(long)PS1M1*(long)PS1 : (long)PS1;
+            for(int t=0; t<Send_NList[r]; t++)  Send_NCount[r] += ( Send_SibList[r][t] < 6 ) ? (long)NBUF_PER_REAL*NCOMP_ELE*PS1M1*PS1 : (long)NBUF_PER_REAL*PS1;
+            for(int t=0; t<Recv_NList[r]; t++)  Recv_NCount[r] += ( Recv_SibList[r][t] < 6 ) ? (long)NBUF_PER_REAL*NCOMP_ELE*PS1M1*PS1 : (long)NBUF_PER_REAL*PS1;
          }
          break; // case COARSE_FINE_ELECTRIC
 #     endif
@@ -584,8 +628,29 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 
 // allocate send/recv buffers (only when the current buffer size is not large enough --> improve performance)
-   real *SendBuf = (real *)LB_GetBufferData_MemAllocate_Send( NSend_Total*sizeof(real) );
-   real *RecvBuf = (real *)LB_GetBufferData_MemAllocate_Recv( NRecv_Total*sizeof(real) );
+// --> use the dedicated buffers attached to the persistent MPI requests when enabling OPT__MPI_PERSISTENT
+// --> exclude the modes used only once right after grid refinement
+   const bool     UsePersist = ( OPT__MPI_PERSISTENT  &&  GetBufMode != DATA_AFTER_REFINE
+#                                ifdef GRAVITY
+                                 &&  GetBufMode != POT_AFTER_REFINE
+#                                endif
+                               );
+   PersistExch_t *Persist    = NULL;
+   real_store    *SendBuf, *RecvBuf;
+
+   if ( UsePersist )
+   {
+      Persist = GetPersistExch( lv, GetBufMode, TVarCC, TVarFC, ParaBuf, Send_NCount, Recv_NCount,
+                                Send_NDisp, Recv_NDisp, NSend_Total, NRecv_Total );
+      SendBuf = Persist->SendBuf;
+      RecvBuf = Persist->RecvBuf;
+   }
+
+   else
+   {
+      SendBuf = (real_store *)LB_GetBufferData_MemAllocate_Send( NSend_Total*sizeof(real_store) );
+      RecvBuf = (real_store *)LB_GetBufferData_MemAllocate_Recv( NRecv_Total*sizeof(real_store) );
+   }
 
 
 
@@ -605,8 +670,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
-            int   Counter = 0;
+            real_store *SendPtr = SendBuf + Send_NDisp[r];
+            int         Counter = 0;
 
             for (int t=0; t<Send_NList[r]; t++)
             {
@@ -695,7 +760,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -705,7 +771,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -715,7 +782,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -738,8 +806,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
-            int   Counter = 0;
+            real_store *SendPtr = SendBuf + Send_NDisp[r];
+            int         Counter = 0;
 
 //          for restriction fix-up
             for (int t=0; t<Send_NResList[r]; t++)
@@ -811,7 +879,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -821,7 +890,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -831,7 +901,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -918,7 +989,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -928,7 +1000,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -938,7 +1011,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                                 BufPackReal( SendPtr+Counter, amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB] );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -961,7 +1035,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
+            real_store *SendPtr = SendBuf + Send_NDisp[r];
 
             for (int t=0; t<Send_NList[r]; t++)
             {
@@ -991,7 +1065,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                   const int TFluVarIdx = TFluVarIdxList[v];
 
                   memcpy( SendPtr, &amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][0][0][0],
-                          PS1*PS1*PS1*sizeof(real) );
+                          PS1*PS1*PS1*sizeof(real_store) );
 
                   SendPtr += CUBE( PS1 );
                }
@@ -1001,7 +1075,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                if ( ExchangePot )
                {
                   memcpy( SendPtr, &amr->patch[PotSg][lv][SPID]->pot[0][0][0],
-                          PS1*PS1*PS1*sizeof(real) );
+                          PS1*PS1*PS1*sizeof(real_store) );
 
                   SendPtr += CUBE( PS1 );
                }
@@ -1017,7 +1091,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                   memcpy( SendPtr, &amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][0],
                           SQR(PS1)*PS1P1*sizeof(real) );
 
-                  SendPtr += SQR( PS1 )*PS1P1;
+                  SendPtr += SQR( PS1 )*PS1P1*NBUF_PER_REAL;
                }
 #              endif
             } // for (int t=0; t<Send_NList[r]; t++)
@@ -1030,14 +1104,14 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
-            int   Counter = 0;
+            real_store *SendPtr = SendBuf + Send_NDisp[r];
+            int         Counter = 0;
 
             for (int t=0; t<Send_NList[r]; t++)
             {
                const int SPID = Send_IDList [r][t];
                const int SSib = Send_SibList[r][t];
-               const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][SPID]->flux[SSib];
+               const real_store (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][SPID]->flux[SSib];
 
 #              ifdef GAMER_DEBUG
                if ( FluxPtr == NULL )
@@ -1049,7 +1123,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                {
                   const int TFluVarIdx = TFluVarIdxList[v];
 
-                  memcpy( SendPtr, FluxPtr[TFluVarIdx], PS1*PS1*sizeof(real) );
+                  memcpy( SendPtr, FluxPtr[TFluVarIdx], PS1*PS1*sizeof(real_store) );
 
                   SendPtr += SQR( PS1 );
                }
@@ -1064,7 +1138,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
+            real_store *SendPtr = SendBuf + Send_NDisp[r];
 
             for (int t=0; t<Send_NList[r]; t++)
             {
@@ -1082,7 +1156,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
                memcpy( SendPtr, ElePtr, SSize*sizeof(real) );
 
-               SendPtr += SSize;
+               SendPtr += SSize*NBUF_PER_REAL;
             } // for (int t=0; t<Send_NList[r]; t++)
          } // for (int r=0; r<MPI_NRank; r++)
          break; // case COARSE_FINE_ELECTRIC
@@ -1099,7 +1173,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 
 
-// 4. transfer data by MPI_Alltoallv
+// 4. transfer data by MPI_Alltoallv (or only with the communicating ranks when enabling OPT__MPI_SPARSE,
+//    or by the persistent MPI requests when enabling OPT__MPI_PERSISTENT)
 // ============================================================================================================
 #  ifdef TIMING
 // it's better to add barrier before timing transferring data through MPI
@@ -1111,8 +1186,19 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
 #  endif
 
-   MPI_Alltoallv_GAMER( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL,
-                        RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
+   if ( UsePersist )
+   {
+      MPI_Startall( Persist->NReq, Persist->Req );
+
+//    data to be sent to the same rank are copied directly
+      memcpy( RecvBuf+Recv_NDisp[MPI_Rank], SendBuf+Send_NDisp[MPI_Rank], Send_NCount[MPI_Rank]*sizeof(real_store) );
+
+      MPI_Waitall( Persist->NReq, Persist->Req, MPI_STATUSES_IGNORE );
+   }
+
+   else
+      LB_SparseAlltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL_STORE,
+                          RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL_STORE, MPI_COMM_WORLD );
 
 #  ifdef TIMING
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
@@ -1136,8 +1222,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
-            int   Counter = 0;
+            real_store *RecvPtr = RecvBuf + Recv_NDisp[r];
+            int         Counter = 0;
 
             for (int t=0; t<Recv_NList[r]; t++)
             {
@@ -1226,7 +1312,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1236,7 +1323,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1246,7 +1334,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1269,8 +1358,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
-            int   Counter = 0;
+            real_store *RecvPtr = RecvBuf + Recv_NDisp[r];
+            int         Counter = 0;
 
 //          for restriction fix-up
             for (int t=0; t<Recv_NResList[r]; t++)
@@ -1342,7 +1431,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1352,7 +1442,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1362,7 +1453,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1449,7 +1541,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1459,7 +1552,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1469,7 +1563,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                               for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
                               {
                                  const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = BufUnpackReal( RecvPtr+Counter );
+                                 Counter += NBUF_PER_REAL;
                               }
                               break;
 
@@ -1492,7 +1587,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
+            real_store *RecvPtr = RecvBuf + Recv_NDisp[r];
 
             for (int t=0; t<Recv_NList[r]; t++)
             {
@@ -1521,7 +1616,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                for (int v=0; v<NVarCC_Flu; v++)
                {
                   const int TFluVarIdx = TFluVarIdxList[v];
-                  memcpy( &amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][0][0][0], RecvPtr, CUBE(PS1)*sizeof(real) );
+                  memcpy( &amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][0][0][0], RecvPtr, CUBE(PS1)*sizeof(real_store) );
                   RecvPtr += CUBE( PS1 );
                }
 
@@ -1529,7 +1624,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #              ifdef GRAVITY
                if ( ExchangePot )
                {
-                  memcpy( &amr->patch[PotSg][lv][RPID]->pot[0][0][0], RecvPtr, CUBE(PS1)*sizeof(real) );
+                  memcpy( &amr->patch[PotSg][lv][RPID]->pot[0][0][0], RecvPtr, CUBE(PS1)*sizeof(real_store) );
                   RecvPtr += CUBE( PS1 );
                }
 #              endif
@@ -1541,7 +1636,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                {
                   const int TMagVarIdx = TMagVarIdxList[v];
                   memcpy( &amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][0], RecvPtr, SQR(PS1)*PS1P1*sizeof(real) );
-                  RecvPtr += SQR( PS1 )*PS1P1;
+                  RecvPtr += SQR( PS1 )*PS1P1*NBUF_PER_REAL;
                }
 #              endif
             } // for (int t=0; t<Recv_NList[r]; t++)
@@ -1554,14 +1649,14 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
-            int   Counter = 0;
+            real_store *RecvPtr = RecvBuf + Recv_NDisp[r];
+            int         Counter = 0;
 
             for (int t=0; t<Recv_NList[r]; t++)
             {
                const int RPID = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];
                const int RSib = Recv_SibList[r][t];
-               real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][RPID]->flux[RSib];
+               real_store (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][RPID]->flux[RSib];
 
 #              ifdef GAMER_DEBUG
                if ( FluxPtr == NULL )
@@ -1589,7 +1684,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
+            real_store *RecvPtr = RecvBuf + Recv_NDisp[r];
 
             for (int t=0; t<Recv_NList[r]; t++)
             {
@@ -1610,9 +1705,9 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #              endif
 
 //             add (not replace) electric field array with the received data
-               for (int i=0; i<RSize; i++)   ElePtr[i] += RecvPtr[i];
+               for (int i=0; i<RSize; i++)   ElePtr[i] += BufUnpackReal( RecvPtr+i*NBUF_PER_REAL );
 
-               RecvPtr += RSize;
+               RecvPtr += RSize*NBUF_PER_REAL;
 
 #              ifdef GAMER_DEBUG
                if ( RSib >= 6 )  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] = true;
@@ -1664,8 +1759,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                                  "Send(MB/s)", "Recv(MB/s)" );
       FirstTime = false;
 
-      const double SendMB = NSend_Total*sizeof(real)*1.0e-6;
-      const double RecvMB = NRecv_Total*sizeof(real)*1.0e-6;
+      const double SendMB = NSend_Total*sizeof(real_store)*1.0e-6;
+      const double RecvMB = NRecv_Total*sizeof(real_store)*1.0e-6;
 
       fprintf( File, "%3d %15s %4d %4d %10.5f %10.5f %10.5f %8.3f %8.3f %10.3f %10.3f\n",
                lv, ModeName, NVarCC_Tot, (GetBufMode==DATA_RESTRICT || GetBufMode==COARSE_FINE_FLUX)?-1:ParaBuf,
@@ -1881,12 +1976,18 @@ void *LB_GetBufferData_MemAllocate_Recv( const long RecvSize )
 // Note        :  1. This function is invoked by "End_MemFree"
 //                2. Use ::operator delete to deallocate MPI_SendBuf_Shared/MPI_RecvBuf_Shared, because
 //                   they are void pointers allocated as raw memories.
+//                3. Also free the persistent MPI requests, their buffers of all levels, and their communicator
+//                   (OPT__MPI_PERSISTENT)
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
 void LB_GetBufferData_MemFree()
 {
 
+   for (int lv=0; lv<NLEVEL; lv++)  LB_GetBufferData_FreePersistent( lv );
+
+   if ( Comm_Persist != MPI_COMM_NULL )   MPI_Comm_free( &Comm_Persist );
+
    if ( MPI_SendBuf_Shared != NULL )
    {
       ::operator delete (MPI_SendBuf_Shared);
@@ -1903,4 +2004,241 @@ void LB_GetBufferData_MemFree()
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_FreePersistent
+// Description :  Free all persistent MPI requests and their buffers of LB_GetBufferData() at the target level
+//
+// Note        :  1. Invoked by LB_RecordExchangeDataPatchID() since the persistent requests become invalid
+//                   once the MPI lists are reconstructed after grid refinement or patch redistribution
+//                2. Also invoked by LB_GetBufferData_MemFree()
+//                3. All requests must be inactive (i.e., completed by MPI_Waitall()) when calling this function
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_FreePersistent( const int lv )
+{
+
+   if ( lv < 0  ||  lv >= NLEVEL )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
+
+   for (int t=0; t<PersistExch_N[lv]; t++)   FreePersistExch( PersistExch[lv]+t );
+
+   free( PersistExch[lv] );
+
+   PersistExch       [lv] = NULL;
+   PersistExch_N     [lv] = 0;
+   PersistExch_NAlloc[lv] = 0;
+
+} // FUNCTION : LB_GetBufferData_FreePersistent
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPersistExch
+// Description :  Return the persistent MPI requests of LB_GetBufferData() for the target exchange and
+//                create them if they do not exist yet
+//
+// Note        :  1. The buffer layout depends on (lv, GetBufMode, TVarCC, TVarFC, ParaBuf) and the number of
+//                   elements exchanged with each rank
+//                   --> The sandglasses FluSg/MagSg/PotSg only affect the data packed into the buffers
+//                   --> Existing requests are rebuilt if any per-rank count differs from the one used to create
+//                       them, even when the total sizes are the same
+//                2. See InitPersistExch() for the creation of requests
+//
+// Parameter   :  lv          : Target refinement level
+//                GetBufMode  : Target mode
+//                TVarCC      : Target cell-centered variables
+//                TVarFC      : Target face-centered variables
+//                ParaBuf     : Number of ghost zones to exchange
+//                Send_NCount : Number of elements to be sent to each rank
+//                Recv_NCount : Number of elements to be received from each rank
+//                Send_NDisp  : Displacement of the send buffer of each rank
+//                Recv_NDisp  : Displacement of the recv buffer of each rank
+//                NSend_Total : Total number of elements to be sent
+//                NRecv_Total : Total number of elements to be received
+//
+// Return      :  Pointer to the persistent MPI requests and buffers
+//-------------------------------------------------------------------------------------------------------
+PersistExch_t *GetPersistExch( const int lv, const GetBufMode_t GetBufMode, const long TVarCC, const long TVarFC,
+                               const int ParaBuf, const long *Send_NCount, const long *Recv_NCount,
+                               const long *Send_NDisp, const long *Recv_NDisp,
+                               const long NSend_Total, const long NRecv_Total )
+{
+
+// 1. return the existing requests
+   for (int t=0; t<PersistExch_N[lv]; t++)
+   {
+      PersistExch_t *Exch = PersistExch[lv] + t;
+
+      if ( Exch->GetBufMode == GetBufMode  &&  Exch->TVarCC == TVarCC  &&  Exch->TVarFC == TVarFC  &&
+           Exch->ParaBuf == ParaBuf )
+      {
+//       rebuild the requests if the number of elements exchanged with any rank has changed
+         bool Match = true;
+
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            if ( Exch->Send_NCount[r] != Send_NCount[r]  ||  Exch->Recv_NCount[r] != Recv_NCount[r] )
+            {
+               Match = false;
+               break;
+            }
+         }
+
+         if ( !Match )
+         {
+            FreePersistExch( Exch );
+            InitPersistExch( Exch, Send_NCount, Recv_NCount, Send_NDisp, Recv_NDisp, NSend_Total, NRecv_Total );
+         }
+
+         return Exch;
+      }
+   }
+
+
+// 2. create new requests
+   if ( PersistExch_N[lv] >= PersistExch_NAlloc[lv] )
+   {
+      PersistExch_NAlloc[lv] = ( PersistExch_NAlloc[lv] == 0 ) ? 8 : 2*PersistExch_NAlloc[lv];
+      PersistExch       [lv] = (PersistExch_t*)realloc( PersistExch[lv], PersistExch_NAlloc[lv]*sizeof(PersistExch_t) );
+
+      if ( PersistExch[lv] == NULL )   Aux_Error( ERROR_INFO, "failed to allocate the persistent request list !!\n" );
+   }
+
+   PersistExch_t *Exch = PersistExch[lv] + PersistExch_N[lv];
+
+   Exch->GetBufMode = GetBufMode;
+   Exch->TVarCC     = TVarCC;
+   Exch->TVarFC     = TVarFC;
+   Exch->ParaBuf    = ParaBuf;
+
+   InitPersistExch( Exch, Send_NCount, Recv_NCount, Send_NDisp, Recv_NDisp, NSend_Total, NRecv_Total );
+
+   PersistExch_N[lv] ++;
+
+   return Exch;
+
+} // FUNCTION : GetPersistExch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  InitPersistExch
+// Description :  Create the persistent MPI requests and buffers of one exchange
+//
+// Note        :  1. Invoked by GetPersistExch()
+//                2. Requests are created by MPI_Send_init() and MPI_Recv_init() for ranks with non-zero
+//                   counts only, excluding the rank itself
+//                   --> Sent through the dedicated communicator Comm_Persist, which is duplicated from
+//                       MPI_COMM_WORLD on the first call
+//                3. Send/recv buffers are page-aligned and dedicated to each set of requests so that
+//                   they stay at the same addresses as required by the persistent requests
+//                4. The per-rank counts are recorded for GetPersistExch() to detect changes
+//
+// Parameter   :  Exch        : Target exchange
+//                Send_NCount : Number of elements to be sent to each rank
+//                Recv_NCount : Number of elements to be received from each rank
+//                Send_NDisp  : Displacement of the send buffer of each rank
+//                Recv_NDisp  : Displacement of the recv buffer of each rank
+//                NSend_Total : Total number of elements to be sent
+//                NRecv_Total : Total number of elements to be received
+//-------------------------------------------------------------------------------------------------------
+void InitPersistExch( PersistExch_t *Exch, const long *Send_NCount, const long *Recv_NCount,
+                      const long *Send_NDisp, const long *Recv_NDisp,
+                      const long NSend_Total, const long NRecv_Total )
+{
+
+   if ( Comm_Persist == MPI_COMM_NULL )   MPI_Comm_dup( MPI_COMM_WORLD, &Comm_Persist );
+
+   Exch->Send_NCount = new long [MPI_NRank];
+   Exch->Recv_NCount = new long [MPI_NRank];
+   Exch->SendBuf     = (real_store*)AllocatePageAligned( NSend_Total*sizeof(real_store) );
+   Exch->RecvBuf     = (real_store*)AllocatePageAligned( NRecv_Total*sizeof(real_store) );
+   Exch->NReq        = 0;
+   Exch->Req         = new MPI_Request [ 2*MPI_NRank ];
+
+   memcpy( Exch->Send_NCount, Send_NCount, MPI_NRank*sizeof(long) );
+   memcpy( Exch->Recv_NCount, Recv_NCount, MPI_NRank*sizeof(long) );
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )    continue;
+
+      if ( Send_NCount[r] > __INT_MAX__  ||  Recv_NCount[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "MPI count (send %ld, recv %ld) exceeds the maximum integer !!\n",
+                    Send_NCount[r], Recv_NCount[r] );
+
+      if ( Recv_NCount[r] > 0L )
+      {
+         MPI_Recv_init( Exch->RecvBuf+Recv_NDisp[r], (int)Recv_NCount[r], MPI_GAMER_REAL_STORE, r, 0, Comm_Persist,
+                        Exch->Req+Exch->NReq );
+         Exch->NReq ++;
+      }
+
+      if ( Send_NCount[r] > 0L )
+      {
+         MPI_Send_init( Exch->SendBuf+Send_NDisp[r], (int)Send_NCount[r], MPI_GAMER_REAL_STORE, r, 0, Comm_Persist,
+                        Exch->Req+Exch->NReq );
+         Exch->NReq ++;
+      }
+   }
+
+} // FUNCTION : InitPersistExch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FreePersistExch
+// Description :  Free the persistent MPI requests and buffers of one exchange
+//
+// Note        :  1. All requests must be inactive
+//
+// Parameter   :  Exch : Target exchange
+//-------------------------------------------------------------------------------------------------------
+void FreePersistExch( PersistExch_t *Exch )
+{
+
+   for (int q=0; q<Exch->NReq; q++)    MPI_Request_free( Exch->Req+q );
+
+   delete [] Exch->Req;
+   delete [] Exch->Send_NCount;
+   delete [] Exch->Recv_NCount;
+   free( Exch->SendBuf );
+   free( Exch->RecvBuf );
+
+   Exch->NReq = 0;
+
+} // FUNCTION : FreePersistExch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AllocatePageAligned
+// Description :  Allocate memory aligned to the page boundary
+//
+// Note        :  1. Page-aligned buffers can be registered by the MPI library more efficiently
+//                2. Free the returned memory by free()
+//                3. Always allocate at least one page so that the returned pointer is never NULL
+//
+// Parameter   :  Size : Number of bytes to be allocated
+//
+// Return      :  Pointer to the allocated memory
+//-------------------------------------------------------------------------------------------------------
+void *AllocatePageAligned( const long Size )
+{
+
+   const long PageSize  = sysconf( _SC_PAGESIZE );
+   const long AllocSize = ( Size <= 0L ) ? PageSize : ( (Size+PageSize-1L)/PageSize )*PageSize;
+
+   void *Ptr = NULL;
+
+   if ( posix_memalign( &Ptr, PageSize, AllocSize ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to allocate %ld bytes of page-aligned memory !!\n", AllocSize );
+
+   return Ptr;
+
+} // FUNCTION : AllocatePageAligned
+
+
+
 #endif // #ifdef LOAD_BALANCE
@@ -4,7 +4,8 @@
 
 
 
-static void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool RemoveParFromRepo, const bool SendGridData );
+static void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool RemoveParFromRepo, const bool SendGridData,
+                                      const bool MigrateOnly );
 static void LB_SortRealPatch( const int lv );
 #ifdef PARTICLE
 static void LB_RedistributeParticle_Init( real_par **ParAtt_Old );
@@ -51,12 +52,20 @@ static void LB_RedistributeParticle_End ( real_par **ParAtt_Old );
 //                                    the same number of MPI processes
 //                                --> Controlled by the runtime parameter OPT__SORT_PATCH_BY_LBIDX
 //                                --> Work even for Redistribute==false
+//                KeepCutPoint  : Redistribute real patches according to the cut points already stored in
+//                                amr->LB->CutPoint[] instead of invoking LB_SetCutPoint()
+//                                --> Used by the incremental load balancing (OPT__LB_INCREMENTAL), where the cut
+//                                    points are shifted by LB_SetCutPoint_Incremental() in advance
+//                                --> Only the patch groups whose owner changes are migrated and all other real
+//                                    patches stay in place (see LB_RedistributeRealPatch())
+//                                --> Must be applied to a single level (i.e., TLv>=0)
+//                                --> Useless when Redistribute==false
 //                TLv           : Target refinement level(s)
 //                                --> 0~TOP_LEVEL : only apply to a specific level
 //                                    <0          : apply to all levels
 //-------------------------------------------------------------------------------------------------------
 void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, const double ParWeight, const bool Reset,
-                          const bool SortRealPatch, const int TLv )
+                          const bool SortRealPatch, const bool KeepCutPoint, const int TLv )
 {
 
    if ( MPI_Rank == 0 )
@@ -69,11 +78,21 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
    }
 
 
+// patch indices may change --> clear the patch-data cache
+   Prepare_PatchData_Cache_Reset();
+
+
 // check
    if ( amr->LB == NULL )  Aux_Error( ERROR_INFO, "amr->LB has not been allocated !!\n" );
 
    if ( TLv > TOP_LEVEL )  Aux_Error( ERROR_INFO, "TLv (%d) > TOP_LEVEL (%d) !!\n", TLv, TOP_LEVEL );
 
+   if ( Redistribute  &&  KeepCutPoint  &&  TLv < 0 )
+      Aux_Error( ERROR_INFO, "KeepCutPoint only supports a single target level (TLv = %d) !!\n", TLv );
+
+// patch indices and owners may change --> invalidate the lists built upon them (e.g., see Patch2Pencil())
+   amr->LB->NInit ++;
+
 // check the synchronization
    if ( TLv < 0 )
    for (int lv=1; lv<NLEVEL; lv++)
@@ -96,7 +115,7 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
 // 1. set up the load-balance cut points (must do this before calling LB_RedistributeParticle_Init())
    const bool InputLBIdxAndLoad_No = false;
 
-   if ( Redistribute )
+   if ( Redistribute  &&  !KeepCutPoint )
    for (int lv=lv_min; lv<=lv_max; lv++)
       LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdxAndLoad_No, NULL, NULL, ParWeight );
 
@@ -113,6 +132,9 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
 
 
 // 3. re-distribute and allocate all patches (and their associated particles)
+// invalidate the neighbor list of the sparse MPI exchange until it is reconstructed in step 5.7
+   amr->LB->NNeighbor = -1;
+
    const bool RemoveParFromRepo_Yes = true;
    const bool RemoveParFromRepo_No  = false;
 
@@ -146,7 +168,7 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
 
 //    3.1 re-distribute real patches (and particles)
       if ( Redistribute )
-      LB_RedistributeRealPatch( lv, ParAtt_Old, (TLv<0)?RemoveParFromRepo_No:RemoveParFromRepo_Yes, SendGridData );
+      LB_RedistributeRealPatch( lv, ParAtt_Old, (TLv<0)?RemoveParFromRepo_No:RemoveParFromRepo_Yes, SendGridData, KeepCutPoint );
 
 //    3.2 sort real patches
       if ( SortRealPatch )
@@ -248,15 +270,22 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
       if ( OPT__OVERLAP_MPI )
       LB_RecordOverlapMPIPatchID( lv );
 
-//    5.7 list for exchanging particles
-#     ifdef PARTICLE
-      Par_LB_RecordExchangeParticlePatchID( lv );
-#     endif
-
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
    } // for (int lv=lv_min_mpi; lv<=lv_max_mpi; lv++)
 
-// 5.8 list for exchanging particles on TLv+1
+// 5.7 list of neighbor ranks for the sparse MPI exchange
+//     --> must be done after allocating all buffer patches but before constructing the particle lists,
+//         which already use the sparse MPI exchange
+   if ( OPT__MPI_SPARSE )
+   LB_RecordNeighborRank();
+
+// 5.8 list for exchanging particles
+#  ifdef PARTICLE
+   for (int lv=lv_min_mpi; lv<=lv_max_mpi; lv++)
+   Par_LB_RecordExchangeParticlePatchID( lv );
+#  endif
+
+// 5.9 list for exchanging particles on TLv+1
 #  ifdef PARTICLE
    if ( TLv >= 0  &&  TLv < TOP_LEVEL )
    Par_LB_RecordExchangeParticlePatchID( TLv+1 );
@@ -316,6 +345,14 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
 //                3. Real patches with LB_Idx in the range "CutPoint[lv][r] <= LB_Idx < CutPoint[lv][r+1]"
 //                   will be sent to rank "r"
 //                4. Particles will be redistributed along with the leaf patches as well
+//                5. The measured workload of each patch (LB_Cost) is also redistributed when enabling
+//                   OPT__LB_MEASURED_COST
+//                6. For MigrateOnly==true, only the patch groups whose owner changes are sent
+//                   --> Real patches staying in this rank are kept in place (with their data and particles) and
+//                       moved to the beginning of the patch list, and the received patches are appended after them
+//                   --> All buffer patches at lv are removed and must be reconstructed afterward
+//                   --> Particles of the migrated patches must be removed from the particle repository
+//                       (i.e., RemoveParFromRepo==true) since the remaining ones stay in the repository
 //
 // Parameter   :  lv                : Target refinement level
 //                ParAtt_Old        : Pointers pointing to the particle attribute arrays (amr->Par->Attribute[])
@@ -323,10 +360,18 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
 //                                    --> Useful when applying LB_Init_LoadBalance() to a single level (i.e., TLv>=0)
 //                SendGridData      : Transfer grid data
 //                                    --> Particle data will always be transferred
+//                MigrateOnly       : Only send the patch groups not belonging to this rank anymore
+//                                    --> Used by the incremental load balancing (OPT__LB_INCREMENTAL)
 //-------------------------------------------------------------------------------------------------------
-void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool RemoveParFromRepo, const bool SendGridData )
+void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool RemoveParFromRepo, const bool SendGridData,
+                               const bool MigrateOnly )
 {
 
+#  ifdef PARTICLE
+   if ( MigrateOnly  &&  !RemoveParFromRepo )
+      Aux_Error( ERROR_INFO, "RemoveParFromRepo must be on for MigrateOnly !!\n" );
+#  endif
+
 // 1. count the number of real patches (and particles) to be sent and received
 // ==========================================================================================
    const int FluSize1v  = CUBE( PS1 );
@@ -337,7 +382,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    const int MagSize1v  = PS1P1*SQR( PS1 );
 #  endif
 
-   int  NSend_Total_Patch, NRecv_Total_Patch, TRank;
+   int  NSend_Total_Patch, NRecv_Total_Patch, NStay_Patch, TRank;
    long LB_Idx;
 
    int *Send_NCount_Patch    = new int  [MPI_NRank];
@@ -396,11 +441,21 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 #  endif
 
 // 1.1 send count
+// --> for MigrateOnly, real patches staying in this rank are not sent
+//     --> all patches in a patch group always have the same target rank
+   NStay_Patch = 0;
+
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
       LB_Idx = amr->patch[0][lv][PID]->LB_Idx;
       TRank  = LB_Index2Rank( lv, LB_Idx, CHECK_ON );
 
+      if ( MigrateOnly  &&  TRank == MPI_Rank )
+      {
+         NStay_Patch ++;
+         continue;
+      }
+
       Send_NCount_Patch  [TRank] ++;
 #     ifdef PARTICLE
       Send_NCount_ParData[TRank] += (long)amr->patch[0][lv][PID]->NPar;
@@ -458,12 +513,15 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 
 // 1.6 check
 #  ifdef GAMER_DEBUG
-   if ( NSend_Total_Patch != amr->NPatchComma[lv][1] )
-      Aux_Error( ERROR_INFO, "NSend_Total_Patch (%d) != expected (%d) !!\n",
-                 NSend_Total_Patch, amr->NPatchComma[lv][1] );
+   if ( NSend_Total_Patch + NStay_Patch != amr->NPatchComma[lv][1] )
+      Aux_Error( ERROR_INFO, "NSend_Total_Patch (%d) + NStay_Patch (%d) != expected (%d) !!\n",
+                 NSend_Total_Patch, NStay_Patch, amr->NPatchComma[lv][1] );
+
+   if ( NStay_Patch % 8 != 0 )
+      Aux_Error( ERROR_INFO, "NStay_Patch (%d) %% 8 != 0 !!\n", NStay_Patch );
 #  endif
 #  ifdef DEBUG_PARTICLE
-   if ( NSend_Total_ParData != (long)amr->Par->NPar_Lv[lv]*(long)PAR_NATT_TOTAL )
+   if ( !MigrateOnly  &&  NSend_Total_ParData != (long)amr->Par->NPar_Lv[lv]*(long)PAR_NATT_TOTAL )
       Aux_Error( ERROR_INFO, "NSend_Total_ParData (%ld) != expected (%ld) !!\n",
                  NSend_Total_ParData, (long)amr->Par->NPar_Lv[lv]*(long)PAR_NATT_TOTAL );
 #  endif
@@ -487,12 +545,14 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    const long RecvDataSizeMag1v  = NRecv_Total_Patch*MagSize1v;
 #  endif
 
-   real     *SendPtr         = NULL;
-   real_par *SendPtr_Par     = NULL;
-   long     *SendBuf_LBIdx   = new long [ NSend_Total_Patch ];
-   real     *SendBuf_Flu     = ( SendGridData ) ? new real [ SendDataSizeFlu1v*NCOMP_TOTAL ] : NULL;
+   real       *SendPtr         = NULL;
+   real_store *SendPtr_Store   = NULL;
+   real_par   *SendPtr_Par     = NULL;
+   long       *SendBuf_LBIdx   = new long [ NSend_Total_Patch ];
+   double     *SendBuf_Cost    = ( OPT__LB_MEASURED_COST ) ? new double [ NSend_Total_Patch ]      : NULL;
+   real_store *SendBuf_Flu     = ( SendGridData ) ? new real_store [ SendDataSizeFlu1v*NCOMP_TOTAL ] : NULL;
 #  ifdef GRAVITY
-   real     *SendBuf_Pot     = ( SendGridData ) ? new real [ SendDataSizeFlu1v ]             : NULL;
+   real_store *SendBuf_Pot     = ( SendGridData ) ? new real_store [ SendDataSizeFlu1v ]             : NULL;
 #  ifdef STORE_POT_GHOST
    real     *SendBuf_PotExt  = ( SendGridData ) ? new real [ SendDataSizePotExt ]            : NULL;
 #  endif
@@ -518,22 +578,28 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
       LB_Idx = amr->patch[0][lv][PID]->LB_Idx;
       TRank  = LB_Index2Rank( lv, LB_Idx, CHECK_ON );
 
+      if ( MigrateOnly  &&  TRank == MPI_Rank )    continue;
+
 //    2.1 LB_Idx
       SendBuf_LBIdx[ Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = LB_Idx;
 
+//    measured workload (for OPT__LB_MEASURED_COST only)
+      if ( OPT__LB_MEASURED_COST )
+      SendBuf_Cost [ Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = amr->patch[0][lv][PID]->LB_Cost;
+
       if ( SendGridData )
       {
 //       2.2 fluid
          for (int v=0; v<NCOMP_TOTAL; v++)
          {
-            SendPtr = SendBuf_Flu + v*SendDataSizeFlu1v + Send_NDisp_Flu1v[TRank] + (long)NDone_Patch[TRank]*FluSize1v;
-            memcpy( SendPtr, &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], FluSize1v*sizeof(real) );
+            SendPtr_Store = SendBuf_Flu + v*SendDataSizeFlu1v + Send_NDisp_Flu1v[TRank] + (long)NDone_Patch[TRank]*FluSize1v;
+            memcpy( SendPtr_Store, &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], FluSize1v*sizeof(real_store) );
          }
 
 #        ifdef GRAVITY
 //       2.3 potential
-         SendPtr = SendBuf_Pot + Send_NDisp_Flu1v[TRank] + (long)NDone_Patch[TRank]*FluSize1v;
-         memcpy( SendPtr, &amr->patch[PotSg][lv][PID]->pot[0][0][0], FluSize1v*sizeof(real) );
+         SendPtr_Store = SendBuf_Pot + Send_NDisp_Flu1v[TRank] + (long)NDone_Patch[TRank]*FluSize1v;
+         memcpy( SendPtr_Store, &amr->patch[PotSg][lv][PID]->pot[0][0][0], FluSize1v*sizeof(real_store) );
 
 //       2.4 potential with ghost zones
 #        ifdef STORE_POT_GHOST
@@ -588,7 +654,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 
 // check if all particles are detached from patches at lv
 #  ifdef DEBUG_PARTICLE
-   if ( amr->Par->NPar_Lv[lv] != 0 )
+   if ( !MigrateOnly  &&  amr->Par->NPar_Lv[lv] != 0 )
       Aux_Error( ERROR_INFO, "NPar_Lv[%d] = %ld != 0 !!\n", lv, amr->Par->NPar_Lv[lv] );
 #  endif
 
@@ -598,13 +664,45 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 // free memory first to reduce the memory consumption
 // --> for OPT__REUSE_MEMORY == 2 (aggressive mode), we only mark patches as inactive but do not deallocate memory
 // --> NPatchComma is also reset to 0 here
-   amr->Lvdelete( lv, OPT__REUSE_MEMORY==2 );
+   if ( MigrateOnly )
+   {
+//    move the staying patch groups to the beginning of the patch list by swapping pointers
+//    --> the patch relation will be reconstructed by LB_Init_LoadBalance()
+      int PID0_Stay = 0;
+
+      for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+      {
+         if ( LB_Index2Rank( lv, amr->patch[0][lv][PID0]->LB_Idx, CHECK_ON ) != MPI_Rank )   continue;
+
+         if ( PID0 != PID0_Stay )
+         for (int LocalID=0; LocalID<8; LocalID++)
+         for (int Sg=0; Sg<2; Sg++)
+            Aux_SwapPointer( (void**)&amr->patch[Sg][lv][PID0+LocalID], (void**)&amr->patch[Sg][lv][PID0_Stay+LocalID] );
+
+         PID0_Stay += 8;
+      }
+
+//    delete the migrated real patches and all buffer patches, which are now at the end of the patch list
+//    --> reset son=-1 to skip the check in pdelete() (as in Lvdelete())
+      for (int PID=amr->num[lv]-1; PID>=NStay_Patch; PID--)
+      {
+         amr->patch[0][lv][PID]->son = -1;
+         amr->pdelete( lv, PID, OPT__REUSE_MEMORY==2 );
+      }
+
+      for (int m=0; m<28; m++)   amr->NPatchComma[lv][m] = 0;
+      amr->NPatchComma[lv][1] = NStay_Patch;
+   }
+
+   else
+      amr->Lvdelete( lv, OPT__REUSE_MEMORY==2 );
 
 // allocate recv buffers AFTER deleting old patches
    long *RecvBuf_LBIdx   = new long [ NRecv_Total_Patch ];
-   real *RecvBuf_Flu     = ( SendGridData ) ? new real [ RecvDataSizeFlu1v*NCOMP_TOTAL ] : NULL;
+   double *RecvBuf_Cost  = ( OPT__LB_MEASURED_COST ) ? new double [ NRecv_Total_Patch ]      : NULL;
+   real_store *RecvBuf_Flu = ( SendGridData ) ? new real_store [ RecvDataSizeFlu1v*NCOMP_TOTAL ] : NULL;
 #  ifdef GRAVITY
-   real *RecvBuf_Pot     = ( SendGridData ) ? new real [ RecvDataSizeFlu1v ]             : NULL;
+   real_store *RecvBuf_Pot = ( SendGridData ) ? new real_store [ RecvDataSizeFlu1v ]             : NULL;
 #  ifdef STORE_POT_GHOST
    real *RecvBuf_PotExt  = ( SendGridData ) ? new real [ RecvDataSizePotExt ]            : NULL;
 #  endif
@@ -624,13 +722,17 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    MPI_Alltoallv( SendBuf_LBIdx, Send_NCount_Patch, Send_NDisp_Patch, MPI_LONG,
                   RecvBuf_LBIdx, Recv_NCount_Patch, Recv_NDisp_Patch, MPI_LONG, MPI_COMM_WORLD );
 
+   if ( OPT__LB_MEASURED_COST )
+   MPI_Alltoallv( SendBuf_Cost,  Send_NCount_Patch, Send_NDisp_Patch, MPI_DOUBLE,
+                  RecvBuf_Cost,  Recv_NCount_Patch, Recv_NDisp_Patch, MPI_DOUBLE, MPI_COMM_WORLD );
+
    if ( SendGridData )
    {
 //    4.2 fluid (transfer one component at a time to avoid exceeding the maximum allowed transfer size in MPI)
       for (int v=0; v<NCOMP_TOTAL; v++)
       {
-         MPI_Alltoallv_GAMER( SendBuf_Flu + v*SendDataSizeFlu1v, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_GAMER_REAL,
-                              RecvBuf_Flu + v*RecvDataSizeFlu1v, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_GAMER_REAL, MPI_COMM_WORLD );
+         MPI_Alltoallv_GAMER( SendBuf_Flu + v*SendDataSizeFlu1v, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_GAMER_REAL_STORE,
+                              RecvBuf_Flu + v*RecvDataSizeFlu1v, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_GAMER_REAL_STORE, MPI_COMM_WORLD );
       }
 
 #     ifdef GRAVITY
@@ -638,8 +740,8 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 //    --> debugger may report that the potential data are NOT initialized when calling LB_Init_LoadBalance()
 //        during initialization
 //    --> it's fine since we will calculate potential AFTER invoking LB_Init_LoadBalance() in Init_GAMER()
-      MPI_Alltoallv_GAMER( SendBuf_Pot, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_GAMER_REAL,
-                           RecvBuf_Pot, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_GAMER_REAL, MPI_COMM_WORLD );
+      MPI_Alltoallv_GAMER( SendBuf_Pot, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_GAMER_REAL_STORE,
+                           RecvBuf_Pot, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_GAMER_REAL_STORE, MPI_COMM_WORLD );
 
 //    4.4 potential with ghost zones
 #     ifdef STORE_POT_GHOST
@@ -677,6 +779,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    delete [] Send_NDisp_Flu1v;
    delete [] NDone_Patch;
    delete [] SendBuf_LBIdx;
+   delete [] SendBuf_Cost;
    delete [] SendBuf_Flu;
 #  ifdef GRAVITY
    delete [] SendBuf_Pot;
@@ -707,10 +810,12 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 // 6. allocate new patches with the data just received (use "patch group" as the basic unit)
 //    --> also add particles to the particle repository and associate them with home patches
 // ==========================================================================================
-   const real *RecvPtr_Grid = NULL;
-   const int   PScale       = PATCH_SIZE*amr->scale[lv];
-   const int   PGScale      = 2*PScale;
-   int PID, Cr0[3];
+   const real       *RecvPtr_Grid  = NULL;
+   const real_store *RecvPtr_Store = NULL;
+   const int         PScale        = PATCH_SIZE*amr->scale[lv];
+   const int         PGScale       = 2*PScale;
+   const int         NReal_New     = NStay_Patch + NRecv_Total_Patch;
+   int PID, RecvID, Cr0[3];
 
 #  ifdef PARTICLE
 // check: for RemoveParFromRepo == false, the size of particle repository should be exactly equal to the received particles
@@ -752,25 +857,29 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 //    6.2 assign data
       for (int LocalID=0; LocalID<8; LocalID++)
       {
-         PID = PID0 + LocalID;
+         RecvID = PID0 + LocalID;
+         PID    = NStay_Patch + RecvID;
+
+//       measured workload
+         if ( OPT__LB_MEASURED_COST )  amr->patch[0][lv][PID]->LB_Cost = RecvBuf_Cost[RecvID];
 
          if ( SendGridData )
          {
 //          fluid
             for (int v=0; v<NCOMP_TOTAL; v++)
             {
-               RecvPtr_Grid = RecvBuf_Flu + v*RecvDataSizeFlu1v + PID*FluSize1v;
-               memcpy( &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], RecvPtr_Grid, FluSize1v*sizeof(real) );
+               RecvPtr_Store = RecvBuf_Flu + v*RecvDataSizeFlu1v + RecvID*FluSize1v;
+               memcpy( &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], RecvPtr_Store, FluSize1v*sizeof(real_store) );
             }
 
 #           ifdef GRAVITY
 //          potential
-            RecvPtr_Grid = RecvBuf_Pot + PID*FluSize1v;
-            memcpy( &amr->patch[PotSg][lv][PID]->pot[0][0][0], RecvPtr_Grid, FluSize1v*sizeof(real) );
+            RecvPtr_Store = RecvBuf_Pot + RecvID*FluSize1v;
+            memcpy( &amr->patch[PotSg][lv][PID]->pot[0][0][0], RecvPtr_Store, FluSize1v*sizeof(real_store) );
 
 //          potential with ghost zones
 #           ifdef STORE_POT_GHOST
-            RecvPtr_Grid = RecvBuf_PotExt + PID*GraNxtSize;
+            RecvPtr_Grid = RecvBuf_PotExt + RecvID*GraNxtSize;
             memcpy( &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], RecvPtr_Grid, GraNxtSize*sizeof(real) );
 #           endif
 #           endif // GRAVITY
@@ -779,7 +888,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 #           ifdef MHD
             for (int v=0; v<NCOMP_MAG; v++)
             {
-               RecvPtr_Grid = RecvBuf_Mag + v*RecvDataSizeMag1v + PID*MagSize1v;
+               RecvPtr_Grid = RecvBuf_Mag + v*RecvDataSizeMag1v + RecvID*MagSize1v;
                memcpy( &amr->patch[MagSg][lv][PID]->magnetic[v][0], RecvPtr_Grid, MagSize1v*sizeof(real) );
             }
 #           endif
@@ -787,7 +896,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 
 //       particle
 #        ifdef PARTICLE
-         for (int p=0; p<RecvBuf_NPar[PID]; p++)
+         for (int p=0; p<RecvBuf_NPar[RecvID]; p++)
          {
 //          add a single particle to the particle repository
             ParID        = amr->Par->AddOneParticle( RecvPtr_Par );
@@ -811,11 +920,11 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 //       may change after calling amr->Par->AddOneParticle()
          const real_par *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
          char Comment[100];
-         sprintf( Comment, "%s, PID %d, NPar %d", __FUNCTION__, PID, RecvBuf_NPar[PID] );
-         amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv],
+         sprintf( Comment, "%s, PID %d, NPar %d", __FUNCTION__, PID, RecvBuf_NPar[RecvID] );
+         amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[RecvID], ParList, &amr->Par->NPar_Lv[lv],
                                               PType, ParPos, amr->Par->NPar_AcPlusInac, Comment );
 #        else
-         amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv],
+         amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[RecvID], ParList, &amr->Par->NPar_Lv[lv],
                                               PType );
 #        endif
 #        endif // #ifdef PARTICLE
@@ -823,7 +932,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    } // for (int PID0=0; PID0<NRecv_Total_Patch; PID0+=8)
 
 // 6.4 reset NPatchComma
-   for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = NRecv_Total_Patch;
+   for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = NReal_New;
 
 // check the amr->NPatchComma recording
    if ( amr->NPatchComma[lv][1] != amr->num[lv] )
@@ -836,12 +945,12 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    delete [] amr->LB->IdxList_Real         [lv];
    delete [] amr->LB->IdxList_Real_IdxTable[lv];
 
-   amr->LB->IdxList_Real         [lv] = new long [NRecv_Total_Patch];
-   amr->LB->IdxList_Real_IdxTable[lv] = new int  [NRecv_Total_Patch];
+   amr->LB->IdxList_Real         [lv] = new long [NReal_New];
+   amr->LB->IdxList_Real_IdxTable[lv] = new int  [NReal_New];
 
-   for (int PID=0; PID<NRecv_Total_Patch; PID++)   amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
+   for (int PID=0; PID<NReal_New; PID++)   amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
 
-   Mis_Heapsort( NRecv_Total_Patch, amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+   Mis_Heapsort( NReal_New, amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
 
 
 // 8. deallocate the MPI recv buffers
@@ -851,6 +960,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    delete [] Recv_NCount_Flu1v;
    delete [] Recv_NDisp_Flu1v;
    delete [] RecvBuf_LBIdx;
+   delete [] RecvBuf_Cost;
    delete [] RecvBuf_Flu;
 #  ifdef GRAVITY
    delete [] RecvBuf_Pot;
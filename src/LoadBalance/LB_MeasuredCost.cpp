@@ -0,0 +1,79 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_AddMeasuredCost
+// Description :  Accumulate the measured solver wall time of a batch of patch groups to their patches
+//
+// Note        :  1. Invoked by InvokeSolver() after the closing step of each batch when OPT__LB_MEASURED_COST is on
+//                2. Use the wall time of each individual patch group if available (i.e., PG_Time[t] >= 0.0)
+//                   --> Otherwise the batch wall time is distributed evenly over all patch groups in this batch
+//                       (e.g., for the GPU solvers and the fluid schemes not recording PG_Time[])
+//                3. The time of each patch group is divided evenly among its eight patches and accumulated
+//                   to patch->LB_CostNow, which is later converted to LB_Cost by LB_UpdateMeasuredCost()
+//
+// Parameter   :  lv        : Target refinement level
+//                NPG       : Number of patch groups in this batch
+//                PID0_List : List recording the patch indices with LocalID==0 in this batch
+//                PG_Time   : Wall time spent on each patch group (negative --> not measured)
+//                            --> Can be NULL, in which case BatchTime is always used
+//                BatchTime : Wall time spent on the entire batch
+//-------------------------------------------------------------------------------------------------------
+void LB_AddMeasuredCost( const int lv, const int NPG, const int *PID0_List, const double *PG_Time, const double BatchTime )
+{
+
+   if ( NPG <= 0 )   return;
+
+   const double BatchTime_PG = BatchTime / NPG;
+
+   for (int t=0; t<NPG; t++)
+   {
+      const int    PID0    = PID0_List[t];
+      const double Time_PG = ( PG_Time != NULL  &&  PG_Time[t] >= 0.0 ) ? PG_Time[t] : BatchTime_PG;
+
+      for (int PID=PID0; PID<PID0+8; PID++)  amr->patch[0][lv][PID]->LB_CostNow += 0.125*Time_PG;
+   }
+
+} // FUNCTION : LB_AddMeasuredCost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_UpdateMeasuredCost
+// Description :  Update the smoothed workload of all real patches at the target level from the wall time
+//                measured during the latest update
+//
+// Note        :  1. Invoked by EvolveLevel() after each update at lv when OPT__LB_MEASURED_COST is on
+//                2. LB_Cost is updated by the exponential moving average
+//                      LB_Cost = LB_MEASURED_COST_SMOOTH*LB_CostNow + (1-LB_MEASURED_COST_SMOOTH)*LB_Cost
+//                   --> Patches without any previous measurement (LB_Cost < 0.0) adopt LB_CostNow directly
+//                3. Patches without any new measurement (LB_CostNow <= 0.0) keep their previous LB_Cost
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_UpdateMeasuredCost( const int lv )
+{
+
+   const double Smooth = LB_MEASURED_COST_SMOOTH;
+
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      patch_t *Patch = amr->patch[0][lv][PID];
+
+      if ( Patch->LB_CostNow <= 0.0 )  continue;
+
+      if ( Patch->LB_Cost < 0.0 )   Patch->LB_Cost = Patch->LB_CostNow;
+      else                          Patch->LB_Cost = Smooth*Patch->LB_CostNow + (1.0-Smooth)*Patch->LB_Cost;
+
+      Patch->LB_CostNow = 0.0;
+   }
+
+} // FUNCTION : LB_UpdateMeasuredCost
+
+
+
+#endif // #ifdef LOAD_BALANCE
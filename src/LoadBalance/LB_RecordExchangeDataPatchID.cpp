@@ -19,6 +19,7 @@ static void SetReceiveSibling( int* RSib_List[] );
 // Note        :  1. LB_RecvH_IDList[] is unsorted --> use LB_RecvH_IDList_Idxtable[] to obtain the correct order
 //                   <--> All other lists are sorted
 //                2. This function will NOT deallocate any fluid/magnetic/pot arrays allocated previously
+//                3. Also discard the persistent MPI requests of LB_GetBufferData() at Lv (OPT__MPI_PERSISTENT)
 //
 // Parameter   :  Lv          : Target refinement level for recording MPI lists
 //                AfterRefine : Record the difference between old and new MPI lists after grid refinement
@@ -84,6 +85,10 @@ void LB_RecordExchangeDataPatchID( const int Lv, const bool AfterRefine )
 #  endif
 
 
+// 0. persistent MPI requests for exchanging the buffer data at Lv become invalid once the MPI lists are reconstructed
+   if ( OPT__MPI_PERSISTENT )    LB_GetBufferData_FreePersistent( Lv );
+
+
 // 1. initialize arrays
 // ============================================================================================================
    for (int r=0; r<MPI_NRank; r++)
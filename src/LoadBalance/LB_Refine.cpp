@@ -69,6 +69,10 @@ void LB_Refine( const int FaLv )
 #  endif
 
 
+// invalidate the neighbor list of the sparse MPI exchange until it is reconstructed in step 5.7
+   amr->LB->NNeighbor = -1;
+
+
 // 1. construct LB_CutPoint for the newly-created level
 // ==========================================================================================
 //###NOTE : here we have assumed that the newly-created son patches will have LB_Idx ~ 8*(father LB_Idx)
@@ -155,7 +159,12 @@ void LB_Refine( const int FaLv )
       LB_RecordOverlapMPIPatchID( SonLv );
    }
 
-// 5.7 list for exchanging particles
+// 5.7 list of neighbor ranks for the sparse MPI exchange
+//     --> must be done before constructing the particle lists, which already use the sparse MPI exchange
+   if ( OPT__MPI_SPARSE )
+   LB_RecordNeighborRank();
+
+// 5.8 list for exchanging particles
 #  ifdef PARTICLE
    Par_LB_RecordExchangeParticlePatchID( SonLv );
 
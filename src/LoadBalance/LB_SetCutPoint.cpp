@@ -4,6 +4,12 @@
 
 
 
+static int SetCutPoint_MultiConstraint( const int NPG_Total, const long *LBIdx0_AllRank, const int *IdxTable,
+                                        const double *Load_AllRank, const double (*Con_AllRank)[LB_NCON],
+                                        long *CutPoint, double *Load_Record );
+
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_SetCutPoint
@@ -17,6 +23,11 @@
 //                   particle information yet ...)
 //                   --> See the description of "InputLBIdx0AndLoad, LBIdx0_AllRank_Input, and
 //                       Load_AllRank_Input" below
+//                4. For OPT__LB_MULTI_CONSTRAINT, the cut points balance all constraints returned by
+//                   LB_EstimateConstraint_AllPatchGroup() simultaneously instead of the single workload
+//                   --> See SetCutPoint_MultiConstraint()
+//                   --> Not applicable when InputLBIdx0AndLoad == true since the constraints are unavailable
+//                       during RESTART
 //
 // Parameter   :  lv                   : Target refinement level
 //                NPG_Total            : Total number of patch groups on level "lv"
@@ -59,6 +70,7 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
 // 1. collect the load-balance weighting and LB_Idx of all patch groups from all ranks
    long   *LBIdx0_AllRank = NULL;
    double *Load_AllRank   = NULL;
+   double (*Con_AllRank)[LB_NCON] = NULL;
    int    *IdxTable       = ( MPI_Rank == 0 ) ? new int [NPG_Total] : NULL;
 
 // use the input tables directly
@@ -117,15 +129,44 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
 
 
 //    collect the load-balance weighting in each patch group
-      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+//    --> also get the number of particles for OPT__LB_MULTI_CONSTRAINT so that particles are collected only once
+      double *NPar_ThisRank = ( OPT__LB_MULTI_CONSTRAINT ) ? new double [NPG_ThisRank] : NULL;
+
+      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank, NPar_ThisRank );
 
       MPI_Gatherv( Load_ThisRank, NPG_ThisRank, MPI_DOUBLE, Load_AllRank, NPG_EachRank, Recv_Disp,
                    MPI_DOUBLE, 0, MPI_COMM_WORLD );
 
 
+//    collect all load-balance constraints in each patch group (for OPT__LB_MULTI_CONSTRAINT only)
+      if ( OPT__LB_MULTI_CONSTRAINT )
+      {
+         double (*Con_ThisRank)[LB_NCON] = new double [NPG_ThisRank][LB_NCON];
+
+         LB_EstimateConstraint_AllPatchGroup( lv, NPar_ThisRank, Con_ThisRank );
+
+         if ( MPI_Rank == 0 )
+         {
+            Con_AllRank = new double [NPG_Total][LB_NCON];
+
+            for (int r=0; r<MPI_NRank; r++)
+            {
+               NPG_EachRank[r] *= LB_NCON;
+               Recv_Disp   [r] *= LB_NCON;
+            }
+         }
+
+         MPI_Gatherv( Con_ThisRank[0], NPG_ThisRank*LB_NCON, MPI_DOUBLE, (Con_AllRank==NULL)?NULL:Con_AllRank[0],
+                      NPG_EachRank, Recv_Disp, MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+         delete [] Con_ThisRank;
+      }
+
+
 //    free memory
       delete [] LBIdx0_ThisRank;
       delete [] Load_ThisRank;
+      delete [] NPar_ThisRank;
 
       if ( MPI_Rank == 0 )
       {
@@ -171,57 +212,66 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
          CutPoint[MPI_NRank] = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
 
 //       4-4. find the LBIdx with an accumulated workload (LoadAcc) closest to the average workload of each rank (LoadTarget)
-         int    CutIdx     = 1;                 // target array index for CutPoint[]
+//       --> for OPT__LB_MULTI_CONSTRAINT, balance all constraints simultaneously instead
+         int CutIdx = 1;                        // target array index for CutPoint[]
                                                 // --> note that CutPoint[CutIdx] is the **exclusive** upper bound of rank "CutIdx-1"
-         double LoadAcc    = 0.0;               // accumulated workload
-         double LoadTarget = CutIdx*Load_Ave;   // target accumulated workload for the rank "CutIdx-1"
-         double LoadThisPG;                     // workload of the target patch group
 
-         for (int PG=0; PG<NPG_Total; PG++)
-         {
-//          nothing to do if all cut points have been set already
-            if ( CutIdx == MPI_NRank )    break;
+         if ( Con_AllRank != NULL )
+            CutIdx = SetCutPoint_MultiConstraint( NPG_Total, LBIdx0_AllRank, IdxTable, Load_AllRank, Con_AllRank,
+                                                  CutPoint, Load_Record );
 
-//          remember to use IdxTable to access Load_AllRank
-            LoadThisPG = Load_AllRank[ IdxTable[PG] ];
+         else
+         {
+            double LoadAcc    = 0.0;               // accumulated workload
+            double LoadTarget = CutIdx*Load_Ave;   // target accumulated workload for the rank "CutIdx-1"
+            double LoadThisPG;                     // workload of the target patch group
 
-//          check if adding a new patch group will exceed the target accumulated workload
-            if ( LoadAcc+LoadThisPG >= LoadTarget )
+            for (int PG=0; PG<NPG_Total; PG++)
             {
-//             determine the cut point with an accumulated workload **closest** to the target accumulated workload
-//             (a) if adding a new patch group will exceed the target accumulated workload too much
-//                 --> exclude this patch group from the rank "CutIdx-1"
-//             note that both "LoadAcc > LoadTarget" and "LoadAcc <= LoadTaget" can happen
-               if ( fabs(LoadAcc-LoadTarget) < LoadAcc+LoadThisPG-LoadTarget )
-               {
-                  CutPoint[CutIdx] = LBIdx0_AllRank[PG];
+//             nothing to do if all cut points have been set already
+               if ( CutIdx == MPI_NRank )    break;
 
-                  PG --;   // because this patch group has been **excluded** from this cut point
-               }
+//             remember to use IdxTable to access Load_AllRank
+               LoadThisPG = Load_AllRank[ IdxTable[PG] ];
 
-//             (b) if adding a new patch group will NOT exceed the target accumulated workload too much
-//                 --> include this patch group in the rank "CutIdx-1"
-               else
+//             check if adding a new patch group will exceed the target accumulated workload
+               if ( LoadAcc+LoadThisPG >= LoadTarget )
                {
-//                be careful about the special case "PG == NPG_Total-1"
-                  CutPoint[CutIdx] = ( PG == NPG_Total-1 ) ? CutPoint[MPI_NRank] : LBIdx0_AllRank[PG+1];
+//                determine the cut point with an accumulated workload **closest** to the target accumulated workload
+//                (a) if adding a new patch group will exceed the target accumulated workload too much
+//                    --> exclude this patch group from the rank "CutIdx-1"
+//                note that both "LoadAcc > LoadTarget" and "LoadAcc <= LoadTaget" can happen
+                  if ( fabs(LoadAcc-LoadTarget) < LoadAcc+LoadThisPG-LoadTarget )
+                  {
+                     CutPoint[CutIdx] = LBIdx0_AllRank[PG];
+
+                     PG --;   // because this patch group has been **excluded** from this cut point
+                  }
+
+//                (b) if adding a new patch group will NOT exceed the target accumulated workload too much
+//                    --> include this patch group in the rank "CutIdx-1"
+                  else
+                  {
+//                   be careful about the special case "PG == NPG_Total-1"
+                     CutPoint[CutIdx] = ( PG == NPG_Total-1 ) ? CutPoint[MPI_NRank] : LBIdx0_AllRank[PG+1];
+
+                     LoadAcc += LoadThisPG;
+                  }
+
+//                record the **accumulated** workload of each rank
+                  if ( OPT__VERBOSE )  Load_Record[ CutIdx - 1 ] = LoadAcc;
+
+                  CutIdx ++;
+                  LoadTarget = CutIdx*Load_Ave;
+               } // if ( LoadAcc+LoadThisPG >= LoadTarget )
 
+               else
+               {
                   LoadAcc += LoadThisPG;
-               }
-
-//             record the **accumulated** workload of each rank
-               if ( OPT__VERBOSE )  Load_Record[ CutIdx - 1 ] = LoadAcc;
-
-               CutIdx ++;
-               LoadTarget = CutIdx*Load_Ave;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget )
+               } // if ( LoadAcc+LoadThisPG >= LoadTarget ) ... else ...
 
-            else
-            {
-               LoadAcc += LoadThisPG;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget ) ... else ...
-
-         } // for (int PG=0; PG<NPG_Total; PG++)
+            } // for (int PG=0; PG<NPG_Total; PG++)
+         } // if ( Con_AllRank != NULL ) ... else ...
 
 //       4.5 take care of the special case where the last several ranks have no patches at all
          for (int t=CutIdx; t<MPI_NRank; t++)
@@ -286,6 +336,7 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
       {
          delete [] LBIdx0_AllRank;
          delete [] Load_AllRank;
+         delete [] Con_AllRank;
       }
    }
 
@@ -297,4 +348,109 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCutPoint_MultiConstraint
+// Description :  Set the cut points balancing multiple load-balance constraints simultaneously
+//
+// Note        :  1. Invoked by LB_SetCutPoint() on rank 0 for OPT__LB_MULTI_CONSTRAINT
+//                2. For each cut point, the accumulated value of each constraint c (Acc[c]) is compared with its
+//                   target value CutIdx*Ave[c], and the deviation is normalized by the tolerance of this
+//                   constraint as
+//                      Dev = max_c |Acc[c] - CutIdx*Ave[c]| / ( Tol[c]*Ave[c] )
+//                   --> The cut point is set to the patch group minimizing Dev
+//                   --> Dev is quasi-convex along the space-filling curve since all Acc[c] are monotonic, so we
+//                       only need to proceed until Dev starts to increase
+//                   --> Constraints with a tighter tolerance are therefore given a higher priority
+//                3. Constraints with Tol <= 0.0 or no workload at all are ignored
+//                   --> Fall back to LB_CON_CELL if all constraints are ignored
+//                4. CutPoint[0] and CutPoint[MPI_NRank] must be set in advance
+//
+// Parameter   :  NPG_Total      : Total number of patch groups
+//                LBIdx0_AllRank : Sorted minimum LBIdx of all patch groups
+//                IdxTable       : Index table for accessing Load_AllRank[] and Con_AllRank[] in the sorted order
+//                Load_AllRank   : Load-balance weighting of all patch groups
+//                                 --> Only used for recording Load_Record[]
+//                Con_AllRank    : Load-balance constraints of all patch groups
+//                CutPoint       : Cut point array to be set
+//                Load_Record    : Array to store the accumulated workload of each rank
+//                                 --> Useless if it is NULL
+//
+// Return      :  CutPoint[], Load_Record[], number of cut points set + 1 (i.e., MPI_NRank)
+//-------------------------------------------------------------------------------------------------------
+int SetCutPoint_MultiConstraint( const int NPG_Total, const long *LBIdx0_AllRank, const int *IdxTable,
+                                 const double *Load_AllRank, const double (*Con_AllRank)[LB_NCON],
+                                 long *CutPoint, double *Load_Record )
+{
+
+// 1. get the average value of each constraint and set the normalization of its deviation
+   double Tol[LB_NCON], Ave[LB_NCON], Norm[LB_NCON];
+   bool   Active[LB_NCON], AnyActive=false;
+
+   LB_GetConstraintTolerance( Tol );
+
+   for (int c=0; c<LB_NCON; c++)
+   {
+      Ave[c] = 0.0;
+      for (int t=0; t<NPG_Total; t++)  Ave[c] += Con_AllRank[t][c];
+      Ave[c] /= (double)MPI_NRank;
+
+      Active[c]  = ( Tol[c] > 0.0  &&  Ave[c] > 0.0 );
+      AnyActive |= Active[c];
+   }
+
+   if ( !AnyActive )
+   {
+      Active[LB_CON_CELL] = true;
+      Tol   [LB_CON_CELL] = 1.0;
+   }
+
+   for (int c=0; c<LB_NCON; c++)    Norm[c] = ( Active[c] ) ? 1.0/( Tol[c]*Ave[c] ) : 0.0;
+
+
+// 2. set the cut points one by one
+   double Acc[LB_NCON], Acc_Next[LB_NCON];
+   double LoadAcc = 0.0;
+   int    PG      = 0;
+
+   for (int c=0; c<LB_NCON; c++)    Acc[c] = 0.0;
+
+   int CutIdx;
+   for (CutIdx=1; CutIdx<MPI_NRank; CutIdx++)
+   {
+      double Dev = 0.0;
+      for (int c=0; c<LB_NCON; c++)    Dev = MAX( Dev, Norm[c]*fabs(Acc[c]-CutIdx*Ave[c]) );
+
+//    include more patch groups in the rank "CutIdx-1" until the normalized deviation starts to increase
+      while ( PG < NPG_Total )
+      {
+         const int Idx = IdxTable[PG];
+
+         double Dev_Next = 0.0;
+         for (int c=0; c<LB_NCON; c++)
+         {
+            Acc_Next[c] = Acc[c] + Con_AllRank[Idx][c];
+            Dev_Next    = MAX( Dev_Next, Norm[c]*fabs(Acc_Next[c]-CutIdx*Ave[c]) );
+         }
+
+         if ( Dev_Next > Dev )   break;
+
+         for (int c=0; c<LB_NCON; c++)    Acc[c] = Acc_Next[c];
+         Dev      = Dev_Next;
+         LoadAcc += Load_AllRank[Idx];
+         PG ++;
+      }
+
+      CutPoint[CutIdx] = ( PG < NPG_Total ) ? LBIdx0_AllRank[PG] : CutPoint[MPI_NRank];
+
+//    record the **accumulated** workload of each rank
+      if ( Load_Record != NULL )    Load_Record[ CutIdx - 1 ] = LoadAcc;
+   } // for (CutIdx=1; CutIdx<MPI_NRank; CutIdx++)
+
+
+   return CutIdx;
+
+} // FUNCTION : SetCutPoint_MultiConstraint
+
+
+
 #endif // #ifdef LOAD_BALANCE
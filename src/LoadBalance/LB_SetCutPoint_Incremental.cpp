@@ -0,0 +1,206 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+static int CountPatchGroupToGive( const int NPG, const double *Load_PG, const int *IdxTable, const double Flow,
+                                  const bool FromRight, const int NPG_Max );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SetCutPoint_Incremental
+// Description :  Shift the existing cut points so that the workload flows only between adjacent ranks
+//
+// Note        :  1. Used by the incremental load balancing (OPT__LB_INCREMENTAL) as a lightweight alternative
+//                   to LB_SetCutPoint()
+//                   --> Only the workload of each rank is collected (by MPI_Allgather) instead of the LBIdx and
+//                       workload of all patch groups
+//                   --> Must be invoked by all ranks
+//                2. The workload flowing across the cut point between ranks r and r+1 is
+//                      Flow[r+1] = sum(Load[0...r]) - (r+1)*Load_Ave
+//                   --> Flow > 0 : the cut point moves toward smaller LB_Idx and rank r gives its patch groups
+//                                  with the largest LB_Idx to rank r+1
+//                       Flow < 0 : the cut point moves toward larger LB_Idx and rank r+1 gives its patch groups
+//                                  with the smallest LB_Idx to rank r
+//                   --> Each cut point is therefore determined by the only rank giving patch groups across it
+//                3. A rank never gives away more patch groups than it owns
+//                   --> Cut points never move across a neighboring rank, so patch groups migrate only between
+//                       adjacent ranks
+//                   --> Large imbalance is removed gradually over several invocations
+//                4. The number of patch groups to move is chosen to make the transferred workload closest to
+//                   the target flow, so the cut points remain unchanged when the imbalance is smaller than
+//                   about half the workload of a patch group
+//                5. The patches must already be distributed according to the input cut points
+//                   --> LB_Init_LoadBalance() with KeepCutPoint==true and TLv==lv must be invoked afterward if any
+//                       cut point has been changed, which migrates only the patch groups changing owner
+//
+// Parameter   :  lv        : Target refinement level
+//                CutPoint  : Cut point array to be updated
+//                ParWeight : Relative load-balance weighting of particles
+//                            --> <= 0.0 : do not consider particle weighting
+//
+// Return      :  CutPoint[], number of cut points changed on lv
+//-------------------------------------------------------------------------------------------------------
+int LB_SetCutPoint_Incremental( const int lv, long *CutPoint, const double ParWeight )
+{
+
+// nothing to do if there are no patches at all
+   if ( NPatchTotal[lv] == 0  ||  MPI_NRank == 1 )    return 0;
+
+
+// 1. get the workload and the minimum LBIdx of all patch groups in this rank
+   const int NPG = amr->NPatchComma[lv][1] / 8;
+
+   long   *LBIdx0   = new long   [NPG];
+   double *Load_PG  = new double [NPG];
+   int    *IdxTable = new int    [NPG];
+
+   LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_PG, NULL );
+
+   for (int t=0; t<NPG; t++)
+   {
+      LBIdx0[t]  = amr->patch[0][lv][t*8]->LB_Idx;
+      LBIdx0[t] -= LBIdx0[t] % 8;   // get the **minimum** LBIdx in this patch group
+   }
+
+// sort LB_Idx
+// --> after sorting, we must use IdxTable to access the Load_PG[] array
+   Mis_Heapsort( NPG, LBIdx0, IdxTable );
+
+
+// 2. collect the workload of all ranks
+   double  Load_ThisRank = 0.0;
+   double *Load_AllRank  = new double [MPI_NRank];
+
+   for (int t=0; t<NPG; t++)  Load_ThisRank += Load_PG[t];
+
+   MPI_Allgather( &Load_ThisRank, 1, MPI_DOUBLE, Load_AllRank, 1, MPI_DOUBLE, MPI_COMM_WORLD );
+
+   double Load_Ave = 0.0;
+   for (int r=0; r<MPI_NRank; r++)  Load_Ave += Load_AllRank[r];
+   Load_Ave /= (double)MPI_NRank;
+
+
+// 3. get the workload flowing across the left and right cut points of this rank
+   double Flow_L = 0.0, Flow_R = 0.0;
+
+   for (int r=0; r<MPI_Rank; r++)   Flow_L += Load_AllRank[r];
+   Flow_L -= MPI_Rank*Load_Ave;
+   Flow_R  = Flow_L + Load_AllRank[MPI_Rank] - Load_Ave;
+
+
+// 4. determine the number of patch groups to be given to the left and right ranks
+// --> give to the left rank first so that the number of patch groups given to the right rank can be capped
+   const bool FromRight_Yes = true;
+   const bool FromRight_No  = false;
+
+   int NGive_L = 0, NGive_R = 0;
+
+   if ( MPI_Rank > 0            &&  Flow_L < 0.0 )
+      NGive_L = CountPatchGroupToGive( NPG, Load_PG, IdxTable, -Flow_L, FromRight_No,  NPG         );
+
+   if ( MPI_Rank < MPI_NRank-1  &&  Flow_R > 0.0 )
+      NGive_R = CountPatchGroupToGive( NPG, Load_PG, IdxTable, +Flow_R, FromRight_Yes, NPG-NGive_L );
+
+
+// 5. set the new cut points
+// --> cut points not determined by any rank are set to -1 and remain unchanged
+   long *CutPoint_New = new long [MPI_NRank+1];
+
+   for (int t=0; t<MPI_NRank+1; t++)   CutPoint_New[t] = -1;
+
+   if ( NGive_L > 0 )   CutPoint_New[MPI_Rank  ] = ( NGive_L < NPG ) ? LBIdx0[NGive_L] : CutPoint[MPI_Rank+1];
+   if ( NGive_R > 0 )   CutPoint_New[MPI_Rank+1] = LBIdx0[ NPG - NGive_R ];
+
+   MPI_Allreduce( MPI_IN_PLACE, CutPoint_New, MPI_NRank+1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+   int NChanged = 0;
+
+   for (int t=1; t<MPI_NRank; t++)
+   {
+      if ( CutPoint_New[t] >= 0  &&  CutPoint_New[t] != CutPoint[t] )
+      {
+         CutPoint[t] = CutPoint_New[t];
+         NChanged ++;
+      }
+   }
+
+
+// 6. check
+#  ifdef GAMER_DEBUG
+   for (int t=0; t<MPI_NRank; t++)
+      if ( CutPoint[t+1] < CutPoint[t] )
+         Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                    lv, t+1, CutPoint[t+1], t, CutPoint[t] );
+#  endif
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+   {
+      double Load_Max = 0.0;
+      for (int r=0; r<MPI_NRank; r++)  Load_Max = MAX( Load_Max, Load_AllRank[r] );
+
+      Aux_Message( stdout, "      %s at Lv %2d: %d cut point(s) shifted, Load_Ave %9.3e, Load_Max %9.3e (before shifting)\n",
+                   __FUNCTION__, lv, NChanged, Load_Ave, Load_Max );
+   }
+
+
+// free memory
+   delete [] LBIdx0;
+   delete [] Load_PG;
+   delete [] IdxTable;
+   delete [] Load_AllRank;
+   delete [] CutPoint_New;
+
+
+   return NChanged;
+
+} // FUNCTION : LB_SetCutPoint_Incremental
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CountPatchGroupToGive
+// Description :  Count the number of patch groups at one end of this rank whose accumulated workload is
+//                closest to the target flow
+//
+// Note        :  1. Invoked by LB_SetCutPoint_Incremental()
+//                2. Patch groups are accumulated in the order of LB_Idx starting from either the largest
+//                   (FromRight == true) or the smallest (FromRight == false) LB_Idx
+//
+// Parameter   :  NPG       : Number of patch groups in this rank
+//                Load_PG   : Workload of each patch group
+//                IdxTable  : Index table sorting the patch groups by LB_Idx
+//                Flow      : Target workload to be given (must be positive)
+//                FromRight : Start from the largest LB_Idx
+//                NPG_Max   : Maximum number of patch groups to be given
+//
+// Return      :  Number of patch groups to be given
+//-------------------------------------------------------------------------------------------------------
+int CountPatchGroupToGive( const int NPG, const double *Load_PG, const int *IdxTable, const double Flow,
+                           const bool FromRight, const int NPG_Max )
+{
+
+   int    NGive   = 0;
+   double LoadAcc = 0.0;
+
+   while ( NGive < NPG_Max )
+   {
+      const double LoadThisPG = Load_PG[ IdxTable[ (FromRight) ? NPG-1-NGive : NGive ] ];
+
+//    stop if including this patch group would overshoot the target flow more than excluding it
+      if ( LoadAcc + 0.5*LoadThisPG >= Flow )   break;
+
+      LoadAcc += LoadThisPG;
+      NGive   ++;
+   }
+
+   return NGive;
+
+} // FUNCTION : CountPatchGroupToGive
+
+
+
+#endif // #ifdef LOAD_BALANCE
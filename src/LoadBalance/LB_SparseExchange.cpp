@@ -0,0 +1,343 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+// tag of all messages sent through amr->LB->Comm_Sparse
+// --> safe to use a single tag since each sparse exchange completes before the next one is posted
+static const int SparseTag = 1;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_RecordNeighborRank
+// Description :  Record the ranks exchanging data with this rank for the sparse MPI exchange
+//
+// Note        :  1. Invoked by LB_Init_LoadBalance() and LB_Refine() when OPT__MPI_SPARSE is on
+//                   --> The neighbor list is reconstructed whenever the patch lists change and is then reused
+//                       by all LB_SparseAlltoall() and LB_SparseAlltoallv() calls until the next update
+//                2. Neighbors include
+//                   (a) ranks recorded in the MPI lists of all levels
+//                   (b) owners of all buffer patches
+//                   (c) owners of all sons living abroad
+//                   (d) owners of all ancestors of real patches (for Par_LB_CollectParticle2OneLevel())
+//                   --> Must be invoked AFTER LB_RecordExchangeDataPatchID() has allocated the buffer patches
+//                   --> Stale MPI lists of the levels being refined only add extra neighbors and are harmless
+//                3. The resulting list is made symmetric (i.e., rank A is a neighbor of rank B if and only if B
+//                   is a neighbor of A) by a single MPI_Alltoall()
+//                   --> Required by LB_SparseAlltoall()
+//                   --> Must be invoked by all ranks
+//                4. This rank itself is never a neighbor
+//                5. Also create the dedicated communicator amr->LB->Comm_Sparse on the first call
+//                6. LB_Init_LoadBalance() and LB_Refine() invalidate the neighbor list (by setting NNeighbor=-1)
+//                   before modifying patches so that any sparse exchange in between falls back to the collective one
+//
+// Parameter   :  None
+//
+// Return      :  amr->LB->Neighbor, amr->LB->NNeighbor, amr->LB->NeighborList, amr->LB->NeighborReq,
+//                amr->LB->Comm_Sparse
+//-------------------------------------------------------------------------------------------------------
+void LB_RecordNeighborRank()
+{
+
+   if ( amr->LB->Comm_Sparse == MPI_COMM_NULL )    MPI_Comm_dup( MPI_COMM_WORLD, &amr->LB->Comm_Sparse );
+
+   bool *Neighbor = amr->LB->Neighbor;
+
+   for (int r=0; r<MPI_NRank; r++)  Neighbor[r] = false;
+
+
+// 1. ranks recorded in the MPI lists
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if (  amr->LB->SendH_NList[lv][r] > 0  ||  amr->LB->RecvH_NList[lv][r] > 0  ||
+            amr->LB->SendX_NList[lv][r] > 0  ||  amr->LB->RecvX_NList[lv][r] > 0  ||
+            amr->LB->SendR_NList[lv][r] > 0  ||  amr->LB->RecvR_NList[lv][r] > 0  ||
+            amr->LB->SendF_NList[lv][r] > 0  ||  amr->LB->RecvF_NList[lv][r] > 0     )
+         Neighbor[r] = true;
+
+#     ifdef MHD
+      if (  amr->LB->SendY_NList[lv][r] > 0  ||  amr->LB->RecvY_NList[lv][r] > 0  ||
+            amr->LB->SendE_NList[lv][r] > 0  ||  amr->LB->RecvE_NList[lv][r] > 0     )
+         Neighbor[r] = true;
+#     endif
+
+#     ifdef GRAVITY
+      if (  amr->LB->SendG_NList[lv][r] > 0  ||  amr->LB->RecvG_NList[lv][r] > 0  )
+         Neighbor[r] = true;
+#     endif
+
+#     ifdef PARTICLE
+      for (int t=0; t<2; t++)
+      {
+         const int *R2B_Real = amr->Par->R2B_Real_NPatchEachRank[lv][t];
+         const int *R2B_Buff = amr->Par->R2B_Buff_NPatchEachRank[lv][t];
+         const int *B2R_Real = amr->Par->B2R_Real_NPatchEachRank[lv][t];
+         const int *B2R_Buff = amr->Par->B2R_Buff_NPatchEachRank[lv][t];
+
+         if (  ( R2B_Real != NULL && R2B_Real[r] > 0 )  ||  ( R2B_Buff != NULL && R2B_Buff[r] > 0 )  ||
+               ( B2R_Real != NULL && B2R_Real[r] > 0 )  ||  ( B2R_Buff != NULL && B2R_Buff[r] > 0 )     )
+            Neighbor[r] = true;
+      }
+
+      const int *F2S_Send = amr->Par->F2S_Send_NPatchEachRank[lv];
+      const int *F2S_Recv = amr->Par->F2S_Recv_NPatchEachRank[lv];
+
+      if (  ( F2S_Send != NULL && F2S_Send[r] > 0 )  ||  ( F2S_Recv != NULL && F2S_Recv[r] > 0 )  )
+         Neighbor[r] = true;
+#     endif // #ifdef PARTICLE
+   } // for lv, r
+
+
+// 2. owners of buffer patches, sons abroad, and ancestors
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][27]; PID++)
+         Neighbor[ LB_Index2Rank( lv, amr->patch[0][lv][PID]->LB_Idx, CHECK_ON ) ] = true;
+
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         const int SonPID = amr->patch[0][lv][PID]->son;
+
+         if ( SonPID < -1 )   Neighbor[ SON_OFFSET_LB - SonPID ] = true;
+
+#        ifdef PARTICLE
+         for (int FaLv=0; FaLv<lv; FaLv++)
+         {
+#           if ( LOAD_BALANCE == HILBERT )
+            const long FaLB_Idx = amr->patch[0][lv][PID]->LB_Idx / ( 1L << (3L*(lv-FaLv)) );
+#           else
+            const int  PatchScaleFaLv = PS1 * amr->scale[FaLv];
+            int FaCr[3];
+            for (int d=0; d<3; d++)    FaCr[d] = amr->patch[0][lv][PID]->corner[d] - amr->patch[0][lv][PID]->corner[d]%PatchScaleFaLv;
+            const long FaLB_Idx = LB_Corner2Index( FaLv, FaCr, CHECK_ON );
+#           endif
+
+            Neighbor[ LB_Index2Rank( FaLv, FaLB_Idx, CHECK_ON ) ] = true;
+         }
+#        endif
+      } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// 3. symmetrize the neighbor list
+   int *Neighbor_Send = new int [MPI_NRank];
+   int *Neighbor_Recv = new int [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)  Neighbor_Send[r] = (int)Neighbor[r];
+
+   MPI_Alltoall( Neighbor_Send, 1, MPI_INT, Neighbor_Recv, 1, MPI_INT, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)  Neighbor[r] = ( Neighbor_Send[r] || Neighbor_Recv[r] );
+
+   Neighbor[MPI_Rank] = false;
+
+   delete [] Neighbor_Send;
+   delete [] Neighbor_Recv;
+
+
+// 4. construct the compact neighbor list and the reusable MPI requests
+   int NNeighbor = 0;
+   for (int r=0; r<MPI_NRank; r++)  if ( Neighbor[r] )   NNeighbor ++;
+
+   delete [] amr->LB->NeighborList;
+   delete [] amr->LB->NeighborReq;
+
+   amr->LB->NNeighbor    = NNeighbor;
+   amr->LB->NeighborList = new int         [   NNeighbor ];
+   amr->LB->NeighborReq  = new MPI_Request [ 2*NNeighbor ];
+
+   NNeighbor = 0;
+   for (int r=0; r<MPI_NRank; r++)  if ( Neighbor[r] )   amr->LB->NeighborList[ NNeighbor ++ ] = r;
+
+} // FUNCTION : LB_RecordNeighborRank
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SparseAlltoall
+// Description :  Replacement of MPI_Alltoall() for exchanging one integer (e.g., the number of patches or
+//                particles) between all ranks
+//
+// Note        :  1. Communicate with the neighbor ranks recorded by LB_RecordNeighborRank() only when OPT__MPI_SPARSE
+//                   is on; invoke MPI_Alltoall() otherwise
+//                   --> No collective operation is involved and the number of messages scales with NNeighbor
+//                   --> Also invoke MPI_Alltoall() if the neighbor list is not available (i.e., NNeighbor<0)
+//                2. Send_NCount[] must be zero for all non-neighbor ranks, which is guaranteed by the construction
+//                   of the neighbor list (checked in the debug mode)
+//                3. Recv_NCount[] of all non-neighbor ranks is set to zero
+//                4. Must be invoked by all ranks
+//
+// Parameter   :  Send_NCount : Data sent to each rank
+//                Recv_NCount : Data received from each rank
+//
+// Return      :  Recv_NCount
+//-------------------------------------------------------------------------------------------------------
+void LB_SparseAlltoall( int *Send_NCount, int *Recv_NCount )
+{
+
+   if ( ! OPT__MPI_SPARSE  ||  amr->LB->NNeighbor < 0 )
+   {
+      MPI_Alltoall( Send_NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+      return;
+   }
+
+
+   const int  NNeighbor    = amr->LB->NNeighbor;
+   const int *NeighborList = amr->LB->NeighborList;
+   MPI_Request *Req        = amr->LB->NeighborReq;
+
+#  ifdef GAMER_DEBUG
+   for (int r=0; r<MPI_NRank; r++)
+      if ( r != MPI_Rank  &&  !amr->LB->Neighbor[r]  &&  Send_NCount[r] != 0 )
+         Aux_Error( ERROR_INFO, "sending data to a non-neighbor rank (%d, Send_NCount %d) !!\n", r, Send_NCount[r] );
+#  endif
+
+   memset( Recv_NCount, 0, MPI_NRank*sizeof(int) );
+
+   for (int n=0; n<NNeighbor; n++)
+   {
+      const int r = NeighborList[n];
+
+      MPI_Irecv( Recv_NCount+r, 1, MPI_INT, r, SparseTag, amr->LB->Comm_Sparse, Req+2*n+0 );
+      MPI_Isend( Send_NCount+r, 1, MPI_INT, r, SparseTag, amr->LB->Comm_Sparse, Req+2*n+1 );
+   }
+
+   Recv_NCount[MPI_Rank] = Send_NCount[MPI_Rank];
+
+   MPI_Waitall( 2*NNeighbor, Req, MPI_STATUSES_IGNORE );
+
+} // FUNCTION : LB_SparseAlltoall
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Alltoallv_Collective
+// Description :  Invoke the collective MPI all-to-all routine suitable for the type of counts
+//
+// Note        :  1. Used by LB_SparseAlltoallv() when OPT__MPI_SPARSE is off
+//                2. Long counts are passed to MPI_Alltoallv_GAMER() to support displacements > __INT_MAX__
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+static void Alltoallv_Collective( T *SendBuf, int *Send_NCount, int *Send_NDisp, MPI_Datatype Send_Datatype,
+                                  T *RecvBuf, int *Recv_NCount, int *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm )
+{
+   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, Send_Datatype, RecvBuf, Recv_NCount, Recv_NDisp, Recv_Datatype, comm );
+}
+
+template <typename T>
+static void Alltoallv_Collective( T *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype,
+                                  T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm )
+{
+   MPI_Alltoallv_GAMER( SendBuf, Send_NCount, Send_NDisp, Send_Datatype, RecvBuf, Recv_NCount, Recv_NDisp, Recv_Datatype, comm );
+}
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SparseAlltoallv
+// Description :  Replacement of MPI_Alltoallv() and MPI_Alltoallv_GAMER() for the load-balance routines
+//
+// Note        :  1. Only loop over the neighbor ranks recorded by LB_RecordNeighborRank() and post MPI_Isend() and
+//                   MPI_Irecv() for those with non-zero counts when OPT__MPI_SPARSE is on; invoke the collective
+//                   routine otherwise or if the neighbor list is not available (i.e., NNeighbor<0)
+//                   --> The cost thus scales with the number of neighbor ranks instead of MPI_NRank
+//                   --> Messages are sent through amr->LB->Comm_Sparse instead of comm to avoid colliding with
+//                       other point-to-point messages
+//                2. Both the send and recv counts must be known in advance on all ranks (e.g., by
+//                   LB_SparseAlltoall() or the MPI lists)
+//                   --> Counts of all non-neighbor ranks must be zero (checked in the debug mode)
+//                3. Data sent to this rank itself are copied directly
+//                4. Explicit template instantiation is put in the end of this file
+//
+// Parameter   :  SendBuf       : Data to be sent
+//                Send_NCount   : Number of elements sent to each rank
+//                Send_NDisp    : Displacement of the data sent to each rank in SendBuf
+//                Send_Datatype : MPI data type of SendBuf
+//                RecvBuf       : Data to be received
+//                Recv_NCount   : Number of elements received from each rank
+//                Recv_NDisp    : Displacement of the data received from each rank in RecvBuf
+//                Recv_Datatype : MPI data type of RecvBuf
+//                comm          : MPI communicator (used only when OPT__MPI_SPARSE is off)
+//
+// Return      :  RecvBuf
+//-------------------------------------------------------------------------------------------------------
+template <typename T, typename U>
+void LB_SparseAlltoallv( T *SendBuf, U *Send_NCount, U *Send_NDisp, MPI_Datatype Send_Datatype,
+                         T *RecvBuf, U *Recv_NCount, U *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm )
+{
+
+   if ( ! OPT__MPI_SPARSE  ||  amr->LB->NNeighbor < 0 )
+   {
+      Alltoallv_Collective( SendBuf, Send_NCount, Send_NDisp, Send_Datatype, RecvBuf, Recv_NCount, Recv_NDisp, Recv_Datatype, comm );
+      return;
+   }
+
+
+   const int  NNeighbor    = amr->LB->NNeighbor;
+   const int *NeighborList = amr->LB->NeighborList;
+   MPI_Request *Req        = amr->LB->NeighborReq;
+   int NReq = 0;
+
+#  ifdef GAMER_DEBUG
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank  ||  amr->LB->Neighbor[r] )  continue;
+
+      if ( Send_NCount[r] != 0  ||  Recv_NCount[r] != 0 )
+         Aux_Error( ERROR_INFO, "exchanging data with a non-neighbor rank (%d, Send_NCount %ld, Recv_NCount %ld) !!\n",
+                    r, (long)Send_NCount[r], (long)Recv_NCount[r] );
+   }
+#  endif
+
+   for (int n=0; n<NNeighbor; n++)
+   {
+      const int r = NeighborList[n];
+
+      if ( Send_NCount[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "Send_NCount[%d] (%ld) > __INT_MAX__ (%ld) !!\n", r, (long)Send_NCount[r], (long)__INT_MAX__ );
+      if ( Recv_NCount[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "Recv_NCount[%d] (%ld) > __INT_MAX__ (%ld) !!\n", r, (long)Recv_NCount[r], (long)__INT_MAX__ );
+
+      if ( Recv_NCount[r] > 0 )
+      {
+         MPI_Irecv( RecvBuf+Recv_NDisp[r], (int)Recv_NCount[r], Recv_Datatype, r, SparseTag, amr->LB->Comm_Sparse, Req+NReq );
+         NReq ++;
+      }
+
+      if ( Send_NCount[r] > 0 )
+      {
+         MPI_Isend( SendBuf+Send_NDisp[r], (int)Send_NCount[r], Send_Datatype, r, SparseTag, amr->LB->Comm_Sparse, Req+NReq );
+         NReq ++;
+      }
+   }
+
+// copy data sent to this rank itself
+#  ifdef GAMER_DEBUG
+   if ( Send_NCount[MPI_Rank] != Recv_NCount[MPI_Rank] )
+      Aux_Error( ERROR_INFO, "Send_NCount[%d] (%ld) != Recv_NCount[%d] (%ld) !!\n",
+                 MPI_Rank, (long)Send_NCount[MPI_Rank], MPI_Rank, (long)Recv_NCount[MPI_Rank] );
+#  endif
+
+   if ( Send_NCount[MPI_Rank] > 0 )
+      memcpy( RecvBuf+Recv_NDisp[MPI_Rank], SendBuf+Send_NDisp[MPI_Rank], Send_NCount[MPI_Rank]*sizeof(T) );
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+} // FUNCTION : LB_SparseAlltoallv
+
+
+
+// explicit template instantiation
+template void LB_SparseAlltoallv <float,  long> ( float  *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, float  *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
+template void LB_SparseAlltoallv <double, long> ( double *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, double *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
+template void LB_SparseAlltoallv <int,    int > ( int    *SendBuf, int  *Send_NCount, int  *Send_NDisp, MPI_Datatype Send_Datatype, int    *RecvBuf, int  *Recv_NCount, int  *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
+template void LB_SparseAlltoallv <long,   int > ( long   *SendBuf, int  *Send_NCount, int  *Send_NDisp, MPI_Datatype Send_Datatype, long   *RecvBuf, int  *Recv_NCount, int  *Recv_NDisp, MPI_Datatype Recv_Datatype, MPI_Comm comm );
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -67,6 +67,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       for (int TLv=0; TLv<NLEVEL; TLv++)  amr->NUpdateLv[TLv] = 0; }
 
 
+// clear the patch-data cache since the patch data may have been modified outside this function
+// (e.g., by Flu_CorrAfterAllSync() and the user-specified routines)
+   if ( lv == 0 )    Prepare_PatchData_Cache_Reset();
+
+
 // sub-step loop
    dTime_SoFar           = 0.0;
    AutoReduceDtCoeff     = 1.0;
@@ -153,9 +158,19 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
          Aux_Message( stdout, "   Lv %2d: Flu_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
-      if ( false ) {}
-      /*
-      if ( OPT__OVERLAP_MPI )
+//    overlap the MPI communication with the fluid solver only if there is data to be transferred right after it
+//    --> with GRAVITY, only the density field is required immediately (by the Poisson solver at lv>0) and the
+//        remaining fluid fields will be transferred after the gravity solver
+#     ifdef GRAVITY
+      const bool OverlapFlu = ( OPT__OVERLAP_MPI  &&  lv > 0  &&  OPT__SELF_GRAVITY );
+#     else
+      const bool OverlapFlu = OPT__OVERLAP_MPI;
+#     endif
+
+//    whether the buffer patches of the updated fluid field have been filled during the MPI overlapping
+      bool FluBufUpdated = false;
+
+      if ( OverlapFlu )
       {
 //       enable OpenMP nested parallelism
 #        ifdef OPENMP
@@ -166,13 +181,22 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, true ),
                         Timer_Flu_Advance[lv],   TIMER_ON   );
 
-#        pragma omp parallel sections num_threads(2)
+//       transfer data and advance patches not needed to be sent simultaneously
+//       --> MPI calls are restricted to the master thread to comply with MPI_THREAD_FUNNELED/SERIALIZED
+//       --> all patches will be advanced by the master thread if nested parallelism is not available
+#        pragma omp parallel num_threads( 2 )
          {
-#           pragma omp section
+#           ifdef OPENMP
+            const int TID = omp_get_thread_num();
+            const int NT  = omp_get_num_threads();
+#           else
+            const int TID = 0;
+            const int NT  = 1;
+#           endif
+
+            if ( TID == 0 )
             {
-//             transfer data simultaneously
 #              ifdef GRAVITY
-               if ( OPT__SELF_GRAVITY )
                TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT,   NULL_INT, DATA_GENERAL, _DENS,  _NONE, Rho_ParaBuf, USELB_YES ),
                               Timer_GetBuf[lv][0],   TIMER_ON   );
 #              else
@@ -181,20 +205,22 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 #              endif
             }
 
-#           pragma omp section
+            if ( TID == 1  ||  NT == 1 )
             {
-//             advance patches not needed to be sent
                TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, false ),
                               Timer_Flu_Advance[lv],   TIMER_ON   );
             }
-         } // OpenMP parallel sections
+         } // OpenMP parallel region
 
 //       disable OpenMP nested parallelism
 #        ifdef OPENMP
          omp_set_nested( false );
 #        endif
-      } // if ( OPT__OVERLAP_MPI )
-      */
+
+#        ifndef GRAVITY
+         FluBufUpdated = true;
+#        endif
+      } // if ( OverlapFlu )
 
       else
       {
@@ -301,7 +327,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
             } // if ( FluStatus_AllRank == GAMER_SUCCESS ) ... else ...
          } // if ( AUTO_REDUCE_DT )
 
-      } // if ( OPT__OVERLAP_MPI ) ... else ...
+      } // if ( OverlapFlu ) ... else ...
 
       amr->FluSg    [lv]             = SaveSg_Flu;
       amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
@@ -310,6 +336,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       amr->MagSgTime[lv][SaveSg_Mag] = TimeNew;
 #     endif
 
+      Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 // ===============================================================================================
 
@@ -349,6 +377,15 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 #     ifdef GRAVITY
       const int SaveSg_Pot = 1 - amr->PotSg[lv];
 
+//    overlap the MPI communication with the Poisson and gravity solvers at lv>0
+//    --> not supported for MASSIVE_PARTICLES since Par_CollectParticle2OneLevel() invoked by Gra_AdvanceDt()
+//        involves MPI communication as well
+#     ifdef MASSIVE_PARTICLES
+      const bool OverlapGra = false;
+#     else
+      const bool OverlapGra = ( OPT__OVERLAP_MPI  &&  lv > 0 );
+#     endif
+
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
          Aux_Message( stdout, "   Lv %2d: Gra_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
@@ -357,25 +394,33 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
       else // lv > 0
       {
-         if ( false ) {}
-         /*
-         if ( OPT__OVERLAP_MPI )
+         if ( OverlapGra )
          {
 //          enable OpenMP nested parallelism
 #           ifdef OPENMP
             omp_set_nested( true );
 #           endif
 
+//          note that the density field in the buffer patches has been exchanged during the fluid solver
 //          advance patches needed to be sent
             TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                           UsePot, true, true, true, true ),
+                                          UsePot, true, true, true, true ),
                            Timer_Gra_Advance[lv],   TIMER_ON   );
 
-#           pragma omp parallel sections num_threads(2)
+//          transfer data and advance patches not needed to be sent simultaneously
+//          --> see the fluid solver above for the thread assignment
+#           pragma omp parallel num_threads( 2 )
             {
-#              pragma omp section
+#              ifdef OPENMP
+               const int TID = omp_get_thread_num();
+               const int NT  = omp_get_num_threads();
+#              else
+               const int TID = 0;
+               const int NT  = 1;
+#              endif
+
+               if ( TID == 0 )
                {
-//                transfer data simultaneously
                   if ( UsePot )
                   TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                                     _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
@@ -386,26 +431,27 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
                                  Timer_GetBuf[lv][2],   TIMER_ON   );
                }
 
-#              pragma omp section
+               if ( TID == 1  ||  NT == 1 )
                {
-//                advance patches not needed to be sent
                   TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
                                                 UsePot, true, true, false, true ),
                                  Timer_Gra_Advance[lv],   TIMER_ON   );
                }
-            } // OpenMP parallel sections
+            } // OpenMP parallel region
 
 //          disable OpenMP nested parallelism
 #           ifdef OPENMP
             omp_set_nested( false );
 #           endif
-         } // if ( OPT__OVERLAP_MPI )
-         */
+
+            FluBufUpdated = true;
+         } // if ( OverlapGra )
 
          else
          {
 //          exchange the updated density field in the buffer patches for the Poisson solver
-            if ( OPT__SELF_GRAVITY )
+//          --> it has been done during the fluid solver if OverlapFlu is on
+            if ( OPT__SELF_GRAVITY  &&  !OverlapFlu )
             TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
                                               _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv][0],   TIMER_ON   );
@@ -418,11 +464,12 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //          --> we will do this after all other operations (e.g., star formation) if OPT__MINIMIZE_MPI_BARRIER is adopted
 //              --> assuming that all remaining operations do not need to access the potential in the buffer patches
 //              --> one must enable both STORE_POT_GHOST and PAR_IMPROVE_ACC for this purpose
-            if ( UsePot  &&  !OPT__MINIMIZE_MPI_BARRIER )
+//          --> it has been done by Gra_AdvanceDt() if OPT__POT_LEVEL_MG is on
+            if ( UsePot  &&  !OPT__MINIMIZE_MPI_BARRIER  &&  !OPT__POT_LEVEL_MG )
             TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                               _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv][1],   TIMER_ON   );
-         } // if ( OPT__OVERLAP_MPI ) ... else ...
+         } // if ( OverlapGra ) ... else ...
 
          if ( UsePot )
          {
@@ -432,6 +479,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
       } // if ( lv == 0 ) ... else ...
 
+//    the gravity solver updates both the fluid and potential
+      Prepare_PatchData_Cache_Invalidate( lv, _TOTAL|_POTE, _NONE );
+
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 #     endif // #ifdef GRAVITY
 // ===============================================================================================
@@ -507,6 +557,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Src_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_SrcFlu, SaveSg_SrcMag, false, false ),
                         Timer_Src_Advance[lv],   TIMER_ON   );
 
+         FluBufUpdated = false;
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       }
 
@@ -526,6 +579,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Grackle_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Che, false, false ),
                         Timer_Che_Advance[lv],   TIMER_ON   );
 
+         FluBufUpdated = false;
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       } // if ( GRACKLE_ACTIVATE )
 #     endif // #ifdef SUPPORT_GRACKLE
@@ -560,6 +616,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   SF_CreateStar( lv, TimeNew, dt_SubStep ),
                         Timer_SF[lv],   TIMER_ON   );
 
+         FluBufUpdated = false;
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       } // if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )
 #     endif // #ifdef STAR_FORMATION
@@ -587,6 +646,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   FB_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_FBFlu, SaveSg_FBMag ),
                         Timer_FB_Advance[lv],   TIMER_ON   );
 
+         FluBufUpdated = false;
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       }
 #     endif // #ifdef FEEDBACK
@@ -603,6 +665,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          {
             TIMING_FUNC(   Flu_ResetByUser_API_Ptr( lv, SaveSg_Flu, SaveSg_Mag, TimeNew, dt_SubStep ),
                            Timer_Flu_Advance[lv],   TIMER_ON   );
+
+            FluBufUpdated = false;
+            Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
          }
 
          else
@@ -614,13 +679,17 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //    8. update MPI buffers
 // ===============================================================================================
 //    exchange the updated fluid field in the buffer patches
+//    --> skip it if it has been done during the MPI overlapping and the fluid field has not been modified since then
+      if ( !FluBufUpdated )
       TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
                                         _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][2],   TIMER_ON   );
 
 //    exchange the updated potential in the buffer patches here if OPT__MINIMIZE_MPI_BARRIER is adopted
+//    --> it has been done during the MPI overlapping if OverlapGra is on
+//    --> it has been done by Gra_AdvanceDt() if OPT__POT_LEVEL_MG is on
 #     ifdef GRAVITY
-      if ( lv > 0  &&  UsePot  &&  OPT__MINIMIZE_MPI_BARRIER )
+      if ( lv > 0  &&  UsePot  &&  OPT__MINIMIZE_MPI_BARRIER  &&  !OverlapGra  &&  !OPT__POT_LEVEL_MG )
       TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                         _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][1],   TIMER_ON   );
@@ -676,6 +745,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Mis_UserWorkBeforeNextLevel_Ptr( lv, TimeNew, TimeOld, dt_SubStep ),
                         Timer_Flu_Advance[lv],   TIMER_ON   );
 
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       }
 // ===============================================================================================
@@ -687,6 +758,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       AdvanceCounter[lv] ++;
       amr->NUpdateLv[lv] ++;
 
+//    convert the solver wall time measured during this update to the load-balance workload
+#     ifdef LOAD_BALANCE
+      if ( OPT__LB_MEASURED_COST )  LB_UpdateMeasuredCost( lv );
+#     endif
+
       if ( AdvanceCounter[lv] >= __LONG_MAX__ )    Aux_Message( stderr, "WARNING : AdvanceCounter overflow !!\n" );
 
 
@@ -758,6 +834,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          }
 
 //       12-4. exchange the updated data
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
 #        ifdef MHD
          if ( OPT__FIXUP_FLUX  ||  OPT__FIXUP_RESTRICT  ||  OPT__FIXUP_ELECTRIC )
 #        else
@@ -871,6 +949,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Mis_UserWorkBeforeNextSubstep_Ptr( lv, TimeNew, TimeOld, dt_SubStep ),
                         Timer_Flu_Advance[lv],   TIMER_ON   );
 
+         Prepare_PatchData_Cache_Invalidate( lv, _TOTAL, _MAG );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
       }
 // ===============================================================================================
@@ -882,5 +962,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
    Timer_Lv[lv]->Stop();
 #  endif
 
+   if ( lv == 0 )    Prepare_PatchData_Cache_Reset();
+
 } // FUNCTION : EvolveLevel
 
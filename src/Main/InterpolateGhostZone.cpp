@@ -231,6 +231,9 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
 
 // coarse-grid data for interpolation (including the ghost zones on each side)
+// --> allocated from the scratch arena of the calling thread and released automatically when returning
+   ScratchScope_t Scratch;
+
 #  if ( MODEL == HYDRO  &&  defined MHD )
 // IntIter requires the cell-centered B field
    const int NVarCC_Allocate = ( IntIter ) ? NVarCC_Tot+NCOMP_MAG : NVarCC_Tot;
@@ -238,12 +241,11 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
    const int NVarCC_Allocate = NVarCC_Tot;
 #  endif
    real *CData_CC_Ptr = NULL;
-   real *CData_CC     = new real [ NVarCC_Allocate*CSize3D_CC ];
-   real **CData_FC    = NULL;
+   real *CData_CC     = Scratch.Allocate<real>( NVarCC_Allocate*CSize3D_CC );
+   real *CData_FC[3]  = { NULL, NULL, NULL };
 
 // assuming NVarFC_Tot = either 0 or 3
-   CData_FC = new real* [NVarFC_Tot];
-   for (int v=0; v<NVarFC_Tot; v++)    CData_FC[v] = new real [ CSize3D_FC[v] ];
+   for (int v=0; v<NVarFC_Tot; v++)    CData_FC[v] = Scratch.Allocate<real>( CSize3D_FC[v] );
 
 
 // temporal interpolation parameters
@@ -1729,7 +1731,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                      IntData_FC + FSize3D_FC[0],
                                      IntData_FC + FSize3D_FC[0] + FSize3D_FC[1] };
 
-         FMag_CC_IntIter = new real [FSize3D_CC][NCOMP_MAG];
+         FMag_CC_IntIter = (real (*)[NCOMP_MAG])Scratch.Allocate<real>( FSize3D_CC*NCOMP_MAG );
 
          for (int k=0; k<FSize_CC[2]; k++)
          for (int j=0; j<FSize_CC[1]; j++)
@@ -1752,8 +1754,6 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                    (IntIter && OPT__INT_PRIM)?INT_PRIM_YES:INT_PRIM_NO,
                    (IntIter                 )?INT_REDUCE_MONO_COEFF:INT_FIX_MONO_COEFF,
                    CMag_CC_IntIter, FMag_CC_IntIter );
-
-      delete [] FMag_CC_IntIter;
    } // if ( IntPhase ) ... else ...
 
    NVarCC_SoFar = NVarCC_Flu;
@@ -1866,13 +1866,6 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 #  endif
 
 
-// free memory
-   delete [] CData_CC;
-   for (int v=0; v<NVarFC_Tot; v++)    delete [] CData_FC[v];
-   delete [] CData_FC;
-
-
-
 // d. ensure the consistency between pressure, total energy density, and the dual-energy variable
 //    when DUAL_ENERGY is on
 //    --> we don't have to check the minimum pressure here when DUAL_ENERGY is off
@@ -1,11 +1,49 @@
 #include "GAMER.h"
 
 static void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                              const int *PID0_List, const int ArrayID );
+                              const int *PID0_List, const int ArrayID, const int PG0 );
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
-                    const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
+                    const int NPG, const int ArrayID, const int PG0, const double dt, const double Poi_Coeff, double *PG_Time );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const int PG0, const double dt );
+static void StartCostTimer( const int NPG, double *PG_Time, Timer_t &Timer_Batch );
+#if ( !defined GPU  &&  defined OPENMP )
+static void Pipeline_FluidSolver( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                                  const int SaveSg_Flu, const int SaveSg_Mag, const int NTotal, const int NPG_Max,
+                                  const int *PID0_List, const bool MeasureCost, double *PG_Time[], Timer_t Timer_Batch[] );
+
+// fraction of OpenMP threads assigned to the solver team of the CPU pipeline on each level
+// --> adjusted on the fly by Pipeline_FluidSolver(); <= 0.0 means not yet measured
+static double Pipeline_SolFrac[NLEVEL];
+#endif
+
+// pointer to the PG0-th patch group of the solver arrays (NULL for the arrays not in use)
+template <typename T>
+static T *PG_Shift( T *Ptr, const int PG0 )  {  return ( Ptr == NULL ) ? NULL : Ptr + PG0;  }
+#ifndef GPU
+static bool AutoTune_Start( const Solver_t TSolver, const int lv, const int NTotal, const bool OverlapMPI, int &NPG_Max,
+                            int &Chunk_Old, Timer_t &Timer_AutoTune );
+static void AutoTune_Stop( const Solver_t TSolver, const int lv, const int NTotal, const bool Measure, const int Chunk_Old,
+                           Timer_t &Timer_AutoTune );
+
+// auto-tuning status of the batch size and the OpenMP chunk size of each solver on each level for OPT__AUTO_NPGROUP
+// --> Stage: 0 = warm-up, 1 = tuning the batch size, 2 = tuning the chunk size, 3 = done
+struct AutoTune_t
+{
+   int    Stage;        // current tuning stage
+   int    Trial;        // index of the candidate being tested in the current stage
+   int    NPG;          // selected number of patch groups per batch (<= 0 --> *_GPU_NPGROUP)
+   int    Chunk;        // selected OpenMP chunk size (<= 0 --> unchanged)
+   int    NPG_Max;      // upper bound of the number of patch groups per batch
+   int    NPG_Try;      // number of patch groups per batch being tested
+   int    Chunk_Try;    // OpenMP chunk size being tested
+   double BestTime;     // shortest wall time per patch group measured in the current stage
+};
+
+// status of each solver on each level
+// --> the second dimension is SRC_SOLVER+1 since SRC_SOLVER is the largest solver index but is not covered by NSOLVER
+static AutoTune_t AutoTune[NLEVEL][SRC_SOLVER+1];
+#endif
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -33,6 +71,17 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. For LOAD_BALANCE, one can turn on the option "OPT__LB_MEASURED_COST" to record the wall time
+//                   of the fluid solver spent on each patch group for estimating the load-balance workload
+//                   --> Use the wall time of each batch of patch groups when the time of individual patch groups
+//                       is unavailable (e.g., GPU solvers)
+//                6. For the CPU fluid solver, one can turn on the option "OPT__CPU_PIPELINE" to overlap the
+//                   preparation and closing steps with the execution step of different batches of patch groups
+//                   --> See Pipeline_FluidSolver()
+//                7. For the CPU solvers, one can turn on the option "OPT__AUTO_NPGROUP" to select the number of
+//                   patch groups per batch and the OpenMP chunk size of each solver on each level by timing the
+//                   first few invocations
+//                   --> See AutoTune_Start()
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -193,18 +242,70 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
       for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
    } // if ( OverlapMPI ) ... else ...
 
+// set the batch size and OpenMP chunk size tuned for OPT__AUTO_NPGROUP
+#  ifndef GPU
+   int     AutoTune_Chunk0  = NULL_INT;
+   bool    AutoTune_Measure = false;
+   Timer_t Timer_AutoTune;
+
+   if ( OPT__AUTO_NPGROUP )
+      AutoTune_Measure = AutoTune_Start( TSolver, lv, NTotal, OverlapMPI, NPG_Max, AutoTune_Chunk0, Timer_AutoTune );
+#  endif
+
    NPG[ArrayID] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
 
 
+// allocate the arrays for measuring the wall time of the fluid solver
+// --> PG_Time[] records the time of individual patch groups and remains negative if it is unavailable
+// --> Timer_Batch[] records the time of an entire batch of patch groups
+#  ifdef LOAD_BALANCE
+   const bool MeasureCost = ( OPT__LB_MEASURED_COST  &&  TSolver == FLUID_SOLVER );
+#  else
+   const bool MeasureCost = false;
+#  endif
+   double *PG_Time[2] = { NULL, NULL };
+   Timer_t Timer_Batch[2];
+
+   if ( MeasureCost )
+      for (int t=0; t<2; t++)    PG_Time[t] = new double [NPG_Max];
+
+
+// pipeline the preparation, execution, and closing steps of the CPU fluid solver
+// --> require at least two batches of patch groups and two OpenMP threads
+// --> disabled when being invoked within an OpenMP parallel region (e.g., for OPT__OVERLAP_MPI)
+#  if ( !defined GPU  &&  defined OPENMP )
+   if ( OPT__CPU_PIPELINE  &&  TSolver == FLUID_SOLVER  &&  NTotal > NPG_Max  &&  OMP_NTHREAD > 1  &&  !omp_in_parallel() )
+   {
+      Pipeline_FluidSolver( lv, TimeNew, TimeOld, dt, SaveSg_Flu, SaveSg_Mag, NTotal, NPG_Max, PID0_List,
+                            MeasureCost, PG_Time, Timer_Batch );
+
+      if ( OPT__AUTO_NPGROUP )
+         AutoTune_Stop( TSolver, lv, NTotal, AutoTune_Measure, AutoTune_Chunk0, Timer_AutoTune );
+
+      if ( AllocateList )  delete [] PID0_List;
+
+      for (int t=0; t<2; t++)    delete [] PG_Time[t];
+
+      return;
+   }
+#  endif
+
+
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID ),
+   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID, 0 ),
                   Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+   if ( MeasureCost )   StartCostTimer( NPG[ArrayID], PG_Time[ArrayID], Timer_Batch[ArrayID] );
+
+   TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff, PG_Time[ArrayID] ),
                   Timer_Sol[lv][TSolver]  );
+
+#  ifndef GPU
+   if ( MeasureCost )   Timer_Batch[ArrayID].Stop();
+#  endif
 //-------------------------------------------------------------------------------------------------------------
 
 
@@ -216,7 +317,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID ),
+      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID, 0 ),
                      Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -224,41 +325,69 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 //-------------------------------------------------------------------------------------------------------------
 #     ifdef GPU
       CUAPI_Synchronize();
+
+      if ( MeasureCost )   Timer_Batch[1-ArrayID].Stop();
 #     endif
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+      if ( MeasureCost )   StartCostTimer( NPG[ArrayID], PG_Time[ArrayID], Timer_Batch[ArrayID] );
+
+      TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff, PG_Time[ArrayID] ),
                      Timer_Sol[lv][TSolver]  );
+
+#     ifndef GPU
+      if ( MeasureCost )   Timer_Batch[ArrayID].Stop();
+#     endif
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
       TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, 0, dt ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
+#     ifdef LOAD_BALANCE
+      if ( MeasureCost )
+         LB_AddMeasuredCost( lv, NPG[1-ArrayID], PID0_List+Disp-NPG_Max, PG_Time[1-ArrayID],
+                             Timer_Batch[1-ArrayID].GetValue() );
+#     endif
+
    } // for (int Disp=NPG_Max; Disp<NTotal; Disp+=NPG_Max)
 
 
 //-------------------------------------------------------------------------------------------------------------
 #  ifdef GPU
    CUAPI_Synchronize();
+
+   if ( MeasureCost )   Timer_Batch[ArrayID].Stop();
 #  endif
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
    TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, 0, dt ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
+#  ifdef LOAD_BALANCE
+   if ( MeasureCost )
+      LB_AddMeasuredCost( lv, NPG[ArrayID], PID0_List+Disp-NPG_Max, PG_Time[ArrayID], Timer_Batch[ArrayID].GetValue() );
+#  endif
+
+#  ifndef GPU
+   if ( OPT__AUTO_NPGROUP )
+      AutoTune_Stop( TSolver, lv, NTotal, AutoTune_Measure, AutoTune_Chunk0, Timer_AutoTune );
+#  endif
+
 
    if ( AllocateList )  delete [] PID0_List;
 
+   for (int t=0; t<2; t++)    delete [] PG_Time[t];
+
 } // FUNCTION : InvokeSolver
 
 
@@ -290,11 +419,17 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 //                NPG       : Number of patch groups to be prepared at a time
 //                PID0_List : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                PG0       : Index of the first patch group in the arrays to store the prepared data
+//                            --> Only for the fluid solver (see Pipeline_FluidSolver()). Must be 0 for other solvers.
 //-------------------------------------------------------------------------------------------------------
 void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                       const int *PID0_List, const int ArrayID )
+                       const int *PID0_List, const int ArrayID, const int PG0 )
 {
 
+// check
+   if ( PG0 != 0  &&  TSolver != FLUID_SOLVER )
+      Aux_Error( ERROR_INFO, "PG0 (%d) != 0 is only supported by the fluid solver (TSolver %d) !!\n", PG0, TSolver );
+
 #  ifndef UNSPLIT_GRAVITY
    real (*h_Pot_Array_USG_F[2])[ CUBE(USG_NXT_F) ]                    = { NULL, NULL };
 #  endif
@@ -314,8 +449,8 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
    switch ( TSolver )
    {
       case FLUID_SOLVER :
-         Flu_Prepare( lv, TimeOld, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID],
-                      h_Pot_Array_USG_F[ArrayID], h_Corner_Array_F[ArrayID], NPG, PID0_List );
+         Flu_Prepare( lv, TimeOld, PG_Shift(h_Flu_Array_F_In[ArrayID],PG0), PG_Shift(h_Mag_Array_F_In[ArrayID],PG0),
+                      PG_Shift(h_Pot_Array_USG_F[ArrayID],PG0), PG_Shift(h_Corner_Array_F[ArrayID],PG0), NPG, PID0_List );
       break;
 
 #     ifdef GRAVITY
@@ -325,7 +460,8 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
                         Timer_Poi_PreRho[lv]   );
 
          if ( OPT__SELF_GRAVITY )
-         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], h_Pot_Array_P_Out[ArrayID], NPG, PID0_List,
+                                         Poi_WarmStart(lv,TimeNew) ),
                         Timer_Poi_PrePot_C[lv]   );
 
 //       use the same timer "Timer_Poi_PreRho" as Poi_Prepare_Rho()
@@ -362,7 +498,8 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
                         Timer_Poi_PreRho[lv]   );
 
          if ( OPT__SELF_GRAVITY )
-         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], h_Pot_Array_P_Out[ArrayID], NPG, PID0_List,
+                                         Poi_WarmStart(lv,TimeNew) ),
                         Timer_Poi_PrePot_C[lv]   );
 
          TIMING_SYNC(   Gra_Prepare_Flu( lv, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
@@ -437,13 +574,23 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 //                TimeOld   : Physical time before update   (for external gravity with UNSPLIT_GRAVITY)
 //                NPG       : Number of patch groups to be updated at a time
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                PG0       : Index of the first patch group in the arrays to be updated
+//                            --> Only for the fluid solver (see Pipeline_FluidSolver()). Must be 0 for other solvers.
 //                dt        : Time interval to advance solution (for the fluid, gravity, and Grackle solvers)
 //                Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
+//                PG_Time   : Array to store the wall time spent on each patch group (for OPT__LB_MEASURED_COST only)
+//                            --> Also shifted by PG0
+//                            --> Only filled by the CPU fluid solvers of the MHM/MHM_RP/CTU schemes
+//                            --> Set to NULL to disable timing
 //-------------------------------------------------------------------------------------------------------
 void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
-             const int NPG, const int ArrayID, const double dt, const double Poi_Coeff )
+             const int NPG, const int ArrayID, const int PG0, const double dt, const double Poi_Coeff, double *PG_Time )
 {
 
+// check
+   if ( PG0 != 0  &&  TSolver != FLUID_SOLVER )
+      Aux_Error( ERROR_INFO, "PG0 (%d) != 0 is only supported by the fluid solver (TSolver %d) !!\n", PG0, TSolver );
+
    const double dh = amr->dh[lv];
 
 #  ifdef GRAVITY
@@ -548,10 +695,11 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                  JEANS_MIN_PRES, JeansMinPres_Coeff,
                                  GPU_NSTREAM );
 #        else
-         CPU_FluidSolver       ( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
-                                 h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
-                                 h_DE_Array_F_Out[ArrayID], h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
+         CPU_FluidSolver       ( PG_Shift(h_Flu_Array_F_In[ArrayID],PG0), PG_Shift(h_Flu_Array_F_Out[ArrayID],PG0),
+                                 PG_Shift(h_Mag_Array_F_In[ArrayID],PG0), PG_Shift(h_Mag_Array_F_Out[ArrayID],PG0),
+                                 PG_Shift(h_DE_Array_F_Out[ArrayID],PG0), PG_Shift(h_Flux_Array[ArrayID],PG0),
+                                 PG_Shift(h_Ele_Array[ArrayID],PG0),
+                                 PG_Shift(h_Corner_Array_F[ArrayID],PG0), PG_Shift(h_Pot_Array_USG_F[ArrayID],PG0),
                                  NPG, dt, dh, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ,
                                  OPT__LR_LIMITER, MINMOD_COEFF, MINMOD_MAX_ITER,
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
@@ -559,7 +707,7 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                  MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx,
                                  OPT__INT_FRAC_PASSIVE_LR, PassiveIntFrac_NVar, PassiveIntFrac_VarIdx,
-                                 JEANS_MIN_PRES, JeansMinPres_Coeff );
+                                 JEANS_MIN_PRES, JeansMinPres_Coeff, PG_Shift(PG_Time,PG0) );
 #        endif
       break;
 
@@ -583,8 +731,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           h_Pot_Array_P_Out[ArrayID], NULL, h_Corner_Array_PGT[ArrayID],
                                           NULL, NULL, NULL, NULL,
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
-                                          SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
-                                          MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
+                                          SOR_OMEGA, SOR_TOLERATED_ERROR, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
+                                          MG_TOLERATED_ERROR, Poi_WarmStart(lv,TimeNew), Poi_Coeff, OPT__POT_INT_SCHEME,
                                           NULL_BOOL, ELBDM_ETA, NULL_REAL, POISSON_ON, GRAVITY_OFF,
                                           OPT__SELF_GRAVITY, OPT__EXT_POT, OPT__EXT_ACC,
                                           TimeNew, TimeOld, NULL_REAL );
@@ -612,8 +760,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
                                           h_Emag_Array_G[ArrayID],
                                           NPG, dt, dh, NULL_INT, NULL_INT,
-                                          NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
-                                          NULL_REAL, NULL_REAL, (IntScheme_t)NULL_INT,
+                                          NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
+                                          NULL_REAL, false, NULL_REAL, (IntScheme_t)NULL_INT,
                                           OPT__GRA_P5_GRADIENT, ELBDM_ETA, ELBDM_LAMBDA, POISSON_OFF, GRAVITY_ON,
                                           OPT__SELF_GRAVITY, OPT__EXT_POT, OPT__EXT_ACC,
                                           TimeNew, TimeOld, MIN_EINT );
@@ -641,8 +789,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
                                           h_Emag_Array_G[ArrayID],
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
-                                          SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
-                                          MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
+                                          SOR_OMEGA, SOR_TOLERATED_ERROR, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
+                                          MG_TOLERATED_ERROR, Poi_WarmStart(lv,TimeNew), Poi_Coeff, OPT__POT_INT_SCHEME,
                                           OPT__GRA_P5_GRADIENT, ELBDM_ETA, ELBDM_LAMBDA, POISSON_ON, GRAVITY_ON,
                                           OPT__SELF_GRAVITY, OPT__EXT_POT, OPT__EXT_ACC,
                                           TimeNew, TimeOld, MIN_EINT );
@@ -756,12 +904,18 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                NPG        : Number of patch groups to be evaluated at a time
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
+//                PG0        : Index of the first patch group in the arrays to be stored
+//                             --> Only for the fluid solver (see Pipeline_FluidSolver()). Must be 0 for other solvers.
 //                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const int PG0, const double dt )
 {
 
+// check
+   if ( PG0 != 0  &&  TSolver != FLUID_SOLVER )
+      Aux_Error( ERROR_INFO, "PG0 (%d) != 0 is only supported by the fluid solver (TSolver %d) !!\n", PG0, TSolver );
+
 #  ifndef DUAL_ENERGY
    char (*h_DE_Array_F_Out [2])[ CUBE(PS2) ]                          = { NULL, NULL };
 #  endif
@@ -780,9 +934,10 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
    switch ( TSolver )
    {
       case FLUID_SOLVER :
-         Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                    h_Flu_Array_F_Out[ArrayID], h_Mag_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
-                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt );
+         Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, PG_Shift(h_Flux_Array[ArrayID],PG0), PG_Shift(h_Ele_Array[ArrayID],PG0),
+                    PG_Shift(h_Flu_Array_F_Out[ArrayID],PG0), PG_Shift(h_Mag_Array_F_Out[ArrayID],PG0),
+                    PG_Shift(h_DE_Array_F_Out[ArrayID],PG0),
+                    NPG, PID0_List, PG_Shift(h_Flu_Array_F_In[ArrayID],PG0), PG_Shift(h_Mag_Array_F_In[ArrayID],PG0), dt );
       break;
 
 #     ifdef GRAVITY
@@ -830,3 +985,435 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 } // FUNCTION : Closing_Step
 
 
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  StartCostTimer
+// Description :  Reset the per-patch-group wall time and start the batch timer before invoking the fluid solver
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__LB_MEASURED_COST is on
+//                2. PG_Time[] is set to -1.0 so that LB_AddMeasuredCost() falls back to the batch wall time
+//                   for solvers not recording the time of individual patch groups
+//
+// Parameter   :  NPG         : Number of patch groups in this batch
+//                PG_Time     : Array to store the wall time spent on each patch group
+//                Timer_Batch : Timer for the entire batch
+//-------------------------------------------------------------------------------------------------------
+void StartCostTimer( const int NPG, double *PG_Time, Timer_t &Timer_Batch )
+{
+
+   for (int t=0; t<NPG; t++)  PG_Time[t] = -1.0;
+
+   Timer_Batch.Reset();
+   Timer_Batch.Start();
+
+} // FUNCTION : StartCostTimer
+
+
+
+#if ( !defined GPU  &&  defined OPENMP )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pipeline_FluidSolver
+// Description :  Pipelined version of InvokeSolver() for the CPU fluid solver
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__CPU_PIPELINE is on
+//                2. All OpenMP threads work in a single parallel region created once per invocation and are
+//                   split by omp_get_thread_num() into two groups working simultaneously on different batches
+//                   --> Solver group : execution step of batch n
+//                       Host   group : closing step of batch n-1 followed by the preparation step of batch n+1
+//                   --> Batches n-1 and n+1 share the same double-buffered arrays (ArrayID) and are thus
+//                       processed one after the other, as in the GPU version where the host closes and prepares
+//                       batches while the GPU advances the next one
+//                   --> All threads synchronize once per batch
+//                3. Each thread processes chunks of patch groups taken dynamically from the shared counters of
+//                   its group, and then helps the other group once its own chunks are exhausted
+//                   --> The OpenMP parallel regions inside the preparation, execution, and closing steps are
+//                       inactive and executed by the calling thread only (nested parallelism is disabled in
+//                       Init_OpenMP())
+//                   --> A host chunk closes and then prepares the same patch groups of the shared arrays,
+//                       so that the input data of batch n-1 are never overwritten before being used
+//                4. Flu_Prepare() of batch n+1 can run concurrently with Flu_Close() of batch n-1 since the
+//                   fluid solver never stores the updated data in the input sandglass
+//                   --> Checked by InvokeSolver()
+//                5. Number of threads in each group is adjusted after each batch according to the time spent
+//                   on each group
+//                   --> Recorded in Pipeline_SolFrac[lv]
+//                6. OPT__TIMING_BARRIER is not applied to the pipelined steps. Timer_Pre/Sol/Clo record the
+//                   time spent on each step divided by the number of threads.
+//
+// Parameter   :  lv          : Target refinement level
+//                TimeNew     : Target physical time to reach
+//                TimeOld     : Physical time before update
+//                dt          : Time interval to advance solution
+//                SaveSg_Flu  : Sandglass to store the updated fluid data
+//                SaveSg_Mag  : Sandglass to store the updated B field
+//                NTotal      : Total number of patch groups to be updated
+//                NPG_Max     : Maximum number of patch groups to be updated at a time
+//                PID0_List   : List recording the patch indices with LocalID==0 to be udpated
+//                MeasureCost : Record the wall time of the fluid solver for OPT__LB_MEASURED_COST
+//                PG_Time     : Arrays to store the wall time spent on each patch group
+//                Timer_Batch : Timers for the entire batch
+//-------------------------------------------------------------------------------------------------------
+void Pipeline_FluidSolver( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                           const int SaveSg_Flu, const int SaveSg_Mag, const int NTotal, const int NPG_Max,
+                           const int *PID0_List, const bool MeasureCost, double *PG_Time[], Timer_t Timer_Batch[] )
+{
+
+   const Solver_t TSolver   = FLUID_SOLVER;
+   const int      SaveSg_No = NULL_INT;
+   const int      NBatch    = ( NTotal + NPG_Max - 1 ) / NPG_Max;
+   const int      NT        = OMP_NTHREAD;
+
+// number of patch groups per chunk (about four chunks per thread in each batch)
+   const int      Chunk     = MAX( 1, NPG_Max/(4*NT) );
+
+   int    NPG[2];
+   int    NT_Sol, Next_Sol, Next_Host;
+   double Time_Sol, Time_Clo, Time_Pre;
+
+
+// 1. prepare the first batch by all threads
+   NPG[0] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
+
+   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[0], PID0_List, 0, 0 ),
+                  Timer_Pre[lv][TSolver]  );
+
+
+// 2. advance batch n while closing batch n-1 and preparing batch n+1
+#  pragma omp parallel num_threads( NT )
+   {
+      const int TID = omp_get_thread_num();
+
+      for (int Batch=0; Batch<NBatch; Batch++)
+      {
+         const int  ArrayID = Batch % 2;
+         const int  Disp    = Batch*NPG_Max;
+         const bool Close   = ( Batch > 0 );
+         const bool Prepare = ( Batch < NBatch-1 );
+
+//       2-1. set up this batch
+#        pragma omp single
+         {
+            if ( Prepare )
+               NPG[1-ArrayID] = ( NPG_Max < NTotal-Disp-NPG_Max ) ? NPG_Max : NTotal-Disp-NPG_Max;
+
+//          number of threads in the solver group
+            if ( Pipeline_SolFrac[lv] <= 0.0 )  Pipeline_SolFrac[lv] = 0.5;
+
+            NT_Sol = (int)round( Pipeline_SolFrac[lv]*NT );
+            NT_Sol = MAX( NT_Sol, 1 );
+            NT_Sol = MIN( NT_Sol, NT-1 );
+
+            Next_Sol  = 0;
+            Next_Host = 0;
+            Time_Sol  = 0.0;
+            Time_Clo  = 0.0;
+            Time_Pre  = 0.0;
+
+            if ( MeasureCost )
+            {
+               for (int t=0; t<NPG[ArrayID]; t++)  PG_Time[ArrayID][t] = -1.0;
+
+               Timer_Batch[ArrayID].Reset();
+            }
+         } // implicit barrier
+
+         const int NPG_Sol  = NPG[ArrayID];
+         const int NPG_Clo  = ( Close   ) ? NPG_Max        : 0;   // all batches but the last one are full
+         const int NPG_Pre  = ( Prepare ) ? NPG[1-ArrayID] : 0;
+         const int NPG_Host = MAX( NPG_Clo, NPG_Pre );
+
+//       2-2. process the chunks of the own group first and then those of the other group
+         double MyTime_Sol = 0.0, MyTime_Clo = 0.0, MyTime_Pre = 0.0;
+
+         for (int Pass=0; Pass<2; Pass++)
+         {
+            const bool DoSolver = ( ( TID < NT_Sol ) == ( Pass == 0 ) );
+
+            while ( true )
+            {
+               int PG0;
+
+               if ( DoSolver )
+               {
+#                 pragma omp atomic capture
+                  {  PG0 = Next_Sol;  Next_Sol += Chunk;  }
+
+                  if ( PG0 >= NPG_Sol )   break;
+
+                  const int    NPG_Chunk = MIN( Chunk, NPG_Sol-PG0 );
+                  const double Time0     = omp_get_wtime();
+
+                  Solver( TSolver, lv, TimeNew, TimeOld, NPG_Chunk, ArrayID, PG0, dt, NULL_REAL, PG_Time[ArrayID] );
+
+                  MyTime_Sol += omp_get_wtime() - Time0;
+               }
+
+               else
+               {
+#                 pragma omp atomic capture
+                  {  PG0 = Next_Host;  Next_Host += Chunk;  }
+
+                  if ( PG0 >= NPG_Host )  break;
+
+                  const double Time0 = omp_get_wtime();
+
+                  if ( PG0 < NPG_Clo )
+                     Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_No, MIN( Chunk, NPG_Clo-PG0 ),
+                                   PID0_List+Disp-NPG_Max+PG0, 1-ArrayID, PG0, dt );
+
+                  const double Time1 = omp_get_wtime();
+
+                  if ( PG0 < NPG_Pre )
+                     Preparation_Step( TSolver, lv, TimeNew, TimeOld, MIN( Chunk, NPG_Pre-PG0 ),
+                                       PID0_List+Disp+NPG_Max+PG0, 1-ArrayID, PG0 );
+
+                  MyTime_Clo += Time1 - Time0;
+                  MyTime_Pre += omp_get_wtime() - Time1;
+               }
+            } // while ( true )
+         } // for (int Pass=0; Pass<2; Pass++)
+
+#        pragma omp atomic
+         Time_Sol += MyTime_Sol;
+#        pragma omp atomic
+         Time_Clo += MyTime_Clo;
+#        pragma omp atomic
+         Time_Pre += MyTime_Pre;
+
+#        pragma omp barrier
+
+//       2-3. record the timing and rebalance the threads between the two groups
+//       --> use the batches with both the closing and preparation steps for rebalancing
+#        pragma omp single
+         {
+#           if ( defined TIMING_SOLVER  &&  defined TIMING )
+            Timer_Sol[lv][TSolver]->AddValue( Time_Sol/NT );
+            Timer_Clo[lv][TSolver]->AddValue( Time_Clo/NT );
+            Timer_Pre[lv][TSolver]->AddValue( Time_Pre/NT );
+#           endif
+
+            if ( MeasureCost )
+            {
+               Timer_Batch[ArrayID].AddValue( Time_Sol/NT );
+
+#              ifdef LOAD_BALANCE
+               if ( Close )
+                  LB_AddMeasuredCost( lv, NPG_Clo, PID0_List+Disp-NPG_Max, PG_Time[1-ArrayID],
+                                      Timer_Batch[1-ArrayID].GetValue() );
+#              endif
+            }
+
+            const double Time_Host = Time_Clo + Time_Pre;
+
+            if ( Close  &&  Prepare  &&  Time_Sol > 0.0  &&  Time_Host > 0.0 )
+               Pipeline_SolFrac[lv] = 0.5*Pipeline_SolFrac[lv] + 0.5*Time_Sol/( Time_Sol + Time_Host );
+         } // implicit barrier
+      } // for (int Batch=0; Batch<NBatch; Batch++)
+   } // OpenMP parallel region
+
+
+// 3. close the last batch by all threads
+   const int ArrayID = ( NBatch - 1 ) % 2;
+   const int Disp    = ( NBatch - 1 )*NPG_Max;
+
+   TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_No, NPG[ArrayID], PID0_List+Disp, ArrayID, 0, dt ),
+                  Timer_Clo[lv][TSolver]  );
+
+#  ifdef LOAD_BALANCE
+   if ( MeasureCost )
+      LB_AddMeasuredCost( lv, NPG[ArrayID], PID0_List+Disp, PG_Time[ArrayID], Timer_Batch[ArrayID].GetValue() );
+#  endif
+
+
+// check that the persistent threads reuse the same scratch arenas across the pipelined steps
+#  ifdef GAMER_DEBUG
+   const int NArena_Max = ( OPT__OVERLAP_MPI ) ? SQR( NT ) : NT;
+
+   if ( Aux_ScratchArena_Count() > NArena_Max )
+      Aux_Error( ERROR_INFO, "number of scratch arenas (%d) > %d at level %d !!\n",
+                 Aux_ScratchArena_Count(), NArena_Max, lv );
+#  endif
+
+} // FUNCTION : Pipeline_FluidSolver
+#endif // #if ( !defined GPU  &&  defined OPENMP )
+
+
+
+#ifndef GPU
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AutoTune_Start
+// Description :  Set the number of patch groups per batch and the OpenMP chunk size for OPT__AUTO_NPGROUP
+//
+// Note        :  1. Invoked by InvokeSolver() before the preparation step
+//                2. Candidates are tested one per invocation of each solver on each level
+//                   --> Stage 1 : batch sizes NPG_Max/2^n (n = 0, 1, ...) that are not smaller than OMP_NTHREAD
+//                       Stage 2 : chunk sizes 2^n (n = 0, 1, ...) that leave at least one chunk per thread in a
+//                                 batch of the selected size
+//                   --> The candidate with the shortest wall time per patch group is selected at the end of
+//                       each stage by AutoTune_Stop()
+//                   --> The first invocation is excluded to skip the one-off overheads such as allocating the
+//                       scratch arenas
+//                3. NPG_Max (i.e., *_GPU_NPGROUP) is the upper bound of the batch size since it sets the size
+//                   of the host arrays
+//                4. The chunk size only applies to the OpenMP loops with the "runtime" schedule
+//                5. Invocations concurrent with MPI communication (i.e., OverlapMPI) and invocations with fewer
+//                   patch groups than OpenMP threads are not timed
+//                   --> They adopt the current selection
+//                6. Each MPI rank tunes independently. The batch size and chunk size do not affect the results.
+//
+// Parameter   :  TSolver        : Target solver
+//                lv             : Target refinement level
+//                NTotal         : Total number of patch groups to be updated
+//                OverlapMPI     : true --> Invoked concurrently with MPI communication
+//                NPG_Max        : Maximum number of patch groups to be updated at a time
+//                                 --> Will be overwritten by the selected or candidate batch size
+//                Chunk_Old      : OpenMP chunk size to be restored by AutoTune_Stop()
+//                Timer_AutoTune : Timer started here if this invocation is to be timed
+//
+// Return      :  true  --> this invocation is to be timed
+//                false --> otherwise
+//-------------------------------------------------------------------------------------------------------
+bool AutoTune_Start( const Solver_t TSolver, const int lv, const int NTotal, const bool OverlapMPI, int &NPG_Max,
+                     int &Chunk_Old, Timer_t &Timer_AutoTune )
+{
+
+   AutoTune_t &AT      = AutoTune[lv][TSolver];
+   const bool  Measure = ( AT.Stage < 3  &&  !OverlapMPI  &&  NTotal >= OMP_NTHREAD );
+
+   int NPG   = ( AT.NPG > 0 ) ? AT.NPG : NPG_Max;
+   int Chunk = AT.Chunk;
+
+// only the timed invocations update the status since the untimed ones may run concurrently (e.g., OverlapMPI)
+   if ( Measure )
+   {
+      if ( AT.Stage == 1 )    NPG   = NPG_Max >> AT.Trial;
+      if ( AT.Stage == 2 )    Chunk = 1       << AT.Trial;
+
+      AT.NPG_Max   = NPG_Max;
+      AT.NPG_Try   = NPG;
+      AT.Chunk_Try = Chunk;
+   }
+
+   NPG_Max = MIN( NPG, NPG_Max );
+
+
+// set the chunk size of the "runtime" schedule, which is inherited by the following parallel regions
+#  ifdef OPENMP
+   omp_sched_t Kind;
+   omp_get_schedule( &Kind, &Chunk_Old );
+
+   if ( Chunk > 0 )  omp_set_schedule( Kind, Chunk );
+#  endif
+
+   if ( Measure )    Timer_AutoTune.Start();
+
+   return Measure;
+
+} // FUNCTION : AutoTune_Start
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AutoTune_Stop
+// Description :  Record the wall time of the candidate tested by AutoTune_Start() and restore the OpenMP
+//                chunk size
+//
+// Note        :  1. Invoked by InvokeSolver() after the closing step
+//                2. The selected batch size and chunk size are recorded in the file "Record__Note" by rank 0
+//
+// Parameter   :  TSolver        : Target solver
+//                lv             : Target refinement level
+//                NTotal         : Total number of patch groups updated
+//                Measure        : Whether this invocation has been timed (i.e., the value returned by AutoTune_Start())
+//                Chunk_Old      : OpenMP chunk size to be restored
+//                Timer_AutoTune : Timer started by AutoTune_Start()
+//-------------------------------------------------------------------------------------------------------
+void AutoTune_Stop( const Solver_t TSolver, const int lv, const int NTotal, const bool Measure, const int Chunk_Old,
+                    Timer_t &Timer_AutoTune )
+{
+
+#  ifdef OPENMP
+   omp_sched_t Kind;
+   int         Chunk;
+   omp_get_schedule( &Kind, &Chunk );
+   omp_set_schedule( Kind, Chunk_Old );
+#  endif
+
+   if ( !Measure )   return;
+
+   Timer_AutoTune.Stop();
+
+
+   AutoTune_t  &AT   = AutoTune[lv][TSolver];
+   const double Time = Timer_AutoTune.GetValue() / NTotal;
+
+
+// 1. warm-up
+   if ( AT.Stage == 0 )
+   {
+      AT.Stage    = 1;
+      AT.Trial    = 0;
+      AT.BestTime = HUGE_NUMBER;
+      return;
+   }
+
+
+// 2. record the candidate if it is faster
+   if ( Time < AT.BestTime )
+   {
+      AT.BestTime = Time;
+
+      if ( AT.Stage == 1 )    AT.NPG   = AT.NPG_Try;
+      else                    AT.Chunk = AT.Chunk_Try;
+   }
+
+
+// 3. move on to the next candidate or stage
+   AT.Trial ++;
+
+   if ( AT.Stage == 1  &&  ( AT.NPG_Max >> AT.Trial ) < MAX( OMP_NTHREAD, 1 ) )
+   {
+#     ifdef OPENMP
+      AT.Stage    = 2;
+      AT.Trial    = 0;
+      AT.BestTime = HUGE_NUMBER;
+#     else
+      AT.Stage    = 3;
+#     endif
+   }
+
+   else if ( AT.Stage == 2  &&  ( 1 << AT.Trial )*OMP_NTHREAD > AT.NPG )
+      AT.Stage = 3;
+
+
+// 4. record the selection
+   if ( AT.Stage == 3  &&  MPI_Rank == 0  &&  OPT__RECORD_NOTE )
+   {
+      const char *SolverName = ( TSolver == FLUID_SOLVER               ) ? "FLUID"               :
+#                              ifdef GRAVITY
+                               ( TSolver == POISSON_SOLVER             ) ? "POISSON"             :
+                               ( TSolver == GRAVITY_SOLVER             ) ? "GRAVITY"             :
+                               ( TSolver == POISSON_AND_GRAVITY_SOLVER ) ? "POISSON_AND_GRAVITY" :
+                               ( TSolver == DT_GRA_SOLVER              ) ? "DT_GRA"              :
+#                              endif
+#                              ifdef SUPPORT_GRACKLE
+                               ( TSolver == GRACKLE_SOLVER             ) ? "GRACKLE"             :
+#                              endif
+                               ( TSolver == DT_FLU_SOLVER              ) ? "DT_FLU"              :
+                               ( TSolver == SRC_SOLVER                 ) ? "SRC"                 : "UNKNOWN";
+
+      FILE *Note = fopen( "Record__Note", "a" );
+#     ifdef OPENMP
+      fprintf( Note, "OPT__AUTO_NPGROUP : level %2d, solver %-19s --> NPGROUP %6d, OpenMP chunk %3d (%13.7e s per patch group)\n",
+               lv, SolverName, AT.NPG, AT.Chunk, AT.BestTime );
+#     else
+      fprintf( Note, "OPT__AUTO_NPGROUP : level %2d, solver %-19s --> NPGROUP %6d (%13.7e s per patch group)\n",
+               lv, SolverName, AT.NPG, AT.BestTime );
+#     endif
+      fclose( Note );
+   }
+
+} // FUNCTION : AutoTune_Stop
+#endif // #ifndef GPU
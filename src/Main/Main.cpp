@@ -53,24 +53,28 @@ int                  GPU_NSTREAM, FLAG_BUFFER_SIZE, FLAG_BUFFER_SIZE_MAXM1_LV, F
 
 IntScheme_t          OPT__FLU_INT_SCHEME, OPT__REF_FLU_INT_SCHEME;
 double               OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT_FACTOR, AUTO_REDUCE_DT_FACTOR_MIN;
-double               AUTO_REDUCE_INT_MONO_FACTOR, AUTO_REDUCE_INT_MONO_MIN;
+double               AUTO_REDUCE_INT_MONO_FACTOR, AUTO_REDUCE_INT_MONO_MIN, PREP_CACHE_MAX_MB;
 double               OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 int                  OPT__UM_IC_LEVEL, OPT__UM_IC_NLEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
 int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
 int                  OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
-bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET, OPT__RESTART_PARALLEL,
+                     OPT__PATCH_SLAB;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
-bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
+bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__CPU_PIPELINE,
+                     OPT__TIMING_BALANCE, OPT__PREP_CACHE, OPT__AUTO_NPGROUP;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
 bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
 bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID, OPT__RECORD_CENTER, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
-bool                 OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX;
+bool                 OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX, OPT__OUTPUT_HDF5_MPIIO,
+                     OPT__OUTPUT_HDF5_ASYNC;
 char                 OPT__OUTPUT_TEXT_FORMAT_FLT[MAX_STRING];
-int                  OPT__UM_IC_FLOAT8;
+int                  OPT__UM_IC_FLOAT8, OUTPUT_HDF5_DEFLATE_LEVEL, OUTPUT_HDF5_LOSSY_DIGITS;
+double               OUTPUT_HDF5_ASYNC_MAX_MEM;
 double               COM_CEN_X, COM_CEN_Y, COM_CEN_Z, COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R;
 int                  COM_MAX_ITER;
 double               ANGMOM_ORIGIN_X, ANGMOM_ORIGIN_Y, ANGMOM_ORIGIN_Z;
@@ -79,6 +83,7 @@ UM_IC_Format_t       OPT__UM_IC_FORMAT;
 TestProbID_t         TESTPROB_ID;
 OptInit_t            OPT__INIT;
 OptOutputFormat_t    OPT__OUTPUT_TOTAL;
+OptHDF5Compress_t    OPT__OUTPUT_HDF5_COMPRESS;
 OptOutputPart_t      OPT__OUTPUT_PART;
 OptOutputMode_t      OPT__OUTPUT_MODE;
 OptFluBC_t           OPT__BC_FLU[6];
@@ -153,8 +158,13 @@ int                  POT_GPU_NPGROUP;
 bool                 OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, OPT__GRAVITY_EXTRA_MASS;
 double               SOR_OMEGA;
 int                  SOR_MAX_ITER, SOR_MIN_ITER;
+double               SOR_TOLERATED_ERROR;
 double               MG_TOLERATED_ERROR;
 int                  MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
+bool                 OPT__POT_LEVEL_MG;
+double               POT_LEVEL_MG_TOLERATED_ERROR;
+int                  POT_LEVEL_MG_MAX_ITER;
+bool                 OPT__POT_WARM_START;
 char                 EXT_POT_TABLE_NAME[MAX_STRING];
 double               EXT_POT_TABLE_DH[3], EXT_POT_TABLE_EDGEL[3];
 int                  EXT_POT_TABLE_NPOINT[3], EXT_POT_TABLE_FLOAT8;
@@ -189,11 +199,14 @@ double               LB_INPUT__WLI_MAX;
 #ifdef PARTICLE
 double               LB_INPUT__PAR_WEIGHT;
 #endif
-bool                 OPT__RECORD_LOAD_BALANCE;
+bool                 OPT__RECORD_LOAD_BALANCE, OPT__MPI_SPARSE, OPT__MPI_PERSISTENT, OPT__LB_MEASURED_COST,
+                     OPT__LB_INCREMENTAL, OPT__LB_MULTI_CONSTRAINT;
+double               LB_MEASURED_COST_SMOOTH, LB_MC_TOL_CELL, LB_MC_TOL_PAR, LB_MC_TOL_TIME, LB_MC_TOL_MEM;
 #endif
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
 int                  OPT__FFTW_STARTUP;
+bool                 OPT__FFTW_PENCIL, OPT__FFTW_WISDOM;
 #if ( SUPPORT_FFTW == FFTW3 )
 bool                 FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #endif // # if ( SUPPORT_FFTW == FFTW3 )
@@ -347,16 +360,6 @@ real (*h_Mag_Array_F_In [2])[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ] = { NULL, NUL
 real (*h_Mag_Array_F_Out[2])[NCOMP_MAG][ PS2P1*SQR(PS2)          ] = { NULL, NULL };
 real (*h_Ele_Array      [2])[9][NCOMP_ELE][ PS2P1*PS2 ]            = { NULL, NULL };
 #endif
-#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-real (*h_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ]  = NULL;
-real (*h_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ]  = NULL;
-real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ]  = NULL;
-real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ]  = NULL;
-#ifdef MHD
-real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]        = NULL;
-real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ]        = NULL;
-#endif
-#endif // FLU_SCHEME
 
 #ifdef GRAVITY
 // (3-2) Poisson and gravity solver
@@ -704,19 +707,28 @@ int main( int argc, char *argv[] )
       Timer_Main[5]->Start();    // timer for load balance
 #     endif
 
-      if ( LB_EstimateLoadImbalance() > amr->LB->WLI_Max )
+      if ( LB_EstimateLoadImbalance( true ) > amr->LB->WLI_Max )
       {
+         const bool Incremental = OPT__LB_INCREMENTAL;
+
          if ( MPI_Rank == 0 )
          {
-            Aux_Message( stdout, "Weighted load-imbalance factor (%13.7e) > threshold (%13.7e) ",
-                         amr->LB->WLI, amr->LB->WLI_Max );
-            Aux_Message( stdout, "--> redistributing all patches ...\n" );
+            if ( amr->LB->WLI > amr->LB->WLI_Max )
+               Aux_Message( stdout, "Weighted load-imbalance factor (%13.7e) > threshold (%13.7e) ",
+                            amr->LB->WLI, amr->LB->WLI_Max );
+            else
+               Aux_Message( stdout, "Load imbalance of multiple constraints > tolerance (see Record__LoadBalance) " );
+
+            Aux_Message( stdout, "--> %s ...\n", ( Incremental ) ? "shifting cut points incrementally"
+                                                                 : "redistributing all patches" );
          }
 
          const bool   Redistribute_Yes = true;
          const bool   SendGridData_Yes = true;
          const bool   ResetLB_Yes      = true;
          const bool   SortRealPatch_No = false;
+         const bool   KeepCutPoint_No  = false;
+         const bool   KeepCutPoint_Yes = true;
 #        ifdef PARTICLE
          const double ParWeight        = amr->LB->Par_Weight;
 #        else
@@ -724,14 +736,41 @@ int main( int argc, char *argv[] )
 #        endif
          const int    AllLv            = -1;
 
-         LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, ParWeight, ResetLB_Yes, SortRealPatch_No, AllLv );
+//       incremental load balancing: shift the existing cut points so that patches migrate between adjacent ranks only
+//       --> only levels with shifted cut points are updated, and only the patch groups changing owner are migrated
+//       --> levels are updated one by one so that the cut points of each level always match the actual patch
+//           distribution when updating its neighboring levels
+         bool Redistributed = true;
 
-         if ( OPT__PATCH_COUNT > 0 )         Aux_Record_PatchCount();
+         if ( Incremental )
+         {
+            Redistributed = false;
 
-#        ifdef PARTICLE
-         if ( OPT__PARTICLE_COUNT > 0 )      Par_Aux_Record_ParticleCount();
-#        endif
-      } // if ( LB_EstimateLoadImbalance() > amr->LB->WLI_Max )
+            for (int lv=0; lv<NLEVEL; lv++)
+            {
+               if ( LB_SetCutPoint_Incremental( lv, amr->LB->CutPoint[lv], ParWeight ) == 0 )   continue;
+
+               LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, ParWeight, ResetLB_Yes, SortRealPatch_No, KeepCutPoint_Yes, lv );
+
+               Redistributed = true;
+            }
+
+            if ( !Redistributed  &&  MPI_Rank == 0 )
+               Aux_Message( stdout, "   No cut point is shifted --> skip redistribution\n" );
+         }
+
+         else
+            LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, ParWeight, ResetLB_Yes, SortRealPatch_No, KeepCutPoint_No, AllLv );
+
+         if ( Redistributed )
+         {
+            if ( OPT__PATCH_COUNT > 0 )      Aux_Record_PatchCount();
+
+#           ifdef PARTICLE
+            if ( OPT__PARTICLE_COUNT > 0 )   Par_Aux_Record_ParticleCount();
+#           endif
+         }
+      } // if ( LB_EstimateLoadImbalance( true ) > amr->LB->WLI_Max )
 
 #     ifdef TIMING
       Timer_Main[5]->Stop();
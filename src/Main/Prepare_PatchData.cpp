@@ -13,6 +13,9 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 static void SetTargetSibling( int NTSib[], int *TSib[] );
 static int Table_01( const int SibID, const char dim, const int Count, const int GhostSize );
 static int Table_02( const int lv, const int PID, const int Side );
+static void CopyPatchGroup2Patch( const real *Data1PG_CC, const real *Data1PG_FC, real *OutputCC, real *OutputFC,
+                                  const int TID, const int GhostSize, const int NVarCC_Tot, const int NVarFC_Tot,
+                                  const int TVarFCIdxList[] );
 void SetTempIntPara( const int lv, const int Sg0, const double PrepTime, const double Time0, const double Time1,
                      bool &IntTime, int &Sg, int &Sg_IntT, real &Weighting, real &Weighting_IntT );
 #ifdef MHD
@@ -87,6 +90,12 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 //                           field on the coarse-fine interfaces of the central patch group
 //                       --> It's OK for the MHD solver since it will still guarantee that the updated B field within the patch group
 //                           is divergence free
+//               10. The prepared patch group data can be cached and reused by the subsequent invocations with the same
+//                   input parameters (except PrepUnit) when enabling OPT__PREP_CACHE
+//                   --> Data cached with more ghost zones may also be reused (see Prepare_PatchData_Cache_SetKey())
+//                   --> See Prepare_PatchData_Cache.cpp
+//                   --> Prepare_PatchData_Cache_Invalidate() must be invoked whenever the data stored in patches are
+//                       modified since the cache key does not track the patch data themselves
 //
 // Parameter   :  lv             : Target refinement level
 //                PrepTime       : Target physical time to prepare data
@@ -539,6 +548,14 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #  endif
 
 
+// key of the patch-data cache (OPT__PREP_CACHE)
+// --> UseCache == false if the cache is disabled or inapplicable
+   PrepCacheKey_t CacheKey;
+   const bool     UseCache = Prepare_PatchData_Cache_SetKey( CacheKey, lv, PrepTime, GhostSize, TVarCC, TVarFC,
+                                                             IntScheme_CC, IntScheme_FC, NSide, IntPhase, FluBC, PotBC,
+                                                             MinDens, MinPres, MinTemp, MinEntr, DE_Consistency );
+
+
 // start to prepare data
 #  pragma omp parallel
    {
@@ -556,20 +573,24 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
       real FluidForEoS[NFluForEoS];
 #     endif
 
+//    all the temporary arrays below are allocated from the scratch arena of each thread
+//    --> they are released automatically at the end of the OpenMP parallel region
+      ScratchScope_t Scratch;
+
 //    Data1PG_CC/FC: array to store the prepared cell-centered/face-centered data of one patch group
 //                   (including the ghost-zone data)
 //    --> for PrepUnit == UNIT_PATCHGROUP, these pointers point to OutputCC/FC directly (which will be set later)
 //        for PrepUnit == UNIT_PATCH, these arrays will be copied to different patches in OutputCC/FC later
-      real *Data1PG_CC     = ( PrepUnit == UNIT_PATCH ) ? new real [ NVarCC_Tot*PGSize3D_CC ] : NULL;
+      real *Data1PG_CC     = ( PrepUnit == UNIT_PATCH ) ? Scratch.Allocate<real>( NVarCC_Tot*PGSize3D_CC ) : NULL;
       real *Data1PG_CC_Ptr = NULL;
-      real *Data1PG_FC     = ( PrepUnit == UNIT_PATCH ) ? new real [ NVarFC_Tot*PGSize3D_FC ] : NULL;
+      real *Data1PG_FC     = ( PrepUnit == UNIT_PATCH ) ? Scratch.Allocate<real>( NVarFC_Tot*PGSize3D_FC ) : NULL;
       real *Data1PG_FC_Ptr = NULL;
 
 
 //    IntData_CC/FC: arrays to store the interpolated cell-/face-centered results
 //    --> allocate it only once but with the maximum required size to reduce the number of memory allocations
-      real *IntData_CC = new real [ NVarCC_Tot*PS2*PS2*(GhostSize_Padded  ) ];
-      real *IntData_FC = new real [ NVarFC_Tot*PS2*PS2*(GhostSize_Padded+1) ];
+      real *IntData_CC = Scratch.Allocate<real>( NVarCC_Tot*PS2*PS2*(GhostSize_Padded  ) );
+      real *IntData_FC = Scratch.Allocate<real>( NVarFC_Tot*PS2*PS2*(GhostSize_Padded+1) );
 
 
 //    B field on the coarse-fine interfaces for the divergence-preserving interpolation
@@ -577,7 +598,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #     ifdef MHD
       real *FInterface_Data = NULL;
 
-      if ( NVarFC_Tot > 0 )   FInterface_Data = new real [ SQR(PS2) + 4*PS2*GhostSize_Padded ];
+      if ( NVarFC_Tot > 0 )   FInterface_Data = Scratch.Allocate<real>( SQR(PS2) + 4*PS2*GhostSize_Padded );
 #     endif
 
 //    IntData_CC_IntTime: for temporal interpolation on density and phase in ELBDM
@@ -585,7 +606,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
       real *IntData_CC_IntTime = (  IntPhase  &&  OPT__INT_TIME  &&  lv > 0  &&
                                    !Mis_CompareRealValue( PrepTime, amr->FluSgTime[lv-1][  amr->FluSg[lv-1]], NULL, false )  &&
                                    !Mis_CompareRealValue( PrepTime, amr->FluSgTime[lv-1][1-amr->FluSg[lv-1]], NULL, false )  )
-                                 ? new real [ 2*PS2*PS2*GhostSize_Padded ] : NULL;
+                                 ? Scratch.Allocate<real>( 2*PS2*PS2*GhostSize_Padded ) : NULL;
 #     else
       real *IntData_CC_IntTime = NULL;
 #     endif
@@ -615,6 +636,18 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
          }
 
 
+//       load the patch group data from the patch-data cache and skip steps a-e if they are available
+         if (  UseCache  &&  Prepare_PatchData_Cache_Load( CacheKey, PID0, GhostSize, NVarCC_Tot, NVarFC_Tot,
+                                                           Data1PG_CC, Data1PG_FC )  )
+         {
+            if ( PrepUnit == UNIT_PATCH )
+               CopyPatchGroup2Patch( Data1PG_CC, Data1PG_FC, OutputCC, OutputFC, TID, GhostSize,
+                                     NVarCC_Tot, NVarFC_Tot, TVarFCIdxList );
+
+            continue;
+         }
+
+
 //       a. fill out the central region of Data1PG_CC[]/FC[] (ghost zones will be filled out later)
 // ------------------------------------------------------------------------------------------------------------
          for (int LocalID=0; LocalID<8; LocalID++ )
@@ -2013,124 +2046,154 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #        endif
 
 
-//       e. copy data from Data1PG_CC[] to OutputCC[]
+//       e. store the prepared patch group data in the patch-data cache
 // ------------------------------------------------------------------------------------------------------------
-         if ( PrepUnit == UNIT_PATCH ) // separate the prepared patch group data into individual patches
-         {
-            const int PSize1D_CC = PS1 + 2*GhostSize;    // width of a single patch including ghost zones
-            const int PSize3D_CC = CUBE(PSize1D_CC);
-            const int PSize1D_FC = PSize1D_CC + 1;
-            const int PSize3D_FC = PSize1D_FC*SQR(PSize1D_CC);
+         if ( UseCache )
+            Prepare_PatchData_Cache_Store( CacheKey, PID0, GhostSize, NVarCC_Tot, NVarFC_Tot, Data1PG_CC, Data1PG_FC );
 
-            real *OutputCC_Ptr = NULL;
-            real *OutputFC_Ptr = NULL;
 
+//       f. copy data from Data1PG_CC[] to OutputCC[]
+// ------------------------------------------------------------------------------------------------------------
+//       separate the prepared patch group data into individual patches
+         if ( PrepUnit == UNIT_PATCH )
+            CopyPatchGroup2Patch( Data1PG_CC, Data1PG_FC, OutputCC, OutputFC, TID, GhostSize,
+                                  NVarCC_Tot, NVarFC_Tot, TVarFCIdxList );
 
-            for (int LocalID=0; LocalID<8; LocalID++)
-            {
-               const int N      = 8*TID + LocalID;
-               const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
-               const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
-               const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
+      } // for (int TID=0; TID<NPG; TID++)
 
-//             cell-centered variables
-               Data1PG_CC_Ptr = Data1PG_CC;
-               OutputCC_Ptr   = OutputCC + N*NVarCC_Tot*PSize3D_CC;
-               Idx2           = 0;
+   } // end of OpenMP parallel region
 
-               for (int v=0; v<NVarCC_Tot; v++)
-               {
-                  for (int k=Disp_k; k<Disp_k+PSize1D_CC; k++)
-                  for (int j=Disp_j; j<Disp_j+PSize1D_CC; j++)
-                  {
-                     Idx1 = IDX321( Disp_i, j, k, PGSize1D_CC, PGSize1D_CC );
 
-                     for (int i=0; i<PSize1D_CC; i++)    OutputCC_Ptr[ Idx2 ++ ] = Data1PG_CC_Ptr[ Idx1 ++ ];
-                  }
+// free memroy
+   for (int s=0; s<26; s++)   delete [] TSib[s];
 
-                  Data1PG_CC_Ptr += PGSize3D_CC;
-               }
+} // FUNCTION : Prepare_PatchData
 
 
-//             face-centered variables
-               Data1PG_FC_Ptr = Data1PG_FC;
-               OutputFC_Ptr   = OutputFC + N*NVarFC_Tot*PSize3D_FC;
-               Idx2           = 0;
 
-               for (int v=0; v<NVarFC_Tot; v++)
-               {
-                  TVarFCIdx = TVarFCIdxList[v];
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CopyPatchGroup2Patch
+// Description :  Separate the prepared patch group data into individual patches for PrepUnit == UNIT_PATCH
+//
+// Note        :  1. Invoked by Prepare_PatchData()
+//                2. Data1PG_CC/FC can be either the data just prepared or the data loaded from the patch-data cache
+//
+// Parameter   :  Data1PG_CC    : Prepared cell-centered data of one patch group (including the ghost-zone data)
+//                Data1PG_FC    : Prepared face-centered data of one patch group (including the ghost-zone data)
+//                OutputCC      : Output array to store the cell-centered data of individual patches
+//                OutputFC      : Output array to store the face-centered data of individual patches
+//                TID           : Index of the target patch group in the output arrays
+//                GhostSize     : Number of ghost zones
+//                NVarCC_Tot    : Number of cell-centered variables
+//                NVarFC_Tot    : Number of face-centered variables
+//                TVarFCIdxList : List recording the target face-centered variable indices
+//
+// Return      :  OutputCC, OutputFC
+//-------------------------------------------------------------------------------------------------------
+void CopyPatchGroup2Patch( const real *Data1PG_CC, const real *Data1PG_FC, real *OutputCC, real *OutputFC,
+                           const int TID, const int GhostSize, const int NVarCC_Tot, const int NVarFC_Tot,
+                           const int TVarFCIdxList[] )
+{
 
-#                 ifdef MHD
+   const int PGSize1D_CC = 2*( PS1 + GhostSize );   // width of a single patch group including ghost zones
+   const int PGSize3D_CC = CUBE( PGSize1D_CC );
+   const int PGSize1D_FC = PGSize1D_CC + 1;
+   const int PGSize3D_FC = PGSize1D_FC*SQR(PGSize1D_CC);
+   const int PSize1D_CC  = PS1 + 2*GhostSize;       // width of a single patch including ghost zones
+   const int PSize3D_CC  = CUBE(PSize1D_CC);
+   const int PSize1D_FC  = PSize1D_CC + 1;
+   const int PSize3D_FC  = PSize1D_FC*SQR(PSize1D_CC);
+
+   int Idx1, Idx2, TVarFCIdx;
+   const real *Data1PG_CC_Ptr = NULL;
+   const real *Data1PG_FC_Ptr = NULL;
+   real       *OutputCC_Ptr   = NULL;
+   real       *OutputFC_Ptr   = NULL;
 
-//                set array indices
-                  int size_p[3], size_pg[3];    // p=patch, pg=patch_group
 
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int N      = 8*TID + LocalID;
+      const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
+      const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
+      const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
 
-                  const int norm_dir = ( TVarFCIdx == MAGX ) ? 0 :
-                                       ( TVarFCIdx == MAGY ) ? 1 :
-                                       ( TVarFCIdx == MAGZ ) ? 2 : -1;
-#                 ifdef GAMER_DEBUG
-                  if ( norm_dir == -1 )   Aux_Error( ERROR_INFO, "Target face-centered variable != MAGX/Y/Z !!\n" );
-#                 endif
+//    cell-centered variables
+      Data1PG_CC_Ptr = Data1PG_CC;
+      OutputCC_Ptr   = OutputCC + N*NVarCC_Tot*PSize3D_CC;
+      Idx2           = 0;
 
-                  for (int d=0; d<3; d++)
-                  {
-                     if ( d == norm_dir )
-                     {
-                        size_p [d] = PSize1D_FC;
-                        size_pg[d] = PGSize1D_FC;
-                     }
+      for (int v=0; v<NVarCC_Tot; v++)
+      {
+         for (int k=Disp_k; k<Disp_k+PSize1D_CC; k++)
+         for (int j=Disp_j; j<Disp_j+PSize1D_CC; j++)
+         {
+            Idx1 = IDX321( Disp_i, j, k, PGSize1D_CC, PGSize1D_CC );
 
-                     else
-                     {
-                        size_p [d] = PSize1D_CC;
-                        size_pg[d] = PGSize1D_CC;
-                     }
-                  }
+            for (int i=0; i<PSize1D_CC; i++)    OutputCC_Ptr[ Idx2 ++ ] = Data1PG_CC_Ptr[ Idx1 ++ ];
+         }
 
+         Data1PG_CC_Ptr += PGSize3D_CC;
+      }
 
-//                copy data
-                  for (int k=Disp_k; k<Disp_k+size_p[2]; k++)
-                  for (int j=Disp_j; j<Disp_j+size_p[1]; j++)
-                  {
-                     Idx1 = IDX321( Disp_i, j, k, size_pg[0], size_pg[1] );
 
-                     for (int i=0; i<size_p[0]; i++)  OutputFC_Ptr[ Idx2 ++ ] = Data1PG_FC_Ptr[ Idx1 ++ ];
-                  }
+//    face-centered variables
+      Data1PG_FC_Ptr = Data1PG_FC;
+      OutputFC_Ptr   = OutputFC + N*NVarFC_Tot*PSize3D_FC;
+      Idx2           = 0;
 
-#                 else
-                  Aux_Error( ERROR_INFO, "currently only MHD supports face-centered variables !!" );
-#                 endif // #ifdef MHD ... else ...
+      for (int v=0; v<NVarFC_Tot; v++)
+      {
+         TVarFCIdx = TVarFCIdxList[v];
 
-                  Data1PG_FC_Ptr += PGSize3D_FC;
-               } // for (int v=0; v<NVarFC_Tot; v++)
+#        ifdef MHD
 
-            } // for (int LocalID=0; LocalID<8; LocalID++)
-         } // if ( PrepUnit == UNIT_PATCH )
+//       set array indices
+         int size_p[3], size_pg[3];    // p=patch, pg=patch_group
 
-      } // for (int TID=0; TID<NPG; TID++)
 
-      if ( PrepUnit == UNIT_PATCH )
-      {
-         delete [] Data1PG_CC;
-         delete [] Data1PG_FC;
-      }
-      delete [] IntData_CC;
-      delete [] IntData_FC;
-      delete [] IntData_CC_IntTime;
+         const int norm_dir = ( TVarFCIdx == MAGX ) ? 0 :
+                              ( TVarFCIdx == MAGY ) ? 1 :
+                              ( TVarFCIdx == MAGZ ) ? 2 : -1;
+#        ifdef GAMER_DEBUG
+         if ( norm_dir == -1 )   Aux_Error( ERROR_INFO, "Target face-centered variable != MAGX/Y/Z !!\n" );
+#        endif
 
-#     ifdef MHD
-      delete [] FInterface_Data;
-#     endif
+         for (int d=0; d<3; d++)
+         {
+            if ( d == norm_dir )
+            {
+               size_p [d] = PSize1D_FC;
+               size_pg[d] = PGSize1D_FC;
+            }
 
-   } // end of OpenMP parallel region
+            else
+            {
+               size_p [d] = PSize1D_CC;
+               size_pg[d] = PGSize1D_CC;
+            }
+         }
 
 
-// free memroy
-   for (int s=0; s<26; s++)   delete [] TSib[s];
+//       copy data
+         for (int k=Disp_k; k<Disp_k+size_p[2]; k++)
+         for (int j=Disp_j; j<Disp_j+size_p[1]; j++)
+         {
+            Idx1 = IDX321( Disp_i, j, k, size_pg[0], size_pg[1] );
 
-} // FUNCTION : Prepare_PatchData
+            for (int i=0; i<size_p[0]; i++)  OutputFC_Ptr[ Idx2 ++ ] = Data1PG_FC_Ptr[ Idx1 ++ ];
+         }
+
+#        else
+         Aux_Error( ERROR_INFO, "currently only MHD supports face-centered variables !!" );
+#        endif // #ifdef MHD ... else ...
+
+         Data1PG_FC_Ptr += PGSize3D_FC;
+      } // for (int v=0; v<NVarFC_Tot; v++)
+
+   } // for (int LocalID=0; LocalID<8; LocalID++)
+
+} // FUNCTION : CopyPatchGroup2Patch
 
 
 
@@ -0,0 +1,514 @@
+#include "GAMER.h"
+
+
+// number of hash buckets at each level
+#define PREP_CACHE_NBUCKET    4096
+
+// fields the prepared data depend on (see PrepCacheKey_t::Depend)
+#define PREP_CACHE_DEP_FLU    ( 1 << 0 )
+#define PREP_CACHE_DEP_MAG    ( 1 << 1 )
+#define PREP_CACHE_DEP_POT    ( 1 << 2 )
+
+
+// cached data of one patch group
+struct PrepCacheEntry_t
+{
+   PrepCacheKey_t    Key;
+   int               PID0;
+   int               GhostSize;
+   long              NCC;
+   long              NFC;
+   real             *Data;     // [NCC] cell-centered data followed by [NFC] face-centered data
+   PrepCacheEntry_t *Next;
+};
+
+static PrepCacheEntry_t **PrepCache_Bucket[NLEVEL];   // hash buckets at each level (allocated on demand)
+static long               PrepCache_NByte = 0L;       // total size of the cached data in bytes
+
+static int  GetDependency( const long TVarCC, const long TVarFC );
+static long GetBucketIdx( const PrepCacheKey_t &Key, const int PID0 );
+static PrepCacheEntry_t *FindEntry( const PrepCacheKey_t &Key, const int PID0, const int GhostSize );
+static void CopySubRegion( const real *In, const int GhostSize_In, real *Out, const int GhostSize_Out,
+                           const int NVar );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_Cache_SetKey
+// Description :  Set the key of the patch-data cache for Prepare_PatchData()
+//
+// Note        :  1. Invoked by Prepare_PatchData()
+//                2. The patch-data cache stores the patch-group data prepared by Prepare_PatchData(),
+//                   including the interpolated ghost zones, so that the subsequent invocations with the same key
+//                   can copy the data directly
+//                   --> Enabled by OPT__PREP_CACHE and bounded by PREP_CACHE_MAX_MB
+//                   --> The key includes everything affecting the patch-group data (see PrepCacheKey_t)
+//                       but not PrepUnit, so that the individual patches of UNIT_PATCH can be extracted from the
+//                       patch-group data cached by UNIT_PATCHGROUP and vice versa
+//                   --> The key does not include GhostSize either, which is stored along with the cached data
+//                3. Data cached with more ghost zones are served to requests with fewer ghost zones by copying the
+//                   inner region only if the prepared data of each cell do not depend on the size of the prepared
+//                   region (Key.SubRegion)
+//                   --> Not the case when preparing all and only the conserved variables in HYDRO since
+//                       INT_REDUCE_MONO_COEFF then reduces the monotonic coefficient of an entire ghost-zone region
+//                       once any cell in it fails (see InterpolateGhostZone())
+//                   --> Face-centered variables and phase interpolation are excluded as well for simplicity
+//                   --> Otherwise, GhostSize must match exactly
+//                4. Not applied to
+//                   --> GhostSize == 0: copying the patch data directly is as fast as loading the cache
+//                   --> _PAR_DENS and _TOTAL_DENS: the particle density arrays are rebuilt before each invocation
+//
+// Parameter   :  Key   : Key to be set
+//                Other : See Prepare_PatchData()
+//
+// Return      :  Key, true/false --> cache is applicable/inapplicable
+//-------------------------------------------------------------------------------------------------------
+bool Prepare_PatchData_Cache_SetKey( PrepCacheKey_t &Key, const int lv, const double PrepTime, const int GhostSize,
+                                     const long TVarCC, const long TVarFC, const IntScheme_t IntScheme_CC,
+                                     const IntScheme_t IntScheme_FC, const NSide_t NSide, const bool IntPhase,
+                                     const OptFluBC_t FluBC[], const OptPotBC_t PotBC, const real MinDens,
+                                     const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency )
+{
+
+   if ( !OPT__PREP_CACHE  ||  PREP_CACHE_MAX_MB <= 0.0  ||  GhostSize == 0 )   return false;
+
+#  ifdef PARTICLE
+   if ( TVarCC & _PAR_DENS  ||  TVarCC & _TOTAL_DENS )   return false;
+#  endif
+
+
+// zero the padding bytes as well since keys are compared by memcmp()
+   memset( &Key, 0, sizeof(PrepCacheKey_t) );
+
+   Key.lv             = lv;
+   Key.TVarCC         = TVarCC;
+   Key.TVarFC         = TVarFC;
+   Key.IntScheme_CC   = IntScheme_CC;
+   Key.IntScheme_FC   = IntScheme_FC;
+   Key.NSide          = NSide;
+   Key.IntPhase       = IntPhase;
+   for (int f=0; f<6; f++)
+   Key.FluBC[f]       = FluBC[f];
+   Key.PotBC          = PotBC;
+   Key.DE_Consistency = DE_Consistency;
+   Key.IntTime        = OPT__INT_TIME;
+   Key.MinDens        = MinDens;
+   Key.MinPres        = MinPres;
+   Key.MinTemp        = MinTemp;
+   Key.MinEntr        = MinEntr;
+   Key.IntMonoCoeff   = INT_MONO_COEFF;
+#  ifdef MHD
+   Key.IntMonoCoeff_B = INT_MONO_COEFF_B;
+#  endif
+   Key.PrepTime       = PrepTime;
+   Key.Depend         = GetDependency( TVarCC, TVarFC );
+   Key.SubRegion      = ( TVarCC != _TOTAL  &&  TVarFC == _NONE  &&  !IntPhase );
+
+// sandglasses at levels lv-1 (for the coarse-grid ghost zones) and lv
+   for (int t=0; t<2; t++)
+   {
+      const int TLv = lv - 1 + t;
+
+      if ( TLv < 0 )    continue;
+
+      Key.Sg    [t][0]    = amr->FluSg    [TLv];
+      Key.SgTime[t][0][0] = amr->FluSgTime[TLv][0];
+      Key.SgTime[t][0][1] = amr->FluSgTime[TLv][1];
+#     ifdef MHD
+      Key.Sg    [t][1]    = amr->MagSg    [TLv];
+      Key.SgTime[t][1][0] = amr->MagSgTime[TLv][0];
+      Key.SgTime[t][1][1] = amr->MagSgTime[TLv][1];
+#     endif
+#     ifdef GRAVITY
+      Key.Sg    [t][2]    = amr->PotSg    [TLv];
+      Key.SgTime[t][2][0] = amr->PotSgTime[TLv][0];
+      Key.SgTime[t][2][1] = amr->PotSgTime[TLv][1];
+#     endif
+   }
+
+// FNV-1a hash of all data members except Hash itself
+   const unsigned char *Byte = (const unsigned char*)&Key;
+   unsigned long Hash = 14695981039346656037UL;
+
+   for (size_t t=0; t<offsetof(PrepCacheKey_t, Hash); t++)
+   {
+      Hash ^= (unsigned long)Byte[t];
+      Hash *= 1099511628211UL;
+   }
+
+   Key.Hash = Hash;
+
+   return true;
+
+} // FUNCTION : Prepare_PatchData_Cache_SetKey
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_Cache_Load
+// Description :  Look up the cached data of the target patch group and copy them to the output arrays
+//
+// Note        :  1. Thread-safe and can be invoked within an OpenMP parallel region
+//                2. Data cached with more ghost zones are also returned if Key.SubRegion is on
+//                   --> Only the inner region with GhostSize ghost zones is copied
+//                3. The cached data remain valid until the next call to Prepare_PatchData_Cache_Invalidate()
+//                   or Prepare_PatchData_Cache_Reset(), which must not be invoked concurrently
+//                   --> Can copy them outside the critical section
+//
+// Parameter   :  Key       : Key set by Prepare_PatchData_Cache_SetKey()
+//                PID0      : Patch index with LocalID==0 of the target patch group
+//                GhostSize : Number of ghost zones to be returned
+//                NVarCC    : Number of cell-centered variables
+//                NVarFC    : Number of face-centered variables
+//                DataCC    : Array to store the cell-centered data of one patch group
+//                DataFC    : Array to store the face-centered data of one patch group
+//
+// Return      :  DataCC, DataFC, true/false --> found/not found
+//-------------------------------------------------------------------------------------------------------
+bool Prepare_PatchData_Cache_Load( const PrepCacheKey_t &Key, const int PID0, const int GhostSize,
+                                   const int NVarCC, const int NVarFC, real *DataCC, real *DataFC )
+{
+
+   PrepCacheEntry_t *Entry = NULL;
+
+#  pragma omp critical( PREP_CACHE )
+   Entry = FindEntry( Key, PID0, GhostSize );
+
+   if ( Entry == NULL )    return false;
+
+   const long PGSize1D_CC = 2*( PS1 + Entry->GhostSize );
+   const long PGSize3D_CC = CUBE( PGSize1D_CC );
+   const long PGSize3D_FC = ( PGSize1D_CC + 1 )*SQR( PGSize1D_CC );
+
+#  ifdef GAMER_DEBUG
+   if ( Entry->NCC != NVarCC*PGSize3D_CC  ||  Entry->NFC != NVarFC*PGSize3D_FC )
+      Aux_Error( ERROR_INFO, "inconsistent data size (lv %d, PID0 %d, GhostSize %d/%d, NCC %ld/%ld, NFC %ld/%ld) !!\n",
+                 Key.lv, PID0, Entry->GhostSize, GhostSize, Entry->NCC, NVarCC*PGSize3D_CC,
+                 Entry->NFC, NVarFC*PGSize3D_FC );
+#  endif
+
+   if ( Entry->GhostSize == GhostSize )
+   {
+      if ( Entry->NCC > 0 )   memcpy( DataCC, Entry->Data,            Entry->NCC*sizeof(real) );
+      if ( Entry->NFC > 0 )   memcpy( DataFC, Entry->Data+Entry->NCC, Entry->NFC*sizeof(real) );
+   }
+
+   else
+   {
+#     ifdef GAMER_DEBUG
+      if ( !Key.SubRegion  ||  Entry->GhostSize < GhostSize  ||  NVarFC > 0 )
+         Aux_Error( ERROR_INFO, "cannot extract %d ghost zones from %d (SubRegion %d, NVarFC %d) !!\n",
+                    GhostSize, Entry->GhostSize, Key.SubRegion, NVarFC );
+#     endif
+
+      CopySubRegion( Entry->Data, Entry->GhostSize, DataCC, GhostSize, NVarCC );
+   }
+
+   return true;
+
+} // FUNCTION : Prepare_PatchData_Cache_Load
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_Cache_Store
+// Description :  Store the prepared data of the target patch group in the cache
+//
+// Note        :  1. Thread-safe and can be invoked within an OpenMP parallel region
+//                2. Do nothing if the data can already be served by the cache (including those cached with more
+//                   ghost zones when Key.SubRegion is on) or the cache size would exceed PREP_CACHE_MAX_MB
+//                   --> Memory is released only by Prepare_PatchData_Cache_Invalidate() and
+//                       Prepare_PatchData_Cache_Reset() so that Prepare_PatchData_Cache_Load() can copy the
+//                       cached data outside the critical section
+//
+// Parameter   :  Key       : Key set by Prepare_PatchData_Cache_SetKey()
+//                PID0      : Patch index with LocalID==0 of the target patch group
+//                GhostSize : Number of ghost zones of the data to be stored
+//                NVarCC    : Number of cell-centered variables
+//                NVarFC    : Number of face-centered variables
+//                DataCC    : Cell-centered data of one patch group to be stored
+//                DataFC    : Face-centered data of one patch group to be stored
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_Cache_Store( const PrepCacheKey_t &Key, const int PID0, const int GhostSize,
+                                    const int NVarCC, const int NVarFC, const real *DataCC, const real *DataFC )
+{
+
+   const long PGSize1D_CC = 2*( PS1 + GhostSize );
+   const long NCC         = NVarCC*CUBE( PGSize1D_CC );
+   const long NFC         = NVarFC*( PGSize1D_CC + 1 )*SQR( PGSize1D_CC );
+   const long NByte       = (NCC+NFC)*sizeof(real) + sizeof(PrepCacheEntry_t);
+   const long MaxNByte = (long)( PREP_CACHE_MAX_MB*1024.0*1024.0 );
+   bool       Reserved = false;
+
+// 1. reserve memory
+#  pragma omp critical( PREP_CACHE )
+   {
+      if ( PrepCache_NByte + NByte <= MaxNByte  &&  FindEntry(Key, PID0, GhostSize) == NULL )
+      {
+         PrepCache_NByte += NByte;
+         Reserved         = true;
+      }
+   }
+
+   if ( !Reserved )  return;
+
+
+// 2. copy data outside the critical section
+   PrepCacheEntry_t *Entry = new PrepCacheEntry_t;
+
+   Entry->Key       = Key;
+   Entry->PID0      = PID0;
+   Entry->GhostSize = GhostSize;
+   Entry->NCC       = NCC;
+   Entry->NFC       = NFC;
+   Entry->Data      = new real [NCC+NFC];
+   Entry->Next      = NULL;
+
+   if ( NCC > 0 )    memcpy( Entry->Data,     DataCC, NCC*sizeof(real) );
+   if ( NFC > 0 )    memcpy( Entry->Data+NCC, DataFC, NFC*sizeof(real) );
+
+
+// 3. insert the new entry
+// --> another thread may have inserted the same patch group in the meantime, in which case one of the two
+//     entries is simply never found since FindEntry() returns the first match
+#  pragma omp critical( PREP_CACHE )
+   {
+      const int  lv        = Key.lv;
+      const long BucketIdx = GetBucketIdx( Key, PID0 );
+
+      if ( PrepCache_Bucket[lv] == NULL )
+      {
+         PrepCache_Bucket[lv] = new PrepCacheEntry_t* [PREP_CACHE_NBUCKET];
+         for (int b=0; b<PREP_CACHE_NBUCKET; b++)  PrepCache_Bucket[lv][b] = NULL;
+      }
+
+      Entry->Next                     = PrepCache_Bucket[lv][BucketIdx];
+      PrepCache_Bucket[lv][BucketIdx] = Entry;
+   }
+
+} // FUNCTION : Prepare_PatchData_Cache_Store
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_Cache_Invalidate
+// Description :  Remove the cached data depending on the target fields at the target level
+//
+// Note        :  1. Must be invoked whenever the target fields at the target level are modified or the
+//                   corresponding sandglass is flipped
+//                   --> Data at lv+1 are removed as well since their ghost zones may be interpolated from lv
+//                2. Must NOT be invoked concurrently with Prepare_PatchData()
+//                3. Do nothing if OPT__PREP_CACHE is off
+//
+// Parameter   :  lv     : Target refinement level
+//                TVarCC : Modified cell-centered fields (e.g., _TOTAL, _POTE)
+//                TVarFC : Modified face-centered fields (e.g., _MAG)
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_Cache_Invalidate( const int lv, const long TVarCC, const long TVarFC )
+{
+
+   if ( !OPT__PREP_CACHE )    return;
+
+   const int Depend = GetDependency( TVarCC, TVarFC );
+
+   for (int TLv=lv; TLv<=MIN(lv+1,NLEVEL-1); TLv++)
+   {
+      if ( PrepCache_Bucket[TLv] == NULL )   continue;
+
+      for (int b=0; b<PREP_CACHE_NBUCKET; b++)
+      {
+         PrepCacheEntry_t **Link = &PrepCache_Bucket[TLv][b];
+
+         while ( *Link != NULL )
+         {
+            PrepCacheEntry_t *Entry = *Link;
+
+            if ( Entry->Key.Depend & Depend )
+            {
+               *Link            = Entry->Next;
+               PrepCache_NByte -= (Entry->NCC+Entry->NFC)*sizeof(real) + sizeof(PrepCacheEntry_t);
+
+               delete [] Entry->Data;
+               delete Entry;
+            }
+
+            else
+               Link = &Entry->Next;
+         }
+      }
+   } // for (int TLv=lv; TLv<=MIN(lv+1,NLEVEL-1); TLv++)
+
+} // FUNCTION : Prepare_PatchData_Cache_Invalidate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_Cache_Reset
+// Description :  Remove all cached data and free all memory of the patch-data cache
+//
+// Note        :  1. Must be invoked whenever the patch indices may change (e.g., grid refinement and
+//                   load balancing) and when the program ends
+//                2. Must NOT be invoked concurrently with Prepare_PatchData()
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_Cache_Reset()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      if ( PrepCache_Bucket[lv] == NULL )    continue;
+
+      for (int b=0; b<PREP_CACHE_NBUCKET; b++)
+      {
+         PrepCacheEntry_t *Entry = PrepCache_Bucket[lv][b];
+
+         while ( Entry != NULL )
+         {
+            PrepCacheEntry_t *Next = Entry->Next;
+
+            delete [] Entry->Data;
+            delete Entry;
+
+            Entry = Next;
+         }
+      }
+
+      delete [] PrepCache_Bucket[lv];
+      PrepCache_Bucket[lv] = NULL;
+   }
+
+   PrepCache_NByte = 0L;
+
+} // FUNCTION : Prepare_PatchData_Cache_Reset
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetDependency
+// Description :  Return the fields the target variables depend on
+//
+// Note        :  1. With MHD, all derived fields are assumed to depend on the magnetic field
+//
+// Parameter   :  TVarCC : Target cell-centered variables
+//                TVarFC : Target face-centered variables
+//
+// Return      :  Bitwise combination of PREP_CACHE_DEP_FLU/MAG/POT
+//-------------------------------------------------------------------------------------------------------
+int GetDependency( const long TVarCC, const long TVarFC )
+{
+
+   int Depend = 0;
+
+   if ( TVarCC & (_TOTAL|_DERIVED) )   Depend |= PREP_CACHE_DEP_FLU;
+
+#  ifdef MHD
+   if ( TVarFC & _MAG  ||  TVarCC & _DERIVED )  Depend |= PREP_CACHE_DEP_MAG;
+#  endif
+
+#  ifdef GRAVITY
+   if ( TVarCC & _POTE )   Depend |= PREP_CACHE_DEP_POT;
+#  endif
+
+   return Depend;
+
+} // FUNCTION : GetDependency
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetBucketIdx
+// Description :  Return the hash-bucket index of the target patch group
+//
+// Parameter   :  Key  : Key set by Prepare_PatchData_Cache_SetKey()
+//                PID0 : Patch index with LocalID==0 of the target patch group
+//
+// Return      :  Bucket index in the range [0 ... PREP_CACHE_NBUCKET-1]
+//-------------------------------------------------------------------------------------------------------
+long GetBucketIdx( const PrepCacheKey_t &Key, const int PID0 )
+{
+
+   const unsigned long Hash = Key.Hash ^ ( (unsigned long)(PID0/8)*11400714819323198485UL );
+
+   return (long)( Hash % PREP_CACHE_NBUCKET );
+
+} // FUNCTION : GetBucketIdx
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FindEntry
+// Description :  Find the cached entry of the target patch group
+//
+// Note        :  1. Must be invoked within the critical section PREP_CACHE
+//                2. Entries with more ghost zones are also accepted if Key.SubRegion is on
+//
+// Parameter   :  Key       : Key set by Prepare_PatchData_Cache_SetKey()
+//                PID0      : Patch index with LocalID==0 of the target patch group
+//                GhostSize : Number of ghost zones requested
+//
+// Return      :  Pointer to the target entry (NULL if not found)
+//-------------------------------------------------------------------------------------------------------
+PrepCacheEntry_t *FindEntry( const PrepCacheKey_t &Key, const int PID0, const int GhostSize )
+{
+
+   if ( PrepCache_Bucket[Key.lv] == NULL )   return NULL;
+
+   for (PrepCacheEntry_t *Entry=PrepCache_Bucket[Key.lv][ GetBucketIdx(Key, PID0) ]; Entry!=NULL; Entry=Entry->Next)
+   {
+      if ( Entry->PID0 != PID0 )    continue;
+
+      if (  ( Entry->GhostSize == GhostSize  ||  ( Key.SubRegion && Entry->GhostSize > GhostSize ) )  &&
+            memcmp( &Entry->Key, &Key, sizeof(PrepCacheKey_t) ) == 0  )
+         return Entry;
+   }
+
+   return NULL;
+
+} // FUNCTION : FindEntry
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CopySubRegion
+// Description :  Copy the inner region of cell-centered patch-group data with fewer ghost zones
+//
+// Note        :  1. Invoked by Prepare_PatchData_Cache_Load()
+//
+// Parameter   :  In            : Input patch-group data
+//                GhostSize_In  : Number of ghost zones of In[]
+//                Out           : Output patch-group data
+//                GhostSize_Out : Number of ghost zones of Out[] (<= GhostSize_In)
+//                NVar          : Number of variables
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+void CopySubRegion( const real *In, const int GhostSize_In, real *Out, const int GhostSize_Out,
+                    const int NVar )
+{
+
+   const int  Disp      = GhostSize_In - GhostSize_Out;
+   const int  Size_In   = 2*( PS1 + GhostSize_In  );
+   const int  Size_Out  = 2*( PS1 + GhostSize_Out );
+   const long Size3D_In = CUBE( (long)Size_In );
+
+   for (int v=0; v<NVar; v++)
+   {
+      const real *In_Ptr = In + v*Size3D_In;
+
+      for (int k=0; k<Size_Out; k++)
+      for (int j=0; j<Size_Out; j++)
+      {
+         memcpy( Out, In_Ptr+IDX321( Disp, j+Disp, k+Disp, Size_In, Size_In ), Size_Out*sizeof(real) );
+         Out += Size_Out;
+      }
+   }
+
+} // FUNCTION : CopySubRegion
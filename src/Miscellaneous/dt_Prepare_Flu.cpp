@@ -35,8 +35,11 @@ void dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][FLU_NIN_T][ CUBE(PS1) ],
          const int N   = 8*TID + LocalID;
 
 //       fluid variables (including/excluding passive scalars for general/constant-gamma EoS)
-         memcpy( h_Flu_Array_T[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
-                 FLU_NIN_T*CUBE(PS1)*sizeof(real) );
+//       --> use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
+         const real_store *FluPtr = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0];
+               real       *ArrPtr = h_Flu_Array_T[N][0];
+
+         for (int t=0; t<FLU_NIN_T*CUBE(PS1); t++)   ArrPtr[t] = FluPtr[t];
 
 //       B field
 #        ifdef MHD
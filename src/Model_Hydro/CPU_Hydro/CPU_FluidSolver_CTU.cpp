@@ -26,6 +26,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                      real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                      real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                               const int k_fc_s, const int k_fc_e,
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
                                const real MinDens, const real MinPres, const real MinEint,
@@ -35,6 +36,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
+                        const int k_flux_s, const int k_flux_e,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
                         const real dt, const real dh, const double Time, const bool UsePot,
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
@@ -44,6 +46,7 @@ void Hydro_StoreIntFlux( const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC
                          const int NFlux );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const int k_out_s, const int k_out_e,
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
                            const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter );
@@ -93,6 +96,11 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                2. See include/CUFLU.h for the values and description of different symbolic constants
 //                   such as N_FC_VAR, N_FC_FLUX, N_SLOPE_PPM, N_FL_FLUX, N_HF_VAR
 //                3. Arrays with a prefix "g_" are stored in the global memory of GPU
+//                4. The CPU solver allocates the working arrays g_PriVar, g_Slope_PPM, g_FC_Var, g_FC_Flux,
+//                   g_FC_Mag_Half, and g_EC_Ele for each OpenMP thread and reuses them for all the patch groups
+//                   computed by the same thread
+//                   --> Only the GPU solver takes them as the input arguments, which are allocated for each
+//                       patch group (i.e., CUDA thread block)
 //
 // Parameter   :  g_Flu_Array_In     : Array storing the input fluid variables
 //                g_Flu_Array_Out    : Array to store the output fluid variables
@@ -103,12 +111,12 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                g_Ele_Array        : Array to store the output electric field (for MHD only)
 //                g_Corner_Array     : Array storing the physical corner coordinates of each patch group (for UNSPLIT_GRAVITY)
 //                g_Pot_Array_USG    : Array storing the input potential for UNSPLIT_GRAVITY
-//                g_PriVar           : Array to store the primitive variables
-//                g_Slope_PPM        : Array to store the slope for the PPM reconstruction
-//                g_FC_Var           : Array to store the half-step variables
-//                g_FC_Flux          : Array to store the face-centered fluxes
-//                g_FC_Mag_Half      : Array to store the half-step B field (for MHD only)
-//                g_EC_Ele           : Array to store the edge-centered electric field (for MHD only)
+//                g_PriVar           : Array to store the primitive variables (for GPU only)
+//                g_Slope_PPM        : Array to store the slope for the PPM reconstruction (for GPU only)
+//                g_FC_Var           : Array to store the half-step variables (for GPU only)
+//                g_FC_Flux          : Array to store the face-centered fluxes (for GPU only)
+//                g_FC_Mag_Half      : Array to store the half-step B field (for MHD and GPU only)
+//                g_EC_Ele           : Array to store the edge-centered electric field (for MHD and GPU only)
 //                NPatchGroup        : Number of patch groups to be evaluated
 //                dt                 : Time interval to advance solution
 //                dh                 : Cell size
@@ -149,6 +157,9 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
+//                g_PG_Time          : Array to store the wall time spent on each patch group (for LOAD_BALANCE and CPU only)
+//                                     --> Used by OPT__LB_MEASURED_COST
+//                                     --> Set to NULL to disable timing
 //-------------------------------------------------------------------------------------------------------
 #ifdef __CUDACC__
 __global__
@@ -189,12 +200,6 @@ void CPU_FluidSolver_CTU(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
-         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const int NPatchGroup,
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
@@ -206,7 +211,8 @@ void CPU_FluidSolver_CTU(
    const bool NormPassive, const int NNorm, const int c_NormIdx[],
    const bool FracPassive, const int NFrac, const int c_FracIdx[],
    const bool JeansMinPres, const real JeansMinPres_Coeff,
-   const EoS_t EoS )
+   const EoS_t EoS,
+         double g_PG_Time[] )
 #endif // #ifdef __CUDACC__ ... else ...
 {
 
@@ -230,6 +236,32 @@ void CPU_FluidSolver_CTU(
 #  pragma omp parallel
 #  endif
    {
+//    allocate the working arrays of each OpenMP thread
+//    --> reused by all the patch groups computed by this thread
+#     ifndef __CUDACC__
+      ScratchScope_t Scratch;
+
+      real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ]
+         = ( real (*)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ] )Scratch.Allocate<real>( 6*NCOMP_TOTAL_PLUS_MAG*CUBE(N_FC_VAR) );
+      real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ]
+         = ( real (*)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ] )Scratch.Allocate<real>( 3*NCOMP_TOTAL_PLUS_MAG*CUBE(N_FC_FLUX) );
+      real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ]
+         = ( real (*)[ CUBE(FLU_NXT) ] )Scratch.Allocate<real>( NCOMP_LR*CUBE(FLU_NXT) );
+#     if ( LR_SCHEME == PPM )
+      real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ]
+         = ( real (*)[NCOMP_LR][ CUBE(N_SLOPE_PPM) ] )Scratch.Allocate<real>( 3*NCOMP_LR*CUBE(N_SLOPE_PPM) );
+#     else
+      real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = NULL;
+#     endif
+#     ifdef MHD
+      real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ]
+         = ( real (*)[ FLU_NXT_P1*SQR(FLU_NXT) ] )Scratch.Allocate<real>( NCOMP_MAG*FLU_NXT_P1*SQR(FLU_NXT) );
+      real (*const g_EC_Ele_1PG     )[ CUBE(N_EC_ELE)          ]
+         = ( real (*)[ CUBE(N_EC_ELE) ] )Scratch.Allocate<real>( NCOMP_MAG*CUBE(N_EC_ELE) );
+#     endif
+#     endif // #ifndef __CUDACC__
+
+
 //    loop over all patch groups
 //    --> CPU/GPU solver: use different (OpenMP threads) / (CUDA thread blocks)
 //        to work on different patch groups
@@ -240,16 +272,24 @@ void CPU_FluidSolver_CTU(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+#        if ( defined LOAD_BALANCE  &&  !defined __CUDACC__ )
+         const double PG_StartTime = ( g_PG_Time == NULL ) ? 0.0 : MPI_Wtime();
+#        endif
+
 //       0. point to the arrays associated with different patch groups
-//          --> necessary because different patch groups are computed by different OpenMP threads or CUDA blocks in parallel
+//          --> necessary because different patch groups are computed by different CUDA blocks in parallel
+#        ifdef __CUDACC__
          real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [P];
          real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [P];
          real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ] = g_PriVar   [P];
          real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[P];
-
 #        ifdef MHD
          real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = g_FC_Mag_Half[P];
          real (*const g_EC_Ele_1PG     )[ CUBE(N_EC_ELE)          ] = g_EC_Ele     [P];
+#        endif
+#        endif // #ifdef __CUDACC__
+
+#        ifdef MHD
          real (*const g_PriVar_Half_1PG)[ CUBE(FLU_NXT) ]           = g_PriVar_1PG;
 #        else
          real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = NULL;
@@ -259,13 +299,13 @@ void CPU_FluidSolver_CTU(
 
 //       1. evaluate the face-centered values at the half time-step
          Hydro_DataReconstruction( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                   NULL, Con2Pri_Yes, LR_Limiter, MinMod_Coeff, dt, dh,
+                                   NULL, 0, N_FC_VAR, Con2Pri_Yes, LR_Limiter, MinMod_Coeff, dt, dh,
                                    MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
                                    JeansMinPres, JeansMinPres_Coeff, &EoS );
 
 
 //       2. evaluate the face-centered half-step fluxes by solving the Riemann problem
-         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_HF_FLUX, 0, 0, CorrHalfVel_No,
+         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_HF_FLUX, 0, 0, 0, N_HF_FLUX, CorrHalfVel_No,
                             NULL, NULL, NULL_REAL, NULL_REAL, NULL_REAL,
                             EXT_POT_NONE, EXT_ACC_NONE, NULL, NULL,
                             MinDens, MinPres, &EoS );
@@ -303,7 +343,7 @@ void CPU_FluidSolver_CTU(
          const int NSkip_N = 0;
          const int NSkip_T = 1;
 #        endif
-         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, CorrHalfVel,
+         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, 0, N_FL_FLUX, CorrHalfVel,
                             g_Pot_Array_USG[P], g_Corner_Array[P], dt, dh, Time,
                             UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
                             MinDens, MinPres, &EoS );
@@ -329,9 +369,15 @@ void CPU_FluidSolver_CTU(
 //       8. full-step evolution of the fluid data
 //          --> CTU does not support reducing the min-mod coefficient
          Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
-                               g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
+                               g_FC_Flux_1PG, 0, PS2, dt, dh, MinDens, MinEint, DualEnergySwitch,
                                NormPassive, NNorm, c_NormIdx, &EoS, NULL, NULL_INT, NULL_INT );
 
+
+//       9. record the wall time spent on this patch group
+#        if ( defined LOAD_BALANCE  &&  !defined __CUDACC__ )
+         if ( g_PG_Time != NULL )   g_PG_Time[P] = MPI_Wtime() - PG_StartTime;
+#        endif
+
       } // loop over all patch groups
    } // OpenMP parallel region
 
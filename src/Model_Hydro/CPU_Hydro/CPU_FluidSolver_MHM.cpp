@@ -48,6 +48,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                      real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                      real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                               const int k_fc_s, const int k_fc_e,
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
                                const real MinDens, const real MinPres, const real MinEint,
@@ -57,6 +58,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
+                        const int k_flux_s, const int k_flux_e,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
                         const real dt, const real dh, const double Time, const bool UsePot,
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
@@ -66,6 +68,7 @@ void Hydro_StoreIntFlux( const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC
                          const int NFlux );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const int k_out_s, const int k_out_e,
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
                            const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter );
@@ -199,6 +202,11 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                   reducing the original minmod coefficient repeatedly until either the unphysical result is
 //                   solved or the reduced minmod coefficient equals zero. Note that interpolating with a
 //                   vanished minmod coefficient is equivalent to the piecewise constant spatial reconstruction.
+//                7. The CPU solver allocates the working arrays g_PriVar, g_Slope_PPM, g_FC_Var, g_FC_Flux,
+//                   g_FC_Mag_Half, and g_EC_Ele for each OpenMP thread and reuses them for all the patch groups
+//                   computed by the same thread
+//                   --> Only the GPU solver takes them as the input arguments, which are allocated for each
+//                       patch group (i.e., CUDA thread block)
 //
 //
 // Parameter   :  g_Flu_Array_In     : Array storing the input fluid variables
@@ -210,12 +218,12 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                g_Ele_Array        : Array to store the output electric field (for MHD only)
 //                g_Corner_Array     : Array storing the physical corner coordinates of each patch group (for UNSPLIT_GRAVITY)
 //                g_Pot_Array_USG    : Array storing the input potential for UNSPLIT_GRAVITY
-//                g_PriVar           : Array to store the primitive variables
-//                g_Slope_PPM        : Array to store the slope for the PPM reconstruction
-//                g_FC_Var           : Array to store the half-step variables
-//                g_FC_Flux          : Array to store the face-centered fluxes
-//                g_FC_Mag_Half      : Array to store the half-step B field (for MHD only)
-//                g_EC_Ele           : Array to store the edge-centered electric field (for MHD only)
+//                g_PriVar           : Array to store the primitive variables (for GPU only)
+//                g_Slope_PPM        : Array to store the slope for the PPM reconstruction (for GPU only)
+//                g_FC_Var           : Array to store the half-step variables (for GPU only)
+//                g_FC_Flux          : Array to store the face-centered fluxes (for GPU only)
+//                g_FC_Mag_Half      : Array to store the half-step B field (for MHD and GPU only)
+//                g_EC_Ele           : Array to store the edge-centered electric field (for MHD and GPU only)
 //                NPatchGroup        : Number of patch groups to be evaluated
 //                dt                 : Time interval to advance solution
 //                dh                 : Cell size
@@ -258,6 +266,9 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
 //                MicroPhy           : Microphysics object
+//                g_PG_Time          : Array to store the wall time spent on each patch group (for LOAD_BALANCE and CPU only)
+//                                     --> Used by OPT__LB_MEASURED_COST
+//                                     --> Set to NULL to disable timing
 //-------------------------------------------------------------------------------------------------------
 #ifdef __CUDACC__
 __global__
@@ -298,12 +309,6 @@ void CPU_FluidSolver_MHM(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
-         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const int NPatchGroup,
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
@@ -315,7 +320,8 @@ void CPU_FluidSolver_MHM(
    const bool NormPassive, const int NNorm, const int c_NormIdx[],
    const bool FracPassive, const int NFrac, const int c_FracIdx[],
    const bool JeansMinPres, const real JeansMinPres_Coeff,
-   const EoS_t EoS, const MicroPhy_t MicroPhy )
+   const EoS_t EoS, const MicroPhy_t MicroPhy,
+         double g_PG_Time[] )
 #endif // #ifdef __CUDACC__ ... else ...
 {
 
@@ -350,6 +356,34 @@ void CPU_FluidSolver_MHM(
 #  pragma omp parallel
 #  endif
    {
+//    allocate the working arrays of each OpenMP thread
+//    --> reused by all the patch groups computed by this thread
+#     ifndef __CUDACC__
+      ScratchScope_t Scratch;
+
+      real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ]
+         = ( real (*)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ] )Scratch.Allocate<real>( 6*NCOMP_TOTAL_PLUS_MAG*CUBE(N_FC_VAR) );
+      real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ]
+         = ( real (*)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ] )Scratch.Allocate<real>( 3*NCOMP_TOTAL_PLUS_MAG*CUBE(N_FC_FLUX) );
+      real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ]
+         = ( real (*)[ CUBE(FLU_NXT) ] )Scratch.Allocate<real>( NCOMP_LR*CUBE(FLU_NXT) );
+#     if ( LR_SCHEME == PPM )
+      real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ]
+         = ( real (*)[NCOMP_LR][ CUBE(N_SLOPE_PPM) ] )Scratch.Allocate<real>( 3*NCOMP_LR*CUBE(N_SLOPE_PPM) );
+#     else
+      real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = NULL;
+#     endif
+#     ifdef MHD
+#     if ( FLU_SCHEME == MHM_RP )
+      real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ]
+         = ( real (*)[ FLU_NXT_P1*SQR(FLU_NXT) ] )Scratch.Allocate<real>( NCOMP_MAG*FLU_NXT_P1*SQR(FLU_NXT) );
+#     endif
+      real (*const g_EC_Ele_1PG     )[ CUBE(N_EC_ELE)          ]
+         = ( real (*)[ CUBE(N_EC_ELE) ] )Scratch.Allocate<real>( NCOMP_MAG*CUBE(N_EC_ELE) );
+#     endif
+#     endif // #ifndef __CUDACC__
+
+
 //    loop over all patch groups
 //    --> CPU/GPU solver: use different (OpenMP threads) / (CUDA thread blocks)
 //        to work on different patch groups
@@ -360,23 +394,32 @@ void CPU_FluidSolver_MHM(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+#        if ( defined LOAD_BALANCE  &&  !defined __CUDACC__ )
+         const double PG_StartTime = ( g_PG_Time == NULL ) ? 0.0 : MPI_Wtime();
+#        endif
+
          Iteration = 0;
 
 //       0. point to the arrays associated with different patch groups
-//          --> necessary because different patch groups are computed by different OpenMP threads or CUDA blocks in parallel
+//          --> necessary because different patch groups are computed by different CUDA blocks in parallel
+#        ifdef __CUDACC__
          real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [P];
          real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [P];
          real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ] = g_PriVar   [P];
          real (*const g_Slope_PPM_1PG)[NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[P];
+#        ifdef MHD
+#        if ( FLU_SCHEME == MHM_RP )
+         real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = g_FC_Mag_Half[P];
+#        endif
+         real (*const g_EC_Ele_1PG     )[ CUBE(N_EC_ELE)          ] = g_EC_Ele     [P];
+#        endif
+#        endif // #ifdef __CUDACC__
 
 #        if ( FLU_SCHEME == MHM_RP )
          real (*const g_Flux_Half_1PG)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ] = g_FC_Flux_1PG;
          real (*const g_PriVar_Half_1PG )                   [ CUBE(FLU_NXT)   ] = g_PriVar_1PG;
 
-#        ifdef MHD
-         real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = g_FC_Mag_Half[P];
-         real (*const g_EC_Ele_1PG     )[ CUBE(N_EC_ELE)          ] = g_EC_Ele     [P];
-#        else
+#        ifndef MHD
          real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = NULL;
 #        endif
 #        endif // if ( FLU_SCHEME == MHM_RP )
@@ -386,9 +429,7 @@ void CPU_FluidSolver_MHM(
 //       --> we use the same array size as the half-step variables of MHM_RP to avoid
 //           changing the MHM_RP full-step MHD_ComputeElectric()
          real (*const g_PriVar_Half_1PG )[ CUBE(FLU_NXT)  ] = g_PriVar_1PG;
-#        ifdef MHD
-         real (*const g_EC_Ele_1PG      )[ CUBE(N_EC_ELE) ] = g_EC_Ele[P];
-#        else
+#        ifndef MHD
          real (*const g_EC_Ele_1PG      )[ CUBE(N_EC_ELE) ] = NULL;
 #        endif
 #        endif // #if ( FLU_SCHEME == MHM )
@@ -482,7 +523,7 @@ void CPU_FluidSolver_MHM(
 //          1-a-5. evaluate the face-centered values by data reconstruction
 //                 --> note that g_PriVar_Half_1PG[] returned by Hydro_RiemannPredict() stores the primitive variables
             Hydro_DataReconstruction( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                      NULL, Con2Pri_No, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
+                                      NULL, 0, N_FC_VAR, Con2Pri_No, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
                                       MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
                                       JeansMinPres, JeansMinPres_Coeff, &EoS );
 
@@ -508,15 +549,53 @@ void CPU_FluidSolver_MHM(
             AdaptiveMinModCoeff = FMAX( AdaptiveMinModCoeff, (real)0.0 );
 
 
+#           ifdef FLU_CACHE_BLOCK
+//          sweep the patch group slab by slab along z
+//          --> each slab updates the output cells with k_out_s <= k < k_out_e and evaluates only the
+//              face-centered variables and fluxes required by these cells but not by the previous slabs
+//          --> the results are identical to those of the unblocked steps 1-4 below
+            const int NSkip_N = 0;
+            const int NSkip_T = 1;
+
+            for (int k_out_s=0; k_out_s<PS2; k_out_s+=FLU_BLOCK_NZ)
+            {
+               const int k_out_e  = MIN( k_out_s+FLU_BLOCK_NZ, PS2 );
+               const int k_fc_s   = ( k_out_s == 0 ) ? 0 : k_out_s + N_FC_VAR  - PS2;
+               const int k_fc_e   =                        k_out_e + N_FC_VAR  - PS2;
+               const int k_flux_s = ( k_out_s == 0 ) ? 0 : k_out_s + N_FL_FLUX - PS2;
+               const int k_flux_e =                        k_out_e + N_FL_FLUX - PS2;
+
+               Hydro_DataReconstruction( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                         g_EC_Ele_1PG, k_fc_s, k_fc_e, Con2Pri_Yes, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
+                                         MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
+                                         JeansMinPres, JeansMinPres_Coeff, &EoS );
+
+               Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, k_flux_s, k_flux_e,
+                                  CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                  dt, dh, Time, UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
+                                  MinDens, MinPres, &EoS );
+
+               Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
+                                     g_FC_Flux_1PG, k_out_s, k_out_e, dt, dh, MinDens, MinEint, DualEnergySwitch,
+                                     NormPassive, NNorm, c_NormIdx, &EoS, &s_FullStepFailure, Iteration, MinMod_MaxIter );
+            } // for (int k_out_s=0; k_out_s<PS2; k_out_s+=FLU_BLOCK_NZ)
+
+            if ( StoreFlux )
+               Hydro_StoreIntFlux( g_FC_Flux_1PG, g_Flux_Array[P], N_FL_FLUX );
+
+#           else // #ifdef FLU_CACHE_BLOCK
+
 //          evaluate the face-centered values by data reconstruction
             Hydro_DataReconstruction( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                      g_EC_Ele_1PG, Con2Pri_Yes, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
+                                      g_EC_Ele_1PG, 0, N_FC_VAR, Con2Pri_Yes, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
                                       MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
                                       JeansMinPres, JeansMinPres_Coeff, &EoS );
+#           endif // #ifdef FLU_CACHE_BLOCK ... else ...
 
 #        endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
 
 
+#           ifndef FLU_CACHE_BLOCK
 //          2. evaluate the full-step fluxes
 #           ifdef MHD
             const int NSkip_N = 0;
@@ -527,7 +606,7 @@ void CPU_FluidSolver_MHM(
 #           endif
 
 //          hydrodynamic fluxes
-            Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T,
+            Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, 0, N_FL_FLUX,
                                CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
                                dt, dh, Time, UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
                                MinDens, MinPres, &EoS );
@@ -564,7 +643,7 @@ void CPU_FluidSolver_MHM(
 
 //          4. full-step evolution
             Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
-                                  g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
+                                  g_FC_Flux_1PG, 0, PS2, dt, dh, MinDens, MinEint, DualEnergySwitch,
                                   NormPassive, NNorm, c_NormIdx, &EoS, &s_FullStepFailure, Iteration, MinMod_MaxIter );
 
 //          add the cosmic-ray source term of adiabatic work
@@ -572,6 +651,7 @@ void CPU_FluidSolver_MHM(
             CR_AdiabaticWork_FullStep( g_PriVar_Half_1PG, g_Flu_Array_Out[P], g_FC_Flux_1PG, g_FC_Var_1PG,
                                        dt, dh, &EoS );
 #           endif
+#           endif // #ifndef FLU_CACHE_BLOCK
 
 
 //          5. counter increment
@@ -579,6 +659,12 @@ void CPU_FluidSolver_MHM(
 
          } while ( s_FullStepFailure  &&  Iteration <= MinMod_MaxIter );
 
+
+//       record the wall time spent on this patch group, including all minmod iterations
+#        if ( defined LOAD_BALANCE  &&  !defined __CUDACC__ )
+         if ( g_PG_Time != NULL )   g_PG_Time[P] = MPI_Wtime() - PG_StartTime;
+#        endif
+
       } // loop over all patch groups
    } // OpenMP parallel region
 
@@ -0,0 +1,779 @@
+#include "CUFLU.h"
+
+#ifdef RSOLVER_PENCIL
+
+
+
+// external functions
+#if ( RSOLVER == HLLE   ||  RSOLVER_RESCUE == HLLE  )
+void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const EoS_GUESS_t EoS_GuessHTilde,
+                               const EoS_H2TEM_t EoS_HTilde2Temp,
+                               const double EoS_AuxArray_Flt[], const int EoS_AuxArray_Int[],
+                               const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+#if ( RSOLVER == HLLC   ||  RSOLVER_RESCUE == HLLC  )
+void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const EoS_GUESS_t EoS_GuessHTilde,
+                               const EoS_H2TEM_t EoS_HTilde2Temp,
+                               const double EoS_AuxArray_Flt[], const int EoS_AuxArray_Int[],
+                               const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+#if ( RSOLVER == HLLD   ||  RSOLVER_RESCUE == HLLD  )
+void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
+                               const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+
+#if   ( RSOLVER == HLLE )
+static void Hydro_RiemannSolver_HLLE_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                             const real *const L_In[], const real *const R_In[],
+                                             const real MinPres, const double EoS_AuxArray_Flt[] );
+#elif ( RSOLVER == HLLC )
+static void Hydro_RiemannSolver_HLLC_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                             const real *const L_In[], const real *const R_In[],
+                                             const real MinPres, const double EoS_AuxArray_Flt[] );
+#elif ( RSOLVER == HLLD )
+static void Hydro_RiemannSolver_HLLD_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                             const real *const L_In[], const real *const R_In[],
+                                             const real MinPres, const double EoS_AuxArray_Flt[] );
+#endif
+
+
+// branch-free versions of FMIN(), FMAX(), and Hydro_CheckMinPres() to allow vectorization
+// --> return exactly the same results as the x86-64 fmin()/fmax() even for NaN and signed zeros
+// --> all comparisons are evaluated unconditionally since the compiler does not speculate floating-point
+//     operations that may trap
+static inline real Pencil_Min( const real a, const real b )  { return ( (a < b) | (b != b) ) ? a : b; }
+static inline real Pencil_Max( const real a, const real b )  { return ( (a > b) | (b != b) ) ? a : b; }
+static inline real Pencil_CheckMinPres( const real Pres, const real MinPres )
+{
+   return ( (Pres != Pres) | (Pres > MinPres) | (MinPres != MinPres) ) ? Pres : MinPres;
+}
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_Pencil
+// Description :  Solve the Riemann problems of a row of cell faces along x at once
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux() when RSOLVER_PENCIL is on (see CUFLU.h)
+//                2. The default Riemann solver is replaced by a loop over faces that the compiler can
+//                   vectorize, which gives the same results as the per-face solver
+//                   --> Verified face by face when RSOLVER_PENCIL_CHECK is on
+//                   --> Also see the random-state test in tool/test/riemann_pencil
+//                3. Faces with NaN fluxes are recomputed by RSOLVER_RESCUE, same as Hydro_ComputeFlux()
+//                4. All input and output arrays must be contiguous along x for each component
+//                   --> Works for all XYZ since the faces in a row along x are always adjacent in memory
+//                5. For MHD, Flux_Out[] and L/R_In[] also include the magnetic field
+//                   --> NCOMP_TOTAL_PLUS_MAG components in total
+//
+// Parameter   :  XYZ          : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace        : Number of faces in the row (<= N_FC_VAR)
+//                Flux_Out     : Pointers to the first output flux of each component
+//                L/R_In       : Pointers to the first left/right state (conserved variables) of each component
+//                MinDens/Pres : Density and pressure floors
+//                EoS          : EoS object
+//
+// Return      :  Flux_Out[][]
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                 const real *const L_In[], const real *const R_In[],
+                                 const real MinDens, const real MinPres, const EoS_t *EoS )
+{
+
+// 1. invoke the vectorized Riemann solver
+#  if   ( RSOLVER == HLLE )
+   Hydro_RiemannSolver_HLLE_Pencil( XYZ, NFace, Flux_Out, L_In, R_In, MinPres, EoS->AuxArrayDevPtr_Flt );
+#  elif ( RSOLVER == HLLC )
+   Hydro_RiemannSolver_HLLC_Pencil( XYZ, NFace, Flux_Out, L_In, R_In, MinPres, EoS->AuxArrayDevPtr_Flt );
+#  elif ( RSOLVER == HLLD )
+   Hydro_RiemannSolver_HLLD_Pencil( XYZ, NFace, Flux_Out, L_In, R_In, MinPres, EoS->AuxArrayDevPtr_Flt );
+#  endif
+
+
+// 2. verify the results and switch to a different Riemann solver if the default one fails
+#  if ( RSOLVER_RESCUE != NONE  ||  defined RSOLVER_PENCIL_CHECK )
+   real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
+
+   for (int i=0; i<NFace; i++)
+   {
+      bool Fail = false;
+
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      {
+//       only check NaN for now
+         if ( Flux_Out[v][i] != Flux_Out[v][i] )
+         {
+            Fail = true;
+            break;
+         }
+      }
+
+#     ifndef RSOLVER_PENCIL_CHECK
+      if ( !Fail )   continue;
+#     endif
+
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      {
+         ConVar_L[v] = L_In[v][i];
+         ConVar_R[v] = R_In[v][i];
+      }
+
+//    2-1. compare with the per-face solver bitwise
+#     ifdef RSOLVER_PENCIL_CHECK
+#     if   ( RSOLVER == HLLE )
+      Hydro_RiemannSolver_HLLE( XYZ, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER == HLLC )
+      Hydro_RiemannSolver_HLLC( XYZ, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER == HLLD )
+      Hydro_RiemannSolver_HLLD( XYZ, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     endif
+
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      {
+         if (  memcmp( &Flux_1Face[v], &Flux_Out[v][i], sizeof(real) ) != 0  )
+            Aux_Error( ERROR_INFO, "pencil and per-face Riemann solvers differ (XYZ %d, face %d, comp %d: %24.17e vs %24.17e) !!\n",
+                       XYZ, i, v, Flux_Out[v][i], Flux_1Face[v] );
+      }
+
+      if ( !Fail )   continue;
+#     endif // #ifdef RSOLVER_PENCIL_CHECK
+
+//    2-2. switch to RSOLVER_RESCUE
+#     if ( RSOLVER_RESCUE != NONE )
+#     ifdef CHECK_UNPHYSICAL_IN_FLUID
+      printf( "WARNING : default Riemann solver failed in Hydro_ComputeFlux() --> switch to RSOLVER_RESCUE (%d) !!\n", RSOLVER_RESCUE );
+#     endif
+
+#     if   ( RSOLVER_RESCUE == HLLE )
+      Hydro_RiemannSolver_HLLE( XYZ, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER_RESCUE == HLLC )
+      Hydro_RiemannSolver_HLLC( XYZ, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER_RESCUE == HLLD )
+      Hydro_RiemannSolver_HLLD( XYZ, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     else
+#     error : ERROR : unsupported RSOLVER_RESCUE (HLLE/HLLC/HLLD) !!
+#     endif
+
+//    check again
+#     ifdef CHECK_UNPHYSICAL_IN_FLUID
+      for (int w=0; w<NCOMP_TOTAL_PLUS_MAG; w++) {
+         if ( Flux_1Face[w] != Flux_1Face[w] ) {
+            printf( "ERROR : RSOLVER_RESCUE still failed !!\n" );
+            break;
+         }
+      }
+#     endif
+
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   Flux_Out[v][i] = Flux_1Face[v];
+#     endif // #if ( RSOLVER_RESCUE != NONE )
+   } // for (int i=0; i<NFace; i++)
+#  endif // #if ( RSOLVER_RESCUE != NONE  ||  defined RSOLVER_PENCIL_CHECK )
+
+} // FUNCTION : Hydro_RiemannSolver_Pencil
+
+
+
+#if ( RSOLVER == HLLC )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLC_Pencil
+// Description :  Vectorizable HLLC Riemann solver for a row of cell faces
+//
+// Note        :  1. Invoked by Hydro_RiemannSolver_Pencil()
+//                2. Same algorithm and floating-point operations as the HD version of Hydro_RiemannSolver_HLLC()
+//                   with HLL_WAVESPEED_DAVIS and EOS_GAMMA
+//                   --> Keep the two functions consistent
+//                   --> Conditional branches are replaced by selections
+//                3. The spatial direction is handled by the momentum indices instead of Hydro_Rotate3D()
+//                4. Do not check unphysical results here
+//
+// Parameter   :  XYZ              : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace            : Number of faces in the row
+//                Flux_Out         : Pointers to the first output flux of each component
+//                L/R_In           : Pointers to the first left/right state (conserved variables) of each component
+//                MinPres          : Pressure floor
+//                EoS_AuxArray_Flt : Auxiliary array of EOS_GAMMA
+//
+// Return      :  Flux_Out[][]
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLC_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                      const real *const L_In[], const real *const R_In[],
+                                      const real MinPres, const double EoS_AuxArray_Flt[] )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real Gamma    = (real)EoS_AuxArray_Flt[0];
+   const real Gamma_m1 = (real)EoS_AuxArray_Flt[1];
+
+// momentum indices along the normal and transverse directions (i.e., Hydro_Rotate3D())
+   const int MomN  = 1 +   XYZ;
+   const int MomT1 = 1 + ( XYZ + 1 )%3;
+   const int MomT2 = 1 + ( XYZ + 2 )%3;
+
+   const real *Rho_L = L_In[0], *Mn_L = L_In[MomN], *Mt1_L = L_In[MomT1], *Mt2_L = L_In[MomT2], *E_L = L_In[4];
+   const real *Rho_R = R_In[0], *Mn_R = R_In[MomN], *Mt1_R = R_In[MomT1], *Mt2_R = R_In[MomT2], *E_R = R_In[4];
+   real *F_Rho = Flux_Out[0], *F_Mn = Flux_Out[MomN], *F_Mt1 = Flux_Out[MomT1], *F_Mt2 = Flux_Out[MomT2], *F_E = Flux_Out[4];
+
+
+// 1. fluid fluxes
+#  pragma omp simd
+   for (int i=0; i<NFace; i++)
+   {
+//    1-1. compute the left/right states
+      const real _RhoL = ONE / Rho_L[i];
+      const real _RhoR = ONE / Rho_R[i];
+      const real u_L   = _RhoL*Mn_L[i];
+      const real u_R   = _RhoR*Mn_R[i];
+      const real P_L   = Pencil_CheckMinPres(  ( E_L[i] - (real)0.5*( SQR(Mn_L[i]) + SQR(Mt1_L[i]) + SQR(Mt2_L[i]) )/Rho_L[i] )*Gamma_m1,
+                                               MinPres  );
+      const real P_R   = Pencil_CheckMinPres(  ( E_R[i] - (real)0.5*( SQR(Mn_R[i]) + SQR(Mt1_R[i]) + SQR(Mt2_R[i]) )/Rho_R[i] )*Gamma_m1,
+                                               MinPres  );
+      const real Cs_L  = SQRT( Gamma*P_L/Rho_L[i] );
+      const real Cs_R  = SQRT( Gamma*P_R/Rho_R[i] );
+
+//    1-2. use the min/max of the left and right eigenvalues
+      const real W_L1 = u_L - Cs_L;
+      const real W_L2 = u_R - Cs_R;
+      const real W_R1 = u_L + Cs_L;
+      const real W_R2 = u_R + Cs_R;
+      const real W_L  = Pencil_Min( W_L1, W_L2 );
+      const real W_R  = Pencil_Max( W_R1, W_R2 );
+
+//    1-3. evaluate the star-region velocity (V_S) and pressure (P_S)
+      const real dCs_L   = (u_L-u_R)+Cs_R;
+      const real dCs_R   = (u_L-u_R)+Cs_L;
+      const real temp1_L = +Rho_L[i]*(  ( W_L1 < W_L2 ) ? Cs_L : dCs_L  );
+      const real temp1_R = -Rho_R[i]*(  ( W_R2 > W_R1 ) ? Cs_R : dCs_R  );
+      const real temp2   = ONE / ( temp1_L - temp1_R );
+      const real V_S     = temp2*( P_L - P_R + temp1_L*u_L - temp1_R*u_R );
+      const real P_S     = Pencil_CheckMinPres(  temp2*(  temp1_L*( P_R + temp1_R*u_R ) - temp1_R*( P_L + temp1_L*u_L )  ),
+                                                 MinPres  );
+
+//    1-4. evaluate the fluxes along the maximum wave speed of the upwind state
+//    --> load both states first to avoid conditional memory access
+      const real Rho_Li = Rho_L[i], Mn_Li = Mn_L[i], Mt1_Li = Mt1_L[i], Mt2_Li = Mt2_L[i], E_Li = E_L[i];
+      const real Rho_Ri = Rho_R[i], Mn_Ri = Mn_R[i], Mt1_Ri = Mt1_R[i], Mt2_Ri = Mt2_R[i], E_Ri = E_R[i];
+      const real MaxV_L = Pencil_Min( W_L, ZERO );
+      const real MaxV_R = Pencil_Max( W_R, ZERO );
+      const bool UseL   = ( V_S >= ZERO );
+      const real MaxV   = ( UseL ) ? MaxV_L : MaxV_R;
+      const real Rho    = ( UseL ) ? Rho_Li : Rho_Ri;
+      const real Mn     = ( UseL ) ? Mn_Li  : Mn_Ri;
+      const real Mt1    = ( UseL ) ? Mt1_Li : Mt1_Ri;
+      const real Mt2    = ( UseL ) ? Mt2_Li : Mt2_Ri;
+      const real E      = ( UseL ) ? E_Li   : E_Ri;
+      const real P      = ( UseL ) ? P_L    : P_R;
+      const real Vx     = ( ONE / Rho )*Mn;
+
+      real Flux_LR[NCOMP_FLUID];
+
+      Flux_LR[0]  = Mn;
+      Flux_LR[1]  = Vx*Mn + P;
+      Flux_LR[2]  = Vx*Mt1;
+      Flux_LR[3]  = Vx*Mt2;
+      Flux_LR[4]  = Vx*( E + P );
+      Flux_LR[0] -= MaxV*Rho;
+      Flux_LR[1] -= MaxV*Mn;
+      Flux_LR[2] -= MaxV*Mt1;
+      Flux_LR[3] -= MaxV*Mt2;
+      Flux_LR[4] -= MaxV*E;
+
+//    1-5. evaluate the weightings of the left/right fluxes and contact wave
+//    --> special case of V_S=MaxV_L=0
+      const bool Special  = ( (V_S == ZERO) & (MaxV == ZERO) );
+      const real temp4    = ONE / ( V_S - MaxV );
+      const real temp5    = temp4*V_S;
+      const real temp6    = -temp4*MaxV*P_S;
+      const real Coeff_LR = ( Special ) ? ONE  : temp5;
+      const real Coeff_S  = ( Special ) ? ZERO : temp6;
+
+//    1-6. evaluate the HLLC fluxes and restore the correct order
+      F_Rho[i] = Coeff_LR*Flux_LR[0];
+      F_Mn [i] = Coeff_LR*Flux_LR[1] + Coeff_S;
+      F_Mt1[i] = Coeff_LR*Flux_LR[2];
+      F_Mt2[i] = Coeff_LR*Flux_LR[3];
+      F_E  [i] = Coeff_LR*Flux_LR[4] + Coeff_S*V_S;
+   } // for (int i=0; i<NFace; i++)
+
+
+// 2. passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp simd
+      for (int i=0; i<NFace; i++)
+      {
+         const real Flux_PL = L_In[v][i]*( F_Rho[i]*(ONE/Rho_L[i]) );
+         const real Flux_PR = R_In[v][i]*( F_Rho[i]*(ONE/Rho_R[i]) );
+
+         Flux_Out[v][i] = ( F_Rho[i] >= ZERO ) ? Flux_PL : Flux_PR;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLC_Pencil
+#endif // #if ( RSOLVER == HLLC )
+
+
+
+#if ( RSOLVER == HLLE )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLE_Pencil
+// Description :  Vectorizable HLLE Riemann solver for a row of cell faces
+//
+// Note        :  1. Invoked by Hydro_RiemannSolver_Pencil()
+//                2. Same algorithm and floating-point operations as the HD version of Hydro_RiemannSolver_HLLE()
+//                   with HLL_WAVESPEED_DAVIS and EOS_GAMMA
+//                   --> Keep the two functions consistent
+//                3. See Hydro_RiemannSolver_HLLC_Pencil()
+//
+// Parameter   :  See Hydro_RiemannSolver_HLLC_Pencil()
+//
+// Return      :  Flux_Out[][]
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLE_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                      const real *const L_In[], const real *const R_In[],
+                                      const real MinPres, const double EoS_AuxArray_Flt[] )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real Gamma    = (real)EoS_AuxArray_Flt[0];
+   const real Gamma_m1 = (real)EoS_AuxArray_Flt[1];
+
+// momentum indices along the normal and transverse directions (i.e., Hydro_Rotate3D())
+   const int MomN  = 1 +   XYZ;
+   const int MomT1 = 1 + ( XYZ + 1 )%3;
+   const int MomT2 = 1 + ( XYZ + 2 )%3;
+
+   const real *Rho_L = L_In[0], *Mn_L = L_In[MomN], *Mt1_L = L_In[MomT1], *Mt2_L = L_In[MomT2], *E_L = L_In[4];
+   const real *Rho_R = R_In[0], *Mn_R = R_In[MomN], *Mt1_R = R_In[MomT1], *Mt2_R = R_In[MomT2], *E_R = R_In[4];
+   real *F_Rho = Flux_Out[0], *F_Mn = Flux_Out[MomN], *F_Mt1 = Flux_Out[MomT1], *F_Mt2 = Flux_Out[MomT2], *F_E = Flux_Out[4];
+
+
+// 1. fluid fluxes
+#  pragma omp simd
+   for (int i=0; i<NFace; i++)
+   {
+//    1-1. compute the left/right states
+      const real _RhoL = ONE / Rho_L[i];
+      const real _RhoR = ONE / Rho_R[i];
+      const real u_L   = _RhoL*Mn_L[i];
+      const real u_R   = _RhoR*Mn_R[i];
+      const real P_L   = Pencil_CheckMinPres(  ( E_L[i] - (real)0.5*( SQR(Mn_L[i]) + SQR(Mt1_L[i]) + SQR(Mt2_L[i]) )/Rho_L[i] )*Gamma_m1,
+                                               MinPres  );
+      const real P_R   = Pencil_CheckMinPres(  ( E_R[i] - (real)0.5*( SQR(Mn_R[i]) + SQR(Mt1_R[i]) + SQR(Mt2_R[i]) )/Rho_R[i] )*Gamma_m1,
+                                               MinPres  );
+      const real Cf_L  = SQRT( Gamma*P_L/Rho_L[i] );
+      const real Cf_R  = SQRT( Gamma*P_R/Rho_R[i] );
+
+//    1-2. use the min/max of the left and right eigenvalues
+      const real MaxV_L = Pencil_Min(  Pencil_Min( u_L-Cf_L, u_R-Cf_R ), ZERO  );
+      const real MaxV_R = Pencil_Max(  Pencil_Max( u_L+Cf_L, u_R+Cf_R ), ZERO  );
+
+//    1-3. evaluate the left and right fluxes along the maximum wave speeds
+      const real Vx_L = _RhoL*Mn_L[i];
+      const real Vx_R = _RhoR*Mn_R[i];
+
+      real Flux_L[NCOMP_FLUID], Flux_R[NCOMP_FLUID];
+
+      Flux_L[0]  = Mn_L[i];
+      Flux_L[1]  = Vx_L*Mn_L[i] + P_L;
+      Flux_L[2]  = Vx_L*Mt1_L[i];
+      Flux_L[3]  = Vx_L*Mt2_L[i];
+      Flux_L[4]  = Vx_L*( E_L[i] + P_L );
+      Flux_L[0] -= MaxV_L*Rho_L[i];
+      Flux_L[1] -= MaxV_L*Mn_L [i];
+      Flux_L[2] -= MaxV_L*Mt1_L[i];
+      Flux_L[3] -= MaxV_L*Mt2_L[i];
+      Flux_L[4] -= MaxV_L*E_L  [i];
+
+      Flux_R[0]  = Mn_R[i];
+      Flux_R[1]  = Vx_R*Mn_R[i] + P_R;
+      Flux_R[2]  = Vx_R*Mt1_R[i];
+      Flux_R[3]  = Vx_R*Mt2_R[i];
+      Flux_R[4]  = Vx_R*( E_R[i] + P_R );
+      Flux_R[0] -= MaxV_R*Rho_R[i];
+      Flux_R[1] -= MaxV_R*Mn_R [i];
+      Flux_R[2] -= MaxV_R*Mt1_R[i];
+      Flux_R[3] -= MaxV_R*Mt2_R[i];
+      Flux_R[4] -= MaxV_R*E_R  [i];
+
+//    1-4. evaluate the HLLE fluxes and restore the correct order
+//    --> special case of MaxV_L=MaxV_R=0
+      const bool Special         = ( (MaxV_L == ZERO) & (MaxV_R == ZERO) );
+      const real _MaxV_R_minus_L = ONE / ( MaxV_R - MaxV_L );
+      real Flux_HLL[NCOMP_FLUID];
+
+      for (int v=0; v<NCOMP_FLUID; v++)
+      {
+         const real Flux_LR = _MaxV_R_minus_L*( MaxV_R*Flux_L[v] - MaxV_L*Flux_R[v] );
+
+         Flux_HLL[v] = ( Special ) ? Flux_L[v] : Flux_LR;
+      }
+
+      F_Rho[i] = Flux_HLL[0];
+      F_Mn [i] = Flux_HLL[1];
+      F_Mt1[i] = Flux_HLL[2];
+      F_Mt2[i] = Flux_HLL[3];
+      F_E  [i] = Flux_HLL[4];
+   } // for (int i=0; i<NFace; i++)
+
+
+// 2. passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp simd
+      for (int i=0; i<NFace; i++)
+      {
+         const real Flux_PL = L_In[v][i]*( F_Rho[i]*(ONE/Rho_L[i]) );
+         const real Flux_PR = R_In[v][i]*( F_Rho[i]*(ONE/Rho_R[i]) );
+
+         Flux_Out[v][i] = ( F_Rho[i] >= ZERO ) ? Flux_PL : Flux_PR;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLE_Pencil
+#endif // #if ( RSOLVER == HLLE )
+
+
+
+#if ( RSOLVER == HLLD )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_HLLD_FastCf2
+// Description :  Fast magnetosonic speed squared for Hydro_RiemannSolver_HLLD_Pencil()
+//
+// Note        :  1. Same floating-point operations as Hydro_RiemannSolver_HLLD()
+//                   --> Conditional branches are replaced by selections
+//
+// Parameter   :  a2   : Sound speed squared
+//                Cax2 : Alfven speed squared along the normal direction
+//                Cat2 : Alfven speed squared along the transverse direction
+//
+// Return      :  Fast magnetosonic speed squared
+//-------------------------------------------------------------------------------------------------------
+static inline real Pencil_HLLD_FastCf2( const real a2, const real Cax2, const real Cat2 )
+{
+
+   const real ZERO        = (real)0.0;
+   const real Ca2_plus_a2 = Cat2 + Cax2 + a2;
+   const real Ca2_min_a2  = Cat2 + Cax2 - a2;
+   const real Cf2_min_Cs2 = SQRT( SQR(Ca2_min_a2) + (real)4.0*a2*Cat2 );
+   const real Cf2_NoBt    = ( Cax2 >= a2 ) ? Cax2 : a2;
+   const real Cf2_Bt      = ( Cax2 == ZERO ) ? a2 + Cat2 : (real)0.5*( Ca2_plus_a2 + Cf2_min_Cs2 );
+
+   return ( Cat2 == ZERO ) ? Cf2_NoBt : Cf2_Bt;
+
+} // FUNCTION : Pencil_HLLD_FastCf2
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil_HLLD_SelectFlux
+// Description :  Select the HLLD flux of the region containing the interface for
+//                Hydro_RiemannSolver_HLLD_Pencil()
+//
+// Note        :  1. Same floating-point operations as Hydro_RiemannSolver_HLLD(), including the supersonic cases
+//                   --> The fluxes of all regions are evaluated and then selected without branching
+//
+// Parameter   :  S_L/R       : Outer wave speeds
+//                S_Lst/Rst   : Alfven wave speeds
+//                S_M         : Contact wave speed
+//                F_L/R       : Flux of the left/right state
+//                C_L/R       : Left/right state
+//                C_Lst/Rst   : Left/right star state
+//                C_Ldst/Rdst : Left/right double-star state
+//
+// Return      :  HLLD flux of one component
+//-------------------------------------------------------------------------------------------------------
+static inline real Pencil_HLLD_SelectFlux( const real S_L, const real S_Lst, const real S_M, const real S_Rst,
+                                           const real S_R, const real F_L, const real F_R, const real C_L,
+                                           const real C_R, const real C_Lst, const real C_Rst,
+                                           const real C_Ldst, const real C_Rdst )
+{
+
+   const real ZERO   = (real)0.0;
+   const real F_Lst  = F_L + S_L*( C_Lst - C_L );
+   const real F_Ldst = F_L - S_L*C_L - ( S_Lst - S_L )*C_Lst + S_Lst*C_Ldst;
+   const real F_Rdst = F_R - S_R*C_R - ( S_Rst - S_R )*C_Rst + S_Rst*C_Rdst;
+   const real F_Rst  = F_R + S_R*( C_Rst - C_R );
+
+   return ( S_L   >= ZERO ) ? F_L    :
+          ( S_R   <= ZERO ) ? F_R    :
+          ( S_Lst >= ZERO ) ? F_Lst  :
+          ( S_M   >= ZERO ) ? F_Ldst :
+          ( S_Rst >  ZERO ) ? F_Rdst :
+                              F_Rst;
+
+} // FUNCTION : Pencil_HLLD_SelectFlux
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLD_Pencil
+// Description :  Vectorizable HLLD Riemann solver for a row of cell faces
+//
+// Note        :  1. Invoked by Hydro_RiemannSolver_Pencil()
+//                2. Same algorithm and floating-point operations as Hydro_RiemannSolver_HLLD() with
+//                   HLL_WAVESPEED_DAVIS and EOS_GAMMA
+//                   --> Keep the two functions consistent
+//                   --> All states (outer, star, and double-star) and all flux regions are evaluated for
+//                       every face, and the results are then selected without branching
+//                   --> Values computed for the unselected regions may be Inf or NaN, which is harmless
+//                3. See Hydro_RiemannSolver_HLLC_Pencil()
+//
+// Parameter   :  See Hydro_RiemannSolver_HLLC_Pencil()
+//
+// Return      :  Flux_Out[][]
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLD_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                      const real *const L_In[], const real *const R_In[],
+                                      const real MinPres, const double EoS_AuxArray_Flt[] )
+{
+
+   const real MaxErr2  = SQR(MAX_ERROR);
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real _TWO     = (real)0.5;
+   const real Gamma    = (real)EoS_AuxArray_Flt[0];
+   const real Gamma_m1 = (real)EoS_AuxArray_Flt[1];
+
+// momentum and magnetic-field indices along the normal and transverse directions (i.e., Hydro_Rotate3D())
+   const int MomN  = 1 +   XYZ;
+   const int MomT1 = 1 + ( XYZ + 1 )%3;
+   const int MomT2 = 1 + ( XYZ + 2 )%3;
+   const int MagN  = MAG_OFFSET +   XYZ;
+   const int MagT1 = MAG_OFFSET + ( XYZ + 1 )%3;
+   const int MagT2 = MAG_OFFSET + ( XYZ + 2 )%3;
+
+   const real *Rho_L = L_In[0], *Mn_L = L_In[MomN], *Mt1_L = L_In[MomT1], *Mt2_L = L_In[MomT2], *E_L = L_In[4];
+   const real *Rho_R = R_In[0], *Mn_R = R_In[MomN], *Mt1_R = R_In[MomT1], *Mt2_R = R_In[MomT2], *E_R = R_In[4];
+   const real *Bn_L  = L_In[MagN], *Bt1_L = L_In[MagT1], *Bt2_L = L_In[MagT2];
+   const real *Bn_R  = R_In[MagN], *Bt1_R = R_In[MagT1], *Bt2_R = R_In[MagT2];
+   real *F_Rho = Flux_Out[0], *F_Mn = Flux_Out[MomN], *F_Mt1 = Flux_Out[MomT1], *F_Mt2 = Flux_Out[MomT2], *F_E = Flux_Out[4];
+   real *F_Bn  = Flux_Out[MagN], *F_Bt1 = Flux_Out[MagT1], *F_Bt2 = Flux_Out[MagT2];
+
+// upwind side of the passive scalars (1/0 --> left/right)
+// --> use int instead of bool so that the passive-scalar loop below can be vectorized together with real
+#  if ( NCOMP_PASSIVE > 0 )
+   int UseL[N_FC_VAR];
+#  endif
+
+
+// 1. fluid and magnetic fluxes
+// --> do not use arrays or loops inside this loop since GNU compilers then fail to vectorize it
+#  pragma omp simd
+   for (int i=0; i<NFace; i++)
+   {
+//    1-1. load the rotated left/right states and compute the primitive variables (i.e., Hydro_Con2Pri())
+      const real RhoL   = Rho_L[i],  RhoR  = Rho_R[i];
+      const real MnL    = Mn_L [i],  MnR   = Mn_R [i];
+      const real Mt1L   = Mt1_L[i],  Mt1R  = Mt1_R[i];
+      const real Mt2L   = Mt2_L[i],  Mt2R  = Mt2_R[i];
+      const real EL     = E_L  [i],  ER    = E_R  [i];
+      const real Bx     = Bn_L [i],  BxR   = Bn_R [i];
+      const real ByL    = Bt1_L[i],  ByR   = Bt1_R[i];
+      const real BzL    = Bt2_L[i],  BzR   = Bt2_R[i];
+
+      const real _RhoL  = ONE/RhoL;
+      const real _RhoR  = ONE/RhoR;
+      const real VxL    = MnL *_RhoL;
+      const real VyL    = Mt1L*_RhoL;
+      const real VzL    = Mt2L*_RhoL;
+      const real VxR    = MnR *_RhoR;
+      const real VyR    = Mt1R*_RhoR;
+      const real VzR    = Mt2R*_RhoR;
+      const real EmagL  = _TWO*( SQR(Bx ) + SQR(ByL) + SQR(BzL) );
+      const real EmagR  = _TWO*( SQR(BxR) + SQR(ByR) + SQR(BzR) );
+      const real PL     = Pencil_CheckMinPres(  ( EL - _TWO*( SQR(MnL) + SQR(Mt1L) + SQR(Mt2L) )/RhoL - EmagL )*Gamma_m1,
+                                                MinPres  );
+      const real PR     = Pencil_CheckMinPres(  ( ER - _TWO*( SQR(MnR) + SQR(Mt1R) + SQR(Mt2R) )/RhoR - EmagR )*Gamma_m1,
+                                                MinPres  );
+
+//    1-2. estimate the outer wave speeds using the min/max left and right fast magnetosonic speeds
+      const real _Bx    = ONE / Bx;
+      const real Bx2    = SQR( Bx );
+      const real _Bx2   = SQR( _Bx );
+      const real BtL2   = SQR( ByL ) + SQR( BzL );
+      const real BtR2   = SQR( ByR ) + SQR( BzR );
+      const real B2L_d2 = _TWO*( Bx2 + BtL2 );
+      const real B2R_d2 = _TWO*( Bx2 + BtR2 );
+      const real PT_L   = PL + B2L_d2;
+      const real PT_R   = PR + B2R_d2;
+      const real Cf_L   = SQRT(  Pencil_HLLD_FastCf2( Gamma*PL/RhoL, Bx2*_RhoL, BtL2*_RhoL )  );
+      const real Cf_R   = SQRT(  Pencil_HLLD_FastCf2( Gamma*PR/RhoR, Bx2*_RhoR, BtR2*_RhoR )  );
+      const real S_L    = Pencil_Min( VxL-Cf_L, VxR-Cf_R );
+      const real S_R    = Pencil_Max( VxL+Cf_L, VxR+Cf_R );
+
+//    1-3. left/right fluxes (i.e., Hydro_Con2Flux())
+      const real FL_Dens = MnL;
+      const real FL_Mx   = VxL*MnL  + PL + ( EmagL - SQR(Bx) );
+      const real FL_My   = VxL*Mt1L - Bx*ByL;
+      const real FL_Mz   = VxL*Mt2L - Bx*BzL;
+      const real FL_Engy = VxL*( EL + PL ) + ( VxL*EmagL - Bx*( Bx*VxL + ByL*VyL + BzL*VzL ) );
+      const real FL_By   = ByL*VxL - Bx*VyL;
+      const real FL_Bz   = BzL*VxL - Bx*VzL;
+      const real FR_Dens = MnR;
+      const real FR_Mx   = VxR*MnR  + PR + ( EmagR - SQR(BxR) );
+      const real FR_My   = VxR*Mt1R - BxR*ByR;
+      const real FR_Mz   = VxR*Mt2R - BxR*BzR;
+      const real FR_Engy = VxR*( ER + PR ) + ( VxR*EmagR - BxR*( BxR*VxR + ByR*VyR + BzR*VzR ) );
+      const real FR_By   = ByR*VxR - BxR*VyR;
+      const real FR_Bz   = BzR*VxR - BxR*VzR;
+
+//    1-4. evaluate the contact wave speed (S_M) and the star states
+//    --> selections replace the branches for a negligible Bx (Weak) and for a vanishing denominator (Degen)
+      const real Sd_L     = S_L - VxL;
+      const real Sd_R     = S_R - VxR;
+      const real tmp_L    = Sd_L*RhoL;
+      const real tmp_R    = Sd_R*RhoR;
+      const real S_M      = ( tmp_R*VxR - tmp_L*VxL - PT_R + PT_L ) / ( tmp_R - tmp_L );
+      const real Sdm_L    = S_L - S_M;
+      const real Sdm_R    = S_R - S_M;
+      const real SdL_SdmL = Sd_L / Sdm_L;
+      const real SdR_SdmR = Sd_R / Sdm_R;
+      const real PT_st    = PT_L + RhoL*Sd_L*( Sd_L - Sdm_L );
+      const real B2min_d2 = Pencil_Min( B2L_d2, B2R_d2 );
+      const bool Weak     = ( B2min_d2 == ZERO ) | ( FABS(_TWO*Bx2/B2min_d2) < MaxErr2 );
+
+      const real crit_L    = ( Weak ) ? RhoL*Sd_L*Sdm_L : RhoL*Sd_L*Sdm_L*_Bx2 - ONE;
+      const real crit_R    = ( Weak ) ? RhoR*Sd_R*Sdm_R : RhoR*Sd_R*Sdm_R*_Bx2 - ONE;
+      const bool Degen_L   = ( FABS(crit_L) < MAX_ERROR );
+      const bool Degen_R   = ( FABS(crit_R) < MAX_ERROR );
+      const real tmpV_L    = ( Sd_L - Sdm_L )*_Bx*( ONE/crit_L );
+      const real tmpV_R    = ( Sd_R - Sdm_R )*_Bx*( ONE/crit_R );
+      const real tmpB_L    = ( RhoL*Sd_L*Sd_L - Bx2 )*_Bx2*( ONE/crit_L );
+      const real tmpB_R    = ( RhoR*Sd_R*Sd_R - Bx2 )*_Bx2*( ONE/crit_R );
+      const real VyL_st    = ( Degen_L | Weak ) ? VyL : VyL - ByL*tmpV_L;
+      const real VzL_st    = ( Degen_L | Weak ) ? VzL : VzL - BzL*tmpV_L;
+      const real VyR_st    = ( Degen_R | Weak ) ? VyR : VyR - ByR*tmpV_R;
+      const real VzR_st    = ( Degen_R | Weak ) ? VzR : VzR - BzR*tmpV_R;
+      const real BFactor_L = ( Degen_L ) ? ONE : ( Weak ) ? SdL_SdmL : tmpB_L;
+      const real BFactor_R = ( Degen_R ) ? ONE : ( Weak ) ? SdR_SdmR : tmpB_R;
+
+      const real Rho_Lst   = RhoL*SdL_SdmL;
+      const real Mx_Lst    = Rho_Lst*S_M;
+      const real My_Lst    = Rho_Lst*VyL_st;
+      const real Mz_Lst    = Rho_Lst*VzL_st;
+      const real By_Lst    = ByL*BFactor_L;
+      const real Bz_Lst    = BzL*BFactor_L;
+      const real VBdot_Lst = ( Mx_Lst*Bx + My_Lst*By_Lst + Mz_Lst*Bz_Lst ) / Rho_Lst;
+      const real E_Lst     = (  Sd_L*EL - PT_L*VxL + PT_st*S_M +
+                                Bx*( VxL*Bx + VyL*ByL + VzL*BzL - VBdot_Lst )  ) / Sdm_L;
+      const real Rho_Rst   = RhoR*SdR_SdmR;
+      const real Mx_Rst    = Rho_Rst*S_M;
+      const real My_Rst    = Rho_Rst*VyR_st;
+      const real Mz_Rst    = Rho_Rst*VzR_st;
+      const real By_Rst    = ByR*BFactor_R;
+      const real Bz_Rst    = BzR*BFactor_R;
+      const real VBdot_Rst = ( Mx_Rst*Bx + My_Rst*By_Rst + Mz_Rst*Bz_Rst ) / Rho_Rst;
+      const real E_Rst     = (  Sd_R*ER - PT_R*VxR + PT_st*S_M +
+                                Bx*( VxR*BxR + VyR*ByR + VzR*BzR - VBdot_Rst )  ) / Sdm_R;
+
+      const real sqrt_RhoLst = SQRT( Rho_Lst );
+      const real sqrt_RhoRst = SQRT( Rho_Rst );
+      const real S_Lst       = S_M - FABS( Bx )/sqrt_RhoLst;
+      const real S_Rst       = S_M + FABS( Bx )/sqrt_RhoRst;
+
+//    1-5. evaluate the double-star states, which are the same as the star states when Bx is negligible
+      const real _Rho_Lst  = ONE/Rho_Lst;
+      const real _Rho_Rst  = ONE/Rho_Rst;
+      const real Vy_Lst    = _Rho_Lst*My_Lst;
+      const real Vz_Lst    = _Rho_Lst*Mz_Lst;
+      const real Vy_Rst    = _Rho_Rst*My_Rst;
+      const real Vz_Rst    = _Rho_Rst*Mz_Rst;
+      const real invsumd   = ONE/( sqrt_RhoLst + sqrt_RhoRst );
+      const real Bxsig     = SIGN( Bx );
+      const real Vy_dst    = invsumd*(  sqrt_RhoLst*Vy_Lst + sqrt_RhoRst*Vy_Rst + Bxsig*( By_Rst - By_Lst )  );
+      const real Vz_dst    = invsumd*(  sqrt_RhoLst*Vz_Lst + sqrt_RhoRst*Vz_Rst + Bxsig*( Bz_Rst - Bz_Lst )  );
+      const real By_dst    = invsumd*(  sqrt_RhoLst*By_Rst + sqrt_RhoRst*By_Lst +
+                                        Bxsig*sqrt_RhoLst*sqrt_RhoRst*( Vy_Rst - Vy_Lst )  );
+      const real Bz_dst    = invsumd*(  sqrt_RhoLst*Bz_Rst + sqrt_RhoRst*Bz_Lst +
+                                        Bxsig*sqrt_RhoLst*sqrt_RhoRst*( Vz_Rst - Vz_Lst )  );
+      const real My_dst    = Rho_Lst*Vy_dst;
+      const real Mz_dst    = Rho_Lst*Vz_dst;
+      const real VBdot_dst = S_M*Bx + ( My_dst*By_dst + Mz_dst*Bz_dst ) / Rho_Lst;
+
+      const real My_Ldst   = ( Weak ) ? My_Lst : My_dst;
+      const real Mz_Ldst   = ( Weak ) ? Mz_Lst : Mz_dst;
+      const real E_Ldst    = ( Weak ) ? E_Lst  : E_Lst - sqrt_RhoLst*Bxsig*( VBdot_Lst - VBdot_dst );
+      const real By_Ldst   = ( Weak ) ? By_Lst : By_dst;
+      const real Bz_Ldst   = ( Weak ) ? Bz_Lst : Bz_dst;
+      const real My_Rdst   = ( Weak ) ? My_Rst : Rho_Rst*Vy_dst;
+      const real Mz_Rdst   = ( Weak ) ? Mz_Rst : Rho_Rst*Vz_dst;
+      const real E_Rdst    = ( Weak ) ? E_Rst  : E_Rst + sqrt_RhoRst*Bxsig*( VBdot_Rst - VBdot_dst );
+      const real By_Rdst   = ( Weak ) ? By_Rst : By_dst;
+      const real Bz_Rdst   = ( Weak ) ? Bz_Rst : Bz_dst;
+
+//    1-6. evaluate the HLLD fluxes and restore the correct order
+      F_Rho[i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_Dens, FR_Dens, RhoL, RhoR,
+                                         Rho_Lst, Rho_Rst, Rho_Lst, Rho_Rst );
+      F_Mn [i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_Mx, FR_Mx, MnL, MnR,
+                                         Mx_Lst, Mx_Rst, Mx_Lst, Mx_Rst );
+      F_Mt1[i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_My, FR_My, Mt1L, Mt1R,
+                                         My_Lst, My_Rst, My_Ldst, My_Rdst );
+      F_Mt2[i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_Mz, FR_Mz, Mt2L, Mt2R,
+                                         Mz_Lst, Mz_Rst, Mz_Ldst, Mz_Rdst );
+      F_E  [i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_Engy, FR_Engy, EL, ER,
+                                         E_Lst, E_Rst, E_Ldst, E_Rdst );
+      F_Bn [i] = ZERO;
+      F_Bt1[i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_By, FR_By, ByL, ByR,
+                                         By_Lst, By_Rst, By_Ldst, By_Rdst );
+      F_Bt2[i] = Pencil_HLLD_SelectFlux( S_L, S_Lst, S_M, S_Rst, S_R, FL_Bz, FR_Bz, BzL, BzR,
+                                         Bz_Lst, Bz_Rst, Bz_Ldst, Bz_Rdst );
+
+//    1-7. use the upwind state for the passive scalars in the supersonic cases as Hydro_Con2Flux() does
+#     if ( NCOMP_PASSIVE > 0 )
+      UseL[i] = (  ( S_L >= ZERO ) | ( !(S_R <= ZERO) & (F_Rho[i] >= ZERO) )  );
+#     endif
+   } // for (int i=0; i<NFace; i++)
+
+
+// 2. passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+      const real *Pas_L = L_In[v], *Pas_R = R_In[v];
+      real *F_Pas = Flux_Out[v];
+
+#     pragma omp simd
+      for (int i=0; i<NFace; i++)
+      {
+         const real Flux_PL = Pas_L[i]*( F_Rho[i]*(ONE/Rho_L[i]) );
+         const real Flux_PR = Pas_R[i]*( F_Rho[i]*(ONE/Rho_R[i]) );
+
+         F_Pas[i] = ( UseL[i] ) ? Flux_PL : Flux_PR;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLD_Pencil
+#endif // #if ( RSOLVER == HLLD )
+
+
+
+#endif // #ifdef RSOLVER_PENCIL
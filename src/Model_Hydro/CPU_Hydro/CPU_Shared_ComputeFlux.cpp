@@ -64,6 +64,11 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
                                const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
                                const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
 #endif
+#ifdef RSOLVER_PENCIL
+void Hydro_RiemannSolver_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                 const real *const L_In[], const real *const R_In[],
+                                 const real MinDens, const real MinPres, const EoS_t *EoS );
+#endif
 
 #endif // #ifdef __CUDACC__ ... else ...
 
@@ -95,6 +100,9 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                                  --> "(N_FC_VAR-1-2*NSkip_N)" fluxes will be computed along the normal direction
 //                NSkip_T         : Number of cells to be skipped in the transverse directions
 //                                  --> "(N_FC_VAR-2*NSkip_T)^2" fluxes will be computed along the transverse direction
+//                k_flux_s/e      : Compute only the fluxes with the z index k in [k_flux_s, k_flux_e) in g_FC_Flux[]
+//                                  --> For sweeping a patch group slab by slab along z (see FLU_CACHE_BLOCK in CUFLU.h)
+//                                  --> Set to 0 and NFlux to compute all the fluxes
 //                CorrHalfVel     : true --> correct the half-step velocity by gravity       (for UNSPLIT_GRAVITY only)
 //                g_Pot_USG       : Array storing the input potential for CorrHalfVel        (for UNSPLIT_GRAVITY only)
 //                g_Corner        : Array storing the corner coordinates of each patch group (for UNSPLIT_GRAVITY only)
@@ -112,6 +120,7 @@ GPU_DEVICE
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
+                        const int k_flux_s, const int k_flux_e,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
                         const real dt, const real dh, const double Time, const bool UsePot,
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
@@ -208,9 +217,41 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                   break;
       }
 
+//    z range of the fluxes to be computed
+      const int k_s = MIN( k_flux_s, idx_flux_e[2] );
+      const int k_e = MIN( k_flux_e, idx_flux_e[2] );
+
+//    solve a row of faces along x at once when the half-step velocity needs no correction
+#     ifdef RSOLVER_PENCIL
+      if ( !CorrHalfVel )
+      {
+         const real *L_Row[NCOMP_TOTAL_PLUS_MAG], *R_Row[NCOMP_TOTAL_PLUS_MAG];
+         real *Flux_Row[NCOMP_TOTAL_PLUS_MAG];
+
+         for (int k_flux=k_s; k_flux<k_e; k_flux++)
+         for (int j_flux=0; j_flux<idx_flux_e[1]; j_flux++)
+         {
+            const int idx_flux0 = IDX321( 0, j_flux, k_flux, NFlux, NFlux );
+            const int idx_fc0   = IDX321( idx_fc_s[0], j_flux+idx_fc_s[1], k_flux+idx_fc_s[2], N_FC_VAR, N_FC_VAR );
+
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+            {
+               L_Row   [v] = g_FC_Var [faceR][v] + idx_fc0;
+               R_Row   [v] = g_FC_Var [faceL][v] + idx_fc0 + didx_fc[d];
+               Flux_Row[v] = g_FC_Flux[d    ][v] + idx_flux0;
+            }
+
+            Hydro_RiemannSolver_Pencil( d, idx_flux_e[0], Flux_Row, L_Row, R_Row, MinDens, MinPres, EoS );
+         }
+
+         continue;
+      } // if ( !CorrHalfVel )
+#     endif // #ifdef RSOLVER_PENCIL
+
       const int size_ij = idx_flux_e[0]*idx_flux_e[1];
-      CGPU_LOOP( idx, idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2] )
+      CGPU_LOOP( idx0, size_ij*(k_e-k_s) )
       {
+         const int idx      = k_s*size_ij + idx0;
          const int i_flux   = idx % idx_flux_e[0];
          const int j_flux   = idx % size_ij / idx_flux_e[0];
          const int k_flux   = idx / size_ij;
@@ -162,6 +162,14 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                                         --> Store internal energy as the last variable when LR_EINT is on
 //                                     --> Useless for PLM
 //                g_EC_Ele           : Array to store the edge-centered electric field at the half step
+//                k_fc_s/e           : Compute g_FC_Var[] only in the z range [k_fc_s, k_fc_e)
+//                                     --> For sweeping a patch group slab by slab along z (see FLU_CACHE_BLOCK
+//                                         in CUFLU.h)
+//                                     --> Primitive variables and slopes are computed only for the cells required
+//                                         by this range but not by the layers below k_fc_s, which must have been
+//                                         computed by the previous invocations
+//                                     --> Set to 0 and N_FC_VAR to compute all the face-centered variables
+//                                         (must be so for MHD)
 //                Con2Pri            : Convert conserved variables in g_ConVar[] to primitive variables and
 //                                     store the results in g_PriVar[]
 //                NIn                : Size of g_PriVar[] along each direction
@@ -191,6 +199,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                      real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                      real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                               const int k_fc_s, const int k_fc_e,
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
                                const real MinDens, const real MinPres, const real MinEint,
@@ -305,8 +314,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real* const EintPtr = NULL;
 #     endif
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+//    z range of the cells required by g_FC_Var[k_fc_s ... k_fc_e-1] but not by g_FC_Var[0 ... k_fc_s-1]
+      const int idx_s = ( ( k_fc_s == 0 ) ? 0 : k_fc_s + 2*NGhost )*SQR( NIn );
+      const int idx_e = ( ( k_fc_e == 0 ) ? 0 : k_fc_e + 2*NGhost )*SQR( NIn );
+
+      CGPU_LOOP( idx0, idx_e-idx_s )
       {
+         const int idx = idx_s + idx0;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
@@ -329,7 +344,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #        ifdef LR_EINT
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
-      } // CGPU_LOOP( idx, CUBE(NIn) )
+      } // CGPU_LOOP( idx0, idx_e-idx_s )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -350,8 +365,9 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    int idx_B[NCOMP_MAG];
 #  endif
 
-   CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   CGPU_LOOP( idx0, (k_fc_e-k_fc_s)*N_FC_VAR2 )
    {
+      const int idx_fc = k_fc_s*N_FC_VAR2 + idx0;
       const int i_cc   = NGhost + idx_fc%N_FC_VAR;
       const int j_cc   = NGhost + idx_fc%N_FC_VAR2/N_FC_VAR;
       const int k_cc   = NGhost + idx_fc/N_FC_VAR2;
@@ -666,7 +682,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
          g_FC_Var[f][v][idx_fc] = fcCon[f][v];
 
-   } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   } // CGPU_LOOP( idx0, (k_fc_e-k_fc_s)*N_FC_VAR2 )
 
 
 #  ifdef __CUDACC__
@@ -676,7 +692,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 #  if ( FLU_SCHEME == MHM  &&  defined MHD )
 // 9. store the half-step primitive variables for MHM+MHD
-//    --> must be done after the CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) ) loop since it will update g_PriVar[]
+//    --> must be done after the data reconstruction loop since it will update g_PriVar[]
    Hydro_ConFC2PriCC_MHM( g_PriVar, g_FC_Var, MinDens, MinPres, MinEint, FracPassive, NFrac, FracIdx,
                           JeansMinPres, JeansMinPres_Coeff, EoS );
 
@@ -703,6 +719,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                      real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                                      real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
                                      real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                               const int k_fc_s, const int k_fc_e,
                                const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh,
                                const real MinDens, const real MinPres, const real MinEint,
@@ -831,8 +848,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real* const EintPtr = NULL;
 #     endif
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+//    z range of the cells required by g_FC_Var[k_fc_s ... k_fc_e-1] but not by g_FC_Var[0 ... k_fc_s-1]
+      const int idx_s = ( ( k_fc_s == 0 ) ? 0 : k_fc_s + 2*NGhost )*SQR( NIn );
+      const int idx_e = ( ( k_fc_e == 0 ) ? 0 : k_fc_e + 2*NGhost )*SQR( NIn );
+
+      CGPU_LOOP( idx0, idx_e-idx_s )
       {
+         const int idx = idx_s + idx0;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
@@ -855,7 +878,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #        ifdef LR_EINT
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
-      } // CGPU_LOOP( idx, CUBE(NIn) )
+      } // CGPU_LOOP( idx0, idx_e-idx_s )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -867,8 +890,13 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    const int N_SLOPE_PPM2 = SQR( N_SLOPE_PPM );
    if ( LR_Limiter != LR_LIMITER_ATHENA )
    {
-      CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+//    z range of the slopes required by g_FC_Var[k_fc_s ... k_fc_e-1] but not by g_FC_Var[0 ... k_fc_s-1]
+      const int idx_s = ( ( k_fc_s == 0 ) ? 0 : k_fc_s + N_SLOPE_PPM - N_FC_VAR )*N_SLOPE_PPM2;
+      const int idx_e = ( ( k_fc_e == 0 ) ? 0 : k_fc_e + N_SLOPE_PPM - N_FC_VAR )*N_SLOPE_PPM2;
+
+      CGPU_LOOP( idx0, idx_e-idx_s )
       {
+         const int idx_slope = idx_s + idx0;
          const int i_cc   = NGhost - 1 + idx_slope%N_SLOPE_PPM;
          const int j_cc   = NGhost - 1 + idx_slope%N_SLOPE_PPM2/N_SLOPE_PPM;
          const int k_cc   = NGhost - 1 + idx_slope/N_SLOPE_PPM2;
@@ -902,7 +930,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
             for (int v=0; v<NCOMP_LR; v++)   g_Slope_PPM[d][v][idx_slope] = Slope_Limiter[v];
 
          } // for (int d=0; d<3; d++)
-      } // CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+      } // CGPU_LOOP( idx0, idx_e-idx_s )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -924,8 +952,9 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    int idx_B[NCOMP_MAG];
 #  endif
 
-   CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   CGPU_LOOP( idx0, (k_fc_e-k_fc_s)*N_FC_VAR2 )
    {
+      const int idx_fc    = k_fc_s*N_FC_VAR2 + idx0;
       const int i_fc      = idx_fc%N_FC_VAR;
       const int j_fc      = idx_fc%N_FC_VAR2/N_FC_VAR;
       const int k_fc      = idx_fc/N_FC_VAR2;
@@ -1371,7 +1400,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
          g_FC_Var[f][v][idx_fc] = fcCon[f][v];
 
-   } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   } // CGPU_LOOP( idx0, (k_fc_e-k_fc_s)*N_FC_VAR2 )
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -1379,7 +1408,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 #  if ( FLU_SCHEME == MHM  &&  defined MHD )
 // 9. Store the half-step primitive variables for MHM+MHD
-//    --> must be done after the CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) ) loop since it will update g_PriVar[]
+//    --> must be done after the data reconstruction loop since it will update g_PriVar[]
    Hydro_ConFC2PriCC_MHM( g_PriVar, g_FC_Var, MinDens, MinPres, MinEint, FracPassive, NFrac, FracIdx,
                           JeansMinPres, JeansMinPres_Coeff, EoS );
 
@@ -1471,8 +1500,8 @@ void Hydro_Pri2Char( real InOut[], const real Dens, const real Pres, const real
 
 // b. pure hydro
 #  else // #ifdef MHD
-   const real  a2 = EoS->DensPres2CSqr_FuncPtr( Dens, Pres, Passive, EoS->AuxArrayDevPtr_Flt,
-                                                EoS->AuxArrayDevPtr_Int, EoS->Table );
+   const real  a2 = EoS_DensPres2CSqr_Inline( EoS->DensPres2CSqr_FuncPtr, Dens, Pres, Passive,
+                                              EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
    const real _a2 = (real)1.0 / a2;
    const real _a  = SQRT( _a2 );
 
@@ -1541,8 +1570,8 @@ void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, const real
 
 
 // primitive --> characteristic
-   const real a2 = EoS->DensPres2CSqr_FuncPtr( Dens, Pres, Passive, EoS->AuxArrayDevPtr_Flt,
-                                               EoS->AuxArrayDevPtr_Int, EoS->Table );
+   const real a2 = EoS_DensPres2CSqr_Inline( EoS->DensPres2CSqr_FuncPtr, Dens, Pres, Passive,
+                                             EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
 
 // a. MHD
 #  ifdef MHD
@@ -1637,8 +1666,8 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 
    const real  Rho = CC_Var[0];
    const real _Rho = (real)1.0/Rho;
-   const real  a2  = EoS->DensPres2CSqr_FuncPtr( Rho, CC_Var[4], Passive, EoS->AuxArrayDevPtr_Flt,
-                                                 EoS->AuxArrayDevPtr_Int, EoS->Table );
+   const real  a2  = EoS_DensPres2CSqr_Inline( EoS->DensPres2CSqr_FuncPtr, Rho, CC_Var[4], Passive,
+                                               EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
    const real  a   = SQRT( a2 );
    const real _a   = (real)1.0/a;
    const real _a2  = _a*_a;
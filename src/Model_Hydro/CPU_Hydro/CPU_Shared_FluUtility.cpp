@@ -276,7 +276,8 @@ void Hydro_Con2Pri( const real In[], real Out[], const real MinPres,
 
 //    recompute internal energy to be consistent with the updated pressure
       if ( EintOut != NULL  &&  Out[4] != Pres0 )
-         *EintOut = EoS_DensPres2Eint( Out[0], Out[4], In+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+         *EintOut = EoS_DensPres2Eint_Inline( EoS_DensPres2Eint, Out[0], Out[4], In+NCOMP_FLUID,
+                                              EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
    }
 #  endif // #ifdef SRHD ... else ...
 
@@ -410,8 +411,8 @@ void Hydro_Pri2Con( const real In[], real Out[], const bool FracPassive,
    const real Bz = In[ MAG_OFFSET + 2 ];
    Emag   = (real)0.5*( SQR(Bx) + SQR(By) + SQR(Bz) );
 #  endif
-   Eint   = ( EintIn == NULL ) ? EoS_DensPres2Eint( In[0], In[4], Out+NCOMP_FLUID, EoS_AuxArray_Flt,
-                                                    EoS_AuxArray_Int, EoS_Table )
+   Eint   = ( EintIn == NULL ) ? EoS_DensPres2Eint_Inline( EoS_DensPres2Eint, In[0], In[4], Out+NCOMP_FLUID,
+                                                           EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )
                                : *EintIn;
    Out[4] = Hydro_ConEint2Etot( Out[0], Out[1], Out[2], Out[3], Eint, Emag );
 
@@ -936,8 +937,8 @@ bool Hydro_IsUnphysical( const IsUnphyMode_t Mode, const real Fields[], const ch
 //       --> for trivial EoS like EOS_GAMMA, checking internal energy is sufficient and pressure can be
 //           slightly negative if it's within machine precision
 #        if ( EOS != EOS_GAMMA )
-         const real Pres = EoS_DensEint2Pres( Fields[DENS], Eint, Fields+NCOMP_FLUID,
-                                              EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+         const real Pres = EoS_DensEint2Pres_Inline( EoS_DensEint2Pres, Fields[DENS], Eint, Fields+NCOMP_FLUID,
+                                                     EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
          if ( Pres < (real)0.0  ||  Pres > HUGE_NUMBER  ||  Pres != Pres )
             UnphyCell = true;
@@ -1159,7 +1160,8 @@ real Hydro_Con2Pres( const real Dens, const real MomX, const real MomY, const re
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag,
                           NULL, NULL, NULL, NULL, NULL );
-   Pres = EoS_DensEint2Pres( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Pres = EoS_DensEint2Pres_Inline( EoS_DensEint2Pres, Dens, Eint, Passive,
+                                    EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
    if ( CheckMinPres )   Pres = Hydro_CheckMinPres( Pres, MinPres );
 
@@ -1396,7 +1398,8 @@ real Hydro_Con2Temp( const real Dens, const real MomX, const real MomY, const re
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag,
                           NULL, NULL, NULL, NULL, NULL );
-   Temp = EoS_DensEint2Temp( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Temp = EoS_DensEint2Temp_Inline( EoS_DensEint2Temp, Dens, Eint, Passive,
+                                    EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 #  endif // #ifdef SRHD ... else ...
 
    if ( CheckMinTemp )   Temp = Hydro_CheckMinTemp( Temp, MinTemp );
@@ -1469,7 +1472,8 @@ real Hydro_Con2Entr( const real Dens, const real MomX, const real MomY, const re
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag,
                           NULL, NULL, NULL, NULL, NULL );
-   Entr = EoS_DensEint2Entr( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Entr = EoS_DensEint2Entr_Inline( EoS_DensEint2Entr, Dens, Eint, Passive,
+                                    EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
    if ( CheckMinEntr )   Entr = Hydro_CheckMinEntr( Entr, MinEntr );
 
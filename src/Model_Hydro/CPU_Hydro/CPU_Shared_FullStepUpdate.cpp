@@ -42,6 +42,9 @@
 //                g_Flux            : Array storing the input face-centered fluxes
 //                                    --> Accessed with the array stride N_FL_FLUX even thought its actually
 //                                        allocated size is N_FC_FLUX^3
+//                k_out_s/e         : Update only the cells with the z index k in [k_out_s, k_out_e) in g_Output[]
+//                                    --> For sweeping a patch group slab by slab along z (see FLU_CACHE_BLOCK in CUFLU.h)
+//                                    --> Set to 0 and PS2 to update all the cells
 //                dt                : Time interval to advance solution
 //                dh                : Cell size
 //                MinDens/Eint      : Density and internal energy floors
@@ -62,6 +65,7 @@
 GPU_DEVICE
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const int k_out_s, const int k_out_e,
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
                            const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter )
@@ -77,8 +81,9 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 
 
    const int size_ij = SQR(PS2);
-   CGPU_LOOP( idx_out, CUBE(PS2) )
+   CGPU_LOOP( idx0, size_ij*(k_out_e-k_out_s) )
    {
+      const int idx_out  = k_out_s*size_ij + idx0;
       const int i_out    = idx_out % PS2;
       const int j_out    = idx_out % size_ij / PS2;
       const int k_out    = idx_out / size_ij;
@@ -224,7 +229,7 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
          }
 #        endif
       } // if ( s_FullStepFailure != NULL )
-   } // CGPU_LOOP( idx_out, CUBE(PS2) )
+   } // CGPU_LOOP( idx0, size_ij*(k_out_e-k_out_s) )
 
 
 // 6. synchronize s_FullStepFailure for all threads within a GPU thread block
@@ -100,7 +100,8 @@ void CPU_dtSolver_HydroCFL  ( real g_dt_Array[], const real g_Flu_Array[][FLU_NI
                         EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table, NULL, &LorentzFactor );
          Rho   = Pri[0];
          Pres  = Pri[4];
-         a2    = EoS.DensPres2CSqr_FuncPtr( Rho, Pres, fluid+NCOMP_FLUID, EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table ); // sound speed squared
+         a2    = EoS_DensPres2CSqr_Inline( EoS.DensPres2CSqr_FuncPtr, Rho, Pres, fluid+NCOMP_FLUID,
+                                           EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table ); // sound speed squared
 
 #        else // #ifdef SRHD
 
@@ -132,8 +133,8 @@ void CPU_dtSolver_HydroCFL  ( real g_dt_Array[], const real g_Flu_Array[][FLU_NI
                                 CheckMinPres_Yes, MinPres, Emag,
                                 EoS.DensEint2Pres_FuncPtr, EoS.GuessHTilde_FuncPtr, EoS.HTilde2Temp_FuncPtr,
                                 EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table, NULL );
-         a2   = EoS.DensPres2CSqr_FuncPtr( fluid[DENS], Pres, fluid+NCOMP_FLUID, EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int,
-                                           EoS.Table ); // sound speed squared
+         a2   = EoS_DensPres2CSqr_Inline( EoS.DensPres2CSqr_FuncPtr, fluid[DENS], Pres, fluid+NCOMP_FLUID,
+                                          EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table ); // sound speed squared
 #        endif // #ifdef SRHD ... else ...
 
 //       compute the maximum information propagating speed
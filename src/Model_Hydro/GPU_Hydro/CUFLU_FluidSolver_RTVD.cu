@@ -203,8 +203,8 @@ __device__ void CUFLU_Advance( real g_Fluid_In [][5][ CUBE(FLU_NXT) ],
                           TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
                           ERROR_INFO, UNPHY_VERBOSE );
 #     endif
-      c    = FABS( vx ) + SQRT(  EoS->DensPres2CSqr_FuncPtr( Fluid[0], p, Passive, EoS->AuxArrayDevPtr_Flt,
-                                                             EoS->AuxArrayDevPtr_Int, EoS->Table )  );
+      c    = FABS( vx ) + SQRT(  EoS_DensPres2CSqr_Inline( EoS->DensPres2CSqr_FuncPtr, Fluid[0], p, Passive,
+                                                           EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table )  );
 
       s_cw[ty][0][i] = Fluid[1];
       s_cw[ty][1][i] = Fluid[1]*vx + p;
@@ -267,8 +267,8 @@ __device__ void CUFLU_Advance( real g_Fluid_In [][5][ CUBE(FLU_NXT) ],
                              ERROR_INFO, UNPHY_VERBOSE );
 #        endif
 
-         c    = FABS( vx ) + SQRT(  EoS->DensPres2CSqr_FuncPtr( Fluid_half[0], p, Passive, EoS->AuxArrayDevPtr_Flt,
-                                                                EoS->AuxArrayDevPtr_Int, EoS->Table )  );
+         c    = FABS( vx ) + SQRT(  EoS_DensPres2CSqr_Inline( EoS->DensPres2CSqr_FuncPtr, Fluid_half[0], p, Passive,
+                                                              EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table )  );
 
          s_cw[ty][0][i] = Fluid_half[1];
          s_cw[ty][1][i] = Fluid_half[1]*vx + p;
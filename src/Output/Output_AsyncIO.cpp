@@ -0,0 +1,266 @@
+#ifdef SUPPORT_HDF5
+
+#include "GAMER.h"
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+
+// data blocks staged in memory and waiting to be written to disk
+struct AsyncIO_Block_t
+{
+   char *Data;
+   long  Size;
+   long  FileOffset;
+};
+
+static char             AsyncIO_FileName[MAX_STRING];
+static AsyncIO_Block_t *AsyncIO_Block       = NULL;
+static int              AsyncIO_NBlock      = 0;
+static int              AsyncIO_NBlockAlloc = 0;
+static long             AsyncIO_StagedSize  = 0;
+static bool             AsyncIO_Running     = false;
+static int              AsyncIO_ErrNo       = 0;
+static pthread_t        AsyncIO_Thread;
+
+static int   WriteBlock( const int FileDes, const char *Data, const long Size, const long FileOffset );
+static void *AsyncIO_Drain( void *Arg );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_AsyncIO_Begin
+// Description :  Start staging the data of a new snapshot for the asynchronous output
+//
+// Note        :  1. Invoked by Output_DumpData_Total_HDF5() when OPT__OUTPUT_HDF5_ASYNC is on
+//                2. Wait until the previous snapshot, if any, has been written to disk
+//                   --> Guarantee that snapshots are written in order and at most one snapshot
+//                       is staged at a time
+//                3. The target file must have been created in advance by other routines
+//                   --> Only the raw data of pre-allocated datasets are written here
+//
+// Parameter   :  FileName : Name of the target file
+//-------------------------------------------------------------------------------------------------------
+void Output_AsyncIO_Begin( const char *FileName )
+{
+
+   Output_AsyncIO_Wait();
+
+   if ( strlen(FileName) >= MAX_STRING )
+      Aux_Error( ERROR_INFO, "length of the file name (%d) >= MAX_STRING (%d) !!\n", strlen(FileName), MAX_STRING );
+
+   strcpy( AsyncIO_FileName, FileName );
+
+   AsyncIO_NBlock     = 0;
+   AsyncIO_StagedSize = 0;
+
+} // FUNCTION : Output_AsyncIO_Begin
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_AsyncIO_Stage
+// Description :  Copy a data block to the staging buffer, which will be written to the target file
+//                by the background I/O thread after calling Output_AsyncIO_Launch()
+//
+// Note        :  1. Data are copied so the input array can be freed or reused immediately after return
+//                2. Backpressure: if the total staged size would exceed OUTPUT_HDF5_ASYNC_MAX_MEM (in MB),
+//                   the block is written to disk synchronously instead
+//                3. Must be called between Output_AsyncIO_Begin() and Output_AsyncIO_Launch()
+//
+// Parameter   :  Data       : Data block to be written
+//                Size       : Size of the data block in bytes
+//                FileOffset : Offset in the target file in bytes
+//-------------------------------------------------------------------------------------------------------
+void Output_AsyncIO_Stage( const void *Data, const long Size, const long FileOffset )
+{
+
+   if ( Size <= 0 )  return;
+
+   if ( AsyncIO_Running )
+      Aux_Error( ERROR_INFO, "cannot stage data while the background I/O thread is running !!\n" );
+
+   if ( FileOffset < 0 )
+      Aux_Error( ERROR_INFO, "incorrect file offset (%ld) for the file \"%s\" !!\n", FileOffset, AsyncIO_FileName );
+
+
+// write the data synchronously if the staging buffer is full
+   const double MaxSize = OUTPUT_HDF5_ASYNC_MAX_MEM*1024.0*1024.0;
+
+   if ( MaxSize > 0.0  &&  (double)( AsyncIO_StagedSize + Size ) > MaxSize )
+   {
+      const int FileDes = open( AsyncIO_FileName, O_WRONLY );
+      if ( FileDes < 0 )   Aux_Error( ERROR_INFO, "failed to open the file \"%s\" !!\n", AsyncIO_FileName );
+
+      const int ErrNo = WriteBlock( FileDes, (const char*)Data, Size, FileOffset );
+      if ( ErrNo != 0 )
+         Aux_Error( ERROR_INFO, "failed to write to the file \"%s\" (%s) !!\n", AsyncIO_FileName, strerror(ErrNo) );
+
+      close( FileDes );
+
+      return;
+   }
+
+
+// copy the data block to the staging buffer
+   if ( AsyncIO_NBlock >= AsyncIO_NBlockAlloc )
+   {
+      AsyncIO_NBlockAlloc = ( AsyncIO_NBlockAlloc == 0 ) ? 64 : 2*AsyncIO_NBlockAlloc;
+      AsyncIO_Block       = (AsyncIO_Block_t*)realloc( AsyncIO_Block, AsyncIO_NBlockAlloc*sizeof(AsyncIO_Block_t) );
+
+      if ( AsyncIO_Block == NULL )  Aux_Error( ERROR_INFO, "failed to allocate the staging list !!\n" );
+   }
+
+   AsyncIO_Block_t *Block = AsyncIO_Block + AsyncIO_NBlock;
+
+   Block->Data       = (char*)malloc( Size );
+   Block->Size       = Size;
+   Block->FileOffset = FileOffset;
+
+   if ( Block->Data == NULL )
+      Aux_Error( ERROR_INFO, "failed to allocate %ld bytes for the staging buffer !!\n", Size );
+
+   memcpy( Block->Data, Data, Size );
+
+   AsyncIO_NBlock     ++;
+   AsyncIO_StagedSize += Size;
+
+} // FUNCTION : Output_AsyncIO_Stage
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_AsyncIO_Launch
+// Description :  Launch the background I/O thread to write all staged data blocks to disk
+//
+// Note        :  1. Return immediately so that the evolution can continue while the data are being written
+//                2. The thread also calls fsync() to make sure that all data are on disk when it finishes,
+//                   including those written synchronously by Output_AsyncIO_Stage()
+//                3. The background thread does not invoke any MPI or HDF5 routine
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Output_AsyncIO_Launch()
+{
+
+   if ( AsyncIO_Running )
+      Aux_Error( ERROR_INFO, "the background I/O thread is already running !!\n" );
+
+   AsyncIO_ErrNo = 0;
+
+   if ( pthread_create( &AsyncIO_Thread, NULL, AsyncIO_Drain, NULL ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to create the background I/O thread !!\n" );
+
+   AsyncIO_Running = true;
+
+} // FUNCTION : Output_AsyncIO_Launch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_AsyncIO_Wait
+// Description :  Wait until the background I/O thread, if any, has written all staged data to disk
+//
+// Note        :  1. Invoked before staging the next snapshot and by End_GAMER()
+//                2. Do nothing if there is no running thread
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Output_AsyncIO_Wait()
+{
+
+   if ( !AsyncIO_Running )    return;
+
+   if ( pthread_join( AsyncIO_Thread, NULL ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to join the background I/O thread !!\n" );
+
+   AsyncIO_Running = false;
+
+   if ( AsyncIO_ErrNo != 0 )
+      Aux_Error( ERROR_INFO, "failed to write the file \"%s\" in the background (%s) !!\n",
+                 AsyncIO_FileName, strerror(AsyncIO_ErrNo) );
+
+} // FUNCTION : Output_AsyncIO_Wait
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AsyncIO_Drain
+// Description :  Routine executed by the background I/O thread
+//
+// Note        :  1. Write all staged blocks, flush the file to disk, and free the staging buffers
+//                2. Errors are recorded in AsyncIO_ErrNo and reported by Output_AsyncIO_Wait()
+//                   since Aux_Error() is not thread-safe
+//
+// Parameter   :  Arg : Useless (required by pthread_create())
+//-------------------------------------------------------------------------------------------------------
+void *AsyncIO_Drain( void *Arg )
+{
+
+   const int FileDes = open( AsyncIO_FileName, O_WRONLY );
+
+   if ( FileDes < 0 )   AsyncIO_ErrNo = errno;
+
+   for (int b=0; b<AsyncIO_NBlock; b++)
+   {
+      if ( AsyncIO_ErrNo == 0 )
+         AsyncIO_ErrNo = WriteBlock( FileDes, AsyncIO_Block[b].Data, AsyncIO_Block[b].Size, AsyncIO_Block[b].FileOffset );
+
+      free( AsyncIO_Block[b].Data );
+   }
+
+   if ( FileDes >= 0 )
+   {
+      if ( fsync(FileDes) != 0  &&  AsyncIO_ErrNo == 0 )    AsyncIO_ErrNo = errno;
+      if ( close(FileDes) != 0  &&  AsyncIO_ErrNo == 0 )    AsyncIO_ErrNo = errno;
+   }
+
+   AsyncIO_NBlock     = 0;
+   AsyncIO_StagedSize = 0;
+
+   return NULL;
+
+} // FUNCTION : AsyncIO_Drain
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteBlock
+// Description :  Write a data block to the target offset of a file
+//
+// Note        :  1. pwrite() may write fewer bytes than requested, so repeat until all bytes are written
+//
+// Parameter   :  FileDes    : File descriptor
+//                Data       : Data block to be written
+//                Size       : Size of the data block in bytes
+//                FileOffset : Offset in the file in bytes
+//
+// Return      :  0 on success and errno otherwise
+//-------------------------------------------------------------------------------------------------------
+int WriteBlock( const int FileDes, const char *Data, const long Size, const long FileOffset )
+{
+
+   long NDone = 0;
+
+   while ( NDone < Size )
+   {
+      const ssize_t NWrite = pwrite( FileDes, Data+NDone, Size-NDone, FileOffset+NDone );
+
+      if ( NWrite < 0 )
+      {
+         if ( errno == EINTR )   continue;
+         else                    return errno;
+      }
+
+      NDone += NWrite;
+   }
+
+   return 0;
+
+} // FUNCTION : WriteBlock
+
+
+
+#endif // #ifdef SUPPORT_HDF5
@@ -9,6 +9,9 @@
 static void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *PS_total, double *NormDC );
 
 extern root_fftw::real_plan_nd     FFTW_Plan_PS;
+#ifdef SUPPORT_FFTW_PENCIL
+extern FFTW_Pencil_t               FFTW_Pencil_PS;
+#endif
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Output_BasePowerSpectrum
@@ -35,77 +38,14 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
    const int Nx_Padded   = NX0_TOT[0]/2+1;
    const int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
-// get the array indices using by FFTW
-   mpi_index_int local_nx, local_ny, local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
-
-// note: total_local_size is NOT necessarily equal to local_nx*local_ny*local_nz
-   local_nx = 2*( FFT_Size[0]/2 + 1 );
-   local_ny = FFT_Size[1];
-
-#  ifdef SERIAL
-   local_nz                      = FFT_Size[2];
-   local_z_start                 = 0;
-   local_ny_after_transpose      = NULL_INT;
-   local_y_start_after_transpose = NULL_INT;
-   total_local_size              = local_nx*local_ny*local_nz;
-#  else // # ifdef SERIAL
-#  if ( SUPPORT_FFTW == FFTW3 )
-   total_local_size = fftw_mpi_local_size_3d_transposed( FFT_Size[2], local_ny, local_nx, MPI_COMM_WORLD,
-                           &local_nz, &local_z_start, &local_ny_after_transpose, &local_y_start_after_transpose );
-#  else // # if ( SUPPORT_FFTW == FFTW3 )
-   rfftwnd_mpi_local_sizes( FFTW_Plan_PS, &local_nz, &local_z_start, &local_ny_after_transpose,
-                            &local_y_start_after_transpose, &total_local_size );
-#  endif // #  if ( SUPPORT_FFTW == FFTW3 ) ... # else
-#  endif // #  ifdef SERIAL ... # else
-
-// check integer overflow (assuming local_nx*local_ny*local_nz ~ total_local_size)
-   const long local_nxyz = (long)local_nx*(long)local_ny*(long)local_nz;
-
-   if ( local_nx < 0 || local_ny < 0 || local_nz < 0 )
-      Aux_Error( ERROR_INFO, "local_nx/y/z (%ld, %ld, %ld) < 0 for FFT !!", local_nx, local_ny, local_nz );
-
-   if (  ( sizeof(mpi_index_int) == sizeof(int) && local_nxyz > __INT_MAX__ )  ||  total_local_size < 0  )
-      Aux_Error( ERROR_INFO, "local_nx*local_ny*local_nz = %d*%d*%d = %ld > __INT_MAX__ (%d)\n"
-                     "        and/or total_local_size (%ld) < 0 for FFT, suggesting integer overflow !!\n"
-                     "        --> Try using more MPI processes\n",
-                 local_nx, local_ny, local_nz, local_nxyz, __INT_MAX__, total_local_size );
-
-// collect "local_nz" from all ranks and set the corresponding list "List_z_start"
-   int List_nz     [MPI_NRank  ];   // slab thickness of each rank in the FFTW slab decomposition
-   int List_z_start[MPI_NRank+1];   // starting z coordinate of each rank in the FFTW slab decomposition
-
-   const int local_nz_int = local_nz;  // necessary since "mpi_index_int" maps to "long int" for FFTW3
-   MPI_Allgather( &local_nz_int, 1, MPI_INT, List_nz, 1, MPI_INT, MPI_COMM_WORLD );
-
-   List_z_start[0] = 0;
-   for (int r=0; r<MPI_NRank; r++)  List_z_start[r+1] = List_z_start[r] + List_nz[r];
-
-   if ( List_z_start[MPI_NRank] != FFT_Size[2] )
-      Aux_Error( ERROR_INFO, "List_z_start[%d] (%d) != expectation (%d) !!\n",
-                 MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
-
-
-// 2. allocate memory
-   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
-
-   double *PS_total     = NULL;
-   real   *VarK         = (real*) root_fftw::fft_malloc(sizeof(real) * total_local_size); // array storing data
-   real   *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];            // MPI send buffer for data
-   real   *RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];            // MPI recv buffer for data
-   long   *SendBuf_SIdx = new long [ (long)amr->NPatchComma[0][1]*PS1 ];                  // MPI send buffer for 1D coordinate in slab
-   long   *RecvBuf_SIdx = new long [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];   // MPI recv buffer for 1D coordinate in slab
-
-   int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
-   int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
-   long  List_NSend  [MPI_NRank];   // size of data sent to each rank
-   long  List_NRecv  [MPI_NRank];   // size of data received from each rank
    const bool ForPoisson  = false;  // preparing the density field for the Poisson solver
    const bool InPlacePad  = true;   // pad the array for in-place real-to-complex FFT
+   double    *PS_total    = NULL;
 
    if ( MPI_Rank == 0 )    PS_total = new double [Nx_Padded];
 
 
-// 3. initialize the particle density array (rho_ext) and collect particles to the target level
+// 2. initialize the particle density array (rho_ext) and collect particles to the target level
 #  ifdef MASSIVE_PARTICLES
    const bool TimingSendPar_No = false;
    const bool JustCountNPar_No = false;
@@ -128,17 +68,118 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
 #  endif // #ifdef MASSIVE_PARTICLES
 
 
-// 4. rearrange data from patch to slab
-   Patch2Slab( VarK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv, List_z_start,
-               local_nz, FFT_Size, NRecvSlice, Time[0], TVar, InPlacePad, ForPoisson, false );
+// 3. rearrange data from patch to pencil/slab and evaluate the base-level power spectrum by FFT
+   double NormDC;  // to record the FFT DC value used for normalization
+
+// 3-1. pencil decomposition for OPT__FFTW_PENCIL
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )
+   {
+      real *VarK = (real*) root_fftw::fft_malloc( sizeof(real)*MAX(FFTW_Pencil_PS.total_local_size,1L) );
 
+//    rearrange data from patch to pencil
+      Patch2Pencil( VarK, FFTW_Pencil_PS, Time[0], TVar, ForPoisson, false );
+
+//    evaluate the base-level power spectrum by FFT
+      GetBasePowerSpectrum( VarK, NULL_INT, NULL_INT, PS_total, &NormDC );
+
+      root_fftw::fft_free(VarK);
+   }
+
+   else
+#  endif // #ifdef SUPPORT_FFTW_PENCIL
+// 3-2. slab decomposition
+   {
+//    get the array indices using by FFTW
+      mpi_index_int local_nx, local_ny, local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
+
+//    note: total_local_size is NOT necessarily equal to local_nx*local_ny*local_nz
+      local_nx = 2*( FFT_Size[0]/2 + 1 );
+      local_ny = FFT_Size[1];
+
+#     ifdef SERIAL
+      local_nz                      = FFT_Size[2];
+      local_z_start                 = 0;
+      local_ny_after_transpose      = NULL_INT;
+      local_y_start_after_transpose = NULL_INT;
+      total_local_size              = local_nx*local_ny*local_nz;
+#     else // # ifdef SERIAL
+#     if ( SUPPORT_FFTW == FFTW3 )
+      total_local_size = fftw_mpi_local_size_3d_transposed( FFT_Size[2], local_ny, local_nx, MPI_COMM_WORLD,
+                              &local_nz, &local_z_start, &local_ny_after_transpose, &local_y_start_after_transpose );
+#     else // # if ( SUPPORT_FFTW == FFTW3 )
+      rfftwnd_mpi_local_sizes( FFTW_Plan_PS, &local_nz, &local_z_start, &local_ny_after_transpose,
+                               &local_y_start_after_transpose, &total_local_size );
+#     endif // #  if ( SUPPORT_FFTW == FFTW3 ) ... # else
+#     endif // #  ifdef SERIAL ... # else
+
+//    check integer overflow (assuming local_nx*local_ny*local_nz ~ total_local_size)
+      const long local_nxyz = (long)local_nx*(long)local_ny*(long)local_nz;
+
+      if ( local_nx < 0 || local_ny < 0 || local_nz < 0 )
+         Aux_Error( ERROR_INFO, "local_nx/y/z (%ld, %ld, %ld) < 0 for FFT !!", local_nx, local_ny, local_nz );
+
+      if (  ( sizeof(mpi_index_int) == sizeof(int) && local_nxyz > __INT_MAX__ )  ||  total_local_size < 0  )
+         Aux_Error( ERROR_INFO, "local_nx*local_ny*local_nz = %d*%d*%d = %ld > __INT_MAX__ (%d)\n"
+                        "        and/or total_local_size (%ld) < 0 for FFT, suggesting integer overflow !!\n"
+                        "        --> Try using more MPI processes\n",
+                    local_nx, local_ny, local_nz, local_nxyz, __INT_MAX__, total_local_size );
+
+//    collect "local_nz" from all ranks and set the corresponding list "List_z_start"
+      int List_nz     [MPI_NRank  ];   // slab thickness of each rank in the FFTW slab decomposition
+      int List_z_start[MPI_NRank+1];   // starting z coordinate of each rank in the FFTW slab decomposition
+
+      const int local_nz_int = local_nz;  // necessary since "mpi_index_int" maps to "long int" for FFTW3
+      MPI_Allgather( &local_nz_int, 1, MPI_INT, List_nz, 1, MPI_INT, MPI_COMM_WORLD );
+
+      List_z_start[0] = 0;
+      for (int r=0; r<MPI_NRank; r++)  List_z_start[r+1] = List_z_start[r] + List_nz[r];
+
+      if ( List_z_start[MPI_NRank] != FFT_Size[2] )
+         Aux_Error( ERROR_INFO, "List_z_start[%d] (%d) != expectation (%d) !!\n",
+                    MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
+
+
+//    allocate memory
+      const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+
+      real *VarK         = (real*) root_fftw::fft_malloc(sizeof(real) * total_local_size); // array storing data
+      real *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];            // MPI send buffer for data
+      real *RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];            // MPI recv buffer for data
+      long *SendBuf_SIdx = new long [ (long)amr->NPatchComma[0][1]*PS1 ];                  // MPI send buffer for 1D coordinate in slab
+      long *RecvBuf_SIdx = new long [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];   // MPI recv buffer for 1D coordinate in slab
+
+      int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
+      int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
+      long  List_NSend  [MPI_NRank];   // size of data sent to each rank
+      long  List_NRecv  [MPI_NRank];   // size of data received from each rank
+
+
+//    rearrange data from patch to slab
+      Patch2Slab( VarK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv, List_z_start,
+                  local_nz, FFT_Size, NRecvSlice, Time[0], TVar, InPlacePad, ForPoisson, false );
+
+
+//    evaluate the base-level power spectrum by FFT
+      GetBasePowerSpectrum( VarK, local_y_start_after_transpose, local_ny_after_transpose, PS_total, &NormDC );
 
-// 5. evaluate the base-level power spectrum by FFT
-   double NormDC;  // to record the FFT DC value used for normalization
-   GetBasePowerSpectrum( VarK, local_y_start_after_transpose, local_ny_after_transpose, PS_total, &NormDC );
 
+//    free memory
+      root_fftw::fft_free(VarK);
+      delete [] SendBuf;
+      delete [] RecvBuf;
+      delete [] SendBuf_SIdx;
+      delete [] RecvBuf_SIdx;
 
-// 6. output the power spectrum
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         free( List_PID[r] );
+         free( List_k  [r] );
+      }
+   } // if ( OPT__FFTW_PENCIL ) ... else
+
+
+// 5. output the power spectrum
    if ( MPI_Rank == 0 )
    {
 //    check if the target file already exists
@@ -164,19 +205,7 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
    } // if ( MPI_Rank == 0 )
 
 
-// 7. free memory
-   root_fftw::fft_free(VarK);
-   delete [] SendBuf;
-   delete [] RecvBuf;
-   delete [] SendBuf_SIdx;
-   delete [] RecvBuf_SIdx;
-
-   for (int r=0; r<MPI_NRank; r++)
-   {
-      free( List_PID[r] );
-      free( List_k  [r] );
-   }
-
+// 6. free memory
    if ( MPI_Rank == 0 )    delete [] PS_total;
 
 // free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
@@ -202,8 +231,8 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
 // Note        :  Invoked by the function "Output_BasePowerSpectrum"
 //
 // Parameter   :  VarK        : Array storing the input data
-//                j_start     : Starting j index
-//                dj          : Size of array in the j (y) direction after the forward FFT
+//                j_start     : Starting j index (useless for OPT__FFTW_PENCIL)
+//                dj          : Size of array in the j (y) direction after the forward FFT (useless for OPT__FFTW_PENCIL)
 //                PS_total    : Power spectrum summed over all MPI ranks
 //                NormDC      : Record of the average (DC) value used for normalization of power spectrum
 //
@@ -226,6 +255,10 @@ void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *
    long   Count_local[Nx_Padded], Count_total[Nx_Padded];
    int    bin, bin_i[Nx_Padded], bin_j[Ny], bin_k[Nz];
 
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )    FFTW_Pencil_R2C( FFTW_Pencil_PS, VarK );
+   else
+#  endif
    root_fftw_r2c( FFTW_Plan_PS, VarK );
 
 // the data are now complex, so typecast a pointer
@@ -247,6 +280,37 @@ void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *
       Count_local[b] = 0;
    }
 
+// pencil decomposition: z-pencil layout [i][j][k]
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )
+   {
+      const int i_start = FFTW_Pencil_PS.List_kx_start[ FFTW_Pencil_PS.Coord[0] ];
+      const int j_start = FFTW_Pencil_PS.List_ky_start[ FFTW_Pencil_PS.Coord[1] ];
+      const int ni      = FFTW_Pencil_PS.local_nkx;
+      const int nj      = FFTW_Pencil_PS.local_nky;
+
+      for (int ii=0; ii<ni; ii++)   {  const int i = i_start + ii;
+      for (int jj=0; jj<nj; jj++)   {  const int j = j_start + jj;
+      for (int k=0;  k<Nz;  k++)    {
+         Idx = ((long)ii*nj + jj)*Nz + k;
+
+#        ifdef FLOAT8
+         bin = lround (   SQRT(   real( SQR(bin_i[i]) + SQR(bin_j[j]) + SQR(bin_k[k]) )  )   );
+#        else
+         bin = lroundf(   SQRT(   real( SQR(bin_i[i]) + SQR(bin_j[j]) + SQR(bin_k[k]) )  )   );
+#        endif
+
+         if ( bin < Nx_Padded )
+         {
+            PS_local   [bin] += double(  SQR( c_re(cdata[Idx]) ) + SQR( c_im(cdata[Idx])  ) );
+            Count_local[bin] ++;
+         }
+      }}}
+   } // if ( OPT__FFTW_PENCIL )
+
+   else
+#  endif // #ifdef SUPPORT_FFTW_PENCIL
+   {
 #  ifdef SERIAL // serial mode
 
    for (int k=0; k<Nz; k++)
@@ -285,6 +349,7 @@ void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *
          }
       } // i,j,k
    } // i,j,k
+   } // if ( OPT__FFTW_PENCIL ) ... else
 
 
 // sum over all ranks
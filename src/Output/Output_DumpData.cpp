@@ -258,9 +258,10 @@ void Output_DumpData( const int Stage )
          const bool   SendGridData_Yes  = true;
          const bool   ResetLB_Yes       = true;
          const bool   SortRealPatch_Yes = true;
+         const bool   KeepCutPoint_No   = false;
          const int    AllLv             = -1;
 
-         LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, ParWeight, ResetLB_Yes, SortRealPatch_Yes, AllLv );
+         LB_Init_LoadBalance( Redistribute_Yes, SendGridData_Yes, ParWeight, ResetLB_Yes, SortRealPatch_Yes, KeepCutPoint_No, AllLv );
       }
 #     endif // #ifdef LOAD_BALANCE
 
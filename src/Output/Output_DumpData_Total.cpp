@@ -62,6 +62,11 @@ void Output_DumpData_Total( const char *FileName )
 #  endif
 #  endif
 
+// the patch data are dumped directly and thus must be stored in the same precision as the other field data
+#  if ( defined FLOAT8  &&  !defined FLOAT8_STORE )
+   Aux_Error( ERROR_INFO, "Must adopt FLOAT8_STORE=FLOAT8 for OPT__OUTPUT_TOTAL=2 (C-binary) !!\n" );
+#  endif
+
 
 // check the synchronization
    for (int lv=1; lv<NLEVEL; lv++)
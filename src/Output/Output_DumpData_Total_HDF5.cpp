@@ -13,6 +13,8 @@ static void GetCompound_KeyInfo  ( hid_t &H5_TypeID );
 static void GetCompound_Makefile ( hid_t &H5_TypeID );
 static void GetCompound_SymConst ( hid_t &H5_TypeID );
 static void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored );
+static void GetPropList_DataCreate( hid_t &H5_PropID, const hid_t H5_PropID_Base, const int NDim,
+                                    const hsize_t ChunkDims[], const bool AllowLossy );
 
 
 
@@ -69,7 +71,7 @@ Procedure for outputting new variables:
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2478)
+// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2496)
 // Description :  Output all simulation data in the HDF5 format, which can be used as a restart file
 //                or loaded by YT
 //
@@ -106,6 +108,20 @@ Procedure for outputting new variables:
 //                        --> Currently we store different attributes in separate datasets
 //                        --> Particles are stored in the order of their associated GIDs as well, but the order of
 //                            particles in the same patch is not specified
+//                11. By default, different ranks take turns to write the grid and particle data
+//                    --> With OPT__OUTPUT_HDF5_MPIIO, all ranks instead write their own hyperslabs (starting from
+//                        LB_PatchCount::GID_Offset[] and GParID_Offset[]) simultaneously using the collective MPI-IO
+//                    --> Require HDF5 to be compiled with the parallel support (i.e., H5_HAVE_PARALLEL)
+//                    --> The file layout is identical in both modes
+//                12. With OPT__OUTPUT_HDF5_COMPRESS and/or OUTPUT_HDF5_LOSSY_DIGITS, the grid and particle datasets are
+//                    chunked (one patch per chunk for the grid data) and compressed by the HDF5 built-in filters
+//                    --> See GetPropList_DataCreate()
+//                13. With OPT__OUTPUT_HDF5_ASYNC, rank 0 still writes all metadata synchronously, but the grid and
+//                    particle data are only copied to the staging buffers of Output_AsyncIO_Stage() and then written to
+//                    the pre-allocated contiguous datasets by a background thread in each rank
+//                    --> Computation can continue while the raw data are being written to disk
+//                    --> The next call waits until the previous snapshot has been completely written
+//                    --> Do not support compression since the dataset offsets must be known in advance
 //
 // Parameter   :  FileName : Name of the output file
 //
@@ -254,6 +270,25 @@ Procedure for outputting new variables:
 //                2477 : 2024/04/05 --> output OPT__RECORD_CENTER, COM_CEN_X, COM_CEN_Y, COM_CEN_Z,
 //                                             COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R, COM_MAX_ITER
 //                2478 : 2024/04/09 --> output ANGMOM_ORIGIN_X, ANGMOM_ORIGIN_Y, ANGMOM_ORIGIN_Z
+//                2479 : 2026/10/18 --> output OPT__OUTPUT_HDF5_MPIIO
+//                2480 : 2026/10/18 --> output OPT__OUTPUT_HDF5_COMPRESS, OUTPUT_HDF5_DEFLATE_LEVEL, OUTPUT_HDF5_LOSSY_DIGITS
+//                2481 : 2026/10/18 --> output OPT__OUTPUT_HDF5_ASYNC, OUTPUT_HDF5_ASYNC_MAX_MEM
+//                2482 : 2026/10/18 --> output OPT__RESTART_PARALLEL
+//                2483 : 2026/10/18 --> output OPT__MPI_SPARSE
+//                2484 : 2026/10/18 --> output OPT__MPI_PERSISTENT
+//                2485 : 2026/10/18 --> output OPT__LB_MEASURED_COST, LB_MEASURED_COST_SMOOTH
+//                2486 : 2026/10/18 --> output OPT__LB_INCREMENTAL
+//                2487 : 2026/10/18 --> output OPT__LB_MULTI_CONSTRAINT, LB_MC_TOL_CELL, LB_MC_TOL_PAR, LB_MC_TOL_TIME,
+//                                      LB_MC_TOL_MEM
+//                2488 : 2026/10/18 --> output OPT__CPU_PIPELINE
+//                2489 : 2026/10/18 --> output OPT__PREP_CACHE, PREP_CACHE_MAX_MB
+//                2490 : 2026/10/18 --> output OPT__PATCH_SLAB
+//                2491 : 2026/10/18 --> record value of FLOAT8_STORE as Makefile.Float8_Store
+//                2492 : 2026/10/18 --> output OPT__AUTO_NPGROUP
+//                2493 : 2026/10/18 --> output OPT__FFTW_PENCIL
+//                2494 : 2026/10/18 --> output OPT__POT_LEVEL_MG, POT_LEVEL_MG_MAX_ITER, POT_LEVEL_MG_TOLERATED_ERROR
+//                2495 : 2026/10/18 --> output OPT__POT_WARM_START and SOR_TOLERATED_ERROR
+//                2496 : 2026/10/18 --> output OPT__FFTW_WISDOM
 //-------------------------------------------------------------------------------------------------------
 void Output_DumpData_Total_HDF5( const char *FileName )
 {
@@ -271,6 +306,10 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
 
 
+// wait for the previous asynchronous output and start staging the new one
+   if ( OPT__OUTPUT_HDF5_ASYNC )    Output_AsyncIO_Begin( FileName );
+
+
 
 // 0. determine all the fields to be stored
 //    --> must do it before calling GetCompound_* and FillIn_*
@@ -398,21 +437,28 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    hid_t   H5_SetID_KeyInfo, H5_SetID_Makefile, H5_SetID_SymConst, H5_SetID_InputPara;
    hid_t   H5_SpaceID_Scalar, H5_SpaceID_LBIdx, H5_SpaceID_Cr, H5_SpaceID_Fa, H5_SpaceID_Son, H5_SpaceID_Sib, H5_SpaceID_Field;
    hid_t   H5_TypeID_Com_KeyInfo, H5_TypeID_Com_Makefile, H5_TypeID_Com_SymConst, H5_TypeID_Com_InputPara;
-   hid_t   H5_DataCreatePropList;
+   hid_t   H5_DataCreatePropList, H5_DataCreatePropList_Field, H5_FileAccPropList, H5_DataXferPropList;
    hid_t   H5_AttID_Cvt2Phy;
    herr_t  H5_Status;
+   haddr_t H5_Addr;
 #  ifdef PARTICLE
    hsize_t H5_SetDims_NPar, H5_SetDims_ParData[1], H5_MemDims_ParData[1],  H5_Count_ParData[1], H5_Offset_ParData[1];
    hid_t   H5_SetID_NPar, H5_SpaceID_NPar, H5_SpaceID_ParData, H5_GroupID_Particle, H5_SetID_ParData, H5_MemID_ParData;
+   hid_t   H5_DataCreatePropList_ParData;
 #  endif
 #  ifdef MHD
    hsize_t H5_SetDims_FCMag[4], H5_MemDims_FCMag[4], H5_Count_FCMag[4], H5_Offset_FCMag[4];
-   hid_t   H5_MemID_FCMag, H5_SetID_FCMag, H5_SpaceID_FCMag[NCOMP_MAG];
+   hid_t   H5_MemID_FCMag, H5_SetID_FCMag, H5_SpaceID_FCMag[NCOMP_MAG], H5_DataCreatePropList_FCMag[NCOMP_MAG];
 #  endif
 
 // 2-1. do NOT write fill values to any dataset for higher I/O performance
+//      --> but allocate the file space on creation with OPT__OUTPUT_HDF5_MPIIO so that the datasets
+//          created by rank 0 can be written collectively by all ranks
+//      --> also required by OPT__OUTPUT_HDF5_ASYNC to get the file offsets of all datasets in advance
    H5_DataCreatePropList = H5Pcreate( H5P_DATASET_CREATE );
    H5_Status             = H5Pset_fill_time( H5_DataCreatePropList, H5D_FILL_TIME_NEVER );
+   if ( OPT__OUTPUT_HDF5_MPIIO  ||  OPT__OUTPUT_HDF5_ASYNC )
+   H5_Status             = H5Pset_alloc_time( H5_DataCreatePropList, H5D_ALLOC_TIME_EARLY );
 
 // 2-2. create the "compound" datatype
    GetCompound_KeyInfo  ( H5_TypeID_Com_KeyInfo   );
@@ -423,6 +469,27 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 // 2-3. create the "scalar" dataspace
    H5_SpaceID_Scalar = H5Screate( H5S_SCALAR );
 
+// 2-4. set the file-access and data-transfer property lists for writing the grid and particle data
+//      --> with OPT__OUTPUT_HDF5_MPIIO, all ranks open the file through MPI-IO and write their own hyperslabs
+//          collectively instead of taking turns
+   H5_FileAccPropList  = H5Pcreate( H5P_FILE_ACCESS );
+   H5_DataXferPropList = H5Pcreate( H5P_DATASET_XFER );
+
+#  ifdef H5_HAVE_PARALLEL
+   if ( OPT__OUTPUT_HDF5_MPIIO )
+   {
+      H5_Status = H5Pset_fapl_mpio( H5_FileAccPropList, MPI_COMM_WORLD, MPI_INFO_NULL );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the MPI-IO file driver !!\n" );
+
+      H5_Status = H5Pset_dxpl_mpio( H5_DataXferPropList, H5FD_MPIO_COLLECTIVE );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the collective data transfer mode !!\n" );
+   }
+#  endif
+
+// number of ranks taking turns to write data (all ranks write simultaneously with MPI-IO or asynchronous output)
+   const bool AllRankWrite = ( OPT__OUTPUT_HDF5_MPIIO  ||  OPT__OUTPUT_HDF5_ASYNC );
+   const int  NRankInTurn  = ( AllRankWrite ) ? 1 : MPI_NRank;
+
 
 
 // 3. output the simulation information
@@ -614,6 +681,12 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    real (*FCMagData)[PS1P1*SQR(PS1)] = NULL;
 #  endif
 
+// file offsets of the datasets for OPT__OUTPUT_HDF5_ASYNC
+   long *AsyncOffset_Field = new long [NFieldStored];
+#  ifdef MHD
+   long  AsyncOffset_FCMag[NCOMP_MAG];
+#  endif
+
 // 5-1. initialize the "GridData" group and the datasets of all fields and magnetic field
    H5_SetDims_Field[0] = pc.NPatchAllLv;
    H5_SetDims_Field[1] = PS1;
@@ -623,6 +696,10 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    H5_SpaceID_Field = H5Screate_simple( 4, H5_SetDims_Field, NULL );
    if ( H5_SpaceID_Field < 0 )   Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_SpaceID_Field" );
 
+// store one patch per chunk when enabling compression
+   const hsize_t H5_ChunkDims_Field[4] = { 1, PS1, PS1, PS1 };
+   GetPropList_DataCreate( H5_DataCreatePropList_Field, H5_DataCreatePropList, 4, H5_ChunkDims_Field, true );
+
 #  ifdef MHD
    for (int v=0; v<NCOMP_MAG; v++)
    {
@@ -633,6 +710,14 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_SpaceID_FCMag[v] = H5Screate_simple( 4, H5_SetDims_FCMag, NULL );
       if ( H5_SpaceID_FCMag[v] < 0 )   Aux_Error( ERROR_INFO, "failed to create the space \"%s[%d]\" !!\n",
                                                   "H5_SpaceID_FCMag", v );
+
+//    never apply the lossy filter to the magnetic field to preserve the divergence-free constraint
+      hsize_t H5_ChunkDims_FCMag[4];
+      H5_ChunkDims_FCMag[0] = 1;
+      for (int t=1; t<4; t++)
+      H5_ChunkDims_FCMag[t] = H5_SetDims_FCMag[t];
+
+      GetPropList_DataCreate( H5_DataCreatePropList_FCMag[v], H5_DataCreatePropList, 4, H5_ChunkDims_FCMag, false );
    }
 #  endif
 
@@ -652,8 +737,17 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       for (int v=0; v<NFieldStored; v++)
       {
          H5_SetID_Field = H5Dcreate( H5_GroupID_GridData, FieldLabelOut[v], H5T_GAMER_REAL, H5_SpaceID_Field,
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                     H5P_DEFAULT, H5_DataCreatePropList_Field, H5P_DEFAULT );
          if ( H5_SetID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FieldLabelOut[v] );
+
+         if ( OPT__OUTPUT_HDF5_ASYNC )
+         {
+            H5_Addr = H5Dget_offset( H5_SetID_Field );
+            if ( H5_Addr == HADDR_UNDEF )
+               Aux_Error( ERROR_INFO, "failed to get the file offset of the dataset \"%s\" !!\n", FieldLabelOut[v] );
+            AsyncOffset_Field[v] = (long)H5_Addr;
+         }
+
          H5_Status = H5Dclose( H5_SetID_Field );
       }
 
@@ -662,8 +756,17 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       for (int v=0; v<NCOMP_MAG; v++)
       {
          H5_SetID_FCMag = H5Dcreate( H5_GroupID_GridData, MagLabel[v], H5T_GAMER_REAL, H5_SpaceID_FCMag[v],
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                     H5P_DEFAULT, H5_DataCreatePropList_FCMag[v], H5P_DEFAULT );
          if ( H5_SetID_FCMag < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", MagLabel[v] );
+
+         if ( OPT__OUTPUT_HDF5_ASYNC )
+         {
+            H5_Addr = H5Dget_offset( H5_SetID_FCMag );
+            if ( H5_Addr == HADDR_UNDEF )
+               Aux_Error( ERROR_INFO, "failed to get the file offset of the dataset \"%s\" !!\n", MagLabel[v] );
+            AsyncOffset_FCMag[v] = (long)H5_Addr;
+         }
+
          H5_Status = H5Dclose( H5_SetID_FCMag );
       }
 #     endif
@@ -674,7 +777,19 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    } // if ( MPI_Rank == 0 )
 
 
-// 5-2. start to dump data (serial instead of parallel)
+// 5-2. start to dump data (serial instead of parallel unless OPT__OUTPUT_HDF5_MPIIO or OPT__OUTPUT_HDF5_ASYNC is enabled)
+//      --> all ranks must wait until rank 0 has created the datasets
+   if ( OPT__OUTPUT_HDF5_MPIIO )    MPI_Barrier( MPI_COMM_WORLD );
+
+// broadcast the dataset offsets for the asynchronous output
+   if ( OPT__OUTPUT_HDF5_ASYNC )
+   {
+      MPI_Bcast( AsyncOffset_Field, NFieldStored, MPI_LONG, 0, MPI_COMM_WORLD );
+#     ifdef MHD
+      MPI_Bcast( AsyncOffset_FCMag, NCOMP_MAG,    MPI_LONG, 0, MPI_COMM_WORLD );
+#     endif
+   }
+
    const bool IntPhase_No         = false;
    const bool DE_Consistency_No   = false;
    const real MinDens_No          = -1.0;
@@ -731,19 +846,24 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       }
 #     endif
 
-      for (int TRank=0; TRank<MPI_NRank; TRank++)
+      for (int TRank=0; TRank<NRankInTurn; TRank++)
       {
-         if ( MPI_Rank == TRank )
+         if ( MPI_Rank == TRank  ||  AllRankWrite )
          {
-//          HDF5 file must be synchronized before being written by the next rank
-            SyncHDF5File( FileName );
-
 //          reopen the file and group
-            H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
-            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+//          --> collective with OPT__OUTPUT_HDF5_MPIIO
+//          --> not required with OPT__OUTPUT_HDF5_ASYNC, which bypasses the HDF5 library
+            if ( !OPT__OUTPUT_HDF5_ASYNC )
+            {
+//             HDF5 file must be synchronized before being written by the next rank
+               if ( !OPT__OUTPUT_HDF5_MPIIO )   SyncHDF5File( FileName );
 
-            H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
-            if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+               H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5_FileAccPropList );
+               if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+
+               H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
+               if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+            }
 
 
 //          5-2-1. dump cell-centered data
@@ -768,7 +888,17 @@ void Output_DumpData_Total_HDF5( const char *FileName )
             H5_Count_Field [2] = PS1;
             H5_Count_Field [3] = PS1;
 
-            H5_Status = H5Sselect_hyperslab( H5_SpaceID_Field, H5S_SELECT_SET, H5_Offset_Field, NULL, H5_Count_Field, NULL );
+//          --> select nothing on ranks without any patch since some HDF5 versions reject a zero-count hyperslab
+//              in the collective I/O of OPT__OUTPUT_HDF5_MPIIO
+            if ( amr->NPatchComma[lv][1] == 0 )
+            {
+               H5_Status = H5Sselect_none( H5_MemID_Field );
+               if ( H5_Status >= 0 )   H5_Status = H5Sselect_none( H5_SpaceID_Field );
+            }
+
+            else
+               H5_Status = H5Sselect_hyperslab( H5_SpaceID_Field, H5S_SELECT_SET, H5_Offset_Field, NULL, H5_Count_Field, NULL );
+
             if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the grid data !!\n" );
 
 
@@ -782,8 +912,14 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 #              ifdef GRAVITY
                if ( v == PotDumpIdx )
                {
+//                use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                     memcpy( FieldData[PID], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot, FieldSizeOnePatch );
+                  {
+                     const real_store *PotPtr = amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[0][0];
+                           real       *OutPtr = FieldData[PID][0][0];
+
+                     for (int t=0; t<CUBE(PS1); t++)  OutPtr[t] = PotPtr[t];
+                  }
                }
 #              else
                if ( false ) {}
@@ -1114,7 +1250,12 @@ void Output_DumpData_Total_HDF5( const char *FileName )
                else if ( v >= FluDumpIdx0  &&  v < FluDumpIdx0+NCOMP_TOTAL )
                {
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                     memcpy( FieldData[PID], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v], FieldSizeOnePatch );
+                  {
+                     const real_store *FluPtr = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][0][0];
+                           real       *OutPtr = FieldData[PID][0][0];
+
+                     for (int t=0; t<CUBE(PS1); t++)  OutPtr[t] = FluPtr[t];
+                  }
                }
 
                else
@@ -1122,12 +1263,21 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-2-1-4. write data to disk
-               H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
+//                      --> or stage them for the background thread, where the grid data of this rank are consecutive
+//                          starting from GID_Offset[lv] in a contiguous dataset
+               if ( OPT__OUTPUT_HDF5_ASYNC )
+                  Output_AsyncIO_Stage( FieldData, (long)amr->NPatchComma[lv][1]*FieldSizeOnePatch,
+                                        AsyncOffset_Field[v] + (long)pc.GID_Offset[lv]*FieldSizeOnePatch );
 
-               H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT, FieldData );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+               else
+               {
+                  H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
 
-               H5_Status = H5Dclose( H5_SetID_Field );
+                  H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5_DataXferPropList, FieldData );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+
+                  H5_Status = H5Dclose( H5_SetID_Field );
+               }
             } // for (int v=0; v<NFieldStored; v++)
 
 
@@ -1174,7 +1324,15 @@ void Output_DumpData_Total_HDF5( const char *FileName )
                for (int t=1; t<4; t++)
                H5_Count_FCMag [t] = ( 3-t == v ) ? PS1P1 : PS1;
 
-               H5_Status = H5Sselect_hyperslab( H5_SpaceID_FCMag[v], H5S_SELECT_SET, H5_Offset_FCMag, NULL, H5_Count_FCMag, NULL );
+               if ( amr->NPatchComma[lv][1] == 0 )
+               {
+                  H5_Status = H5Sselect_none( H5_MemID_FCMag );
+                  if ( H5_Status >= 0 )   H5_Status = H5Sselect_none( H5_SpaceID_FCMag[v] );
+               }
+
+               else
+                  H5_Status = H5Sselect_hyperslab( H5_SpaceID_FCMag[v], H5S_SELECT_SET, H5_Offset_FCMag, NULL, H5_Count_FCMag, NULL );
+
                if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the magnetic field !!\n" );
 
 
@@ -1184,12 +1342,20 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-2-2-4. write data to disk
-               H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, MagLabel[v], H5P_DEFAULT );
+               if ( OPT__OUTPUT_HDF5_ASYNC )
+                  Output_AsyncIO_Stage( FCMagData, (long)amr->NPatchComma[lv][1]*FCMagSizeOnePatch,
+                                        AsyncOffset_FCMag[v] + (long)pc.GID_Offset[lv]*FCMagSizeOnePatch );
+
+               else
+               {
+                  H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, MagLabel[v], H5P_DEFAULT );
 
-               H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5P_DEFAULT, FCMagData );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
+                  H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5_DataXferPropList, FCMagData );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
+
+                  H5_Status = H5Dclose( H5_SetID_FCMag );
+               }
 
-               H5_Status = H5Dclose( H5_SetID_FCMag );
                H5_Status = H5Sclose( H5_MemID_FCMag );
             } // for (int v=0; v<NCOMP_MAG; v++)
 
@@ -1198,21 +1364,28 @@ void Output_DumpData_Total_HDF5( const char *FileName )
             delete [] FCMagData;
 #           endif // #ifdef MHD
 
-            H5_Status = H5Gclose( H5_GroupID_GridData );
-            H5_Status = H5Fclose( H5_FileID );
-         } // if ( MPI_Rank == TRank )
+            if ( !OPT__OUTPUT_HDF5_ASYNC )
+            {
+               H5_Status = H5Gclose( H5_GroupID_GridData );
+               H5_Status = H5Fclose( H5_FileID );
+            }
+         } // if ( MPI_Rank == TRank  ||  AllRankWrite )
 
          MPI_Barrier( MPI_COMM_WORLD );
 
-      } // for (int TRank=0; TRank<MPI_NRank; TRank++)
+      } // for (int TRank=0; TRank<NRankInTurn; TRank++)
 
       delete [] PID0List;
    } // for (int lv=0; lv<NLEVEL; lv++)
 
    H5_Status = H5Sclose( H5_SpaceID_Field );
+   H5_Status = H5Pclose( H5_DataCreatePropList_Field );
 #  ifdef MHD
    for (int v=0; v<NCOMP_MAG; v++)
-   H5_Status = H5Sclose( H5_SpaceID_FCMag[v] );
+   {
+      H5_Status = H5Sclose( H5_SpaceID_FCMag[v] );
+      H5_Status = H5Pclose( H5_DataCreatePropList_FCMag[v] );
+   }
 #  endif
 
    delete [] Der_FluIn;
@@ -1222,6 +1395,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    delete [] Der_MagCC;
 #  endif
    delete [] Der_FluInTmp;
+   delete [] AsyncOffset_Field;
 
 
 
@@ -1236,6 +1410,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    long  GParID_Offset[NLEVEL];  // GParID = global particle index (==> unique for each particle)
    long  NParLv_AllRank[NLEVEL];
    long  MaxNPar1Lv, NParInBuf, ParID;
+   long  AsyncOffset_ParData[PAR_NATT_STORED];  // file offsets of the datasets for OPT__OUTPUT_HDF5_ASYNC
 
 
 // 6-1. initialize variables
@@ -1265,6 +1440,17 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    H5_SpaceID_ParData    = H5Screate_simple( 1, H5_SetDims_ParData, NULL );
    if ( H5_SpaceID_ParData < 0 )    Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_SpaceID_ParData" );
 
+// store CUBE(PS1) particles per chunk when enabling compression
+// --> chunked datasets cannot be empty
+// --> never apply the lossy filter to particles since it is an absolute-error filter unsuitable for, e.g., particle IDs
+   if ( H5_SetDims_ParData[0] > 0 )
+   {
+      const hsize_t H5_ChunkDims_ParData[1] = { MIN( H5_SetDims_ParData[0], (hsize_t)CUBE(PS1) ) };
+      GetPropList_DataCreate( H5_DataCreatePropList_ParData, H5_DataCreatePropList, 1, H5_ChunkDims_ParData, false );
+   }
+   else
+      H5_DataCreatePropList_ParData = H5Pcopy( H5_DataCreatePropList );
+
    if ( MPI_Rank == 0 )
    {
 //    HDF5 file must be synchronized before being written by the next rank
@@ -1281,8 +1467,18 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       for (int v=0; v<PAR_NATT_STORED; v++)
       {
          H5_SetID_ParData = H5Dcreate( H5_GroupID_Particle, ParAttLabel[v], H5T_GAMER_REAL_PAR, H5_SpaceID_ParData,
-                                       H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+                                       H5P_DEFAULT, H5_DataCreatePropList_ParData, H5P_DEFAULT );
          if ( H5_SetID_ParData < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", ParAttLabel[v] );
+
+//       empty datasets are not allocated and will never be written
+         if ( OPT__OUTPUT_HDF5_ASYNC )
+         {
+            H5_Addr = ( H5_SetDims_ParData[0] > 0 ) ? H5Dget_offset( H5_SetID_ParData ) : 0;
+            if ( H5_Addr == HADDR_UNDEF )
+               Aux_Error( ERROR_INFO, "failed to get the file offset of the dataset \"%s\" !!\n", ParAttLabel[v] );
+            AsyncOffset_ParData[v] = (long)H5_Addr;
+         }
+
          H5_Status = H5Dclose( H5_SetID_ParData );
       }
 
@@ -1294,20 +1490,30 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 // 6-3. start to dump particle data (one level, one rank, and one attribute at a time)
 //      --> note that particles must be outputted in the same order as their associated patches
+//      --> all ranks write simultaneously with OPT__OUTPUT_HDF5_MPIIO, which must wait until rank 0 has created the datasets
+   if ( OPT__OUTPUT_HDF5_MPIIO )    MPI_Barrier( MPI_COMM_WORLD );
+
+   if ( OPT__OUTPUT_HDF5_ASYNC )    MPI_Bcast( AsyncOffset_ParData, PAR_NATT_STORED, MPI_LONG, 0, MPI_COMM_WORLD );
+
    for (int lv=0; lv<NLEVEL; lv++)
-   for (int TRank=0; TRank<MPI_NRank; TRank++)
+   for (int TRank=0; TRank<NRankInTurn; TRank++)
    {
-      if ( MPI_Rank == TRank )
+      if ( MPI_Rank == TRank  ||  AllRankWrite )
       {
-//       HDF5 file must be synchronized before being written by the next rank
-         SyncHDF5File( FileName );
-
 //       reopen the file and group
-         H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
-         if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+//       --> collective with OPT__OUTPUT_HDF5_MPIIO
+//       --> not required with OPT__OUTPUT_HDF5_ASYNC, which bypasses the HDF5 library
+         if ( !OPT__OUTPUT_HDF5_ASYNC )
+         {
+//          HDF5 file must be synchronized before being written by the next rank
+            if ( !OPT__OUTPUT_HDF5_MPIIO )   SyncHDF5File( FileName );
+
+            H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5_FileAccPropList );
+            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
 
-         H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
-         if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+            H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
+            if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+         }
 
 
 //       6-3-1. determine the memory space
@@ -1320,7 +1526,15 @@ void Output_DumpData_Total_HDF5( const char *FileName )
          H5_Offset_ParData[0] = GParID_Offset[lv];
          H5_Count_ParData [0] = amr->Par->NPar_Lv[lv];
 
-         H5_Status = H5Sselect_hyperslab( H5_SpaceID_ParData, H5S_SELECT_SET, H5_Offset_ParData, NULL, H5_Count_ParData, NULL );
+         if ( amr->Par->NPar_Lv[lv] == 0 )
+         {
+            H5_Status = H5Sselect_none( H5_MemID_ParData );
+            if ( H5_Status >= 0 )   H5_Status = H5Sselect_none( H5_SpaceID_ParData );
+         }
+
+         else
+            H5_Status = H5Sselect_hyperslab( H5_SpaceID_ParData, H5S_SELECT_SET, H5_Offset_ParData, NULL, H5_Count_ParData, NULL );
+
          if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the particle data !!\n" );
 
 
@@ -1346,26 +1560,38 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //          6-3-4. write data to disk
-            H5_SetID_ParData = H5Dopen( H5_GroupID_Particle, ParAttLabel[v], H5P_DEFAULT );
+            if ( OPT__OUTPUT_HDF5_ASYNC )
+               Output_AsyncIO_Stage( ParBuf1v1Lv, amr->Par->NPar_Lv[lv]*(long)sizeof(real_par),
+                                     AsyncOffset_ParData[v] + GParID_Offset[lv]*(long)sizeof(real_par) );
+
+            else
+            {
+               H5_SetID_ParData = H5Dopen( H5_GroupID_Particle, ParAttLabel[v], H5P_DEFAULT );
 
-            H5_Status = H5Dwrite( H5_SetID_ParData, H5T_GAMER_REAL_PAR, H5_MemID_ParData, H5_SpaceID_ParData, H5P_DEFAULT, ParBuf1v1Lv );
-            if ( H5_Status < 0 )
-               Aux_Error( ERROR_INFO, "failed to write a particle attribute (lv %d, v %d) !!\n", lv, v );
+               H5_Status = H5Dwrite( H5_SetID_ParData, H5T_GAMER_REAL_PAR, H5_MemID_ParData, H5_SpaceID_ParData, H5_DataXferPropList, ParBuf1v1Lv );
+               if ( H5_Status < 0 )
+                  Aux_Error( ERROR_INFO, "failed to write a particle attribute (lv %d, v %d) !!\n", lv, v );
 
-            H5_Status = H5Dclose( H5_SetID_ParData );
+               H5_Status = H5Dclose( H5_SetID_ParData );
+            }
          } // for (int v=0; v<PAR_NATT_STORED; v++)
 
 //       free resource
          H5_Status = H5Sclose( H5_MemID_ParData );
-         H5_Status = H5Gclose( H5_GroupID_Particle );
-         H5_Status = H5Fclose( H5_FileID );
-      } // if ( MPI_Rank == TRank )
+
+         if ( !OPT__OUTPUT_HDF5_ASYNC )
+         {
+            H5_Status = H5Gclose( H5_GroupID_Particle );
+            H5_Status = H5Fclose( H5_FileID );
+         }
+      } // if ( MPI_Rank == TRank  ||  AllRankWrite )
 
       MPI_Barrier( MPI_COMM_WORLD );
 
-   } // for (int TRank=0; TRank<MPI_NRank; TRank++) ... for (int lv=0; lv<NLEVEL; lv++)
+   } // for (int TRank=0; TRank<NRankInTurn; TRank++) ... for (int lv=0; lv<NLEVEL; lv++)
 
    H5_Status = H5Sclose( H5_SpaceID_ParData );
+   H5_Status = H5Pclose( H5_DataCreatePropList_ParData );
 
    delete [] ParBuf1v1Lv;
    delete [] NParLv_EachRank;
@@ -1481,6 +1707,12 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    H5_Status = H5Tclose( H5_TypeID_Com_InputPara );
    H5_Status = H5Sclose( H5_SpaceID_Scalar );
    H5_Status = H5Pclose( H5_DataCreatePropList );
+   H5_Status = H5Pclose( H5_FileAccPropList );
+   H5_Status = H5Pclose( H5_DataXferPropList );
+
+// 9. launch the background thread to write the staged data
+//    --> all HDF5 operations on this file must be completed beforehand
+   if ( OPT__OUTPUT_HDF5_ASYNC )    Output_AsyncIO_Launch();
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d)     ... done\n", __FUNCTION__, DumpID );
 
@@ -1503,7 +1735,7 @@ void FillIn_KeyInfo( KeyInfo_t &KeyInfo, const int NFieldStored )
 
    const time_t CalTime = time( NULL );   // calendar time
 
-   KeyInfo.FormatVersion        = 2478;
+   KeyInfo.FormatVersion        = 2496;
    KeyInfo.Model                = MODEL;
    KeyInfo.NLevel               = NLEVEL;
    KeyInfo.NCompFluid           = NCOMP_FLUID;
@@ -1661,6 +1893,12 @@ void FillIn_Makefile( Makefile_t &Makefile )
    Makefile.Float8                 = 0;
 #  endif
 
+#  ifdef FLOAT8_STORE
+   Makefile.Float8_Store           = 1;
+#  else
+   Makefile.Float8_Store           = 0;
+#  endif
+
 #  ifdef SERIAL
    Makefile.Serial                 = 1;
 #  else
@@ -2307,6 +2545,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  endif
    InputPara.Opt__ReuseMemory        = OPT__REUSE_MEMORY;
    InputPara.Opt__MemoryPool         = OPT__MEMORY_POOL;
+   InputPara.Opt__PatchSlab          = OPT__PATCH_SLAB;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2315,6 +2554,16 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.LB_Par_Weight           = amr->LB->Par_Weight;
 #  endif
    InputPara.Opt__RecordLoadBalance  = OPT__RECORD_LOAD_BALANCE;
+   InputPara.Opt__MPI_Sparse         = OPT__MPI_SPARSE;
+   InputPara.Opt__MPI_Persistent     = OPT__MPI_PERSISTENT;
+   InputPara.Opt__LB_MeasuredCost    = OPT__LB_MEASURED_COST;
+   InputPara.LB_MeasuredCost_Smooth  = LB_MEASURED_COST_SMOOTH;
+   InputPara.Opt__LB_Incremental     = OPT__LB_INCREMENTAL;
+   InputPara.Opt__LB_MultiConstraint = OPT__LB_MULTI_CONSTRAINT;
+   InputPara.LB_MC_Tol_Cell          = LB_MC_TOL_CELL;
+   InputPara.LB_MC_Tol_Par           = LB_MC_TOL_PAR;
+   InputPara.LB_MC_Tol_Time          = LB_MC_TOL_TIME;
+   InputPara.LB_MC_Tol_Mem           = LB_MC_TOL_MEM;
 #  endif
    InputPara.Opt__MinimizeMPIBarrier = OPT__MINIMIZE_MPI_BARRIER;
 
@@ -2351,6 +2600,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 // fluid solvers in different models
    InputPara.Flu_GPU_NPGroup         = FLU_GPU_NPGROUP;
    InputPara.GPU_NStream             = GPU_NSTREAM;
+   InputPara.Opt__AutoNPGroup        = OPT__AUTO_NPGROUP;
    InputPara.Opt__FixUp_Flux         = OPT__FIXUP_FLUX;
    InputPara.FixUpFlux_Var           = FixUpVar_Flux;
 #  ifdef MHD
@@ -2382,6 +2632,9 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  endif
 
    InputPara.Opt__OverlapMPI         = OPT__OVERLAP_MPI;
+   InputPara.Opt__CPU_Pipeline       = OPT__CPU_PIPELINE;
+   InputPara.Opt__PrepCache          = OPT__PREP_CACHE;
+   InputPara.PrepCache_MaxMB         = PREP_CACHE_MAX_MB;
    InputPara.Opt__ResetFluid         = OPT__RESET_FLUID;
    InputPara.Opt__ResetFluidInit     = OPT__RESET_FLUID_INIT;
    InputPara.Opt__FreezeFluid        = OPT__FREEZE_FLUID;
@@ -2407,12 +2660,17 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.SOR_Omega               = SOR_OMEGA;
    InputPara.SOR_MaxIter             = SOR_MAX_ITER;
    InputPara.SOR_MinIter             = SOR_MIN_ITER;
+   InputPara.SOR_ToleratedError      = SOR_TOLERATED_ERROR;
 #  elif ( POT_SCHEME == MG )
    InputPara.MG_MaxIter              = MG_MAX_ITER;
    InputPara.MG_NPreSmooth           = MG_NPRE_SMOOTH;
    InputPara.MG_NPostSmooth          = MG_NPOST_SMOOTH;
    InputPara.MG_ToleratedError       = MG_TOLERATED_ERROR;
 #  endif
+   InputPara.Opt__Pot_Level_MG       = OPT__POT_LEVEL_MG;
+   InputPara.Pot_Level_MG_MaxIter    = POT_LEVEL_MG_MAX_ITER;
+   InputPara.Pot_Level_MG_ToleratedError = POT_LEVEL_MG_TOLERATED_ERROR;
+   InputPara.Opt__Pot_WarmStart      = OPT__POT_WARM_START;
    InputPara.Pot_GPU_NPGroup         = POT_GPU_NPGROUP;
    InputPara.Opt__GraP5Gradient      = OPT__GRA_P5_GRADIENT;
    InputPara.Opt__SelfGravity        = OPT__SELF_GRAVITY;
@@ -2486,6 +2744,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__Init               = OPT__INIT;
    InputPara.RestartLoadNRank        = RESTART_LOAD_NRANK;
    InputPara.Opt__RestartReset       = OPT__RESTART_RESET;
+   InputPara.Opt__RestartParallel    = OPT__RESTART_PARALLEL;
    InputPara.Opt__UM_IC_Level        = OPT__UM_IC_LEVEL;
    InputPara.Opt__UM_IC_NLevel       = OPT__UM_IC_NLEVEL;
    InputPara.Opt__UM_IC_NVar         = OPT__UM_IC_NVAR;
@@ -2523,6 +2782,8 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  endif
 #  ifdef SUPPORT_FFTW
    InputPara.Opt__FFTW_Startup       = OPT__FFTW_STARTUP;
+   InputPara.Opt__FFTW_Pencil        = OPT__FFTW_PENCIL;
+   InputPara.Opt__FFTW_Wisdom        = OPT__FFTW_WISDOM;
 #  endif
 // interpolation schemes
    InputPara.Opt__Int_Time           = OPT__INT_TIME;
@@ -2588,6 +2849,12 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__Output_UserField       = OPT__OUTPUT_USER_FIELD;
    InputPara.Opt__Output_Mode            = OPT__OUTPUT_MODE;
    InputPara.Opt__Output_Restart         = OPT__OUTPUT_RESTART;
+   InputPara.Opt__Output_HDF5_MPIIO      = OPT__OUTPUT_HDF5_MPIIO;
+   InputPara.Opt__Output_HDF5_Compress   = OPT__OUTPUT_HDF5_COMPRESS;
+   InputPara.Output_HDF5_Deflate_Level   = OUTPUT_HDF5_DEFLATE_LEVEL;
+   InputPara.Output_HDF5_Lossy_Digits    = OUTPUT_HDF5_LOSSY_DIGITS;
+   InputPara.Opt__Output_HDF5_Async      = OPT__OUTPUT_HDF5_ASYNC;
+   InputPara.Output_HDF5_Async_Max_Mem   = OUTPUT_HDF5_ASYNC_MAX_MEM;
    InputPara.Opt__Output_Step            = OUTPUT_STEP;
    InputPara.Opt__Output_Dt              = OUTPUT_DT;
    InputPara.Opt__Output_Text_Format_Flt = OPT__OUTPUT_TEXT_FORMAT_FLT;
@@ -2821,6 +3088,7 @@ void GetCompound_Makefile( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Timing",                 HOFFSET(Makefile_t,Timing                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "TimingSolver",           HOFFSET(Makefile_t,TimingSolver           ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Float8",                 HOFFSET(Makefile_t,Float8                 ), H5T_NATIVE_INT );
+   H5Tinsert( H5_TypeID, "Float8_Store",           HOFFSET(Makefile_t,Float8_Store           ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Serial",                 HOFFSET(Makefile_t,Serial                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "LoadBalance",            HOFFSET(Makefile_t,LoadBalance            ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "OverlapMPI",             HOFFSET(Makefile_t,OverlapMPI             ), H5T_NATIVE_INT );
@@ -3264,6 +3532,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  endif
    H5Tinsert( H5_TypeID, "Opt__ReuseMemory",        HOFFSET(InputPara_t,Opt__ReuseMemory       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__MemoryPool",         HOFFSET(InputPara_t,Opt__MemoryPool        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__PatchSlab",          HOFFSET(InputPara_t,Opt__PatchSlab         ), H5T_NATIVE_INT     );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -3272,6 +3541,16 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "LB_Par_Weight",           HOFFSET(InputPara_t,LB_Par_Weight          ), H5T_NATIVE_DOUBLE  );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__RecordLoadBalance",  HOFFSET(InputPara_t,Opt__RecordLoadBalance ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__MPI_Sparse",         HOFFSET(InputPara_t,Opt__MPI_Sparse        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__MPI_Persistent",     HOFFSET(InputPara_t,Opt__MPI_Persistent    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_MeasuredCost",    HOFFSET(InputPara_t,Opt__LB_MeasuredCost   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "LB_MeasuredCost_Smooth",  HOFFSET(InputPara_t,LB_MeasuredCost_Smooth ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "Opt__LB_Incremental",     HOFFSET(InputPara_t,Opt__LB_Incremental    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_MultiConstraint", HOFFSET(InputPara_t,Opt__LB_MultiConstraint), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "LB_MC_Tol_Cell",          HOFFSET(InputPara_t,LB_MC_Tol_Cell         ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "LB_MC_Tol_Par",           HOFFSET(InputPara_t,LB_MC_Tol_Par          ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "LB_MC_Tol_Time",          HOFFSET(InputPara_t,LB_MC_Tol_Time         ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "LB_MC_Tol_Mem",           HOFFSET(InputPara_t,LB_MC_Tol_Mem          ), H5T_NATIVE_DOUBLE  );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__MinimizeMPIBarrier", HOFFSET(InputPara_t,Opt__MinimizeMPIBarrier), H5T_NATIVE_INT     );
 
@@ -3308,6 +3587,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 // fluid solvers in different models
    H5Tinsert( H5_TypeID, "Flu_GPU_NPGroup",         HOFFSET(InputPara_t,Flu_GPU_NPGroup        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "GPU_NStream",             HOFFSET(InputPara_t,GPU_NStream            ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__AutoNPGroup",        HOFFSET(InputPara_t,Opt__AutoNPGroup       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__FixUp_Flux",         HOFFSET(InputPara_t,Opt__FixUp_Flux        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "FixUpFlux_Var",           HOFFSET(InputPara_t,FixUpFlux_Var          ), H5T_NATIVE_LONG    );
 #  ifdef MHD
@@ -3349,6 +3629,9 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  endif
 
    H5Tinsert( H5_TypeID, "Opt__OverlapMPI",         HOFFSET(InputPara_t,Opt__OverlapMPI        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__CPU_Pipeline",       HOFFSET(InputPara_t,Opt__CPU_Pipeline      ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__PrepCache",          HOFFSET(InputPara_t,Opt__PrepCache         ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "PrepCache_MaxMB",         HOFFSET(InputPara_t,PrepCache_MaxMB        ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Opt__ResetFluid",         HOFFSET(InputPara_t,Opt__ResetFluid        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__ResetFluidInit",     HOFFSET(InputPara_t,Opt__ResetFluidInit    ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__FreezeFluid",        HOFFSET(InputPara_t,Opt__FreezeFluid       ), H5T_NATIVE_INT              );
@@ -3374,12 +3657,17 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "SOR_Omega",               HOFFSET(InputPara_t,SOR_Omega              ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "SOR_MaxIter",             HOFFSET(InputPara_t,SOR_MaxIter            ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "SOR_MinIter",             HOFFSET(InputPara_t,SOR_MinIter            ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "SOR_ToleratedError",      HOFFSET(InputPara_t,SOR_ToleratedError     ), H5T_NATIVE_DOUBLE           );
 #  elif ( POT_SCHEME == MG )
    H5Tinsert( H5_TypeID, "MG_MaxIter",              HOFFSET(InputPara_t,MG_MaxIter             ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "MG_NPreSmooth",           HOFFSET(InputPara_t,MG_NPreSmooth          ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "MG_NPostSmooth",          HOFFSET(InputPara_t,MG_NPostSmooth         ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "MG_ToleratedError",       HOFFSET(InputPara_t,MG_ToleratedError      ), H5T_NATIVE_DOUBLE           );
 #  endif
+   H5Tinsert( H5_TypeID, "Opt__Pot_Level_MG",       HOFFSET(InputPara_t,Opt__Pot_Level_MG      ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Pot_Level_MG_MaxIter",    HOFFSET(InputPara_t,Pot_Level_MG_MaxIter   ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Pot_Level_MG_ToleratedError", HOFFSET(InputPara_t,Pot_Level_MG_ToleratedError), H5T_NATIVE_DOUBLE   );
+   H5Tinsert( H5_TypeID, "Opt__Pot_WarmStart",      HOFFSET(InputPara_t,Opt__Pot_WarmStart     ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Pot_GPU_NPGroup",         HOFFSET(InputPara_t,Pot_GPU_NPGroup        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__GraP5Gradient",      HOFFSET(InputPara_t,Opt__GraP5Gradient     ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__SelfGravity",        HOFFSET(InputPara_t,Opt__SelfGravity       ), H5T_NATIVE_INT              );
@@ -3450,6 +3738,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__Init",               HOFFSET(InputPara_t,Opt__Init               ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "RestartLoadNRank",        HOFFSET(InputPara_t,RestartLoadNRank        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__RestartReset",       HOFFSET(InputPara_t,Opt__RestartReset       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__RestartParallel",    HOFFSET(InputPara_t,Opt__RestartParallel    ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_Level",        HOFFSET(InputPara_t,Opt__UM_IC_Level        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_NLevel",       HOFFSET(InputPara_t,Opt__UM_IC_NLevel       ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_NVar",         HOFFSET(InputPara_t,Opt__UM_IC_NVar         ), H5T_NATIVE_INT              );
@@ -3470,6 +3759,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  endif
 #  ifdef SUPPORT_FFTW
    H5Tinsert( H5_TypeID, "Opt__FFTW_Startup",       HOFFSET(InputPara_t,Opt__FFTW_Startup       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__FFTW_Pencil",        HOFFSET(InputPara_t,Opt__FFTW_Pencil        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__FFTW_Wisdom",        HOFFSET(InputPara_t,Opt__FFTW_Wisdom        ), H5T_NATIVE_INT              );
 #  endif
 
 // interpolation schemes
@@ -3536,6 +3827,12 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__Output_UserField",       HOFFSET(InputPara_t,Opt__Output_UserField      ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Mode",            HOFFSET(InputPara_t,Opt__Output_Mode           ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Restart",         HOFFSET(InputPara_t,Opt__Output_Restart        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__Output_HDF5_MPIIO",      HOFFSET(InputPara_t,Opt__Output_HDF5_MPIIO     ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__Output_HDF5_Compress",   HOFFSET(InputPara_t,Opt__Output_HDF5_Compress  ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_HDF5_Deflate_Level",   HOFFSET(InputPara_t,Output_HDF5_Deflate_Level  ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_HDF5_Lossy_Digits",    HOFFSET(InputPara_t,Output_HDF5_Lossy_Digits   ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__Output_HDF5_Async",      HOFFSET(InputPara_t,Opt__Output_HDF5_Async     ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Output_HDF5_Async_Max_Mem",   HOFFSET(InputPara_t,Output_HDF5_Async_Max_Mem  ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Opt__Output_Step",            HOFFSET(InputPara_t,Opt__Output_Step           ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Dt",              HOFFSET(InputPara_t,Opt__Output_Dt             ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Opt__Output_Text_Format_Flt", HOFFSET(InputPara_t,Opt__Output_Text_Format_Flt), H5_TypeID_VarStr            );
@@ -3680,4 +3977,71 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPropList_DataCreate
+// Description :  Create the dataset creation property list for storing the grid and particle data
+//
+// Note        :  1. Filters are set by OPT__OUTPUT_HDF5_COMPRESS, OUTPUT_HDF5_DEFLATE_LEVEL, and
+//                   OUTPUT_HDF5_LOSSY_DIGITS
+//                   --> Datasets are chunked only when at least one filter is applied
+//                2. Filters are applied in the order of scale-offset (lossy), shuffle, and deflate
+//                   --> All of them are HDF5 built-in filters and thus can be read transparently by
+//                       Init_ByRestart_HDF5() and any other HDF5 readers (e.g., yt)
+//                3. The lossy scale-offset filter keeps OUTPUT_HDF5_LOSSY_DIGITS digits after the decimal point
+//                   --> It bounds the absolute instead of the relative error
+//                4. The returned H5_PropID must be closed manually
+//                5. Call-by-reference
+//
+// Parameter   :  H5_PropID      : HDF5 property list ID to be returned
+//                H5_PropID_Base : Property list to be copied from (e.g., for the fill-value settings)
+//                NDim           : Number of dimensions of the target dataset
+//                ChunkDims      : Chunk dimensions
+//                AllowLossy     : Apply the lossy filter if OUTPUT_HDF5_LOSSY_DIGITS > 0
+//-------------------------------------------------------------------------------------------------------
+void GetPropList_DataCreate( hid_t &H5_PropID, const hid_t H5_PropID_Base, const int NDim,
+                             const hsize_t ChunkDims[], const bool AllowLossy )
+{
+
+   const bool Lossy   = ( AllowLossy  &&  OUTPUT_HDF5_LOSSY_DIGITS > 0 );
+   const bool Shuffle = ( OPT__OUTPUT_HDF5_COMPRESS == HDF5_COMPRESS_SHUFFLE_DEFLATE );
+   const bool Deflate = ( OPT__OUTPUT_HDF5_COMPRESS == HDF5_COMPRESS_DEFLATE  ||
+                          OPT__OUTPUT_HDF5_COMPRESS == HDF5_COMPRESS_SHUFFLE_DEFLATE );
+
+   herr_t H5_Status;
+
+   H5_PropID = H5Pcopy( H5_PropID_Base );
+   if ( H5_PropID < 0 )    Aux_Error( ERROR_INFO, "failed to copy the dataset creation property list !!\n" );
+
+   if ( !Lossy  &&  !Shuffle  &&  !Deflate )    return;
+
+
+// filters require chunked datasets
+   H5_Status = H5Pset_chunk( H5_PropID, NDim, ChunkDims );
+   if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the chunk dimensions !!\n" );
+
+   if ( Lossy )
+   {
+      H5_Status = H5Pset_scaleoffset( H5_PropID, H5Z_SO_FLOAT_DSCALE, OUTPUT_HDF5_LOSSY_DIGITS );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the scale-offset filter !!\n" );
+   }
+
+   if ( Shuffle )
+   {
+      H5_Status = H5Pset_shuffle( H5_PropID );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the shuffle filter !!\n" );
+   }
+
+   if ( Deflate )
+   {
+      if ( H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0 )
+         Aux_Error( ERROR_INFO, "the deflate filter is not available in the HDF5 library !!\n" );
+
+      H5_Status = H5Pset_deflate( H5_PropID, OUTPUT_HDF5_DEFLATE_LEVEL );
+      if ( H5_Status < 0 )    Aux_Error( ERROR_INFO, "failed to set the deflate filter !!\n" );
+   }
+
+} // FUNCTION : GetPropList_DataCreate
+
+
+
 #endif // #ifdef SUPPORT_HDF5
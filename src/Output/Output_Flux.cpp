@@ -68,7 +68,7 @@ void Output_Flux( const int lv, const int PID, const int Sib, const char *commen
    fprintf( File, "Flux at %c%c surface\n\n", 45-2*(Sib%2), 120+Sib/2  );
 
 // output flux
-   real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = amr->patch[0][lv][PID]->flux[Sib];
+   real_store (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = amr->patch[0][lv][PID]->flux[Sib];
    if ( FluxPtr != NULL )
    {
 #     if   ( MODEL == HYDRO )
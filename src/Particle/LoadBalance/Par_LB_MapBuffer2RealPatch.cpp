@@ -104,7 +104,7 @@ void Par_LB_MapBuffer2RealPatch( const int lv, const int  Buff_NPatchTotal, int
       Buff_NPatchEachRank[TRank] ++;
    }
 
-   MPI_Alltoall( Buff_NPatchEachRank, 1, MPI_INT, Real_NPatchEachRank, 1, MPI_INT, MPI_COMM_WORLD );
+   LB_SparseAlltoall( Buff_NPatchEachRank, Real_NPatchEachRank );
 
    Real_NPatchTotal = 0;
    for (int r=0; r<MPI_NRank; r++)  Real_NPatchTotal += Real_NPatchEachRank[r];
@@ -151,8 +151,8 @@ void Par_LB_MapBuffer2RealPatch( const int lv, const int  Buff_NPatchTotal, int
 #  endif
 
 // 1-5. collect LBIdx from all ranks
-   MPI_Alltoallv( Buff_LBIdxList_Sort, SendCount_LBIdxList, SendDisp_LBIdxList, MPI_LONG,
-                  Real_LBIdxList_Sort, RecvCount_LBIdxList, RecvDisp_LBIdxList, MPI_LONG, MPI_COMM_WORLD );
+   LB_SparseAlltoallv( Buff_LBIdxList_Sort, SendCount_LBIdxList, SendDisp_LBIdxList, MPI_LONG,
+                       Real_LBIdxList_Sort, RecvCount_LBIdxList, RecvDisp_LBIdxList, MPI_LONG, MPI_COMM_WORLD );
 
 // 1-6. store the sorted PID list
    memcpy( Buff_PIDList, Buff_PIDList_Sort, Buff_NPatchTotal*sizeof(int) );
@@ -99,7 +99,7 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
    {
       RecvBuf_NPatchEachRank = new int [MPI_NRank];
 
-      MPI_Alltoall( SendBuf_NPatchEachRank, 1, MPI_INT, RecvBuf_NPatchEachRank, 1, MPI_INT, MPI_COMM_WORLD );
+      LB_SparseAlltoall( SendBuf_NPatchEachRank, RecvBuf_NPatchEachRank );
    }
 
    NRecvPatchTotal = 0;
@@ -131,8 +131,8 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
    }
 
 // exchange data
-   MPI_Alltoallv( SendBuf_NParEachPatch, SendCount_NParEachPatch, SendDisp_NParEachPatch, MPI_INT,
-                  RecvBuf_NParEachPatch, RecvCount_NParEachPatch, RecvDisp_NParEachPatch, MPI_INT, MPI_COMM_WORLD );
+   LB_SparseAlltoallv( SendBuf_NParEachPatch, SendCount_NParEachPatch, SendDisp_NParEachPatch, MPI_INT,
+                       RecvBuf_NParEachPatch, RecvCount_NParEachPatch, RecvDisp_NParEachPatch, MPI_INT, MPI_COMM_WORLD );
 
 
 // 3. collect LBIdx from all ranks
@@ -140,8 +140,8 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
    {
       RecvBuf_LBIdxEachPatch = new long [NRecvPatchTotal];
 
-      MPI_Alltoallv( SendBuf_LBIdxEachPatch, SendCount_NParEachPatch, SendDisp_NParEachPatch, MPI_LONG,
-                     RecvBuf_LBIdxEachPatch, RecvCount_NParEachPatch, RecvDisp_NParEachPatch, MPI_LONG, MPI_COMM_WORLD );
+      LB_SparseAlltoallv( SendBuf_LBIdxEachPatch, SendCount_NParEachPatch, SendDisp_NParEachPatch, MPI_LONG,
+                          RecvBuf_LBIdxEachPatch, RecvCount_NParEachPatch, RecvDisp_NParEachPatch, MPI_LONG, MPI_COMM_WORLD );
    }
 
 
@@ -188,8 +188,8 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
 
 
 //    exchange data
-      MPI_Alltoallv_GAMER( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_GAMER_REAL_PAR,
-                           RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_GAMER_REAL_PAR, MPI_COMM_WORLD );
+      LB_SparseAlltoallv( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_GAMER_REAL_PAR,
+                          RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_GAMER_REAL_PAR, MPI_COMM_WORLD );
 
 //    free memory
       delete [] SendCount_ParDataEachPatch;
@@ -1,6 +1,7 @@
 #include "GAMER.h"
 
-static bool Check_Gradient( const int i, const int j, const int k, const real Input[], const double Threshold );
+template <typename T>
+static bool Check_Gradient( const int i, const int j, const int k, const T Input[], const double Threshold );
 static bool Check_Curl( const int i, const int j, const int k,
                         const real vx[][PS1][PS1], const real vy[][PS1][PS1], const real vz[][PS1][PS1],
                         const double Threshold );
@@ -39,7 +40,7 @@ static bool Check_Curl( const int i, const int j, const int k,
 //                "false" if none of the refinement criteria is satisfied
 //-------------------------------------------------------------------------------------------------------
 bool Flag_Check( const int lv, const int PID, const int i, const int j, const int k, const real dv,
-                 const real Fluid[][PS1][PS1][PS1], const real Pot[][PS1][PS1], const real MagCC[][PS1][PS1][PS1],
+                 const real_store Fluid[][PS1][PS1][PS1], const real_store Pot[][PS1][PS1], const real MagCC[][PS1][PS1][PS1],
                  const real Vel[][PS1][PS1][PS1], const real Pres[][PS1][PS1], const real Lrtz[][PS1][PS1],
                  const real *Lohner_Var, const real *Lohner_Ave, const real *Lohner_Slope, const int Lohner_NVar,
                  const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff )
@@ -225,6 +226,8 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
 //                2. For cells adjacent to the patch boundaries, only first-order approximation is adopted
 //                   to estimate gradient. Otherwise, second-order approximation is adopted.
 //                   --> Advantage: NO need to prepare the ghost-zone data for the target patch
+//                3. Template is used since "Input" can be either the patch data stored in real_store
+//                   or the derived fields stored in real
 //
 // Parameter   :  i,j,k     : Indices of the target cell in the array "Input"
 //                Input     : Input array
@@ -233,7 +236,8 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
 // Return      :  "true"  if the gradient is larger           than the given threshold
 //                "false" if the gradient is equal or smaller than the given threshold
 //-------------------------------------------------------------------------------------------------------
-bool Check_Gradient( const int i, const int j, const int k, const real Input[], const double Threshold )
+template <typename T>
+bool Check_Gradient( const int i, const int j, const int k, const T Input[], const double Threshold )
 {
 
 // check
@@ -126,8 +126,8 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 //###ISSUE: use atomic ??
 #  pragma omp parallel
    {
-      const real (*Fluid)[PS1][PS1][PS1] = NULL;
-      real (*Pot )[PS1][PS1]             = NULL;
+      const real_store (*Fluid)[PS1][PS1][PS1] = NULL;
+      real_store (*Pot )[PS1][PS1]             = NULL;
       real (*MagCC)[PS1][PS1][PS1]       = NULL;
       real (*Vel)[PS1][PS1][PS1]         = NULL;
       real (*Pres)[PS1][PS1]             = NULL;
@@ -141,6 +141,10 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       int  i_start, i_end, j_start, j_end, k_start, k_end, SibID, SibPID, PID;
       bool ProperNesting, NextPatch;
 
+//    allocate the temporary arrays from the scratch arena of each thread
+//    --> they are released automatically at the end of the OpenMP parallel region
+      ScratchScope_t Scratch;
+
 #     if ( MODEL == HYDRO )
       bool NeedPres = false;
       if ( OPT__FLAG_PRES_GRADIENT )   NeedPres = true;
@@ -149,25 +153,25 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 #     endif
 
 #     ifdef MHD
-      if ( OPT__FLAG_CURRENT || NeedPres )   MagCC    = new real [3][PS1][PS1][PS1];
+      if ( OPT__FLAG_CURRENT || NeedPres )   MagCC    = (real (*)[PS1][PS1][PS1])Scratch.Allocate<real>( 3*CUBE(PS1) );
 #     endif
 #     ifdef SRHD
-      if ( OPT__FLAG_LRTZ_GRADIENT )         Lrtz     = new real    [PS1][PS1][PS1];
+      if ( OPT__FLAG_LRTZ_GRADIENT )         Lrtz     = (real (*)     [PS1][PS1])Scratch.Allocate<real>(   CUBE(PS1) );
 #     endif
-      if ( OPT__FLAG_VORTICITY )             Vel      = new real [3][PS1][PS1][PS1];
-      if ( NeedPres )                        Pres     = new real    [PS1][PS1][PS1];
+      if ( OPT__FLAG_VORTICITY )             Vel      = (real (*)[PS1][PS1][PS1])Scratch.Allocate<real>( 3*CUBE(PS1) );
+      if ( NeedPres )                        Pres     = (real (*)     [PS1][PS1])Scratch.Allocate<real>(   CUBE(PS1) );
 #     endif // HYDRO
 
 #     ifdef PARTICLE
-      if ( OPT__FLAG_NPAR_CELL )             ParCount = new real    [PS1][PS1][PS1];
-      if ( OPT__FLAG_PAR_MASS_CELL )         ParDens  = new real    [PS1][PS1][PS1];
+      if ( OPT__FLAG_NPAR_CELL )             ParCount = (real (*)     [PS1][PS1])Scratch.Allocate<real>(   CUBE(PS1) );
+      if ( OPT__FLAG_PAR_MASS_CELL )         ParDens  = (real (*)     [PS1][PS1])Scratch.Allocate<real>(   CUBE(PS1) );
 #     endif
 
       if ( Lohner_NVar > 0 )
       {
-         Lohner_Var   = new real [ 8*Lohner_NVar*Lohner_NCell *Lohner_NCell *Lohner_NCell  ]; // 8: number of local patches
-         Lohner_Ave   = new real [ 3*Lohner_NVar*Lohner_NAve  *Lohner_NAve  *Lohner_NAve   ]; // 3: X/Y/Z of 1 patch
-         Lohner_Slope = new real [ 3*Lohner_NVar*Lohner_NSlope*Lohner_NSlope*Lohner_NSlope ]; // 3: X/Y/Z of 1 patch
+         Lohner_Var   = Scratch.Allocate<real>( 8*Lohner_NVar*Lohner_NCell *Lohner_NCell *Lohner_NCell  ); // 8: number of local patches
+         Lohner_Ave   = Scratch.Allocate<real>( 3*Lohner_NVar*Lohner_NAve  *Lohner_NAve  *Lohner_NAve   ); // 3: X/Y/Z of 1 patch
+         Lohner_Slope = Scratch.Allocate<real>( 3*Lohner_NVar*Lohner_NSlope*Lohner_NSlope*Lohner_NSlope ); // 3: X/Y/Z of 1 patch
       }
 
 
@@ -571,17 +575,6 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
          } // for (int LocalID=0; LocalID<8; LocalID++)
       } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
 
-
-      delete [] MagCC;
-      delete [] Vel;
-      delete [] Pres;
-      delete [] Lrtz;
-      delete [] ParCount;
-      delete [] ParDens;
-      delete [] Lohner_Var;
-      delete [] Lohner_Ave;
-      delete [] Lohner_Slope;
-
    } // OpenMP parallel region
 
 
@@ -24,6 +24,15 @@ void ELBDM_GetPhase_DebugOnly( real *CData, const int CSize );
 void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 {
 
+// patch indices may change --> clear the patch-data cache
+   Prepare_PatchData_Cache_Reset();
+
+// patch indices may change --> the potential in 1-PotSg at lv+1 can no longer serve as the warm start of the Poisson solver
+#  ifdef GRAVITY
+   if ( lv < NLEVEL-1 )    amr->PotRefineTime[lv+1] = Time[lv];
+#  endif
+
+
 // invoke the load-balance refine function
 #  ifdef LOAD_BALANCE
    if ( UseLBFunc == USELB_YES )
@@ -10,7 +10,8 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
                             const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
                                   real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                             const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
-                            const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme );
+                            const real Omega, const real Tolerated_Error, const real Poi_Coeff,
+                            const IntScheme_t IntScheme, const bool WarmStart );
 
 #elif ( POT_SCHEME == MG  )
 void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
@@ -18,7 +19,7 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
                                  real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                            const int NPatchGroup, const real dh_Min, const int Max_Iter, const int NPre_Smooth,
                            const int NPost_Smooth, const real Tolerated_Error, const real Poi_Coeff,
-                           const IntScheme_t IntScheme );
+                           const IntScheme_t IntScheme, const bool WarmStart );
 #endif // POT_SCHEME
 
 void CPU_ExtPotSolver( real g_Pot_Array[][ CUBE(GRA_NXT) ],
@@ -81,10 +82,13 @@ void CPU_ELBDMGravitySolver(       real Flu_Array[][GRA_NIN][PATCH_SIZE][PATCH_S
 //                SOR_Min_Iter       : Minimum number of iterations for SOR
 //                SOR_Max_Iter       : Maximum number of iterations for SOR
 //                SOR_Omega          : Over-relaxation parameter
+//                SOR_Tolerated_Error: Maximum tolerated relative residual for SOR (only used with WarmStart)
 //                MG_Max_Iter        : Maximum number of iterations for multigrid
 //                MG_NPre_Smooth     : Number of pre-smoothing steps for multigrid
 //                MG_NPos_tSmooth    : Number of post-smoothing steps for multigrid
 //                MG_Tolerated_Error : Maximum tolerated error for multigrid
+//                WarmStart          : Start the Poisson solver from the initial guess stored in the central region
+//                                     of h_Pot_Array_Out (see Poi_Prepare_Pot())
 //                Poi_Coeff          : Coefficient in front of the RHS in the Poisson eq.
 //                IntScheme          : Interpolation scheme for potential
 //                                     --> currently supported schemes include
@@ -119,8 +123,9 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
                                      char h_DE_Array     [][PS1][PS1][PS1],
                                const real h_Emag_Array   [][PS1][PS1][PS1],
                                const int NPatchGroup, const real dt, const real dh, const int SOR_Min_Iter,
-                               const int SOR_Max_Iter, const real SOR_Omega, const int MG_Max_Iter,
-                               const int MG_NPre_Smooth, const int MG_NPost_Smooth, const real MG_Tolerated_Error,
+                               const int SOR_Max_Iter, const real SOR_Omega, const real SOR_Tolerated_Error,
+                               const int MG_Max_Iter, const int MG_NPre_Smooth, const int MG_NPost_Smooth,
+                               const real MG_Tolerated_Error, const bool WarmStart,
                                const real Poi_Coeff, const IntScheme_t IntScheme, const bool P5_Gradient,
                                const real ELBDM_Eta, const real ELBDM_Lambda, const bool Poisson, const bool GraAcc,
                                const bool SelfGravity, const OptExtPot_t ExtPot, const OptExtAcc_t ExtAcc,
@@ -172,14 +177,14 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
 #        if   ( POT_SCHEME == SOR )
 
          CPU_PoissonSolver_SOR( h_Rho_Array, h_Pot_Array_In, h_Pot_Array_Out, NPatchGroup, dh,
-                                SOR_Min_Iter, SOR_Max_Iter, SOR_Omega,
-                                Poi_Coeff, IntScheme );
+                                SOR_Min_Iter, SOR_Max_Iter, SOR_Omega, SOR_Tolerated_Error,
+                                Poi_Coeff, IntScheme, WarmStart );
 
 #        elif ( POT_SCHEME == MG  )
 
          CPU_PoissonSolver_MG ( h_Rho_Array, h_Pot_Array_In, h_Pot_Array_Out, NPatchGroup, dh,
                                 MG_Max_Iter, MG_NPre_Smooth, MG_NPost_Smooth, MG_Tolerated_Error,
-                                Poi_Coeff, IntScheme );
+                                Poi_Coeff, IntScheme, WarmStart );
 
 #        else
 
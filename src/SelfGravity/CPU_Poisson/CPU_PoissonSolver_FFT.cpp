@@ -6,8 +6,15 @@
 
 static void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const long RhoK_Size );
 static void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const long RhoK_Size );
+#ifdef SUPPORT_FFTW_PENCIL
+static void FFT_Periodic_Pencil( real *RhoK, const real Poi_Coeff );
+static void CPU_PoissonSolver_FFT_Pencil( const real Poi_Coeff, const int SaveSg, const double PrepTime );
+#endif
 
 extern root_fftw::real_plan_nd     FFTW_Plan_Poi, FFTW_Plan_Poi_Inv;
+#ifdef SUPPORT_FFTW_PENCIL
+extern FFTW_Pencil_t               FFTW_Pencil_Poi;
+#endif
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  FFT_Periodic
@@ -132,6 +139,10 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const l
 
 
 // forward FFT
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )    FFTW_Pencil_R2C( FFTW_Pencil_Poi, RhoK );
+   else
+#  endif
    root_fftw_r2c( FFTW_Plan_Poi, RhoK );
 
 
@@ -149,6 +160,10 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const l
 
 
 // backward FFT
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )    FFTW_Pencil_C2R( FFTW_Pencil_Poi, RhoK );
+   else
+#  endif
    root_fftw_c2r( FFTW_Plan_Poi_Inv, RhoK );
 
 // effect of "4*PI*NEWTON_G" has been included in gFuncK, but the scale factor in the comoving frame hasn't
@@ -162,11 +177,157 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const l
 } // FUNCTION : FFT_Isolated
 
 
+
+#ifdef SUPPORT_FFTW_PENCIL
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Periodic_Pencil
+// Description :  Counterpart of FFT_Periodic() for OPT__FFTW_PENCIL
+//
+// Note        :  1. The k-space data are stored in the z-pencil layout [kx][ky][z] (see FFTW_Pencil_t in FFTW.h)
+//                2. Effect from the homogenerous background density (DC) will be ignored by setting the k=0 mode
+//                   equal to zero
+//
+// Parameter   :  RhoK      : Array storing the input density and output potential
+//                Poi_Coeff : Coefficient in front of density in the Poisson equation (4*Pi*Newton_G*a)
+//-------------------------------------------------------------------------------------------------------
+void FFT_Periodic_Pencil( real *RhoK, const real Poi_Coeff )
+{
+
+   const FFTW_Pencil_t &Pencil = FFTW_Pencil_Poi;
+
+   const int Nx        = NX0_TOT[0];
+   const int Ny        = NX0_TOT[1];
+   const int Nz        = NX0_TOT[2];
+   const int Nx_Padded = Nx/2 + 1;
+   const int i_start   = Pencil.List_kx_start[ Pencil.Coord[0] ];
+   const int j_start   = Pencil.List_ky_start[ Pencil.Coord[1] ];
+   const real dh       = amr->dh[0];
+   real Deno;
+   gamer_fftw::fft_complex *cdata;
+
+
+// forward FFT
+   FFTW_Pencil_R2C( FFTW_Pencil_Poi, RhoK );
+
+// the data are now complex, so typecast a pointer
+   cdata = (gamer_fftw::fft_complex*) RhoK;
+
+
+// set up the dimensionless wave number and the corresponding sin(k)^2 function
+   real kx[Nx_Padded], ky[Ny], kz[Nz];
+   real sinkx2[Nx_Padded], sinky2[Ny], sinkz2[Nz];
+
+   for (int i=0; i<Nx_Padded; i++) {   kx    [i] = 2.0*M_PI/Nx*i;
+                                       sinkx2[i] = SQR(  SIN( (real)0.5*kx[i] )  );    }
+   for (int j=0; j<Ny;        j++) {   ky    [j] = ( j <= Ny/2 ) ? 2.0*M_PI/Ny*j : 2.0*M_PI/Ny*(j-Ny);
+                                       sinky2[j] = SQR(  SIN( (real)0.5*ky[j] )  );    }
+   for (int k=0; k<Nz;        k++) {   kz    [k] = ( k <= Nz/2 ) ? 2.0*M_PI/Nz*k : 2.0*M_PI/Nz*(k-Nz);
+                                       sinkz2[k] = SQR(  SIN( (real)0.5*kz[k] )  );    }
+
+
+// divide the Rho_K by -k^2
+   long ID;
+   int  i, j;
+
+   for (int ii=0; ii<Pencil.local_nkx; ii++)
+   {
+      i = i_start + ii;
+
+      for (int jj=0; jj<Pencil.local_nky; jj++)
+      {
+         j = j_start + jj;
+
+         for (int k=0; k<Nz; k++)
+         {
+            ID = ((long)ii*Pencil.local_nky + jj)*Nz + k;
+
+//          this form is more consistent with the "second-order discrete" Laplacian operator
+            Deno = -4.0 * ( sinkx2[i] + sinky2[j] + sinkz2[k] );
+
+//          remove the DC mode
+            if ( Deno == 0.0 )
+            {
+               c_re(cdata[ID]) = 0.0;
+               c_im(cdata[ID]) = 0.0;
+            }
+
+            else
+            {
+               c_re(cdata[ID]) =  c_re(cdata[ID]) * Poi_Coeff / Deno;
+               c_im(cdata[ID]) =  c_im(cdata[ID]) * Poi_Coeff / Deno;
+            }
+         } // k
+      } // jj
+   } // ii
+
+
+// backward FFT
+   FFTW_Pencil_C2R( FFTW_Pencil_Poi, RhoK );
+
+// normalization
+   const real norm = dh*dh / ( (real)Nx*Ny*Nz );
+
+   for (long t=0; t<Pencil.total_local_size; t++)  RhoK[t] *= norm;
+
+} // FUNCTION : FFT_Periodic_Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_PoissonSolver_FFT_Pencil
+// Description :  Counterpart of CPU_PoissonSolver_FFT() for OPT__FFTW_PENCIL
+//
+// Note        :  Invoked by CPU_PoissonSolver_FFT()
+//
+// Parameter   :  Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
+//                SaveSg    : Sandglass to store the updated data
+//                PrepTime  : Physical time for preparing the density field
+//-------------------------------------------------------------------------------------------------------
+void CPU_PoissonSolver_FFT_Pencil( const real Poi_Coeff, const int SaveSg, const double PrepTime )
+{
+
+   const long total_local_size = FFTW_Pencil_Poi.total_local_size;
+   const bool ForPoisson       = true;   // preparing the density field for the Poisson solver
+
+   real *RhoK = (real*) root_fftw::fft_malloc( sizeof(real)*MAX(total_local_size,1L) );  // array storing both density and potential
+
+
+// initialize RhoK as zeros for the isolated BC where the zero-padding method is adopted
+   if ( OPT__BC_POT == BC_POT_ISOLATED )
+      for (long t=0; t<total_local_size; t++)   RhoK[t] = (real)0.0;
+
+
+// rearrange data from patch to pencil
+   Patch2Pencil( RhoK, FFTW_Pencil_Poi, PrepTime, _TOTAL_DENS, ForPoisson, OPT__GRAVITY_EXTRA_MASS );
+
+
+// evaluate potential by FFT
+   if      ( OPT__BC_POT == BC_POT_PERIODIC )
+      FFT_Periodic_Pencil( RhoK, Poi_Coeff );
+
+   else if ( OPT__BC_POT == BC_POT_ISOLATED )
+      FFT_Isolated( RhoK, GreenFuncK, Poi_Coeff, total_local_size );
+
+   else
+      Aux_Error( ERROR_INFO, "unsupported paramter %s = %d !!\n", "OPT__BC_POT", OPT__BC_POT );
+
+
+// rearrange data from pencil back to patch
+   Pencil2Patch( RhoK, FFTW_Pencil_Poi, SaveSg, _POTE );
+
+
+   root_fftw::fft_free(RhoK);
+
+} // FUNCTION : CPU_PoissonSolver_FFT_Pencil
+#endif // #ifdef SUPPORT_FFTW_PENCIL
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  CPU_PoissonSolver_FFT
 // Description :  Evaluate the base-level potential by FFT
 //
-// Note        :  Work with both periodic and isolated BC's
+// Note        :  1. Work with both periodic and isolated BC's
+//                2. Use the pencil decomposition instead of the FFTW slab decomposition for OPT__FFTW_PENCIL
 //
 // Parameter   :  Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
 //                SaveSg    : Sandglass to store the updated data
@@ -175,6 +336,14 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const l
 void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double PrepTime )
 {
 
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )
+   {
+      CPU_PoissonSolver_FFT_Pencil( Poi_Coeff, SaveSg, PrepTime );
+      return;
+   }
+#  endif
+
 // determine the FFT size (the zero-padding method is adopted for the isolated BC)
    int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
@@ -0,0 +1,854 @@
+#include "GAMER.h"
+
+#if ( defined GRAVITY  &&  defined LOAD_BALANCE )
+
+
+
+#define NPRE_SMOOTH     2           // number of red-black Gauss-Seidel sweeps before the coarse-grid correction
+#define NPOST_SMOOTH    2           // number of red-black Gauss-Seidel sweeps after  the coarse-grid correction
+#define BOTTOM_MAX_ITER 200         // maximum number of conjugate-gradient iterations at the bottom level
+#define BOTTOM_TOL      1.0e-3      // residual reduction required by the bottom-level conjugate-gradient solver
+#define MAX_NLV         10          // maximum number of multigrid levels
+
+
+// data of one multigrid level
+// --> each patch is coarsened independently (PS1 -> PS1/2 -> ... -> 1 cell per patch), so the sibling relation
+//     of patches is shared by all multigrid levels
+struct LevelMG_t
+{
+   int   N;       // number of cells per patch along each direction
+   int   NG;      // N + 2 (one ghost cell on each side)
+   real  dh2;     // square of the cell size
+   real *Sol;     // solution of real patches including ghost zones   [NReal][NG][NG][NG]
+   real *RHS;     // right-hand side of real patches                 [NReal][N ][N ][N ]
+   real *Res;     // residual of real patches                        [NReal][N ][N ][N ]
+   real *Buf;     // solution of buffer patches without ghost zones  [NBuff][N ][N ][N ]
+   long *Send_NCount;   // number of cells sent to/received from each rank by LevelMG_Exchange() [MPI_NRank]
+   long *Recv_NCount;   // --> set once per solve
+   long *Send_NDisp;
+   long *Recv_NDisp;
+};
+
+static void   LevelMG_FillGhost( const int lv, const LevelMG_t &G, const bool Finest, real *Arr, real *BufArr,
+                                 const int (*Sib)[6] );
+static void   LevelMG_Exchange( const int lv, const LevelMG_t &G, const real *Arr, real *BufArr );
+static void   LevelMG_Smooth( const LevelMG_t &G, const int m, const int (*Corner)[3], const int Color );
+static double LevelMG_Residual( const LevelMG_t &G, const real *Arr, const real *RHS, real *Res );
+static void   LevelMG_Restrict( const LevelMG_t &F, const LevelMG_t &C );
+static void   LevelMG_Prolongate( const LevelMG_t &C, const LevelMG_t &F );
+static void   LevelMG_VCycle( const int lv, LevelMG_t *G, const int m, const int Bottom, const int (*Sib)[6],
+                              const int (*Corner)[3] );
+static void   LevelMG_BottomSolve( const int lv, const LevelMG_t &G, const int (*Sib)[6] );
+
+static int NReal, NBuff;
+static real *MPI_SendBuf, *MPI_RecvBuf;     // MPI buffers of LevelMG_Exchange() shared by all multigrid levels
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_PoissonSolver_LevelMG
+// Description :  Solve the Poisson equation of all patches at lv>0 simultaneously by a level-wide multigrid
+//
+// Note        :  1. Alternative to the patch-by-patch SOR/MG solvers invoked by InvokeSolver() when
+//                   OPT__POT_LEVEL_MG is on
+//                   --> Invoked by Gra_AdvanceDt()
+//                2. The unknowns are the cells of all real patches at lv. Cells adjacent to sibling patches
+//                   are coupled directly, and only the faces without sibling patches (i.e., the coarse-fine
+//                   interfaces and the non-periodic domain boundaries) use the Dirichlet B.C. interpolated
+//                   from the coarse-grid potential
+//                   --> Unlike the patch-by-patch solvers, the solution is continuous across patch boundaries
+//                       and no ghost zones (RHO_NXT/POT_NXT) are solved redundantly
+//                3. V-cycle with red-black Gauss-Seidel smoothing and a conjugate-gradient bottom solver
+//                   --> Multigrid levels coarsen each patch independently down to one cell per patch
+//                   --> Face ghost zones are exchanged between smoothing sweeps using the send/recv lists of
+//                       LB_GetBufferData() (SendG/RecvG) on all multigrid levels
+//                   --> The exchange carries "real" data so that the buffer patches have the same precision as
+//                       the real patches even when the patch data are stored in lower precision (FLOAT4_STORE)
+//                   --> The MPI counts and buffers are set up once per solve and the exchange only involves the
+//                       neighbor ranks when OPT__MPI_SPARSE is on (see LevelMG_Exchange())
+//                4. Iterate until the L2 norm of the residual is reduced by POT_LEVEL_MG_TOLERATED_ERROR,
+//                   POT_LEVEL_MG_MAX_ITER V-cycles are reached, or the residual no longer decreases
+//                5. External potential is added afterwards if OPT__EXT_POT is on
+//                6. Only potential of real patches is updated. The caller must fill the buffer patches.
+//
+// Parameter   :  lv        : Target refinement level (>0)
+//                Poi_Coeff : Coefficient in front of density in the Poisson equation (4*Pi*Newton_G*a)
+//                SaveSg    : Sandglass to store the updated potential
+//                PrepTime  : Physical time to prepare the density and the coarse-grid potential
+//
+// Return      :  amr->patch->pot[]
+//-------------------------------------------------------------------------------------------------------
+void CPU_PoissonSolver_LevelMG( const int lv, const real Poi_Coeff, const int SaveSg, const double PrepTime )
+{
+
+// check
+   if ( lv <= 0  ||  lv >= NLEVEL )    Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
+   if ( SaveSg != 0  &&  SaveSg != 1 ) Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "SaveSg", SaveSg );
+
+   if ( NPatchTotal[lv] == 0 )   return;
+
+
+   NReal = amr->NPatchComma[lv][ 1];
+   NBuff = amr->NPatchComma[lv][27] - NReal;
+
+   const double dh       = amr->dh[lv];
+   const int    NPG_Real = NReal/8;
+   const int    NPG_Max  = ( POT_GPU_NPGROUP > 0 ) ? POT_GPU_NPGROUP : 1;
+
+
+// 1. set up the multigrid levels
+// ------------------------------------------------------------------------------------------------------------
+   LevelMG_t G[MAX_NLV];
+   int Bottom = 0;
+
+   G[0].N = PS1;
+   while ( G[Bottom].N%2 == 0  &&  G[Bottom].N > 1  &&  Bottom+1 < MAX_NLV )
+   {
+      G[Bottom+1].N = G[Bottom].N/2;
+      Bottom ++;
+   }
+
+   for (int m=0; m<=Bottom; m++)
+   {
+      G[m].NG  = G[m].N + 2;
+      G[m].dh2 = SQR( dh*(1<<m) );
+      G[m].Sol = new real [ (long)NReal*CUBE(G[m].NG) ];
+      G[m].RHS = new real [ (long)NReal*CUBE(G[m].N ) ];
+      G[m].Res = new real [ (long)NReal*CUBE(G[m].N ) ];
+      G[m].Buf = new real [ (long)NBuff*CUBE(G[m].N) ];
+
+//    MPI counts of LevelMG_Exchange()
+      const int N3 = CUBE( G[m].N );
+
+      G[m].Send_NCount = new long [MPI_NRank];
+      G[m].Recv_NCount = new long [MPI_NRank];
+      G[m].Send_NDisp  = new long [MPI_NRank];
+      G[m].Recv_NDisp  = new long [MPI_NRank];
+
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         G[m].Send_NCount[r] = (long)amr->LB->SendG_NList[lv][r]*N3;
+         G[m].Recv_NCount[r] = (long)amr->LB->RecvG_NList[lv][r]*N3;
+      }
+
+      G[m].Send_NDisp[0] = 0;
+      G[m].Recv_NDisp[0] = 0;
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         G[m].Send_NDisp[r] = G[m].Send_NDisp[r-1] + G[m].Send_NCount[r-1];
+         G[m].Recv_NDisp[r] = G[m].Recv_NDisp[r-1] + G[m].Recv_NCount[r-1];
+      }
+   }
+
+// MPI buffers are sized for the finest level and are shared by all levels
+   const long NSend_Total = G[0].Send_NDisp[MPI_NRank-1] + G[0].Send_NCount[MPI_NRank-1];
+   const long NRecv_Total = G[0].Recv_NDisp[MPI_NRank-1] + G[0].Recv_NCount[MPI_NRank-1];
+
+   MPI_SendBuf = new real [NSend_Total];
+   MPI_RecvBuf = new real [NRecv_Total];
+
+// face siblings and the cell indices of the patch corners at lv (for the red-black ordering)
+   int (*Sib)[6]    = new int [NReal][6];
+   int (*Corner)[3] = new int [NReal][3];
+
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int s=0; s<6; s++)    Sib   [PID][s] = amr->patch[0][lv][PID]->sibling[s];
+      for (int d=0; d<3; d++)    Corner[PID][d] = amr->patch[0][lv][PID]->corner[d] / amr->scale[lv];
+   }
+
+
+// 2. prepare the right-hand side and the initial guess/boundary values at the finest level
+// ------------------------------------------------------------------------------------------------------------
+   const bool   IntPhase_No       = false;
+   const bool   DE_Consistency_No = false;
+   const bool   Monotonicity_No   = false;
+   const bool   OppSign0thOrder_No= false;
+   const real   MinPres_No        = -1.0;
+   const real   MinTemp_No        = -1.0;
+   const real   MinEntr_No        = -1.0;
+   const int    CGhost            = ( POT_NXT - PS1/2 )/2;   // coarse-grid ghost zones in h_Pot_Array_P_In[]
+   const int    FSize             = PS1 + 4;                  // interpolate two fine-grid ghost cells on each side
+   const int    CSize3 [3]        = { POT_NXT, POT_NXT, POT_NXT };
+   const int    CStart3[3]        = { CGhost-1, CGhost-1, CGhost-1 };
+   const int    CRange3[3]        = { PS1/2+2, PS1/2+2, PS1/2+2 };
+   const int    FSize3 [3]        = { FSize, FSize, FSize };
+   const int    FStart3[3]        = { 0, 0, 0 };
+   const int    NG0               = G[0].NG;
+
+#  ifdef COMOVING
+   const bool Comoving = true;
+#  else
+   const bool Comoving = false;
+#  endif
+   real RhoSubtract = (real)0.0;
+   if      ( OPT__BC_POT == BC_POT_PERIODIC )   RhoSubtract = AveDensity_Init;
+   else if ( Comoving )                         RhoSubtract = (real)1.0;
+
+   real (*Rho )[PS1][PS1][PS1]             = new real [8*NPG_Max][PS1][PS1][PS1];
+   real (*CPot)[POT_NXT][POT_NXT][POT_NXT] = new real [8*NPG_Max][POT_NXT][POT_NXT][POT_NXT];
+   int   *PID0_List                        = new int  [NPG_Max];
+
+   for (int PG_Start=0; PG_Start<NPG_Real; PG_Start+=NPG_Max)
+   {
+      const int NPG = MIN( NPG_Max, NPG_Real-PG_Start );
+
+      for (int t=0; t<NPG; t++)  PID0_List[t] = 8*( PG_Start + t );
+
+//    2-1. density without ghost zones
+      Prepare_PatchData( lv, PrepTime, &Rho[0][0][0][0], NULL, 0, NPG, PID0_List, _TOTAL_DENS, _NONE,
+                         OPT__RHO_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_00, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
+                         MIN_DENS, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+
+//    2-2. coarse-grid potential (excluding external potential)
+      Poi_Prepare_Pot( lv, PrepTime, CPot, NULL, NPG, PID0_List, false );
+
+#     pragma omp parallel
+      {
+         real (*FPot)[FSize][FSize] = new real [FSize][FSize][FSize];
+
+#        pragma omp for schedule( runtime )
+         for (int N=0; N<8*NPG; N++)
+         {
+            const int PID = PID0_List[N/8] + N%8;
+            real *RHS = G[0].RHS + (long)PID*CUBE(PS1);
+            real *Sol = G[0].Sol + (long)PID*CUBE(NG0);
+
+//          RHS = Poi_Coeff*( rho + extra mass - background density )
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               real Dens = Rho[N][k][j][i];
+
+               if ( OPT__GRAVITY_EXTRA_MASS )
+               {
+                  const double x = amr->patch[0][lv][PID]->EdgeL[0] + (i+0.5)*dh;
+                  const double y = amr->patch[0][lv][PID]->EdgeL[1] + (j+0.5)*dh;
+                  const double z = amr->patch[0][lv][PID]->EdgeL[2] + (k+0.5)*dh;
+
+                  Dens += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[lv], lv, NULL );
+               }
+
+               RHS[ (k*PS1 + j)*PS1 + i ] = Poi_Coeff*( Dens - RhoSubtract );
+            }
+
+//          interpolate the coarse-grid potential to the patch and its one-cell ghost zones
+//          --> the interior serves as the initial guess and the ghost zones as the Dirichlet B.C.
+            Interpolate( &CPot[N][0][0][0], CSize3, CStart3, CRange3, &FPot[0][0][0], FSize3, FStart3,
+                         1, OPT__POT_INT_SCHEME, IntPhase_No, &Monotonicity_No, OppSign0thOrder_No,
+                         ALL_CONS_NO, INT_PRIM_NO, INT_FIX_MONO_COEFF, NULL, NULL );
+
+            for (int k=0; k<NG0; k++)
+            for (int j=0; j<NG0; j++)
+            for (int i=0; i<NG0; i++)
+               Sol[ (k*NG0 + j)*NG0 + i ] = FPot[k+1][j+1][i+1];
+         } // for (int N=0; N<8*NPG; N++)
+
+         delete [] FPot;
+      } // OpenMP parallel region
+   } // for (int PG_Start=0; PG_Start<NPG_Real; PG_Start+=NPG_Max)
+
+   delete [] Rho;
+   delete [] CPot;
+   delete [] PID0_List;
+
+
+// 3. V-cycles
+// ------------------------------------------------------------------------------------------------------------
+// replace the ghost zones shared with sibling patches by the initial guess of the siblings
+   LevelMG_FillGhost( lv, G[0], true, G[0].Sol, G[0].Buf, Sib );
+
+   double ResNorm_Local = LevelMG_Residual( G[0], G[0].Sol, G[0].RHS, G[0].Res ), ResNorm0, ResNorm, ResNorm_Prev;
+   MPI_Allreduce( &ResNorm_Local, &ResNorm0, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+   ResNorm0     = sqrt( ResNorm0 );
+   ResNorm      = ResNorm0;
+   ResNorm_Prev = ResNorm0;
+
+   int  Iter      = 0;
+   bool Stagnated = false;
+   while ( Iter < POT_LEVEL_MG_MAX_ITER  &&  ResNorm > POT_LEVEL_MG_TOLERATED_ERROR*ResNorm0 )
+   {
+      LevelMG_VCycle( lv, G, 0, Bottom, Sib, Corner );
+      Iter ++;
+
+      ResNorm_Local = LevelMG_Residual( G[0], G[0].Sol, G[0].RHS, G[0].Res );
+      MPI_Allreduce( &ResNorm_Local, &ResNorm, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+      ResNorm = sqrt( ResNorm );
+
+//    stop if the residual no longer decreases (i.e., it has reached the round-off level)
+      if ( ResNorm >= ResNorm_Prev )
+      {
+         Stagnated = true;
+         break;
+      }
+
+      ResNorm_Prev = ResNorm;
+   }
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "      Lv %2d: level-wide multigrid, V-cycles = %3d, residual reduction = %13.7e\n",
+                   lv, Iter, ( ResNorm0 > 0.0 ) ? ResNorm/ResNorm0 : 0.0 );
+
+// only warn if the iterations are exhausted since the round-off level of single precision can exceed the tolerated error
+   if ( ResNorm > POT_LEVEL_MG_TOLERATED_ERROR*ResNorm0  &&  !Stagnated  &&  MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : level-wide multigrid at lv %d does not converge (V-cycles %d, residual reduction %13.7e > %13.7e) !!\n",
+                   lv, Iter, ResNorm/ResNorm0, POT_LEVEL_MG_TOLERATED_ERROR );
+
+
+// 4. store the solution (and add the external potential)
+// ------------------------------------------------------------------------------------------------------------
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real   *Sol = G[0].Sol + (long)PID*CUBE(NG0);
+      const double  x0  = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh;
+      const double  y0  = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh;
+      const double  z0  = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh;
+
+      for (int k=0; k<PS1; k++)  {  const double z = z0 + k*dh;
+      for (int j=0; j<PS1; j++)  {  const double y = y0 + j*dh;
+      for (int i=0; i<PS1; i++)  {  const double x = x0 + i*dh;
+
+         real Pot = Sol[ ((k+1)*NG0 + j+1)*NG0 + i+1 ];
+
+         if ( OPT__EXT_POT )
+            Pot += CPUExtPot_Ptr( x, y, z, PrepTime, ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                  EXT_POT_USAGE_ADD, h_ExtPotTable, h_ExtPotGenePtr );
+
+         amr->patch[SaveSg][lv][PID]->pot[k][j][i] = Pot;
+      }}}
+   }
+
+
+// 5. free memory
+// ------------------------------------------------------------------------------------------------------------
+   for (int m=0; m<=Bottom; m++)
+   {
+      delete [] G[m].Sol;
+      delete [] G[m].RHS;
+      delete [] G[m].Res;
+      delete [] G[m].Buf;
+      delete [] G[m].Send_NCount;
+      delete [] G[m].Recv_NCount;
+      delete [] G[m].Send_NDisp;
+      delete [] G[m].Recv_NDisp;
+   }
+
+   delete [] MPI_SendBuf;
+   delete [] MPI_RecvBuf;
+   delete [] Sib;
+   delete [] Corner;
+
+} // FUNCTION : CPU_PoissonSolver_LevelMG
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_VCycle
+// Description :  Apply one multigrid V-cycle starting from the multigrid level m
+//
+// Note        :  1. The ghost zones of G[m].Sol must be up to date on input and are up to date on output
+//                2. Coarser levels solve the residual equation with homogeneous Dirichlet B.C. on the patch
+//                   faces without sibling patches
+//
+// Parameter   :  lv     : Target AMR level
+//                G      : Multigrid levels
+//                m      : Current multigrid level
+//                Bottom : Coarsest multigrid level
+//                Sib    : Face siblings of all real patches
+//                Corner : Cell indices of the corners of all real patches at lv
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_VCycle( const int lv, LevelMG_t *G, const int m, const int Bottom, const int (*Sib)[6],
+                     const int (*Corner)[3] )
+{
+
+   const bool Finest = ( m == 0 );
+
+   if ( m == Bottom )
+   {
+      LevelMG_BottomSolve( lv, G[m], Sib );
+      return;
+   }
+
+
+// pre-smoothing
+   for (int s=0; s<NPRE_SMOOTH; s++)
+   for (int Color=0; Color<2; Color++)
+   {
+      LevelMG_Smooth( G[m], m, Corner, Color );
+      LevelMG_FillGhost( lv, G[m], Finest, G[m].Sol, G[m].Buf, Sib );
+   }
+
+// coarse-grid correction
+   LevelMG_Residual( G[m], G[m].Sol, G[m].RHS, G[m].Res );
+   LevelMG_Restrict( G[m], G[m+1] );
+   LevelMG_VCycle( lv, G, m+1, Bottom, Sib, Corner );
+   LevelMG_Prolongate( G[m+1], G[m] );
+   LevelMG_FillGhost( lv, G[m], Finest, G[m].Sol, G[m].Buf, Sib );
+
+// post-smoothing
+   for (int s=0; s<NPOST_SMOOTH; s++)
+   for (int Color=0; Color<2; Color++)
+   {
+      LevelMG_Smooth( G[m], m, Corner, Color );
+      LevelMG_FillGhost( lv, G[m], Finest, G[m].Sol, G[m].Buf, Sib );
+   }
+
+} // FUNCTION : LevelMG_VCycle
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_FillGhost
+// Description :  Fill up the face ghost zones of all real patches
+//
+// Note        :  1. Ghost zones adjacent to sibling patches are copied from the siblings
+//                   --> Buffer patches are filled by LevelMG_Exchange() on all levels
+//                   --> Do not go through amr->patch->pot[], which may be stored in lower precision
+//                2. Ghost zones without sibling patches
+//                   --> Finest level : remain unchanged (i.e., the Dirichlet B.C. set initially)
+//                       Other  levels: homogeneous Dirichlet B.C. on the patch face (ghost = -interior)
+//
+// Parameter   :  lv     : Target AMR level
+//                G      : Target multigrid level
+//                Finest : Whether G is the finest multigrid level
+//                Arr    : Array with ghost zones to be filled [NReal][NG][NG][NG]
+//                BufArr : Array to store the data of buffer patches [NBuff][N][N][N]
+//                Sib    : Face siblings of all real patches
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_FillGhost( const int lv, const LevelMG_t &G, const bool Finest, real *Arr, real *BufArr,
+                        const int (*Sib)[6] )
+{
+
+   const int N   = G.N;
+   const int NG  = G.NG;
+   const int NG3 = CUBE( NG );
+   const int N3  = CUBE( N );
+
+
+// 1. fill up the buffer patches
+   LevelMG_Exchange( lv, G, Arr, BufArr );
+
+
+// 2. fill up the face ghost zones
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      real *Ptr = Arr + (long)PID*NG3;
+
+      for (int s=0; s<6; s++)
+      {
+         const int SibPID = Sib[PID][s];
+         const int d      = s/2;                             // normal direction
+         const int da     = (d+1)%3;                         // tangential directions
+         const int db     = (d+2)%3;
+         const int Ghost  = ( s%2 == 0 ) ? 0   : N+1;        // ghost index along d (with ghost zones)
+         const int Inner  = ( s%2 == 0 ) ? 1   : N;          // adjacent interior index along d (with ghost zones)
+         const int Src    = ( s%2 == 0 ) ? N-1 : 0;          // source index along d in the sibling (without ghost zones)
+
+//       finest level without sibling --> keep the Dirichlet B.C.
+         if ( SibPID < 0  &&  Finest )    continue;
+
+         int IdxG[3], IdxS[3];
+
+         for (int b=0; b<N; b++)
+         for (int a=0; a<N; a++)
+         {
+            IdxG[d] = Ghost;  IdxG[da] = a+1;  IdxG[db] = b+1;
+            IdxS[d] = Src;    IdxS[da] = a;    IdxS[db] = b;
+
+            const int tG = ( IdxG[2]*NG + IdxG[1] )*NG + IdxG[0];
+            real Val;
+
+            if      ( SibPID < 0 )
+            {
+               IdxG[d] = Inner;
+               Val     = -Ptr[ ( IdxG[2]*NG + IdxG[1] )*NG + IdxG[0] ];
+            }
+
+            else if ( SibPID < NReal )
+               Val = Arr[ (long)SibPID*NG3 + ( (IdxS[2]+1)*NG + IdxS[1]+1 )*NG + IdxS[0]+1 ];
+
+            else
+               Val = BufArr[ (long)(SibPID-NReal)*N3 + ( IdxS[2]*N + IdxS[1] )*N + IdxS[0] ];
+
+            Ptr[tG] = Val;
+         }
+      } // for (int s=0; s<6; s++)
+   } // for (int PID=0; PID<NReal; PID++)
+
+} // FUNCTION : LevelMG_FillGhost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_Exchange
+// Description :  Send the interior data of real patches to the buffer patches of other ranks at a
+//                multigrid level
+//
+// Note        :  1. Use the same send/recv lists as LB_GetBufferData() in the mode POT_FOR_POISSON
+//                   (i.e., amr->LB->SendG/RecvG_XXX)
+//                2. Whole patches are sent for simplicity
+//                   --> At the finest level this sends PS1^3 instead of PS1^2 cells per face, which is
+//                       acceptable since the level-wide solver exchanges a single field
+//                3. MPI counts (G.Send/Recv_NCount/NDisp) and buffers (MPI_SendBuf/RecvBuf) are prepared once
+//                   per solve by CPU_PoissonSolver_LevelMG()
+//                4. Use LB_SparseAlltoallv() so that only the neighbor ranks are involved when OPT__MPI_SPARSE is on
+//
+// Parameter   :  lv     : Target AMR level
+//                G      : Target multigrid level
+//                Arr    : Array of real patches with ghost zones [NReal][N+2][N+2][N+2]
+//                BufArr : Array to store the data of buffer patches [NBuff][N][N][N]
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_Exchange( const int lv, const LevelMG_t &G, const real *Arr, real *BufArr )
+{
+
+   const int N   = G.N;
+   const int NG  = G.NG;
+   const int NG3 = CUBE( NG );
+   const int N3  = CUBE( N );
+
+
+// pack
+   for (int r=0; r<MPI_NRank; r++)
+   for (int t=0; t<amr->LB->SendG_NList[lv][r]; t++)
+   {
+      const int   PID = amr->LB->SendG_IDList[lv][r][t];
+      const real *Src = Arr + (long)PID*NG3;
+      real       *Dst = MPI_SendBuf + G.Send_NDisp[r] + (long)t*N3;
+
+      for (int k=0; k<N; k++)
+      for (int j=0; j<N; j++)
+      for (int i=0; i<N; i++)
+         *Dst++ = Src[ ((k+1)*NG + j+1)*NG + i+1 ];
+   }
+
+// exchange
+   LB_SparseAlltoallv( MPI_SendBuf, G.Send_NCount, G.Send_NDisp, MPI_GAMER_REAL,
+                       MPI_RecvBuf, G.Recv_NCount, G.Recv_NDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
+
+// unpack
+   for (int r=0; r<MPI_NRank; r++)
+   for (int t=0; t<amr->LB->RecvG_NList[lv][r]; t++)
+   {
+      const int PID = amr->LB->RecvG_IDList[lv][r][ amr->LB->RecvG_IDList_IdxTable[lv][r][t] ];   // RecvG_IDList is unsorted
+
+      memcpy( BufArr + (long)(PID-NReal)*N3, MPI_RecvBuf + G.Recv_NDisp[r] + (long)t*N3, N3*sizeof(real) );
+   }
+
+} // FUNCTION : LevelMG_Exchange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_Smooth
+// Description :  One half sweep of the red-black Gauss-Seidel smoother
+//
+// Note        :  1. Colors are defined by the global cell indices so that they are consistent across patches
+//                2. Ghost zones are not updated here
+//
+// Parameter   :  G      : Target multigrid level
+//                m      : Index of the target multigrid level
+//                Corner : Cell indices of the corners of all real patches at lv
+//                Color  : Target color (0/1)
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_Smooth( const LevelMG_t &G, const int m, const int (*Corner)[3], const int Color )
+{
+
+   const int  N     = G.N;
+   const int  NG    = G.NG;
+   const int  NG3   = CUBE( NG );
+   const int  dj    = NG;
+   const int  dk    = SQR( NG );
+   const real _6    = (real)1.0/(real)6.0;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+            real *Sol = G.Sol + (long)PID*NG3;
+      const real *RHS = G.RHS + (long)PID*CUBE(N);
+      const int   P0  = ( (Corner[PID][0]>>m) + (Corner[PID][1]>>m) + (Corner[PID][2]>>m) + Color ) & 1;
+
+      for (int k=0; k<N; k++)
+      for (int j=0; j<N; j++)
+      for (int i=(k+j+P0)&1; i<N; i+=2)
+      {
+         const int t = ( (k+1)*NG + j+1 )*NG + i+1;
+
+         Sol[t] = _6*(  Sol[t+1] + Sol[t-1] + Sol[t+dj] + Sol[t-dj] + Sol[t+dk] + Sol[t-dk]
+                      - G.dh2*RHS[ (k*N + j)*N + i ]  );
+      }
+   }
+
+} // FUNCTION : LevelMG_Smooth
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_Residual
+// Description :  Evaluate the residual RHS - Laplacian(Arr)
+//
+// Note        :  1. Ghost zones of Arr must be up to date
+//
+// Parameter   :  G   : Target multigrid level
+//                Arr : Input array with ghost zones
+//                RHS : Right-hand side
+//                Res : Output residual
+//
+// Return      :  Res[], sum of the squared residual of all local cells
+//-------------------------------------------------------------------------------------------------------
+double LevelMG_Residual( const LevelMG_t &G, const real *Arr, const real *RHS, real *Res )
+{
+
+   const int  N    = G.N;
+   const int  NG   = G.NG;
+   const int  NG3  = CUBE( NG );
+   const int  N3   = CUBE( N );
+   const int  dj   = NG;
+   const int  dk   = SQR( NG );
+   const real _dh2 = (real)1.0/G.dh2;
+
+   double SumSqr = 0.0;
+
+#  pragma omp parallel for reduction( +:SumSqr ) schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real *A = Arr + (long)PID*NG3;
+      const real *F = RHS + (long)PID*N3;
+            real *R = Res + (long)PID*N3;
+
+      for (int k=0; k<N; k++)
+      for (int j=0; j<N; j++)
+      for (int i=0; i<N; i++)
+      {
+         const int t = ( (k+1)*NG + j+1 )*NG + i+1;
+         const int s = ( k*N + j )*N + i;
+
+         R[s] = F[s] - _dh2*( A[t+1] + A[t-1] + A[t+dj] + A[t-dj] + A[t+dk] + A[t-dk] - (real)6.0*A[t] );
+
+         SumSqr += SQR( (double)R[s] );
+      }
+   }
+
+   return SumSqr;
+
+} // FUNCTION : LevelMG_Residual
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_Restrict
+// Description :  Restrict the residual of the fine multigrid level to the right-hand side of the coarse level
+//                and reset the coarse-level solution to zero
+//
+// Parameter   :  F : Fine   multigrid level
+//                C : Coarse multigrid level
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_Restrict( const LevelMG_t &F, const LevelMG_t &C )
+{
+
+   const int  NF  = F.N;
+   const int  NC  = C.N;
+   const real _8  = (real)0.125;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real *Res = F.Res + (long)PID*CUBE(NF);
+            real *RHS = C.RHS + (long)PID*CUBE(NC);
+            real *Sol = C.Sol + (long)PID*CUBE(C.NG);
+
+      for (int K=0; K<NC; K++)
+      for (int J=0; J<NC; J++)
+      for (int I=0; I<NC; I++)
+      {
+         real Sum = (real)0.0;
+
+         for (int dk=0; dk<2; dk++)
+         for (int dj=0; dj<2; dj++)
+         for (int di=0; di<2; di++)
+            Sum += Res[ ( (2*K+dk)*NF + 2*J+dj )*NF + 2*I+di ];
+
+         RHS[ (K*NC + J)*NC + I ] = _8*Sum;
+      }
+
+      for (int t=0; t<CUBE(C.NG); t++)    Sol[t] = (real)0.0;
+   }
+
+} // FUNCTION : LevelMG_Restrict
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_Prolongate
+// Description :  Interpolate the coarse-level correction to the fine level and add it to the fine-level solution
+//
+// Note        :  1. Use the central-slope linear interpolation, which only requires the face ghost zones
+//                2. Ghost zones of the fine level are not updated here
+//
+// Parameter   :  C : Coarse multigrid level (with up-to-date ghost zones)
+//                F : Fine   multigrid level
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_Prolongate( const LevelMG_t &C, const LevelMG_t &F )
+{
+
+   const int  NC  = C.N;
+   const int  NGC = C.NG;
+   const int  NGF = F.NG;
+   const int  dj  = NGC;
+   const int  dk  = SQR( NGC );
+   const real _8  = (real)0.125;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real *CSol = C.Sol + (long)PID*CUBE(NGC);
+            real *FSol = F.Sol + (long)PID*CUBE(NGF);
+
+      for (int K=0; K<NC; K++)
+      for (int J=0; J<NC; J++)
+      for (int I=0; I<NC; I++)
+      {
+         const int  t       = ( (K+1)*NGC + J+1 )*NGC + I+1;
+         const real Slope_x = _8*( CSol[t+1 ] - CSol[t-1 ] );
+         const real Slope_y = _8*( CSol[t+dj] - CSol[t-dj] );
+         const real Slope_z = _8*( CSol[t+dk] - CSol[t-dk] );
+
+         for (int sk=0; sk<2; sk++)
+         for (int sj=0; sj<2; sj++)
+         for (int si=0; si<2; si++)
+         {
+            const int tf = ( (2*K+sk+1)*NGF + 2*J+sj+1 )*NGF + 2*I+si+1;
+
+            FSol[tf] += CSol[t] + (2*si-1)*Slope_x + (2*sj-1)*Slope_y + (2*sk-1)*Slope_z;
+         }
+      }
+   }
+
+} // FUNCTION : LevelMG_Prolongate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LevelMG_BottomSolve
+// Description :  Solve the residual equation at the coarsest multigrid level by the conjugate-gradient method
+//
+// Note        :  1. The discrete Laplacian with the homogeneous Dirichlet B.C. is symmetric negative definite,
+//                   for which the standard conjugate-gradient iterations apply without modification
+//                2. Stop when the residual is reduced by BOTTOM_TOL or after BOTTOM_MAX_ITER iterations
+//                3. Ghost zones of G.Sol are up to date on output
+//
+// Parameter   :  lv     : Target AMR level
+//                G      : Coarsest multigrid level (G.Sol must be zero on input)
+//                Sib    : Face siblings of all real patches
+//-------------------------------------------------------------------------------------------------------
+void LevelMG_BottomSolve( const int lv, const LevelMG_t &G, const int (*Sib)[6] )
+{
+
+   const int  N   = G.N;
+   const int  NG  = G.NG;
+   const long N3  = CUBE( N );
+   const long NG3 = CUBE( NG );
+
+   real *r  = G.Res;                            // residual (= RHS since the initial guess is zero)
+   real *p  = new real [ (long)NReal*NG3 ];     // search direction with ghost zones
+   real *Ap = new real [ (long)NReal*N3  ];     // Laplacian(p)
+
+   double rr_Local = 0.0, rr, rr0, pAp_Local, pAp, rr_New_Local, rr_New, alpha, beta;
+
+#  pragma omp parallel for reduction( +:rr_Local ) schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int t=0; t<NG3; t++)  p[ PID*NG3 + t ] = (real)0.0;
+
+      for (int k=0; k<N; k++)
+      for (int j=0; j<N; j++)
+      for (int i=0; i<N; i++)
+      {
+         const long s = PID*N3 + (k*N + j)*N + i;
+
+         r[s] = G.RHS[s];
+         p[ PID*NG3 + ((k+1)*NG + j+1)*NG + i+1 ] = r[s];
+         rr_Local += SQR( (double)r[s] );
+      }
+   }
+
+   MPI_Allreduce( &rr_Local, &rr, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+   rr0 = rr;
+
+   for (int Iter=0; Iter<BOTTOM_MAX_ITER  &&  rr > SQR(BOTTOM_TOL)*rr0; Iter++)
+   {
+//    Ap = Laplacian(p) = -( Res(p) with zero RHS )
+      LevelMG_FillGhost( lv, G, false, p, G.Buf, Sib );
+
+      pAp_Local = 0.0;
+
+#     pragma omp parallel for reduction( +:pAp_Local ) schedule( runtime )
+      for (int PID=0; PID<NReal; PID++)
+      {
+         const real *P = p + PID*NG3;
+         const real _dh2 = (real)1.0/G.dh2;
+
+         for (int k=0; k<N; k++)
+         for (int j=0; j<N; j++)
+         for (int i=0; i<N; i++)
+         {
+            const int  t = ( (k+1)*NG + j+1 )*NG + i+1;
+            const long s = PID*N3 + (k*N + j)*N + i;
+
+            Ap[s] = _dh2*( P[t+1] + P[t-1] + P[t+NG] + P[t-NG] + P[t+NG*NG] + P[t-NG*NG] - (real)6.0*P[t] );
+            pAp_Local += (double)P[t]*(double)Ap[s];
+         }
+      }
+
+      MPI_Allreduce( &pAp_Local, &pAp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      if ( pAp == 0.0 )    break;
+
+      alpha        = rr/pAp;
+      rr_New_Local = 0.0;
+
+#     pragma omp parallel for reduction( +:rr_New_Local ) schedule( runtime )
+      for (int PID=0; PID<NReal; PID++)
+      for (int k=0; k<N; k++)
+      for (int j=0; j<N; j++)
+      for (int i=0; i<N; i++)
+      {
+         const long t = PID*NG3 + ((k+1)*NG + j+1)*NG + i+1;
+         const long s = PID*N3  + (k*N + j)*N + i;
+
+         G.Sol[t] += alpha*p[t];
+         r    [s] -= alpha*Ap[s];
+         rr_New_Local += SQR( (double)r[s] );
+      }
+
+      MPI_Allreduce( &rr_New_Local, &rr_New, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      beta = rr_New/rr;
+      rr   = rr_New;
+
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<NReal; PID++)
+      for (int k=0; k<N; k++)
+      for (int j=0; j<N; j++)
+      for (int i=0; i<N; i++)
+      {
+         const long t = PID*NG3 + ((k+1)*NG + j+1)*NG + i+1;
+         const long s = PID*N3  + (k*N + j)*N + i;
+
+         p[t] = r[s] + beta*p[t];
+      }
+   } // for (int Iter=0; Iter<BOTTOM_MAX_ITER  &&  rr > SQR(BOTTOM_TOL)*rr0; Iter++)
+
+   LevelMG_FillGhost( lv, G, false, G.Sol, G.Buf, Sib );
+
+   delete [] p;
+   delete [] Ap;
+
+} // FUNCTION : LevelMG_BottomSolve
+
+
+
+#endif // #if ( defined GRAVITY  &&  defined LOAD_BALANCE )
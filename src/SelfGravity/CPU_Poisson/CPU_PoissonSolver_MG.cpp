@@ -23,7 +23,12 @@ static void Prolongate_and_Correct( const real *CData_1D, real *FData_1D, const
 // Function    :  CPU_PoissonSolver_MG
 // Description :  Use CPU to solve the Poisson equation by the multigrid scheme
 //
-// Note        :  Reference : Numerical Recipes, Chapter 20.6
+// Note        :  1. Reference : Numerical Recipes, Chapter 20.6
+//                2. WarmStart (OPT__POT_WARM_START):
+//                   --> replace the interpolated potential in the patch interior by the initial guess stored in
+//                       the central region of Pot_Array_Out (see Poi_Prepare_Pot())
+//                       --> the interpolated coarse-grid potential is still used as the boundary condition
+//                   --> the V-cycles still terminate once the estimated error drops below Tolerated_Error
 //
 // Parameter   :  Rho_Array         : Array to store the input density
 //                Pot_Array_In      : Array to store the input "coarse-grid" potential for interpolation
@@ -39,13 +44,14 @@ static void Prolongate_and_Correct( const real *CData_1D, real *FData_1D, const
 //                                    --> currently supported schemes include
 //                                        INT_CQUAD : conservative quadratic interpolation
 //                                        INT_QUAD  : quadratic interpolation
+//                WarmStart         : Start from the initial guess stored in Pot_Array_Out
 //-------------------------------------------------------------------------------------------------------
 void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
                            const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
                                  real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                            const int NPatchGroup, const real dh_Min, const int Max_Iter, const int NPre_Smooth,
                            const int NPost_Smooth, const real Tolerated_Error, const real Poi_Coeff,
-                           const IntScheme_t IntScheme )
+                           const IntScheme_t IntScheme, const bool WarmStart )
 {
 
    const int  NPatch    = NPatchGroup*8;
@@ -249,6 +255,19 @@ void CPU_PoissonSolver_MG( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT]
          } // switch ( IntScheme )
 
 
+//       replace the interior potential by the initial guess for WarmStart
+         if ( WarmStart )
+         {
+            for (int k=GRA_GHOST_SIZE; k<GRA_NXT-GRA_GHOST_SIZE; k++)   {  K = k + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+            for (int j=GRA_GHOST_SIZE; j<GRA_NXT-GRA_GHOST_SIZE; j++)   {  J = j + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+            for (int i=GRA_GHOST_SIZE; i<GRA_NXT-GRA_GHOST_SIZE; i++)   {  I = i + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+
+               Pot_Array_Int[K][J][I] = Pot_Array_Out[P][k][j][i];
+
+            }}}
+         }
+
+
 
 //       b. initialize the level 0 multigrid arrays
 // ------------------------------------------------------------------------------------------------------------
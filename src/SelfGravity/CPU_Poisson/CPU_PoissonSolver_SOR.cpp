@@ -17,6 +17,12 @@
 //
 // Note        :  1. Reference : Numerical Recipes, Chapter 20.5
 //                2. Typically, the number of iterations required to reach round-off errors is 20 ~ 25 (single precision)
+//                3. WarmStart (OPT__POT_WARM_START):
+//                   --> replace the interpolated potential in the patch interior by the initial guess stored in
+//                       the central region of Pot_Array_Out (see Poi_Prepare_Pot())
+//                       --> the interpolated coarse-grid potential is still used as the boundary condition
+//                   --> terminate the iteration once the 1-norm of the residual drops below
+//                       Tolerated_Error*(1-norm of the initial guess), in addition to the original criteria
 //
 // Parameter   :  Rho_Array      : Array to store the input density
 //                Pot_Array_In   : Array to store the input "coarse-grid" potential for interpolation
@@ -26,17 +32,20 @@
 //                Min_Iter       : Minimum # of iterations for SOR
 //                Max_Iter       : Maximum # of iterations for SOR
 //                Omega          : Over-relaxation parameter
+//                Tolerated_Error: Maximum tolerated relative residual (only used with WarmStart)
 //                Poi_Coeff      : Coefficient in front of the RHS in the Poisson eq.
 //                IntScheme      : Interpolation scheme for potential
 //                                 --> currently supported schemes include
 //                                     INT_CQUAD : conservative quadratic interpolation
 //                                     INT_QUAD  : quadratic interpolation
+//                WarmStart      : Start from the initial guess stored in Pot_Array_Out
 //-------------------------------------------------------------------------------------------------------
 void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT],
                             const real Pot_Array_In [][POT_NXT][POT_NXT][POT_NXT],
                                   real Pot_Array_Out[][GRA_NXT][GRA_NXT][GRA_NXT],
                             const int NPatchGroup, const real dh, const int Min_Iter, const int Max_Iter,
-                            const real Omega, const real Poi_Coeff, const IntScheme_t IntScheme )
+                            const real Omega, const real Tolerated_Error, const real Poi_Coeff,
+                            const IntScheme_t IntScheme, const bool WarmStart )
 {
 
    const int  NPatch    = NPatchGroup*8;
@@ -52,7 +61,7 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
    {
       int i_start, i_start_pass, i_start_k;     // i_start_(pass,k) : record the i_start in the (pass,k) loop
       int ip, jp, kp, im, jm, km, I, J, K, Ip, Jp, Kp, ii, jj, kk, Iter, x, y, z;
-      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total, Residual;
+      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total, Residual, Residual_Tol;
 
 //    array to store the interpolated "fine-grid" potential (as the initial guess and the B.C.)
       real (*Pot_Array_Int)[POT_NXT_INT][POT_NXT_INT] = new real [POT_NXT_INT][POT_NXT_INT][POT_NXT_INT];
@@ -195,6 +204,27 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
          } // switch ( IntScheme )
 
 
+//       replace the interior potential by the initial guess for WarmStart
+         if ( WarmStart )
+         {
+            real Pot_Total = (real)0.0;
+
+            for (int k=GRA_GHOST_SIZE; k<GRA_NXT-GRA_GHOST_SIZE; k++)   {  K = k + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+            for (int j=GRA_GHOST_SIZE; j<GRA_NXT-GRA_GHOST_SIZE; j++)   {  J = j + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+            for (int i=GRA_GHOST_SIZE; i<GRA_NXT-GRA_GHOST_SIZE; i++)   {  I = i + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
+
+               Pot_Array_Int[K][J][I] = Pot_Array_Out[P][k][j][i];
+               Pot_Total += FABS( Pot_Array_Int[K][J][I] );
+
+            }}}
+
+            Residual_Tol = Tolerated_Error*Pot_Total;
+         }
+
+         else
+            Residual_Tol = (real)-1.0;
+
+
 
 //       b. use the SOR scheme to evaluate potential (store in the Pot_Array_Int array)
 // ------------------------------------------------------------------------------------------------------------
@@ -256,6 +286,13 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
             } // for (int pass=0; pass<2; pass++)
 
 
+//          terminate the SOR iteration if the total residual is small enough (for WarmStart only)
+            if ( Residual_Total <= Residual_Tol )
+            {
+               Iter++;
+               break;
+            }
+
 //          terminate the SOR iteration if the total residual begins to grow
 //          we set the minimum number of iterations because usually the total residual will grow at the first step
             if (  Iter+1 >= Min_Iter  &&  Residual_Total > Residual_Total_Old )
@@ -17,12 +17,14 @@ extern Timer_t *Timer_Par_Collect[NLEVEL];
 //
 // Note        :  1. Poisson solver : lv = 0 : invoke CPU_PoissonSolver_FFT()
 //                                    lv > 0 : invoke InvokeSolver()
+//                                             --> invoke CPU_PoissonSolver_LevelMG() instead if OPT__POT_LEVEL_MG is on
 //                2. Gravity solver : invoke InvokeSolver()
 //                3. The updated potential and fluid variables will be stored in the same sandglass
 //                4. PotSg at lv=0 will be updated here, but PotSg at at lv>0 and FluSg at lv>=0 will NOT be updated
 //                   (they will be updated in EvolveLevel instead)
 //                   --> It is because the lv-0 Poisson and Gravity solvers are invoked separately, and Gravity solver
 //                       needs to call Prepare_PatchData to get the updated potential
+//                   --> Same for PotSg at lv>0 when OPT__POT_LEVEL_MG is on
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -157,6 +159,41 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
    } // if ( lv == 0 )
 
 
+#  ifdef LOAD_BALANCE
+// the level-wide multigrid Poisson solver at lv>0 is invoked separately from the Gravity solver as at lv=0
+// --> no timer here since the entire function is timed by EvolveLevel() at lv>0
+   else if ( OPT__POT_LEVEL_MG  &&  Poisson )
+   {
+      if ( UsePot )
+      {
+         if ( OPT__SELF_GRAVITY )
+            CPU_PoissonSolver_LevelMG( lv, Poi_Coeff, SaveSg_Pot, TimeNew );
+
+//       external potential only --> the patch-by-patch solver skips the self-gravity part
+         else
+            InvokeSolver( POISSON_SOLVER, lv, TimeNew, TimeOld, NULL_REAL, Poi_Coeff, NULL_INT, NULL_INT, SaveSg_Pot,
+                          false, false );
+
+         amr->PotSg    [lv]             = SaveSg_Pot;
+         amr->PotSgTime[lv][SaveSg_Pot] = TimeNew;
+
+         Prepare_PatchData_Cache_Invalidate( lv, _POTE, _NONE );
+
+         Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES );
+
+//       must call Poi_StorePotWithGhostZone AFTER collecting potential for buffer patches
+#        ifdef STORE_POT_GHOST
+         Poi_StorePotWithGhostZone( lv, SaveSg_Pot, true );
+#        endif
+      }
+
+      if ( Gravity )
+         InvokeSolver( GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
+                       false, false );
+   } // else if ( OPT__POT_LEVEL_MG  &&  Poisson )
+#  endif // #ifdef LOAD_BALANCE
+
+
    else // lv > 0
    {
       if      (  Poisson  &&  !Gravity )
@@ -3,6 +3,9 @@
 #if ( defined GRAVITY  &&  defined SUPPORT_FFTW )
 
 extern root_fftw::real_plan_nd     FFTW_Plan_Poi;
+#ifdef SUPPORT_FFTW_PENCIL
+extern FFTW_Pencil_t               FFTW_Pencil_Poi;
+#endif
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_GreenFuncK
@@ -10,7 +13,8 @@ extern root_fftw::real_plan_nd     FFTW_Plan_Poi;
 //
 // Note        :  1. We only need to calculate it once during the initialization stage
 //                2. The zero-padding method is implemented
-//                3. Slab decomposition is assumed in FFTW
+//                3. Slab decomposition is assumed in FFTW, or the pencil decomposition for OPT__FFTW_PENCIL
+//                   --> GreenFuncK[] shares the same k-space layout as the density in CPU_PoissonSolver_FFT()
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -33,21 +37,38 @@ void Init_GreenFuncK()
    local_nx = 2*( FFT_Size[0]/2 + 1 );
    local_ny = FFT_Size[1];
 
-#  ifdef SERIAL
-   local_nz                      = FFT_Size[2];
-   local_z_start                 = 0;
-   local_ny_after_transpose      = NULL_INT;
-   local_y_start_after_transpose = NULL_INT;
-   total_local_size              = local_nx*local_ny*local_nz;
-#  else // # ifdef SERIAL
-#  if ( SUPPORT_FFTW == FFTW3 )
-   total_local_size = fftw_mpi_local_size_3d_transposed( FFT_Size[2], local_ny, local_nx, MPI_COMM_WORLD,
-                           &local_nz, &local_z_start, &local_ny_after_transpose, &local_y_start_after_transpose );
-#  else // # if ( SUPPORT_FFTW == FFTW3 )
-   rfftwnd_mpi_local_sizes( FFTW_Plan_Poi, &local_nz, &local_z_start, &local_ny_after_transpose,
-                            &local_y_start_after_transpose, &total_local_size );
-#  endif // #  if ( SUPPORT_FFTW == FFTW3 ) ... # else
-#  endif // # ifdef SERIAL
+// the pencil decomposition stores the real-space data in the x-pencil layout [z][y][x]
+// --> local_y_start is only used by the pencil decomposition
+   mpi_index_int local_y_start = 0;
+
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )
+   {
+      local_ny         = FFTW_Pencil_Poi.local_ny;
+      local_nz         = FFTW_Pencil_Poi.local_nz;
+      local_y_start    = FFTW_Pencil_Poi.List_y_start[ FFTW_Pencil_Poi.Coord[0] ];
+      local_z_start    = FFTW_Pencil_Poi.List_z_start[ FFTW_Pencil_Poi.Coord[1] ];
+      total_local_size = FFTW_Pencil_Poi.total_local_size;
+   }
+   else
+#  endif
+   {
+#     ifdef SERIAL
+      local_nz                      = FFT_Size[2];
+      local_z_start                 = 0;
+      local_ny_after_transpose      = NULL_INT;
+      local_y_start_after_transpose = NULL_INT;
+      total_local_size              = local_nx*local_ny*local_nz;
+#     else // # ifdef SERIAL
+#     if ( SUPPORT_FFTW == FFTW3 )
+      total_local_size = fftw_mpi_local_size_3d_transposed( FFT_Size[2], local_ny, local_nx, MPI_COMM_WORLD,
+                              &local_nz, &local_z_start, &local_ny_after_transpose, &local_y_start_after_transpose );
+#     else // # if ( SUPPORT_FFTW == FFTW3 )
+      rfftwnd_mpi_local_sizes( FFTW_Plan_Poi, &local_nz, &local_z_start, &local_ny_after_transpose,
+                               &local_y_start_after_transpose, &total_local_size );
+#     endif // #  if ( SUPPORT_FFTW == FFTW3 ) ... # else
+#     endif // # ifdef SERIAL
+   } // if ( OPT__FFTW_PENCIL ) ... else
 
 // check integer overflow (assuming local_nx*local_ny*local_nz ~ total_local_size)
    const long local_nxyz = (long)local_nx*(long)local_ny*(long)local_nz;
@@ -69,11 +90,14 @@ void Init_GreenFuncK()
    int    kk;
    long   idx;
 
-   GreenFuncK = (real*) root_fftw::fft_malloc(sizeof(real) * total_local_size);
+   int    jj;
+
+   GreenFuncK = (real*) root_fftw::fft_malloc(sizeof(real) * MAX(total_local_size,(mpi_index_int)1));
 
    for (int k=0; k<local_nz; k++)   {  kk = k + local_z_start;
                                        z  = ( kk <= NX0_TOT[2] ) ? kk*dh0 : (FFT_Size[2]-kk)*dh0;
-   for (int j=0; j<local_ny; j++)   {  y  = ( j  <= NX0_TOT[1] ) ? j *dh0 : (FFT_Size[1]-j )*dh0;
+   for (int j=0; j<local_ny; j++)   {  jj = j + local_y_start;
+                                       y  = ( jj <= NX0_TOT[1] ) ? jj*dh0 : (FFT_Size[1]-jj)*dh0;
    for (int i=0; i<local_nx; i++)   {  x  = ( i  <= NX0_TOT[0] ) ? i *dh0 : (FFT_Size[0]-i )*dh0;
 
       r   = sqrt( x*x + y*y + z*z );
@@ -86,9 +110,14 @@ void Init_GreenFuncK()
 
 // 3. reset the Green's function at the origin
 // ***by setting it equal to zero, we ignore the contribution from the mass within the same cell***
-   if ( MPI_Rank == 0 )    GreenFuncK[0] = GFUNC_COEFF0*Coeff/dh0;
+   if ( local_z_start == 0  &&  local_y_start == 0  &&  local_nz > 0  &&  local_ny > 0 )
+      GreenFuncK[0] = GFUNC_COEFF0*Coeff/dh0;
 
 // 4. convert the Green's function to the k space
+#  ifdef SUPPORT_FFTW_PENCIL
+   if ( OPT__FFTW_PENCIL )    FFTW_Pencil_R2C( FFTW_Pencil_Poi, GreenFuncK );
+   else
+#  endif
    root_fftw_r2c( FFTW_Plan_Poi, GreenFuncK );
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
@@ -12,7 +12,7 @@
 // Note        :  1. Work only when the corresponding input parameters are negative
 //                2. The default values are determined empirically from the cosmological simulations
 //
-// Return      :  SOR_OMEGA, SOR_MAX_ITER, SOR_MIN_ITER
+// Return      :  SOR_OMEGA, SOR_MAX_ITER, SOR_MIN_ITER, SOR_TOLERATED_ERROR
 //-------------------------------------------------------------------------------------------------------
 void Init_Set_Default_SOR_Parameter()
 {
@@ -28,6 +28,11 @@ void Init_Set_Default_SOR_Parameter()
    const int    Default_MaxIter = int( 40 + 3*NCell );   // add a factor of 2 buffer to the empirically determined maximum iteration
 #  endif
    const int    Default_MinIter = Default_MaxIter / 5;   // 20% of the maximum iteration (determined empirically)
+#  ifdef FLOAT8
+   const double Default_Tolerated_Error = 1.0e-12;       // a few orders of magnitude above the round-off errors
+#  else
+   const double Default_Tolerated_Error = 1.0e-5;
+#  endif
 
 
    if ( SOR_OMEGA < 0.0 )
@@ -51,6 +56,13 @@ void Init_Set_Default_SOR_Parameter()
       PRINT_RESET_PARA( SOR_MIN_ITER, FORMAT_INT, "" );
    }
 
+   if ( SOR_TOLERATED_ERROR < 0.0 )
+   {
+      SOR_TOLERATED_ERROR = Default_Tolerated_Error;
+
+      PRINT_RESET_PARA( SOR_TOLERATED_ERROR, FORMAT_REAL, "" );
+   }
+
 } // FUNCTION : Init_Set_Default_SOR_Parameter
 
 
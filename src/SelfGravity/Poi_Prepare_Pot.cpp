@@ -16,15 +16,23 @@
 //                       is NOT equal to the time of data stored previously (i.e., PotSgTime[0/1])
 //                3. Use extrapolation to obtain data outside the non-periodic boundaries
 //                4. h_Pot_Array_P_In[] must **exclude external potential** since it is for the Poisson solver
+//                5. For OPT__POT_WARM_START, also fill up the central PS1^3 cells of h_Pot_Array_P_Out[] with the
+//                   fine-grid (lv) potential of the previous step as the initial guess of the Poisson solver
+//                   --> Only when WarmStart == true, which must be determined by Poi_WarmStart()
+//                   --> Linearly extrapolated to PrepTime using both sandglasses if available
+//                   --> Also exclude external potential
 //
-// Parameter   :  lv               : Target refinement level
-//                PrepTime         : Target physical time to prepare the coarse-grid data
-//                h_Pot_Array_P_In : Host array to store the prepared coarse-grid potential
-//                NPG              : Number of patch groups prepared at a time
-//                PID0_List        : List recording the patch indices with LocalID==0 to be udpated
+// Parameter   :  lv                : Target refinement level
+//                PrepTime          : Target physical time to prepare the coarse-grid data
+//                h_Pot_Array_P_In  : Host array to store the prepared coarse-grid potential
+//                h_Pot_Array_P_Out : Host array to store the prepared fine-grid initial guess (for WarmStart only)
+//                NPG               : Number of patch groups prepared at a time
+//                PID0_List         : List recording the patch indices with LocalID==0 to be udpated
+//                WarmStart         : Prepare the fine-grid initial guess in h_Pot_Array_P_Out[]
 //-------------------------------------------------------------------------------------------------------
 void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In[][POT_NXT][POT_NXT][POT_NXT],
-                      const int NPG, const int *PID0_List )
+                      real h_Pot_Array_P_Out[][GRA_NXT][GRA_NXT][GRA_NXT], const int NPG, const int *PID0_List,
+                      const bool WarmStart )
 {
 
 // nothing to do if there is no target patch group
@@ -43,6 +51,9 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
 
    if ( !OPT__SELF_GRAVITY  &&  MPI_Rank == 0 )
       Aux_Message( stderr, "WARNING : why invoking %s when OPT__SELF_GRAVITY is disabled ?!\n", __FUNCTION__ );
+
+   if ( WarmStart  &&  h_Pot_Array_P_Out == NULL )
+      Aux_Error( ERROR_INFO, "h_Pot_Array_P_Out == NULL for WarmStart !!\n" );
 #  endif
 
 
@@ -54,6 +65,8 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
    const int    FaLv     = lv - 1;
    const double dh       = amr->dh[FaLv];
    const double dh_2     = 0.5*dh;
+   const double dh_F     = amr->dh[lv];
+   const double dh_F_2   = 0.5*dh_F;
 
 
 
@@ -120,6 +133,19 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
    } // Mis_CompareRealValue
 
 
+// temporal extrapolation parameters of the fine-grid initial guess for WarmStart
+// --> extrapolate only if 1-PotSg stores the potential of the current patches at an earlier time
+//     (i.e., it has not been overwritten by LB_Init_LoadBalance() and the patches have not been rebuilt by Refine() since then)
+// --> limit the extrapolation weighting to 1 in case the time-step has grown abruptly
+   const int    FPotSg        = amr->PotSg[lv];
+   const double FPotTime      = amr->PotSgTime[lv][  FPotSg];
+   const double FPotTime_Old  = amr->PotSgTime[lv][1-FPotSg];
+   const bool   FPotExtrap    = (  WarmStart  &&  FPotTime_Old >= 0.0  &&  FPotTime_Old >= amr->PotRefineTime[lv]  &&
+                                   FPotTime > FPotTime_Old  );
+   const real   FPotWeighting = ( FPotExtrap ) ? (real)MIN( (PrepTime-FPotTime)/(FPotTime-FPotTime_Old), 1.0 )
+                                               : NULL_REAL;
+
+
 // determine the priority of different boundary faces (z>y>x) to set the corner cells properly for the non-periodic B.C.
    int BC_Face[26], BC_Face_tmp[3];
 
@@ -143,7 +169,7 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
       real (*CPot)[CWidth][CWidth] = new real [CWidth][CWidth][CWidth];
 
       double x0, y0, z0, x, y, z;
-      real   CPot_IntT;
+      real   CPot_IntT, FPot, FPot_Old;
       int    FaPID, FaSibPID, PID0, Idx_Start_Out[3], Idx_End_Out[3], Idx_Start_In[3], BC_Sibling;
 
 //    prepare the coarse-grid potential for eight patches (one patch group) at a time
@@ -282,6 +308,46 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
             for (int io=0, ii=Idx_Start_In[0]; io<POT_NXT; io++, ii++)
                h_Pot_Array_P_In[N][ko][jo][io] = CPot[ki][ji][ii];
          }
+
+
+//       d. copy the fine-grid potential of the previous step to the central region of h_Pot_Array_P_Out[] for WarmStart
+// ------------------------------------------------------------------------------------------------------------
+         if ( WarmStart )
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            const int N   = 8*TID + LocalID;
+            const int PID = PID0 + LocalID;
+
+            x0 = amr->patch[0][lv][PID]->EdgeL[0] + dh_F_2;
+            y0 = amr->patch[0][lv][PID]->EdgeL[1] + dh_F_2;
+            z0 = amr->patch[0][lv][PID]->EdgeL[2] + dh_F_2;
+
+            for (int k=0; k<PS1; k++)  {  z = z0 + k*dh_F;
+            for (int j=0; j<PS1; j++)  {  y = y0 + j*dh_F;
+            for (int i=0; i<PS1; i++)  {  x = x0 + i*dh_F;
+
+               FPot = amr->patch[FPotSg][lv][PID]->pot[k][j][i];
+
+//             subtract external potential
+               if ( OPT__EXT_POT )
+                  FPot -= CPUExtPot_Ptr( x, y, z, FPotTime, ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                         EXT_POT_USAGE_SUB, h_ExtPotTable, h_ExtPotGenePtr );
+
+//             temporal extrapolation
+               if ( FPotExtrap )
+               {
+                  FPot_Old = amr->patch[1-FPotSg][lv][PID]->pot[k][j][i];
+
+                  if ( OPT__EXT_POT )
+                     FPot_Old -= CPUExtPot_Ptr( x, y, z, FPotTime_Old, ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                                EXT_POT_USAGE_SUB_TINT, h_ExtPotTable, h_ExtPotGenePtr );
+
+                  FPot += FPotWeighting*( FPot - FPot_Old );
+               }
+
+               h_Pot_Array_P_Out[N][ k+GRA_GHOST_SIZE ][ j+GRA_GHOST_SIZE ][ i+GRA_GHOST_SIZE ] = FPot;
+            }}} // i,j,k
+         } // for (int LocalID=0; LocalID<8; LocalID++)
       } // for (int TID=0; TID<NPG; TID++)
 
       delete [] CPot;
@@ -291,4 +357,38 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_WarmStart
+// Description :  Return whether the Poisson solver at lv can start from the fine-grid potential of the previous
+//                step (OPT__POT_WARM_START)
+//
+// Note        :  1. Only for the patch-by-patch CPU solvers (i.e., CPU_PoissonSolver_SOR/MG()) at lv>0
+//                2. Return false if the potential at lv has not been advanced to a time earlier than PrepTime,
+//                   in which case PotSg may not store a valid potential yet
+//                   --> e.g., the first Poisson solve during initialization and restart, where
+//                       PotSgTime[PotSg] == PrepTime
+//                3. Invoked by InvokeSolver() for both the preparation and execution steps
+//
+// Parameter   :  lv       : Target refinement level
+//                PrepTime : Target physical time to compute the potential
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool Poi_WarmStart( const int lv, const double PrepTime )
+{
+
+#  ifdef GPU
+   return false;
+#  endif
+
+   if ( !OPT__POT_WARM_START  ||  lv == 0 )  return false;
+
+   const double FPotTime = amr->PotSgTime[lv][ amr->PotSg[lv] ];
+
+   return (  FPotTime >= 0.0  &&  PrepTime > FPotTime  &&  !Mis_CompareRealValue( PrepTime, FPotTime, NULL, false )  );
+
+} // FUNCTION : Poi_WarmStart
+
+
+
 #endif // #ifdef GRAVITY
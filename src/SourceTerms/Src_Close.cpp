@@ -34,8 +34,11 @@ void Src_Close( const int lv, const int SaveSg_Flu, const real h_Flu_Array_S_Out
          const int N   = 8*TID + LocalID;
 
 //       update all fluid variables for now
-         memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0], h_Flu_Array_S_Out[N][0],
-                 FLU_NOUT_S*CUBE(PS1)*sizeof(real) );
+//       --> use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
+               real_store *FluPtr = amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0];
+         const real       *ArrPtr = h_Flu_Array_S_Out[N][0];
+
+         for (int t=0; t<FLU_NOUT_S*CUBE(PS1); t++)   FluPtr[t] = ArrPtr[t];
       }
    } // for (int TID=0; TID<NPG; TID++)
 
@@ -65,8 +65,11 @@ void Src_Prepare( const int lv, const double PrepTime,
 //       1. fast version for zero ghost zone
 #        if ( SRC_GHOST_SIZE == 0 )
 //       fluid variables (include all fields for now)
-         memcpy( h_Flu_Array_S_In[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
-                 FLU_NIN_S*CUBE(SRC_NXT)*sizeof(real) );
+//       --> use element-wise copy since the patch data may be stored in a different precision (i.e., real_store)
+         const real_store *FluPtr = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0];
+               real       *ArrPtr = h_Flu_Array_S_In[N][0];
+
+         for (int t=0; t<FLU_NIN_S*CUBE(SRC_NXT); t++)   ArrPtr[t] = FluPtr[t];
 
 //       B field
 #        ifdef MHD
@@ -87,11 +87,11 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
    const int TID = 0;
 #  endif
 
-   double x0, y0, z0, x, y, z;
-   real   GasDens, _GasDens, GasMass, _Time_FreeFall, StarMFrac, StarMass, GasMFracLeft;
-   real   (*fluid)[PS1][PS1][PS1]      = NULL;
+   double      x0, y0, z0, x, y, z;
+   real        GasDens, _GasDens, GasMass, _Time_FreeFall, StarMFrac, StarMass, GasMFracLeft;
+   real_store (*fluid)[PS1][PS1][PS1]      = NULL;
 #  ifdef STORE_POT_GHOST
-   real   (*pot_ext)[GRA_NXT][GRA_NXT] = NULL;
+   real       (*pot_ext)[GRA_NXT][GRA_NXT] = NULL;
 #  endif
 
    const int    MaxNewParPerPatch = CUBE(PS1);
@@ -603,6 +603,12 @@ def load_arguments():
                          help="Enable double precision.\n"
                        )
 
+    parser.add_argument( "--double_store", type=str2bool, metavar="BOOLEAN", gamer_name="FLOAT8_STORE",
+                         default=None,
+                         constraint={ True:{"double":True} },
+                         help="Enable double precision for the patch data (fluid, potential, and flux) stored in memory. Set to <--double> by default. Disabling it with <--double> stores the patch data in single precision while the solvers still compute in double precision.\n"
+                       )
+
     parser.add_argument( "--laohu", type=str2bool, metavar="BOOLEAN", gamer_name="LAOHU",
                          default=False,
                          help="Work on the NAOC Laohu GPU cluster.\n"
@@ -671,8 +677,8 @@ def load_arguments():
 
     parser.add_argument( "--overlap_mpi", type=str2bool, metavar="BOOLEAN", gamer_name="OVERLAP_MPI",
                          default=False,
-                         constraint={ True:{"mpi":True} },
-                         help="Overlap MPI communication with computation. Not supported yet. Must enable <--mpi>.\n"
+                         constraint={ True:{"mpi":True, "openmp":True} },
+                         help="Overlap MPI communication with computation. Must enable <--mpi> and <--openmp>.\n"
                        )
 
     parser.add_argument( "--gpu", type=str2bool, metavar="BOOLEAN", gamer_name="GPU",
@@ -737,6 +743,9 @@ def set_conditional_defaults( args ):
     if args["double_par"] is None:
         args["double_par"] = args["double"]
 
+    if args["double_store"] is None:
+        args["double_store"] = args["double"]
+
     if args["flux"] is None:
         args["flux"] = "HLLD" if args["mhd"] else "HLLC"
 
@@ -802,6 +811,9 @@ def set_sims( name_table, depends, **kwargs ):
     # hard-code the option of serial.
     if not kwargs["mpi"]: opt_str = add_option( opt_str, name="SERIAL", val=True )
 
+    # FLOAT8 implies FLOAT8_STORE in Macro.h, so single-precision storage must be requested explicitly.
+    if kwargs["double"] and not kwargs["double_store"]: opt_str = add_option( opt_str, name="FLOAT4_STORE", val=True )
+
     return {"SIMU_OPTION":opt_str}
 
 def set_compile( paths, compilers, flags, kwargs ):
@@ -817,7 +829,13 @@ def set_compile( paths, compilers, flags, kwargs ):
     # NOTE: `-G` may cause the GPU Poisson solver to fail
     if kwargs["debug"]: flags["NVCCFLAG_COM"] += "-g -Xptxas -v"
 
-    # 4. Write flags to compile option dictionary.
+    # 4. Set the flags required to vectorize the row-wise CPU Riemann solvers (RSOLVER_PENCIL in CUFLU.h)
+    # NOTE: they only apply to CPU_RiemannSolver_Pencil.cpp and do not change the results
+    com_opt["CXXFLAG_PENCIL"] = ""
+    if not kwargs["gpu"] and kwargs["model"] == "HYDRO" and kwargs["flux"] in ["HLLE", "HLLC", "HLLD"]:
+        com_opt["CXXFLAG_PENCIL"] = "-fno-math-errno -fno-trapping-math"
+
+    # 5. Write flags to compile option dictionary.
     for key, val in flags.items():
         com_opt[key] = val
 
@@ -900,10 +918,6 @@ def validation( paths, depends, constraints, **kwargs ):
         LOGGER.error("<--patch_size> should be an even number greater than or equal to 8. Current: %d"%kwargs["patch_size"])
         success = False
 
-    if kwargs["overlap_mpi"]:
-        LOGGER.error("<--overlap_mpi> is not supported yet.")
-        success = False
-
     if not success: raise BaseException( "The above vaildation failed." )
     return
 
@@ -0,0 +1,412 @@
+#include "CUFLU.h"
+
+#ifndef RSOLVER_PENCIL
+#  error : ERROR : RSOLVER_PENCIL is off --> check the simulation options in the Makefile !!
+#endif
+
+
+
+
+// global variables referenced by the linked GAMER sources
+int    MPI_Rank = 0;
+double GAMMA, MOLECULAR_WEIGHT, MU_NORM, UNIT_E, UNIT_M;
+bool   OPT__UNIT = false;
+double EoS_AuxArray_Flt[EOS_NAUX_MAX];
+int    EoS_AuxArray_Int[EOS_NAUX_MAX];
+EoS_DE2P_t EoS_DensEint2Pres_CPUPtr = NULL;
+EoS_DP2E_t EoS_DensPres2Eint_CPUPtr = NULL;
+EoS_DP2C_t EoS_DensPres2CSqr_CPUPtr = NULL;
+EoS_DE2T_t EoS_DensEint2Temp_CPUPtr = NULL;
+EoS_DT2P_t EoS_DensTemp2Pres_CPUPtr = NULL;
+EoS_DE2S_t EoS_DensEint2Entr_CPUPtr = NULL;
+EoS_GENE_t EoS_General_CPUPtr       = NULL;
+
+
+// GAMER functions
+void EoS_Init_Gamma();
+void Hydro_RiemannSolver_Pencil( const int XYZ, const int NFace, real *const Flux_Out[],
+                                 const real *const L_In[], const real *const R_In[],
+                                 const real MinDens, const real MinPres, const EoS_t *EoS );
+#if ( RSOLVER == HLLE   ||  RSOLVER_RESCUE == HLLE  )
+void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const EoS_GUESS_t EoS_GuessHTilde,
+                               const EoS_H2TEM_t EoS_HTilde2Temp,
+                               const double EoS_AuxArray_Flt[], const int EoS_AuxArray_Int[],
+                               const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+#if ( RSOLVER == HLLC   ||  RSOLVER_RESCUE == HLLC  )
+void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const EoS_GUESS_t EoS_GuessHTilde,
+                               const EoS_H2TEM_t EoS_HTilde2Temp,
+                               const double EoS_AuxArray_Flt[], const int EoS_AuxArray_Int[],
+                               const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+#if ( RSOLVER == HLLD   ||  RSOLVER_RESCUE == HLLD  )
+void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
+                               const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                               const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
+                               const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+
+
+// types of the random states
+enum State_t { STATE_GENERIC=0, STATE_EQUAL, STATE_CONTACT, STATE_COLD, STATE_REST, STATE_SUPERSONIC,
+               STATE_NEG_EINT, STATE_SIGNED_ZERO,
+#              ifdef MHD
+               STATE_BN_ZERO, STATE_BN_TINY, STATE_BT_ZERO, STATE_B_ZERO,
+#              endif
+               N_STATE };
+
+static const char *StateName[N_STATE] = { "generic", "equal L/R", "stationary contact", "cold flow (S*~S_L/R)",
+                                          "cold gas at rest", "supersonic", "negative internal energy",
+                                          "signed zero",
+#                                         ifdef MHD
+                                          "Bn=0", "Bn~0", "Bt=0", "B=0"
+#                                         endif
+                                        };
+
+static void SetState( const State_t Type, real L[], real R[] );
+static double Rand( const double Min, const double Max ) { return Min + ( Max - Min )*drand48(); }
+static double RandLog( const double Min, const double Max ) { return pow( 10.0, Rand(log10(Min), log10(Max)) ); }
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Compare the row-wise Riemann solver Hydro_RiemannSolver_Pencil() with the per-face solver
+//                bitwise on random states
+//
+// Note        :  1. Usage: ./Test_RiemannPencil [number of rows (default=100000)] [random seed (default=123)]
+//                2. Each row has N_FC_VAR faces with randomly mixed types of states (see State_t), including
+//                   the degenerate cases S*~S_L/R and, for MHD, Bn~0
+//                3. Rows are solved along all three directions and with both zero and positive pressure floors
+//                4. Faces where the per-face solver returns NaN are recomputed by RSOLVER_RESCUE, same as
+//                   Hydro_ComputeFlux() and Hydro_RiemannSolver_Pencil()
+//                5. Return 0 if all fluxes are bitwise identical and 1 otherwise
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+
+   const long NRow    = ( argc > 1 ) ? atol( argv[1] ) : 100000;
+   const long Seed    = ( argc > 2 ) ? atol( argv[2] ) : 123;
+   const int  NFace   = N_FC_VAR;
+   const int  MaxDump = 10;
+
+   srand48( Seed );
+
+
+// initialize the EoS
+   GAMMA = 5.0/3.0;
+   EoS_Init_Gamma();
+
+   EoS_t EoS;
+   EoS.AuxArrayDevPtr_Flt    = EoS_AuxArray_Flt;
+   EoS.AuxArrayDevPtr_Int    = EoS_AuxArray_Int;
+   EoS.GuessHTilde_FuncPtr   = NULL;
+   EoS.HTilde2Temp_FuncPtr   = NULL;
+   EoS.Temp2HTilde_FuncPtr   = NULL;
+   EoS.DensEint2Pres_FuncPtr = EoS_DensEint2Pres_CPUPtr;
+   EoS.DensPres2Eint_FuncPtr = EoS_DensPres2Eint_CPUPtr;
+   EoS.DensPres2CSqr_FuncPtr = EoS_DensPres2CSqr_CPUPtr;
+   EoS.DensEint2Temp_FuncPtr = EoS_DensEint2Temp_CPUPtr;
+   EoS.DensTemp2Pres_FuncPtr = EoS_DensTemp2Pres_CPUPtr;
+   EoS.DensEint2Entr_FuncPtr = EoS_DensEint2Entr_CPUPtr;
+   EoS.General_FuncPtr       = EoS_General_CPUPtr;
+   EoS.Table                 = NULL;
+
+
+   real L[NCOMP_TOTAL_PLUS_MAG][N_FC_VAR], R[NCOMP_TOTAL_PLUS_MAG][N_FC_VAR], Flux[NCOMP_TOTAL_PLUS_MAG][N_FC_VAR];
+   real L_1Face[NCOMP_TOTAL_PLUS_MAG], R_1Face[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
+   const real *L_Row[NCOMP_TOTAL_PLUS_MAG], *R_Row[NCOMP_TOTAL_PLUS_MAG];
+   real *Flux_Row[NCOMP_TOTAL_PLUS_MAG];
+   State_t Type[N_FC_VAR];
+   long NFail[N_STATE], NTest[N_STATE], NRescue=0;
+
+   for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+   {
+      L_Row   [v] = L   [v];
+      R_Row   [v] = R   [v];
+      Flux_Row[v] = Flux[v];
+   }
+
+   for (int t=0; t<N_STATE; t++)    NFail[t] = NTest[t] = 0;
+
+
+// compare the two solvers
+   for (long r=0; r<NRow; r++)
+   {
+      const int  XYZ     = r%3;
+      const real MinDens = (real)0.0;
+      const real MinPres = ( (r/3)%2 == 0 ) ? (real)0.0 : (real)RandLog( 1.0e-6, 1.0e-2 );
+
+//    set the left/right states face by face
+      for (int i=0; i<NFace; i++)
+      {
+         Type[i] = ( drand48() < 0.5 ) ? STATE_GENERIC : (State_t)( lrand48()%N_STATE );
+
+         SetState( Type[i], L_1Face, R_1Face );
+
+//       rotate the normal momentum and magnetic field from x to XYZ
+         real Tmp;
+         Tmp = L_1Face[1];  L_1Face[1] = L_1Face[1+XYZ];  L_1Face[1+XYZ] = Tmp;
+         Tmp = R_1Face[1];  R_1Face[1] = R_1Face[1+XYZ];  R_1Face[1+XYZ] = Tmp;
+#        ifdef MHD
+         Tmp = L_1Face[MAG_OFFSET];  L_1Face[MAG_OFFSET] = L_1Face[MAG_OFFSET+XYZ];  L_1Face[MAG_OFFSET+XYZ] = Tmp;
+         Tmp = R_1Face[MAG_OFFSET];  R_1Face[MAG_OFFSET] = R_1Face[MAG_OFFSET+XYZ];  R_1Face[MAG_OFFSET+XYZ] = Tmp;
+#        endif
+
+         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         {
+            L[v][i] = L_1Face[v];
+            R[v][i] = R_1Face[v];
+         }
+      } // for (int i=0; i<NFace; i++)
+
+//    row-wise solver
+      Hydro_RiemannSolver_Pencil( XYZ, NFace, Flux_Row, L_Row, R_Row, MinDens, MinPres, &EoS );
+
+//    per-face solver
+      for (int i=0; i<NFace; i++)
+      {
+         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         {
+            L_1Face[v] = L[v][i];
+            R_1Face[v] = R[v][i];
+         }
+
+#        if   ( RSOLVER == HLLE )
+         Hydro_RiemannSolver_HLLE( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                                   EoS.DensEint2Pres_FuncPtr, EoS.DensPres2CSqr_FuncPtr,
+                                   EoS.GuessHTilde_FuncPtr, EoS.HTilde2Temp_FuncPtr,
+                                   EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table );
+#        elif ( RSOLVER == HLLC )
+         Hydro_RiemannSolver_HLLC( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                                   EoS.DensEint2Pres_FuncPtr, EoS.DensPres2CSqr_FuncPtr,
+                                   EoS.GuessHTilde_FuncPtr, EoS.HTilde2Temp_FuncPtr,
+                                   EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table );
+#        elif ( RSOLVER == HLLD )
+         Hydro_RiemannSolver_HLLD( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                                   EoS.DensEint2Pres_FuncPtr, EoS.DensPres2CSqr_FuncPtr,
+                                   EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table );
+#        endif
+
+//       switch to RSOLVER_RESCUE if the default solver fails, same as Hydro_ComputeFlux()
+#        if ( RSOLVER_RESCUE != NONE )
+         bool Rescue = false;
+         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+            if ( Flux_1Face[v] != Flux_1Face[v] )  Rescue = true;
+
+         if ( Rescue )
+         {
+#           if   ( RSOLVER_RESCUE == HLLE )
+            Hydro_RiemannSolver_HLLE( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                                      EoS.DensEint2Pres_FuncPtr, EoS.DensPres2CSqr_FuncPtr,
+                                      EoS.GuessHTilde_FuncPtr, EoS.HTilde2Temp_FuncPtr,
+                                      EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table );
+#           elif ( RSOLVER_RESCUE == HLLC )
+            Hydro_RiemannSolver_HLLC( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                                      EoS.DensEint2Pres_FuncPtr, EoS.DensPres2CSqr_FuncPtr,
+                                      EoS.GuessHTilde_FuncPtr, EoS.HTilde2Temp_FuncPtr,
+                                      EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table );
+#           elif ( RSOLVER_RESCUE == HLLD )
+            Hydro_RiemannSolver_HLLD( XYZ, Flux_1Face, L_1Face, R_1Face, MinDens, MinPres,
+                                      EoS.DensEint2Pres_FuncPtr, EoS.DensPres2CSqr_FuncPtr,
+                                      EoS.AuxArrayDevPtr_Flt, EoS.AuxArrayDevPtr_Int, EoS.Table );
+#           endif
+            NRescue ++;
+         }
+#        endif
+
+         bool Fail = false;
+
+         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         {
+            if (  memcmp( &Flux_1Face[v], &Flux[v][i], sizeof(real) ) != 0  )
+            {
+               if ( NFail[ Type[i] ] < MaxDump )
+                  printf( "Mismatch (%s, XYZ %d, MinPres %13.7e, comp %d): pencil %24.17e != per-face %24.17e\n",
+                          StateName[ Type[i] ], XYZ, MinPres, v, Flux[v][i], Flux_1Face[v] );
+
+               Fail = true;
+            }
+         }
+
+         NTest[ Type[i] ] ++;
+         if ( Fail )    NFail[ Type[i] ] ++;
+      } // for (int i=0; i<NFace; i++)
+   } // for (long r=0; r<NRow; r++)
+
+
+// summary
+   long NFail_All = 0;
+
+   printf( "\n%-28s  %12s  %12s\n", "State", "NFace", "NMismatch" );
+   for (int t=0; t<N_STATE; t++)
+   {
+      printf( "%-28s  %12ld  %12ld\n", StateName[t], NTest[t], NFail[t] );
+      NFail_All += NFail[t];
+   }
+
+   printf( "\nNumber of faces switched to RSOLVER_RESCUE : %ld\n", NRescue );
+
+   printf( "\n%s\n", ( NFail_All == 0 ) ? "PASSED : all fluxes are bitwise identical" :
+                                          "FAILED : pencil and per-face Riemann solvers differ" );
+
+   return ( NFail_All == 0 ) ? 0 : 1;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetState
+// Description :  Set random left/right conserved variables of a given type along x
+//
+// Note        :  1. The normal momentum and magnetic field are along x and rotated by the caller
+//                2. For MHD, the normal magnetic field is always the same on both sides
+//                3. Pressure is drawn before computing the total energy so that negative internal energy only
+//                   appears in STATE_NEG_EINT
+//
+// Parameter   :  Type : Type of the states (see State_t)
+//                L/R  : Left/right states to be returned
+//
+// Return      :  L[], R[]
+//-------------------------------------------------------------------------------------------------------
+void SetState( const State_t Type, real L[], real R[] )
+{
+
+   const double Gamma_m1 = GAMMA - 1.0;
+
+   double Dens[2], Vel[2][3], Pres[2], Mag[2][3] = { {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0} };
+   real  *State[2] = { L, R };
+
+// 1. generic states
+   for (int s=0; s<2; s++)
+   {
+      Dens[s] = RandLog( 1.0e-3, 1.0e3 );
+      Pres[s] = RandLog( 1.0e-3, 1.0e3 );
+      for (int d=0; d<3; d++)    Vel[s][d] = Rand( -3.0, 3.0 );
+#     ifdef MHD
+      for (int d=0; d<3; d++)    Mag[s][d] = Rand( -3.0, 3.0 );
+#     endif
+   }
+
+
+// 2. special states
+   switch ( Type )
+   {
+      case STATE_GENERIC:
+         break;
+
+      case STATE_EQUAL:
+         Dens[1] = Dens[0];
+         Pres[1] = Pres[0];
+         for (int d=0; d<3; d++)    { Vel[1][d] = Vel[0][d];  Mag[1][d] = Mag[0][d]; }
+         break;
+
+//    S* = 0
+      case STATE_CONTACT:
+         Pres[1] = Pres[0];
+         Vel[0][0] = Vel[1][0] = 0.0;
+         for (int d=0; d<3; d++)    Mag[1][d] = Mag[0][d];
+         break;
+
+//    negligible sound speed and nearly the same velocity --> S* ~ S_L ~ S_R
+      case STATE_COLD:
+         Vel[1][0] = Vel[0][0]*( 1.0 + Rand(-1.0e-10, 1.0e-10) );
+         for (int s=0; s<2; s++)
+         {
+            Pres[s] = Dens[s]*SQR( Vel[s][0] )*RandLog( 1.0e-16, 1.0e-8 );
+            for (int d=0; d<3; d++)    Mag[s][d] *= 1.0e-8;
+         }
+         break;
+
+//    zero pressure and velocity --> S* = S_L = S_R = 0
+      case STATE_REST:
+         for (int s=0; s<2; s++)
+         {
+            Pres[s] = 0.0;
+            for (int d=0; d<3; d++)    Vel[s][d] = Mag[s][d] = 0.0;
+         }
+         break;
+
+      case STATE_SUPERSONIC:
+      {
+         const double Sign = ( drand48() < 0.5 ) ? -1.0 : +1.0;
+         for (int s=0; s<2; s++)
+         {
+            Vel [s][0] = Sign*Rand( 1.0e2, 1.0e3 );
+            Pres[s]    = Dens[s]*RandLog( 1.0e-3, 1.0e0 );
+         }
+         break;
+      }
+
+//    pressure floor
+      case STATE_NEG_EINT:
+         Pres[0] = -Pres[0];
+         if ( drand48() < 0.5 )  Pres[1] = -Pres[1];
+         break;
+
+      case STATE_SIGNED_ZERO:
+         for (int s=0; s<2; s++)
+         for (int d=0; d<3; d++)
+         {
+            Vel[s][d] = ( drand48() < 0.5 ) ? -0.0 : +0.0;
+            Mag[s][d] = ( drand48() < 0.5 ) ? -0.0 : Mag[s][d];
+         }
+         break;
+
+#     ifdef MHD
+      case STATE_BN_ZERO:
+         Mag[0][0] = Mag[1][0] = ( drand48() < 0.5 ) ? -0.0 : 0.0;
+         break;
+
+      case STATE_BN_TINY:
+         Mag[0][0] = Mag[1][0] = Rand( -1.0, 1.0 )*RandLog( 1.0e-30, 1.0e-6 );
+         break;
+
+      case STATE_BT_ZERO:
+         for (int s=0; s<2; s++)    Mag[s][1] = Mag[s][2] = 0.0;
+         break;
+
+      case STATE_B_ZERO:
+         for (int s=0; s<2; s++)
+         for (int d=0; d<3; d++)    Mag[s][d] = 0.0;
+         break;
+#     endif
+
+      default:
+         fprintf( stderr, "ERROR : unsupported state type %d !!\n", Type );
+         exit( 1 );
+   } // switch ( Type )
+
+
+// 3. the normal magnetic field must be continuous across the face
+#  ifdef MHD
+   Mag[1][0] = Mag[0][0];
+#  endif
+
+
+// 4. convert to the conserved variables
+   for (int s=0; s<2; s++)
+   {
+      const double Emag = 0.5*( SQR(Mag[s][0]) + SQR(Mag[s][1]) + SQR(Mag[s][2]) );
+      const double Ekin = 0.5*Dens[s]*( SQR(Vel[s][0]) + SQR(Vel[s][1]) + SQR(Vel[s][2]) );
+
+      State[s][0] = (real)Dens[s];
+      State[s][1] = (real)( Dens[s]*Vel[s][0] );
+      State[s][2] = (real)( Dens[s]*Vel[s][1] );
+      State[s][3] = (real)( Dens[s]*Vel[s][2] );
+      State[s][4] = (real)( Pres[s]/Gamma_m1 + Ekin + Emag );
+
+      for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  State[s][v] = (real)( Dens[s]*drand48() );
+
+#     ifdef MHD
+      for (int d=0; d<3; d++)    State[s][ MAG_OFFSET + d ] = (real)Mag[s][d];
+#     endif
+   }
+
+} // FUNCTION : SetState